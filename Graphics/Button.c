@@ -59,7 +59,7 @@ BUTTON *BtnCreate(	WORD ID, SHORT left, SHORT top, SHORT right, SHORT bottom, SH
 {
 	BUTTON *pB = NULL;
 	
-	pB = malloc(sizeof(BUTTON));
+	pB = GOLPoolAlloc(sizeof(BUTTON));
 	if (pB == NULL) 
 		return NULL;
 	
@@ -254,14 +254,14 @@ static SHORT width, height, radius;
 
 WORD faceClr, embossLtClr, embossDkClr, xText, yText;
 
-    if(IsDeviceBusy())
+    if(GOLDrawBusy())
         return 0;
 
     switch(state){
 
         case REMOVE:
 
-            if(IsDeviceBusy())
+            if(GOLDrawBusy())
                 return 0;  
 
 	        if (GetState(pB,BTN_HIDE)) {  				      // Hide the button (remove from screen)
@@ -352,7 +352,7 @@ WORD faceClr, embossLtClr, embossDkClr, xText, yText;
  
         case FOCUS_DRAW:
 rnd_button_draw_focus:
-            if(IsDeviceBusy())
+            if(GOLDrawBusy())
                 return 0;
     
 	        if(GetState(pB,BTN_FOCUSED)){
@@ -75,7 +75,7 @@ CHART  *ChCreate( WORD ID, SHORT left, SHORT top, SHORT right, SHORT bottom,
 {
 	CHART *pCh = NULL;
 	
-	pCh = malloc(sizeof(CHART));
+	pCh = GOLPoolAlloc(sizeof(CHART));
 	
 	if (pCh == NULL) 
 		return NULL;
@@ -359,14 +359,14 @@ static SHORT varCtr, pieX, pieY;
 	   XCHAR xtemp;
 	   WORD  j, k, h, i;
 	   
-    if(IsDeviceBusy())
+    if(GOLDrawBusy())
         return 0;
 
     switch(state) {
 
         case REMOVE:
 
-            if(IsDeviceBusy())
+            if(GOLDrawBusy())
                 return 0;  
 
 	        if (GetState(pCh,CH_HIDE)) {  				      	// Hide the Chart (remove from screen)
@@ -1725,7 +1725,7 @@ DATASERIES *ChAddDataSeries(CHART *pCh, WORD nSamples, WORD *pData, XCHAR *pName
 {
 	DATASERIES *pVar = NULL, *pListVar;
 	
-	pVar = malloc(sizeof(DATASERIES));
+	pVar = GOLPoolAlloc(sizeof(DATASERIES));
 
 	if (pVar == NULL) 
 		return NULL;
@@ -1772,7 +1772,7 @@ void ChRemoveDataSeries(CHART *pCh, WORD number)
 		
 	// check if there is only one entry
 	if (pVar->pNextData == NULL) {
-		free(pVar);
+		GOLPoolFree(pVar);
 		pCh->pChData = NULL;
 		return;
 	}
@@ -1787,7 +1787,7 @@ void ChRemoveDataSeries(CHART *pCh, WORD number)
 	pPrevVar->pNextData = pVar->pNextData;
 	
 	// free the memory used by the item
-	free(pVar);
+	GOLPoolFree(pVar);
 
 }
 
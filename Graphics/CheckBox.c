@@ -56,7 +56,7 @@ CHECKBOX *CbCreate(WORD ID, SHORT left, SHORT top, SHORT right, SHORT bottom,
 {
 	CHECKBOX *pCb = NULL;
 	
-	pCb = malloc(sizeof(CHECKBOX));
+	pCb = GOLPoolAlloc(sizeof(CHECKBOX));
 	if (pCb == NULL)
 		return pCb;
 
@@ -216,7 +216,7 @@ static CB_DRAW_STATES state = REMOVE;
 
 SHORT checkIndent;
 
-    if(IsDeviceBusy())
+    if(GOLDrawBusy())
         return 0;
 
     switch(state){
@@ -224,7 +224,7 @@ SHORT checkIndent;
         case REMOVE:
             if(GetState(pCb,CB_HIDE|CB_DRAW)){
 
-                if(IsDeviceBusy())
+                if(GOLDrawBusy())
                     return 0;
                 SetColor(pCb->hdr.pGolScheme->CommonBkColor);
                 Bar(pCb->hdr.left,pCb->hdr.top,pCb->hdr.right,pCb->hdr.bottom);
@@ -295,7 +295,7 @@ SHORT checkIndent;
         case CHECK_DRAW:
 
             if(GetState(pCb,CB_DRAW|CB_DRAW_CHECK)){
-                if(IsDeviceBusy())
+                if(GOLDrawBusy())
                     return 0;
 
                 if(!GetState(pCb,CB_DISABLED)){
@@ -323,7 +323,7 @@ SHORT checkIndent;
 
         case FOCUS_DRAW:
 	        if(GetState(pCb,CB_DRAW|CB_DRAW_FOCUS)){
-                if(IsDeviceBusy())
+                if(GOLDrawBusy())
                     return 0;
 	            if(GetState(pCb,CB_FOCUSED)){
 		            SetColor(pCb->hdr.pGolScheme->TextColor0);
@@ -54,7 +54,7 @@ EDITBOX  *EbCreate(WORD ID, SHORT left, SHORT top, SHORT right, SHORT bottom,
 
 	EDITBOX *pEb = NULL;
 
-  	pEb = malloc(sizeof(EDITBOX)+ (charMax + 1)*sizeof(XCHAR)); // ending zero is not included into charMax
+  	pEb = GOLPoolAlloc(sizeof(EDITBOX)+ (charMax + 1)*sizeof(XCHAR)); // ending zero is not included into charMax
 	if (pEb == NULL)
 		return pEb;
 
@@ -250,7 +250,7 @@ static EB_DRAW_STATES state = EB_STATE_START;
 SHORT temp;
 SHORT width;
 
-    if(IsDeviceBusy())
+    if(GOLDrawBusy())
         return 0;
         
     switch(state){
@@ -295,12 +295,10 @@ SHORT width;
 
     }
 
-            SetClip(CLIP_ENABLE);
-
-            SetClipRgn(pEb->left+GOL_EMBOSS_SIZE+EB_INDENT,
-                       pEb->top+GOL_EMBOSS_SIZE+EB_INDENT,
-                       pEb->right-GOL_EMBOSS_SIZE-EB_INDENT,
-                       pEb->bottom-GOL_EMBOSS_SIZE-EB_INDENT);
+            GOLSetClipRgn(pEb->left+GOL_EMBOSS_SIZE+EB_INDENT,
+                          pEb->top+GOL_EMBOSS_SIZE+EB_INDENT,
+                          pEb->right-GOL_EMBOSS_SIZE-EB_INDENT,
+                          pEb->bottom-GOL_EMBOSS_SIZE-EB_INDENT);
 
 	        SetFont(pEb->pGolScheme->pFont);
 
@@ -330,7 +328,7 @@ SHORT width;
 		    state = EB_STATE_TEXT;
 			
         case EB_STATE_TEXT:
-            if(IsDeviceBusy())
+            if(GOLDrawBusy())
                 return 0;
             if(!OutText(pEb->pBuffer))
                 return 0;
@@ -344,7 +342,7 @@ SHORT width;
 
         case EB_STATE_CARET:
             if(!GetState(pEb,EB_DISABLED)){
-                if(IsDeviceBusy())
+                if(GOLDrawBusy())
                     return 0;
                 if(GetState(pEb,EB_CARET)){
                     SetColor(pEb->pGolScheme->TextColor0);
@@ -353,7 +351,7 @@ SHORT width;
                 }
                 Bar(GetX(),GetY(),GetX()+EB_CARET_WIDTH,GetY()+pEb->textHeight);
             }
-            SetClip(CLIP_DISABLE);
+            GOLClearClipRgn();
 			state = EB_STATE_START;
 			return 1;
     }
@@ -41,6 +41,8 @@
  *****************************************************************************/
 
 #include "Graphics\Graphics.h"
+#include "Profile.h"
+#include "Timebase.h"
 
 // Pointer to the current linked list of objects displayed and receiving messages
 OBJ_HEADER  *_pGolObjects        = NULL;
@@ -51,6 +53,61 @@ GOL_SCHEME  *_pDefaultGolScheme  = NULL;
 // Pointer to the object receiving keyboard input
 OBJ_HEADER  *_pObjectFocused     = NULL;
 
+// Objects of the current list by ID, slot ID & (GOL_ID_INDEX_SIZE-1) onwards
+static OBJ_HEADER *_golIndex[GOL_ID_INDEX_SIZE];
+
+// GOL_INDEX_VALID while _golIndex[] holds the current list, GOL_INDEX_FULL
+// while the list has more objects than the index has room for
+WORD         _golIndexState      = 0;
+
+#define GOL_INDEX_VALID 0x0001
+#define GOL_INDEX_FULL  0x0002
+
+// Bit of every object's own state asking for the whole object to be drawn
+#define GOL_DRAW_WHOLE  0x4000
+
+// Rectangle of the screen to be redrawn
+typedef struct {
+    SHORT left;
+    SHORT top;
+    SHORT right;
+    SHORT bottom;
+} GOL_DAMAGE;
+
+// Damaged rectangles collected for the next GOLDraw() pass
+static GOL_DAMAGE  _damage[GOL_DAMAGE_RECS];
+static WORD        _damageCount      = 0;
+
+// Damaged rectangles the current GOLDraw() pass redraws
+static GOL_DAMAGE  _damagePass[GOL_DAMAGE_RECS];
+static WORD        _damagePassCount  = 0;
+
+// Rectangle the object being drawn is clipped to, NULL while it draws whole
+static GOL_DAMAGE *_pDamageClip      = NULL;
+
+// Non-zero while GOLDrawBudget() runs
+static WORD        _drawBudget       = 0;
+
+// timebaseCycles() value the GOLDrawBudget() time slice ends at
+static DWORD       _drawDeadline;
+
+// Non-zero once GOLDrawBusy() let a drawing step through in the time slice
+static WORD        _drawStepped;
+
+// Time an object always gets from the first GOLDrawBusy() check of a time
+// slice. One that carries on part way checks again before it draws anything,
+// so with less it could stop there on every call.
+#define GOL_DRAW_STEP_MIN_US  5
+
+// Object the GOLDraw() pass carries on from, NULL between passes
+static OBJ_HEADER *_pDrawObj         = NULL;
+
+// Damaged rectangle of the pass _pDrawObj is drawn for, -1 if none
+static SHORT       _drawDamageIndex  = -1;
+
+// Non-zero while the drawing of _pDrawObj has stopped part way
+static WORD        _drawResume       = 0;
+
 #ifdef USE_FOCUS
 
 /*********************************************************************
@@ -189,7 +246,7 @@ WORD GOLCanBeFocused(OBJ_HEADER* object){
 GOL_SCHEME *GOLCreateScheme(void)
 {
 	GOL_SCHEME *pTemp;
-	pTemp = (GOL_SCHEME*) malloc(sizeof(GOL_SCHEME));
+	pTemp = (GOL_SCHEME*) GOLPoolAlloc(sizeof(GOL_SCHEME));
 	if (pTemp != NULL)
 	{
 		pTemp->EmbossDkColor 		= EMBOSSDKCOLORDEFAULT;
@@ -219,13 +276,15 @@ GOL_SCHEME *GOLCreateScheme(void)
 *
 * Overview: initializes GOL
 *
-* Note: none
+* Note: calling it again restores the default scheme colors
+*       instead of taking a second scheme from the pool
 *
 ********************************************************************/
 void  GOLInit(){
 	// Initialize display
     InitGraph();
 	// Initialize the default GOL scheme
+	GOLPoolFree(_pDefaultGolScheme);
 	_pDefaultGolScheme  = GOLCreateScheme();
 }
 
@@ -243,13 +302,16 @@ void  GOLInit(){
 * Overview: frees memory of all objects in the current linked list
 *           and starts a new linked list
 *
-* Note: drawing and messaging must be suspended
+* Note: messaging must be suspended. A GOLDraw() pass under way is
+*       ended by GOLDrawAbort() before the objects are freed. Once no
+*       list holds memory from the arena any more it is reset to empty.
 *
 ********************************************************************/
 void GOLFree(){
 OBJ_HEADER * pNextObj;
 OBJ_HEADER * pCurrentObj;
 
+    GOLDrawAbort();
 
     pCurrentObj = _pGolObjects;
     while(pCurrentObj != NULL){
@@ -262,13 +324,76 @@ OBJ_HEADER * pCurrentObj;
         if(pCurrentObj->type == OBJ_GRID)
             GridFreeItems((GRID*)pCurrentObj);
 #endif
-        free(pCurrentObj);
+        GOLPoolFree(pCurrentObj);
         pCurrentObj = pNextObj;
     }
 
     GOLNewList();
 }
 
+/*********************************************************************
+* Function: static void GOLIndexAdd(OBJ_HEADER *pObj)
+*
+* PreCondition: none
+*
+* Input: pObj - object added to the current list
+*
+* Output: none
+*
+* Side Effects: none
+*
+* Overview: puts the object in the first free slot from its ID on.
+*           An ID already in the index keeps the object found first,
+*           as a walk of the list would. When no slot is free the
+*           index is marked full.
+*
+* Note: none
+*
+********************************************************************/
+static void GOLIndexAdd(OBJ_HEADER *pObj){
+WORD slot, probe;
+
+    slot = pObj->ID;
+    for(probe=0; probe<GOL_ID_INDEX_SIZE; probe++, slot++){
+        slot &= GOL_ID_INDEX_SIZE-1;
+        if(_golIndex[slot] == NULL){
+            _golIndex[slot] = pObj;
+            return;
+        }
+        if(_golIndex[slot]->ID == pObj->ID)
+            return;
+    }
+    _golIndexState |= GOL_INDEX_FULL;
+}
+
+/*********************************************************************
+* Function: static void GOLIndexBuild()
+*
+* PreCondition: none
+*
+* Input: none
+*
+* Output: none
+*
+* Side Effects: none
+*
+* Overview: indexes the objects of the current list by ID
+*
+* Note: none
+*
+********************************************************************/
+static void GOLIndexBuild(){
+OBJ_HEADER *pObj;
+WORD slot;
+
+    for(slot=0; slot<GOL_ID_INDEX_SIZE; slot++)
+        _golIndex[slot] = NULL;
+    _golIndexState = GOL_INDEX_VALID;
+
+    for(pObj=_pGolObjects; pObj!=NULL; pObj=pObj->pNxtObj)
+        GOLIndexAdd(pObj);
+}
+
 /*********************************************************************
 * Function: OBJ_HEADER* GOLFindObject(WORD ID)
 *
@@ -280,21 +405,41 @@ OBJ_HEADER * pCurrentObj;
 *
 * Side Effects: none
 *
-* Overview: searches for the object by its ID in the current objects linked list,
-*           returns NULL if the object is not found
+* Overview: looks the object up by its ID in the index of the current
+*           objects linked list, returns NULL if the object is not found.
+*           The index is built on the first search after the list
+*           was changed with GOLNewList() or GOLSetList().
 *
-* Note: none
+* Note: while the list has more objects than the index has room
+*       for, the list is searched instead
 *
 ********************************************************************/
 OBJ_HEADER* GOLFindObject(WORD ID){
 OBJ_HEADER * pNextObj;
+WORD slot, probe;
 
-    pNextObj = _pGolObjects;
-    while(pNextObj != NULL){
-        if(pNextObj->ID == ID){
-            return pNextObj;
+    if(!(_golIndexState & GOL_INDEX_VALID))
+        GOLIndexBuild();
+
+    if(_golIndexState & GOL_INDEX_FULL){
+        pNextObj = _pGolObjects;
+        while(pNextObj != NULL){
+            if(pNextObj->ID == ID){
+                return pNextObj;
+            }
+            pNextObj = pNextObj->pNxtObj;            
         }
-        pNextObj = pNextObj->pNxtObj;            
+        return NULL;
+    }
+
+    slot = ID;
+    for(probe=0; probe<GOL_ID_INDEX_SIZE; probe++, slot++){
+        slot &= GOL_ID_INDEX_SIZE-1;
+        pNextObj = _golIndex[slot];
+        if(pNextObj == NULL)
+            break;
+        if(pNextObj->ID == ID)
+            return pNextObj;
     }
     return NULL;
 }
@@ -329,132 +474,724 @@ OBJ_HEADER * pNextObj;
         pNextObj->pNxtObj = object;
     }
     object->pNxtObj = NULL;
+
+    if(_golIndexState & GOL_INDEX_VALID)
+        GOLIndexAdd(object);
 }
 
 /*********************************************************************
-* Function: WORD GOLDraw()
+* Function: static void GOLDamageMerge(GOL_DAMAGE *pList, WORD *pCount,
+*                                     SHORT left, SHORT top, SHORT right, SHORT bottom)
+*
+* PreCondition: none
+*
+* Input: pList, pCount - damage list and its length
+*        left,top,right,bottom - rectangle borders
+*
+* Output: none
+*
+* Side Effects: none
+*
+* Overview: adds a rectangle to a damage list. Rectangles that
+*           overlap it are merged into it first. When the list is
+*           full it is merged with the rectangle whose bounding box
+*           with it is the smallest.
+*
+* Note: none
+*
+********************************************************************/
+static void GOLDamageMerge(GOL_DAMAGE *pList, WORD *pCount,
+                           SHORT left, SHORT top, SHORT right, SHORT bottom){
+GOL_DAMAGE *pRec;
+DWORD area, bestArea;
+WORD i, best;
+
+    if(left < 0)
+        left = 0;
+    if(top < 0)
+        top = 0;
+    if(right > GetMaxX())
+        right = GetMaxX();
+    if(bottom > GetMaxY())
+        bottom = GetMaxY();
+    if(left > right || top > bottom)
+        return;
+
+    while(*pCount){
+        best = *pCount;
+        for(i=0; i<*pCount; i++){
+            pRec = &pList[i];
+            if( !( (pRec->left > right) ||
+                   (pRec->right < left) ||
+                   (pRec->top > bottom) ||
+                   (pRec->bottom < top) ) ){
+                best = i;
+                break;
+            }
+        }
+
+        if(best == *pCount){
+            if(*pCount < GOL_DAMAGE_RECS)
+                break;
+            // list is full, take the cheapest merge
+            bestArea = 0xffffffff;
+            for(i=0; i<*pCount; i++){
+                pRec = &pList[i];
+                area = (DWORD)((pRec->right > right ? pRec->right : right) -
+                               (pRec->left < left ? pRec->left : left) + 1) *
+                       (DWORD)((pRec->bottom > bottom ? pRec->bottom : bottom) -
+                               (pRec->top < top ? pRec->top : top) + 1);
+                if(area < bestArea){
+                    bestArea = area;
+                    best = i;
+                }
+            }
+        }
+
+        // grow the new rectangle over the old one and drop the old one,
+        // the grown rectangle may now overlap others
+        pRec = &pList[best];
+        if(pRec->left < left)
+            left = pRec->left;
+        if(pRec->top < top)
+            top = pRec->top;
+        if(pRec->right > right)
+            right = pRec->right;
+        if(pRec->bottom > bottom)
+            bottom = pRec->bottom;
+        *pRec = pList[--*pCount];
+    }
+
+    pRec = &pList[(*pCount)++];
+    pRec->left   = left;
+    pRec->top    = top;
+    pRec->right  = right;
+    pRec->bottom = bottom;
+}
+
+/*********************************************************************
+* Function: static void GOLDamageBegin()
 *
 * PreCondition: none
 *
 * Input: none
 *
+* Output: none
+*
+* Side Effects: none
+*
+* Overview: starts a redraw pass with the damage collected so far.
+*           Objects to be hidden are cleared to the background here,
+*           before anything is drawn, and their area is added to the
+*           damage so the objects under them are redrawn on top.
+*
+* Note: none
+*
+********************************************************************/
+static void GOLDamageBegin(){
+OBJ_HEADER *pObj;
+WORD i;
+
+    _damagePassCount = _damageCount;
+    for(i=0; i<_damageCount; i++)
+        _damagePass[i] = _damage[i];
+    _damageCount = 0;
+
+    for(pObj=_pGolObjects; pObj!=NULL; pObj=pObj->pNxtObj){
+        if(GetState(pObj, HIDE)){
+            SetColor(pObj->pGolScheme->CommonBkColor);
+            Bar(pObj->left, pObj->top, pObj->right, pObj->bottom);
+            GOLDamageMerge(_damagePass, &_damagePassCount,
+                           pObj->left, pObj->top, pObj->right, pObj->bottom);
+        }
+    }
+}
+
+/*********************************************************************
+* Function: static SHORT GOLDamageNext(OBJ_HEADER *pObj, SHORT index)
+*
+* PreCondition: none
+*
+* Input: pObj - object of interest
+*        index - first damaged rectangle of the pass to look at
+*
+* Output: index of the next damaged rectangle overlapping the
+*         object, -1 if there are no more
+*
+* Side Effects: none
+*
+* Overview: finds the parts of an object the pass redraws
+*
+* Note: none
+*
+********************************************************************/
+static SHORT GOLDamageNext(OBJ_HEADER *pObj, SHORT index){
+GOL_DAMAGE *pRec;
+
+    for(; index<(SHORT)_damagePassCount; index++){
+        pRec = &_damagePass[index];
+        if( !( (pObj->left > pRec->right) ||
+               (pObj->right < pRec->left) ||
+               (pObj->top > pRec->bottom) ||
+               (pObj->bottom < pRec->top) ) )
+            return index;
+    }
+    return -1;
+}
+
+/*********************************************************************
+* Overview: Functions of an object type called by GOLDraw() and
+*           GOLMsg(). A type without a function has NULL in its place.
+*
+*********************************************************************/
+typedef WORD (*GOL_DRAW_FUNC)(OBJ_HEADER *pObj);
+typedef WORD (*GOL_TRANSLATE_FUNC)(OBJ_HEADER *pObj, GOL_MSG *pMsg);
+typedef void (*GOL_MSG_DEFAULT_FUNC)(WORD translatedMsg, OBJ_HEADER *pObj, GOL_MSG *pMsg);
+
+typedef struct {
+    GOL_DRAW_FUNC        pDraw;          // draws the object, non-zero when done
+    GOL_TRANSLATE_FUNC   pTranslateMsg;  // turns a message into an object message
+    GOL_MSG_DEFAULT_FUNC pMsgDefault;    // default action on an object message
+} GOL_OBJ_FUNCS;
+
+/*********************************************************************
+* Overview: Adapters from the OBJ_HEADER pointer the table passes to
+*           the object pointer each type's functions take. For a
+*           function Fn the adapter is FnObj. CcMsgDefault() takes no
+*           translated message, so its adapter is written out.
+*
+*********************************************************************/
+#define GOL_DRAW_ADAPTER(draw, TYPE) \
+    static WORD draw##Obj(OBJ_HEADER *pObj){ return draw((TYPE*)pObj); }
+#define GOL_TRANSLATE_ADAPTER(translate, TYPE) \
+    static WORD translate##Obj(OBJ_HEADER *pObj, GOL_MSG *pMsg){ return translate((TYPE*)pObj, pMsg); }
+#define GOL_MSG_DEFAULT_ADAPTER(msgDefault, TYPE) \
+    static void msgDefault##Obj(WORD translatedMsg, OBJ_HEADER *pObj, GOL_MSG *pMsg){ msgDefault(translatedMsg, (TYPE*)pObj, pMsg); }
+
+#ifdef USE_BUTTON
+GOL_DRAW_ADAPTER(BtnDraw, BUTTON)
+GOL_TRANSLATE_ADAPTER(BtnTranslateMsg, BUTTON)
+GOL_MSG_DEFAULT_ADAPTER(BtnMsgDefault, BUTTON)
+#endif
+#ifdef USE_WINDOW
+GOL_DRAW_ADAPTER(WndDraw, WINDOW)
+GOL_TRANSLATE_ADAPTER(WndTranslateMsg, WINDOW)
+#endif
+#ifdef USE_CHECKBOX
+GOL_DRAW_ADAPTER(CbDraw, CHECKBOX)
+GOL_TRANSLATE_ADAPTER(CbTranslateMsg, CHECKBOX)
+GOL_MSG_DEFAULT_ADAPTER(CbMsgDefault, CHECKBOX)
+#endif
+#ifdef USE_RADIOBUTTON
+GOL_DRAW_ADAPTER(RbDraw, RADIOBUTTON)
+GOL_TRANSLATE_ADAPTER(RbTranslateMsg, RADIOBUTTON)
+GOL_MSG_DEFAULT_ADAPTER(RbMsgDefault, RADIOBUTTON)
+#endif
+#ifdef USE_EDITBOX
+GOL_DRAW_ADAPTER(EbDraw, EDITBOX)
+GOL_TRANSLATE_ADAPTER(EbTranslateMsg, EDITBOX)
+GOL_MSG_DEFAULT_ADAPTER(EbMsgDefault, EDITBOX)
+#endif
+#ifdef USE_LISTBOX
+GOL_DRAW_ADAPTER(LbDraw, LISTBOX)
+GOL_TRANSLATE_ADAPTER(LbTranslateMsg, LISTBOX)
+GOL_MSG_DEFAULT_ADAPTER(LbMsgDefault, LISTBOX)
+#endif
+#ifdef USE_SLIDER
+GOL_DRAW_ADAPTER(SldDraw, SLIDER)
+GOL_TRANSLATE_ADAPTER(SldTranslateMsg, SLIDER)
+GOL_MSG_DEFAULT_ADAPTER(SldMsgDefault, SLIDER)
+#endif
+#ifdef USE_PROGRESSBAR
+GOL_DRAW_ADAPTER(PbDraw, PROGRESSBAR)
+#endif
+#ifdef USE_STATICTEXT
+GOL_DRAW_ADAPTER(StDraw, STATICTEXT)
+GOL_TRANSLATE_ADAPTER(StTranslateMsg, STATICTEXT)
+#endif
+#ifdef USE_PICTURE
+GOL_DRAW_ADAPTER(PictDraw, PICTURE)
+GOL_TRANSLATE_ADAPTER(PictTranslateMsg, PICTURE)
+#endif
+#ifdef USE_GROUPBOX
+GOL_DRAW_ADAPTER(GbDraw, GROUPBOX)
+GOL_TRANSLATE_ADAPTER(GbTranslateMsg, GROUPBOX)
+#endif
+#ifdef USE_ROUNDDIAL
+GOL_DRAW_ADAPTER(RdiaDraw, ROUNDDIAL)
+GOL_TRANSLATE_ADAPTER(RdiaTranslateMsg, ROUNDDIAL)
+GOL_MSG_DEFAULT_ADAPTER(RdiaMsgDefault, ROUNDDIAL)
+#endif
+#ifdef USE_METER
+GOL_DRAW_ADAPTER(MtrDraw, METER)
+GOL_TRANSLATE_ADAPTER(MtrTranslateMsg, METER)
+GOL_MSG_DEFAULT_ADAPTER(MtrMsgDefault, METER)
+#endif
+#ifdef USE_CUSTOM
+GOL_DRAW_ADAPTER(CcDraw, CUSTOM)
+GOL_TRANSLATE_ADAPTER(CcTranslateMsg, CUSTOM)
+static void CcMsgDefaultObj(WORD translatedMsg, OBJ_HEADER *pObj, GOL_MSG *pMsg){
+    (void)translatedMsg;
+    CcMsgDefault((CUSTOM*)pObj, pMsg);
+}
+#endif
+#ifdef USE_GRID
+GOL_DRAW_ADAPTER(GridDraw, GRID)
+GOL_TRANSLATE_ADAPTER(GridTranslateMsg, GRID)
+GOL_MSG_DEFAULT_ADAPTER(GridMsgDefault, GRID)
+#endif
+
+// Functions of the enabled object types, indexed by GOL_OBJ_TYPE
+static const GOL_OBJ_FUNCS _golObjFuncs[OBJ_UNKNOWN] = {
+#ifdef USE_BUTTON
+    [OBJ_BUTTON] = { BtnDrawObj, BtnTranslateMsgObj, BtnMsgDefaultObj },
+#endif
+#ifdef USE_WINDOW
+    [OBJ_WINDOW] = { WndDrawObj, WndTranslateMsgObj, NULL },
+#endif
+#ifdef USE_CHECKBOX
+    [OBJ_CHECKBOX] = { CbDrawObj, CbTranslateMsgObj, CbMsgDefaultObj },
+#endif
+#ifdef USE_RADIOBUTTON
+    [OBJ_RADIOBUTTON] = { RbDrawObj, RbTranslateMsgObj, RbMsgDefaultObj },
+#endif
+#ifdef USE_EDITBOX
+    [OBJ_EDITBOX] = { EbDrawObj, EbTranslateMsgObj, EbMsgDefaultObj },
+#endif
+#ifdef USE_LISTBOX
+    [OBJ_LISTBOX] = { LbDrawObj, LbTranslateMsgObj, LbMsgDefaultObj },
+#endif
+#ifdef USE_SLIDER
+    [OBJ_SLIDER] = { SldDrawObj, SldTranslateMsgObj, SldMsgDefaultObj },
+#endif
+#ifdef USE_PROGRESSBAR
+    [OBJ_PROGRESSBAR] = { PbDrawObj, NULL, NULL },
+#endif
+#ifdef USE_STATICTEXT
+    [OBJ_STATICTEXT] = { StDrawObj, StTranslateMsgObj, NULL },
+#endif
+#ifdef USE_PICTURE
+    [OBJ_PICTURE] = { PictDrawObj, PictTranslateMsgObj, NULL },
+#endif
+#ifdef USE_GROUPBOX
+    [OBJ_GROUPBOX] = { GbDrawObj, GbTranslateMsgObj, NULL },
+#endif
+#ifdef USE_ROUNDDIAL
+    [OBJ_ROUNDDIAL] = { RdiaDrawObj, RdiaTranslateMsgObj, RdiaMsgDefaultObj },
+#endif
+#ifdef USE_METER
+    [OBJ_METER] = { MtrDrawObj, MtrTranslateMsgObj, MtrMsgDefaultObj },
+#endif
+#ifdef USE_CUSTOM
+    [OBJ_CUSTOM] = { CcDrawObj, CcTranslateMsgObj, CcMsgDefaultObj },
+#endif
+#ifdef USE_GRID
+    [OBJ_GRID] = { GridDrawObj, GridTranslateMsgObj, GridMsgDefaultObj },
+#endif
+};
+
+/*********************************************************************
+* Function: static WORD GOLDrawObject(OBJ_HEADER *pObj)
+*
+* PreCondition: none
+*
+* Input: pObj - object to draw
+*
 * Output: non-zero if drawing is complete
 *
 * Side Effects: none
 *
-* Overview: redraws objects in the current linked list
+* Overview: calls the draw function of the object's type
 *
 * Note: none
 *
 ********************************************************************/
-WORD GOLDraw(){
-static OBJ_HEADER *pCurrentObj = NULL;
+static WORD GOLDrawObject(OBJ_HEADER *pObj){
+GOL_DRAW_FUNC pDraw;
+
+    if(pObj->type >= OBJ_UNKNOWN)
+        return 1;
+    pDraw = _golObjFuncs[pObj->type].pDraw;
+    if(pDraw == NULL)
+        return 1;
+    return pDraw(pObj);
+}
+
+/*********************************************************************
+* Function: static WORD GOLDrawStep(OBJ_HEADER *pObj, GOL_DAMAGE *pRec)
+*
+* PreCondition: none
+*
+* Input: pObj - object to draw
+*        pRec - damaged rectangle, NULL to draw as the object asks
+*
+* Output: non-zero if drawing is complete
+*
+* Side Effects: none
+*
+* Overview: draws the object, clipped to the damaged rectangle if
+*           there is one. The clipping region of the application is
+*           kept aside meanwhile. When the object's drawing does not
+*           complete, the clipping region, color, font, cursor and
+*           line style it was drawing with are kept aside instead
+*           until the next call picks them up again, as other drawing
+*           may run in between.
+*
+* Note: none
+*
+********************************************************************/
+static WORD GOLDrawStep(OBJ_HEADER *pObj, GOL_DAMAGE *pRec){
+static SHORT objRgn, objLeft, objTop, objRight, objBottom;
+static SHORT objCursorX, objCursorY, objLineType, objLineThickness;
+static BYTE objColor;
+static void *objFont;
+SHORT clipRgn, clipLeft, clipTop, clipRight, clipBottom;
+WORD done;
+
+    clipRgn    = _clipRgn;
+    clipLeft   = _clipLeft;
+    clipTop    = _clipTop;
+    clipRight  = _clipRight;
+    clipBottom = _clipBottom;
+
+    _pDamageClip = pRec;
+    if(_drawResume){
+        _clipRgn    = objRgn;
+        _clipLeft   = objLeft;
+        _clipTop    = objTop;
+        _clipRight  = objRight;
+        _clipBottom = objBottom;
+        SetColor(objColor);
+        if(objFont != NULL)
+            SetFont(objFont);
+        MoveTo(objCursorX, objCursorY);
+        SetLineType(objLineType);
+        SetLineThickness(objLineThickness);
+    }else if(pRec != NULL){
+        GOLClearClipRgn();
+    }
+
+    done = GOLDrawObject(pObj);
+
+    _drawResume = !done;
+    if(_drawResume){
+        objRgn    = _clipRgn;
+        objLeft   = _clipLeft;
+        objTop    = _clipTop;
+        objRight  = _clipRight;
+        objBottom = _clipBottom;
+        objColor  = _color;
+        objFont   = _font;
+        objCursorX       = _cursorX;
+        objCursorY       = _cursorY;
+        objLineType      = _lineType;
+        objLineThickness = _lineThickness;
+    }
+    _pDamageClip = NULL;
+
+    _clipRgn    = clipRgn;
+    _clipLeft   = clipLeft;
+    _clipTop    = clipTop;
+    _clipRight  = clipRight;
+    _clipBottom = clipBottom;
+    return done;
+}
+
+/*********************************************************************
+* Function: void GOLSetClipRgn(SHORT left, SHORT top, SHORT right, SHORT bottom)
+*
+* PreCondition: none
+*
+* Input: left,top,right,bottom - clipping region borders
+*
+* Output: none
+*
+* Side Effects: none
+*
+* Overview: enables clipping to the region, limited to the damaged
+*           rectangle when the object is redrawn for damage
+*
+* Note: none
+*
+********************************************************************/
+void GOLSetClipRgn(SHORT left, SHORT top, SHORT right, SHORT bottom){
+
+    if(_pDamageClip != NULL){
+        if(left < _pDamageClip->left)
+            left = _pDamageClip->left;
+        if(top < _pDamageClip->top)
+            top = _pDamageClip->top;
+        if(right > _pDamageClip->right)
+            right = _pDamageClip->right;
+        if(bottom > _pDamageClip->bottom)
+            bottom = _pDamageClip->bottom;
+    }
+    SetClip(CLIP_ENABLE);
+    SetClipRgn(left, top, right, bottom);
+}
+
+/*********************************************************************
+* Function: void GOLClearClipRgn()
+*
+* PreCondition: none
+*
+* Input: none
+*
+* Output: none
+*
+* Side Effects: none
+*
+* Overview: disables clipping, or clips to the damaged rectangle
+*           when the object is redrawn for damage
+*
+* Note: none
+*
+********************************************************************/
+void GOLClearClipRgn(){
+
+    if(_pDamageClip != NULL){
+        SetClip(CLIP_ENABLE);
+        SetClipRgn(_pDamageClip->left, _pDamageClip->top,
+                   _pDamageClip->right, _pDamageClip->bottom);
+    }else{
+        SetClip(CLIP_DISABLE);
+    }
+}
+
+/*********************************************************************
+* Function: static WORD GOLDrawSliceUsed()
+*
+* PreCondition: none
+*
+* Input: none
+*
+* Output: non-zero if GOLDrawBudget() runs and its time slice is
+*         used up
+*
+* Side Effects: none
+*
+* Overview: tells GOLDrawList() to stop before the next object
+*
+* Note: none
+*
+********************************************************************/
+static WORD GOLDrawSliceUsed(){
+
+    if(!_drawBudget)
+        return 0;
+    return (LONG)(timebaseCycles() - _drawDeadline) >= 0;
+}
+
+/*********************************************************************
+* Function: WORD GOLDrawBusy()
+*
+* PreCondition: none
+*
+* Input: none
+*
+* Output: non-zero if the object's drawing should stop for now
+*
+* Side Effects: none
+*
+* Overview: IsDeviceBusy() of the objects' draw functions. Besides a
+*           busy controller it reports the GOLDrawBudget() time slice
+*           as used up, so an object stops part way and carries on at
+*           the next call. The first check in a slice always lets the
+*           drawing step through, and the slice runs on for at least
+*           GOL_DRAW_STEP_MIN_US from it.
+*
+* Note: none
+*
+********************************************************************/
+WORD GOLDrawBusy(){
+DWORD stepEnd;
+
+    if(IsDeviceBusy())
+        return 1;
+    if(!_drawBudget)
+        return 0;
+    if(!_drawStepped){
+        _drawStepped = 1;
+        stepEnd = timebaseCycles() + GOL_DRAW_STEP_MIN_US*(GetInstructionClock()/1000000L);
+        if((LONG)(stepEnd - _drawDeadline) > 0)
+            _drawDeadline = stepEnd;
+        return 0;
+    }
+    return GOLDrawSliceUsed();
+}
+
+/*********************************************************************
+* Function: void GOLDrawAbort()
+*
+* PreCondition: none
+*
+* Input: none
+*
+* Output: none
+*
+* Side Effects: none
+*
+* Overview: ends the GOLDraw() pass under way. An object that stopped
+*           part way is drawn to the end first, so its draw function
+*           starts from the beginning next time, then the pass and the
+*           damage collected for the current list are dropped.
+*
+* Note: called by GOLFree(), GOLNewList() and GOLSetList() while the
+*       objects of the current list are still there
+*
+********************************************************************/
+void GOLDrawAbort(){
+
+    if(_drawResume){
+        while(!GOLDrawStep(_pDrawObj, (_drawDamageIndex < 0) ? NULL : &_damagePass[_drawDamageIndex]));
+    }
+    _pDrawObj         = NULL;
+    _drawDamageIndex  = -1;
+    _damagePassCount  = 0;
+    _damageCount      = 0;
+}
+
+/*********************************************************************
+* Function: static WORD GOLDrawList()
+*
+* PreCondition: none
+*
+* Input: none
+*
+* Output: non-zero if drawing is complete
+*
+* Side Effects: none
+*
+* Overview: redraws objects in the current linked list. An object
+*           with a redraw state set draws as it asks. Any other
+*           object overlapping the damage is drawn once for each
+*           damaged rectangle it overlaps, clipped to it.
+*
+* Note: body of GOLDraw(), kept apart so the probe sees every return
+*
+********************************************************************/
+static WORD GOLDrawList(){
 SHORT done;
 
-    if(pCurrentObj == NULL){
+    if(_pDrawObj == NULL){
         if(GOLDrawCallback()){
             // It's last object jump to head
-            pCurrentObj = _pGolObjects;
+            _pDrawObj = _pGolObjects;
+            GOLDamageBegin();
         }else{
             return 0;  // drawing is not done
         }
     }
 
     done = 0;
-    while(pCurrentObj != NULL){
-        
-        if(IsObjUpdated(pCurrentObj)){
-
-            switch(pCurrentObj->type){
-                #ifdef USE_BUTTON
-	            case OBJ_BUTTON:
-                    done = BtnDraw((BUTTON*)pCurrentObj);
-                    break;
-                #endif
-                #ifdef USE_WINDOW
-	            case OBJ_WINDOW:
-                    done = WndDraw((WINDOW*)pCurrentObj);
-                    break;
-                #endif
-                #ifdef USE_CHECKBOX
-	            case OBJ_CHECKBOX:
-                    done = CbDraw((CHECKBOX*)pCurrentObj);
-                    break;
-                #endif
-                #ifdef USE_RADIOBUTTON
-	            case OBJ_RADIOBUTTON:
-                    done = RbDraw((RADIOBUTTON*)pCurrentObj);
-                    break;
-                #endif
-                #ifdef USE_EDITBOX
-	            case OBJ_EDITBOX:
-                    done = EbDraw((EDITBOX*)pCurrentObj);
-                    break;
-                #endif
-                #ifdef USE_LISTBOX
-	            case OBJ_LISTBOX:
-                    done = LbDraw((LISTBOX*)pCurrentObj);
-                    break;
-                #endif
-                #ifdef USE_SLIDER
-	            case OBJ_SLIDER:
-                    done = SldDraw((SLIDER*)pCurrentObj);
-                    break;
-                #endif
-                #ifdef USE_PROGRESSBAR
-	            case OBJ_PROGRESSBAR:
-                    done = PbDraw((PROGRESSBAR*)pCurrentObj);
-                    break;
-                #endif
-                #ifdef USE_STATICTEXT
-	            case OBJ_STATICTEXT:
-                    done = StDraw((STATICTEXT*)pCurrentObj);
-                    break;
-                #endif
-                #ifdef USE_PICTURE
-	            case OBJ_PICTURE:
-                    done = PictDraw((PICTURE*)pCurrentObj);
-                    break;
-                #endif
-                #ifdef USE_GROUPBOX
-	            case OBJ_GROUPBOX:
-                    done = GbDraw((GROUPBOX*)pCurrentObj);
-                    break;
-                #endif
-                #ifdef USE_ROUNDDIAL
-	            case OBJ_ROUNDDIAL:
-                    done = RdiaDraw((ROUNDDIAL*)pCurrentObj);
-                    break;
-                #endif
-                #ifdef USE_METER
-	            case OBJ_METER:
-                    done = MtrDraw((METER*)pCurrentObj);
-                    break;
-                #endif
-                #ifdef USE_CUSTOM
-	            case OBJ_CUSTOM:
-                    done = CcDraw((CUSTOM*)pCurrentObj);
-                    break;
-                #endif
-                #ifdef USE_GRID
-                case OBJ_GRID:
-                    done = GridDraw( (GRID *)pCurrentObj );
-                    break;
-                #endif
-                default:
-                    break;
+    while(_pDrawObj != NULL){
+
+        if(_drawDamageIndex < 0){
+            if(IsObjUpdated(_pDrawObj)){
+                // hidden objects were cleared when the pass began
+                if(!GetState(_pDrawObj, HIDE)){
+                    done = GOLDrawStep(_pDrawObj, NULL);
+                    if(!done)
+                        return 0; // drawing is not done
+                }
+                GOLDrawComplete(_pDrawObj);
+                _pDrawObj = _pDrawObj->pNxtObj;
+                if(GOLDrawSliceUsed() && _pDrawObj != NULL)
+                    return 0; // time slice is used up
+                continue;
             }
-            if(done){
-                GOLDrawComplete(pCurrentObj);
-            }else{
-                return 0; // drawing is not done
+
+            _drawDamageIndex = GOLDamageNext(_pDrawObj, 0);
+            if(_drawDamageIndex < 0){
+                _pDrawObj = _pDrawObj->pNxtObj;
+                continue;
             }
+            SetState(_pDrawObj, DRAW);
         }
-        pCurrentObj = pCurrentObj->pNxtObj;
+
+        done = GOLDrawStep(_pDrawObj, &_damagePass[_drawDamageIndex]);
+        if(!done)
+            return 0; // drawing is not done
+        GOLDrawComplete(_pDrawObj);
+
+        _drawDamageIndex = GOLDamageNext(_pDrawObj, _drawDamageIndex+1);
+        if(_drawDamageIndex >= 0)
+            SetState(_pDrawObj, DRAW);
+        else
+            _pDrawObj = _pDrawObj->pNxtObj;
+        if(GOLDrawSliceUsed() && _pDrawObj != NULL)
+            return 0; // time slice is used up
     }
+    _damagePassCount = 0;
     return 1;   // drawing is completed
 }
 
+/*********************************************************************
+* Function: WORD GOLDraw()
+*
+* PreCondition: none
+*
+* Input: none
+*
+* Output: non-zero if drawing is complete
+*
+* Side Effects: none
+*
+* Overview: redraws objects in the current linked list
+*
+* Note: the display is flushed once drawing is complete
+*
+********************************************************************/
+WORD GOLDraw(){
+WORD done;
+
+    PROFILE_BEGIN(PROFILE_GOL_DRAW);
+    done = GOLDrawList();
+    if(done)
+        FlushDisplay();
+    PROFILE_END(PROFILE_GOL_DRAW);
+    return done;
+}
+
+/*********************************************************************
+* Function: WORD GOLDrawBudget(WORD us)
+*
+* PreCondition: timebaseInit() must have been called
+*
+* Input: us - time slice in microseconds
+*
+* Output: non-zero if drawing is complete
+*
+* Side Effects: none
+*
+* Overview: redraws objects in the current linked list like GOLDraw()
+*           until the time slice measured on Timer 1 is used up, then
+*           returns. The next call carries on from there.
+*
+* Note: the slice is checked between the drawing steps of an object
+*       through GOLDrawBusy() and after each object or damaged part
+*       of one, so at least one step is drawn on every call and a call
+*       can overrun by the longest step. A slice shorter than
+*       GOL_DRAW_STEP_MIN_US runs for that long once an object starts
+*       drawing. The display is flushed once drawing is complete,
+*       outside the slice.
+*
+********************************************************************/
+WORD GOLDrawBudget(WORD us){
+WORD done;
+
+    PROFILE_BEGIN(PROFILE_GOL_DRAW);
+    _drawDeadline = timebaseCycles() + (DWORD)us*(GetInstructionClock()/1000000L);
+    _drawStepped = 0;
+    _drawBudget = 1;
+    done = GOLDrawList();
+    _drawBudget = 0;
+    if(done)
+        FlushDisplay();
+    PROFILE_END(PROFILE_GOL_DRAW);
+    return done;
+}
+
 /*********************************************************************
 * Function: void GOLRedrawRec(SHORT left, SHORT top, SHORT right, SHORT bottom)
 *
@@ -466,34 +1203,28 @@ SHORT done;
 *
 * Side Effects: none
 *
-* Overview: marks objects with parts in the rectangle to be redrawn
+* Overview: adds the rectangle to the damage. GOLDraw() redraws the
+*           parts of objects in it.
 *
-* Note: none
+* Note: an object that already waits for a partial redraw is marked
+*       to be redrawn whole, as the partial redraw may miss the damage
 *
 ********************************************************************/
 void  GOLRedrawRec(SHORT left, SHORT top, SHORT right, SHORT bottom){
 OBJ_HEADER *pCurrentObj;
 
+    GOLDamageMerge(_damage, &_damageCount, left, top, right, bottom);
+
     pCurrentObj = _pGolObjects;
 
     while(pCurrentObj != NULL){
         
-        if( !( (pCurrentObj->left > right) ||
-             (pCurrentObj->right < left) ||       
-             (pCurrentObj->top > bottom) ||
-             (pCurrentObj->bottom < top) ) )
-
-		if( ( (pCurrentObj->left >= left)&&
-              (pCurrentObj->left <= right) ) ||
-
-            ( (pCurrentObj->right >= left)&&
-              (pCurrentObj->right <= right) ) ||
-
-            ( (pCurrentObj->top >= top)&&
-              (pCurrentObj->top <= bottom) )||
-
-            ( (pCurrentObj->bottom >= top)&&
-              (pCurrentObj->bottom <= bottom) ) ){
+        if(IsObjUpdated(pCurrentObj) &&
+           !GetState(pCurrentObj, HIDE|GOL_DRAW_WHOLE) &&
+           !( (pCurrentObj->left > right) ||
+              (pCurrentObj->right < left) ||
+              (pCurrentObj->top > bottom) ||
+              (pCurrentObj->bottom < top) ) ){
 
                 GOLRedraw(pCurrentObj);
 
@@ -522,6 +1253,7 @@ OBJ_HEADER *pCurrentObj;
 ********************************************************************/
 void  GOLMsg(GOL_MSG *pMsg){
 OBJ_HEADER *pCurrentObj;
+const GOL_OBJ_FUNCS *pFuncs;
 WORD   translatedMsg;
 
     if(pMsg->uiEvent == EVENT_INVALID)
@@ -530,140 +1262,15 @@ WORD   translatedMsg;
     pCurrentObj = _pGolObjects;
 
     while(pCurrentObj != NULL){
-        switch(pCurrentObj->type){
-            #ifdef USE_BUTTON
-	        case OBJ_BUTTON:
-                translatedMsg = BtnTranslateMsg((BUTTON*)pCurrentObj, pMsg);
-                if(translatedMsg == OBJ_MSG_INVALID)
-                    break;
-                if(GOLMsgCallback(translatedMsg,pCurrentObj,pMsg))
-                    BtnMsgDefault(translatedMsg,(BUTTON*)pCurrentObj, pMsg);
-                break;
-            #endif
-            #ifdef USE_WINDOW
-	        case OBJ_WINDOW:
-                translatedMsg = WndTranslateMsg((WINDOW*)pCurrentObj, pMsg);
-                if(translatedMsg == OBJ_MSG_INVALID)
-                    break;
-                GOLMsgCallback(translatedMsg,pCurrentObj,pMsg);
-                break;
-            #endif
-            #ifdef USE_CHECKBOX
-	        case OBJ_CHECKBOX:
-                translatedMsg = CbTranslateMsg((CHECKBOX*)pCurrentObj, pMsg);
-                if(translatedMsg == OBJ_MSG_INVALID)
-                    break;
-                if(GOLMsgCallback(translatedMsg,pCurrentObj,pMsg))
-                    CbMsgDefault(translatedMsg,(CHECKBOX*)pCurrentObj, pMsg);
-                break;
-            #endif
-            #ifdef USE_RADIOBUTTON
-	        case OBJ_RADIOBUTTON:
-                translatedMsg = RbTranslateMsg((RADIOBUTTON*)pCurrentObj, pMsg);
-                if(translatedMsg == OBJ_MSG_INVALID)
-                    break;
-                if(GOLMsgCallback(translatedMsg,pCurrentObj,pMsg))
-                    RbMsgDefault(translatedMsg,(RADIOBUTTON*)pCurrentObj, pMsg);
-                break;
-            #endif
-            #ifdef USE_EDITBOX
-	        case OBJ_EDITBOX:
-                translatedMsg = EbTranslateMsg((EDITBOX*)pCurrentObj, pMsg);
-                if(translatedMsg == OBJ_MSG_INVALID)
-                    break;
-                if(GOLMsgCallback(translatedMsg,pCurrentObj,pMsg))
-                    EbMsgDefault(translatedMsg,(EDITBOX*)pCurrentObj, pMsg);
-                break;
-            #endif
-            #ifdef USE_LISTBOX
-	        case OBJ_LISTBOX:
-                translatedMsg = LbTranslateMsg((LISTBOX*)pCurrentObj, pMsg);
-                if(translatedMsg == OBJ_MSG_INVALID)
-                    break;
-                if(GOLMsgCallback(translatedMsg,pCurrentObj,pMsg))
-                    LbMsgDefault(translatedMsg,(LISTBOX*)pCurrentObj, pMsg);
-                break;
-            #endif
-            #ifdef USE_SLIDER
-	        case OBJ_SLIDER:
-                translatedMsg = SldTranslateMsg((SLIDER*)pCurrentObj, pMsg);
-                if(translatedMsg == OBJ_MSG_INVALID)
-                    break;
-                if(GOLMsgCallback(translatedMsg,pCurrentObj,pMsg))
-                    SldMsgDefault(translatedMsg,(SLIDER*)pCurrentObj, pMsg);
-                break;
-            #endif
-            #ifdef USE_GROUPBOX
-	        case OBJ_GROUPBOX:
-                translatedMsg = GbTranslateMsg((GROUPBOX*)pCurrentObj, pMsg);
-                if(translatedMsg == OBJ_MSG_INVALID)
-                    break;
-                GOLMsgCallback(translatedMsg,pCurrentObj,pMsg);
-                break;
-            #endif
-            #ifdef USE_PROGRESSBAR
-	        case OBJ_PROGRESSBAR:
-                break;
-            #endif
-            #ifdef USE_STATICTEXT
-	        case OBJ_STATICTEXT:
-                translatedMsg = StTranslateMsg((STATICTEXT*)pCurrentObj, pMsg);
-                if(translatedMsg == OBJ_MSG_INVALID)
-                    break;
-                GOLMsgCallback(translatedMsg,pCurrentObj,pMsg);
-                break;
-            #endif
-            #ifdef USE_PICTURE
-	        case OBJ_PICTURE:
-                translatedMsg = PictTranslateMsg((PICTURE*)pCurrentObj, pMsg);
-                if(translatedMsg == OBJ_MSG_INVALID)
-                    break;
-                GOLMsgCallback(translatedMsg,pCurrentObj,pMsg);
-                break;
-            #endif
-           
-            #ifdef USE_ROUNDDIAL
-            case OBJ_ROUNDDIAL:
-                translatedMsg = RdiaTranslateMsg((ROUNDDIAL*)pCurrentObj, pMsg);
-                if(translatedMsg == OBJ_MSG_INVALID)
-                    break;
-                if(GOLMsgCallback(translatedMsg,pCurrentObj,pMsg))
-                    RdiaMsgDefault(translatedMsg,(ROUNDDIAL*)pCurrentObj, pMsg);
-                break;
-            #endif            
-            
-            #ifdef USE_METER
-            case OBJ_METER:
-                translatedMsg = MtrTranslateMsg((METER*)pCurrentObj, pMsg);
-                if(translatedMsg == OBJ_MSG_INVALID)
-                    break;
-                if(GOLMsgCallback(translatedMsg,pCurrentObj,pMsg))
-                    MtrMsgDefault(translatedMsg,(METER*)pCurrentObj, pMsg);
-                break;
-            #endif            
-
-            #ifdef USE_CUSTOM
-	        case OBJ_CUSTOM:
-                translatedMsg = CcTranslateMsg((CUSTOM*)pCurrentObj, pMsg);
-                if(translatedMsg == OBJ_MSG_INVALID)
-                    break;
-                if(GOLMsgCallback(translatedMsg,pCurrentObj,pMsg))
-                    CcMsgDefault((CUSTOM*)pCurrentObj,pMsg);
-                break;
-            #endif
-
-            #ifdef USE_GRID
-	        case OBJ_GRID:
-                translatedMsg = GridTranslateMsg((GRID*)pCurrentObj, pMsg);
-                if(translatedMsg == OBJ_MSG_INVALID)
-                    break;
-                if(GOLMsgCallback(translatedMsg,pCurrentObj,pMsg))
-                    GridMsgDefault( translatedMsg, (GRID*)pCurrentObj, pMsg );
-                break;
-            #endif
-            
-            default:
-                break;
+        if(pCurrentObj->type < OBJ_UNKNOWN){
+            pFuncs = &_golObjFuncs[pCurrentObj->type];
+            if(pFuncs->pTranslateMsg != NULL){
+                translatedMsg = pFuncs->pTranslateMsg(pCurrentObj, pMsg);
+                if(translatedMsg != OBJ_MSG_INVALID){
+                    if(GOLMsgCallback(translatedMsg,pCurrentObj,pMsg) && pFuncs->pMsgDefault != NULL)
+                        pFuncs->pMsgDefault(translatedMsg,pCurrentObj,pMsg);
+                }
+            }
         }
         pCurrentObj = pCurrentObj->pNxtObj;
     }
@@ -797,7 +1404,7 @@ static ROUND_PANEL_DRAW_STATES state = BEGIN;
 static WORD counter;
 
 while(1){
-    if(IsDeviceBusy())
+    if(GOLDrawBusy())
         return 0;
     switch(state){
         case BEGIN:      
@@ -812,6 +1419,7 @@ while(1){
         		state = DRAW_EMBOSS1;
         		goto rnd_panel_draw_emboss;
         	}
+        	// fall through
 
         case ARC1:      
 			// draw upper left portion of the embossed area
@@ -827,7 +1435,7 @@ rnd_panel_draw_emboss:
 	    	SetColor(_rpnlEmbossLtColor);
             counter = 1;
             while(counter < _rpnlEmbossSize){
-   	            if(IsDeviceBusy())
+   	            if(GOLDrawBusy())
 	       	            return 0;
 	       	    // draw top        
 				Bar( _rpnlX1+counter, _rpnlY1+counter,  \
@@ -840,7 +1448,7 @@ rnd_panel_draw_emboss:
 
 		case DRAW_EMBOSS2:
            	while(counter < _rpnlEmbossSize){
-               	if(IsDeviceBusy())
+               	if(GOLDrawBusy())
                    	return 0;
                 // draw left   	
 	        	Bar( _rpnlX1+counter, _rpnlY1+counter,  \
@@ -855,7 +1463,7 @@ rnd_panel_draw_emboss:
 		case DRAW_EMBOSS3:
 		    SetColor(_rpnlEmbossDkColor);
 	        while(counter < _rpnlEmbossSize){
-                if(IsDeviceBusy())
+                if(GOLDrawBusy())
        	            return 0;
        	        // draw bottom    
 		       	Bar( _rpnlX1+counter, _rpnlY2-counter,   \
@@ -868,7 +1476,7 @@ rnd_panel_draw_emboss:
 
 		case DRAW_EMBOSS4:
 			while(counter < _rpnlEmbossSize){
-               	if(IsDeviceBusy())
+               	if(GOLDrawBusy())
                    	return 0;
                 // draw right	   	
 	        	Bar( _rpnlX2-counter, _rpnlY1+counter,  \
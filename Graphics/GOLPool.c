@@ -0,0 +1,248 @@
+/*****************************************************************************
+ *  Module for Microchip Graphics Library
+ *  GOL Layer
+ *  Object Memory Pools
+ *****************************************************************************
+ * FileName:        GOLPool.c
+ * Dependencies:    None
+ * Processor:       PIC24
+ * Compiler:       	MPLAB C30 V3.00
+ * Linker:          MPLAB LINK30
+ *
+ * See GOLPool.h. Each pool is a static array with a free list of the
+ * blocks released so far and an offset to the part never handed out.
+ * When the last block of a pool is released the free list is dropped
+ * and the offset goes back to zero, so the pool starts every screen in
+ * the same state whatever order the previous screen freed it in.
+ *****************************************************************************/
+#include "Graphics\Graphics.h"
+
+/*********************************************************************
+* Overview: Block of the item pool, large enough for a style scheme
+*			or a list item.
+*
+*********************************************************************/
+typedef union {
+	void			*pNext;			// Link while on the free list.
+	GOL_SCHEME		scheme;
+#ifdef USE_LISTBOX
+	LISTITEM		item;
+#endif
+} ITEM_BLOCK;
+
+/*********************************************************************
+* Overview: Block of the object pool, large enough for any enabled
+*			object.
+*
+*********************************************************************/
+typedef union {
+	void			*pNext;			// Link while on the free list.
+	OBJ_HEADER		hdr;
+#ifdef USE_BUTTON
+	BUTTON			button;
+#endif
+#ifdef USE_WINDOW
+	WINDOW			window;
+#endif
+#ifdef USE_GROUPBOX
+	GROUPBOX		groupBox;
+#endif
+#ifdef USE_STATICTEXT
+	STATICTEXT		staticText;
+#endif
+#ifdef USE_SLIDER
+	SLIDER			slider;
+#endif
+#ifdef USE_CHECKBOX
+	CHECKBOX		checkBox;
+#endif
+#ifdef USE_RADIOBUTTON
+	RADIOBUTTON		radioButton;
+#endif
+#ifdef USE_PICTURE
+	PICTURE			picture;
+#endif
+#ifdef USE_PROGRESSBAR
+	PROGRESSBAR		progressBar;
+#endif
+#ifdef USE_EDITBOX
+	EDITBOX			editBox;
+#endif
+#ifdef USE_LISTBOX
+	LISTBOX			listBox;
+#endif
+#ifdef USE_ROUNDDIAL
+	ROUNDDIAL		roundDial;
+#endif
+#ifdef USE_METER
+	METER			meter;
+#endif
+#ifdef USE_GRID
+	GRID			grid;
+#endif
+#ifdef USE_CUSTOM
+	CUSTOM			custom;
+#endif
+} OBJECT_BLOCK;
+
+/*********************************************************************
+* Overview: Unit the arena hands out, so every request is aligned for
+*			the types it may hold.
+*
+*********************************************************************/
+typedef union {
+	void			*p;
+	DWORD			d;
+} ARENA_UNIT;
+
+#define ARENA_UNITS		((GOL_POOL_ARENA_SIZE + sizeof(ARENA_UNIT) - 1)/sizeof(ARENA_UNIT))
+
+/*********************************************************************
+* Overview: State of a pool.
+*
+*********************************************************************/
+typedef struct {
+	BYTE			*pBlocks;		// First byte of the pool.
+	void			*pFree;			// Released blocks, fixed size pools only.
+	WORD			next;			// Offset of the bytes not handed out yet.
+	WORD			live;			// Blocks taken and not released.
+	GOL_POOL_STATS	stats;
+} GOL_POOL;
+
+static ITEM_BLOCK	_poolItems[GOL_POOL_ITEMS];
+static OBJECT_BLOCK	_poolObjects[GOL_POOL_OBJECTS];
+static ARENA_UNIT	_poolArena[ARENA_UNITS];
+
+static GOL_POOL		_pools[GOL_POOL_COUNT] = {
+	{ (BYTE*)_poolItems,   NULL, 0, 0, { sizeof(ITEM_BLOCK),   GOL_POOL_ITEMS,     0, 0, 0 } },
+	{ (BYTE*)_poolObjects, NULL, 0, 0, { sizeof(OBJECT_BLOCK), GOL_POOL_OBJECTS,   0, 0, 0 } },
+	{ (BYTE*)_poolArena,   NULL, 0, 0, { 1,                    sizeof(_poolArena), 0, 0, 0 } },
+};
+
+/*********************************************************************
+* Function: void *GOLPoolAlloc(WORD size)
+*
+* PreCondition: none
+*
+* Input: size - bytes needed
+*
+* Output: pointer to the block, NULL if its pool is used up
+*
+* Side Effects: none
+*
+* Overview: picks the pool by size, then takes the most recently
+*			released block or the next block never handed out
+*
+* Note: none
+*
+********************************************************************/
+void *GOLPoolAlloc(WORD size)
+{
+	GOL_POOL	*pPool;
+	BYTE		*pBlock;
+	WORD		capacity;
+
+	if(size <= sizeof(ITEM_BLOCK))
+		pPool = &_pools[GOL_POOL_ITEM];
+	else if(size <= sizeof(OBJECT_BLOCK))
+		pPool = &_pools[GOL_POOL_OBJECT];
+	else
+		pPool = &_pools[GOL_POOL_ARENA];
+
+	capacity = pPool->stats.size*pPool->stats.total;
+
+	if(pPool->pFree != NULL)
+	{
+		pBlock = pPool->pFree;
+		pPool->pFree = *(void**)pBlock;
+	}
+	else
+	{
+		// Fixed size pools hand out whole blocks, the arena whole units
+		if(pPool->stats.size != 1)
+			size = pPool->stats.size;
+		else if(size <= capacity)
+			size = (size + sizeof(ARENA_UNIT) - 1) & ~(sizeof(ARENA_UNIT) - 1);
+
+		if(size > capacity - pPool->next)
+		{
+			pPool->stats.failed++;
+			return NULL;
+		}
+		pBlock = pPool->pBlocks + pPool->next;
+		pPool->next += size;
+	}
+
+	pPool->live++;
+	pPool->stats.used = (pPool->stats.size == 1) ? pPool->next : pPool->live;
+	if(pPool->stats.used > pPool->stats.highWater)
+		pPool->stats.highWater = pPool->stats.used;
+
+	return pBlock;
+}
+
+/*********************************************************************
+* Function: void GOLPoolFree(void *pBlock)
+*
+* PreCondition: none
+*
+* Input: pBlock - block taken by GOLPoolAlloc(), or NULL
+*
+* Output: none
+*
+* Side Effects: none
+*
+* Overview: finds the pool from the address, then puts a fixed size
+*			block on the free list; the arena only counts it. A pool
+*			with nothing left taken is reset to empty.
+*
+* Note: none
+*
+********************************************************************/
+void GOLPoolFree(void *pBlock)
+{
+	GOL_POOL	*pPool;
+
+	for(pPool = _pools; pPool < &_pools[GOL_POOL_COUNT]; pPool++)
+	{
+		if((BYTE*)pBlock >= pPool->pBlocks && (BYTE*)pBlock < pPool->pBlocks + pPool->next)
+			break;
+	}
+	if(pPool == &_pools[GOL_POOL_COUNT])
+		return;
+
+	if(--pPool->live == 0)
+	{
+		pPool->pFree = NULL;
+		pPool->next = 0;
+	}
+	else if(pPool->stats.size != 1)
+	{
+		*(void**)pBlock = pPool->pFree;
+		pPool->pFree = pBlock;
+	}
+	pPool->stats.used = (pPool->stats.size == 1) ? pPool->next : pPool->live;
+}
+
+/*********************************************************************
+* Function: void GOLPoolGetStats(GOL_POOL_ID pool, GOL_POOL_STATS *pStats)
+*
+* PreCondition: none
+*
+* Input: pool - pool of interest
+*		 pStats - where the usage is copied
+*
+* Output: none
+*
+* Side Effects: none
+*
+* Overview: copies the usage of a pool
+*
+* Note: none
+*
+********************************************************************/
+void GOLPoolGetStats(GOL_POOL_ID pool, GOL_POOL_STATS *pStats)
+{
+	if(pool < GOL_POOL_COUNT)
+		*pStats = _pools[pool].stats;
+}
@@ -57,14 +57,14 @@ GRID *GridCreate( WORD ID, SHORT left, SHORT top, SHORT right, SHORT bottom, WOR
 {
     GRID *pGrid = NULL;
 
-    if ((pGrid = malloc(sizeof(GRID))) == NULL)
+    if ((pGrid = GOLPoolAlloc(sizeof(GRID))) == NULL)
     {
         return NULL;
     }
 
-    if ((pGrid->gridObjects = malloc(sizeof(GRIDITEM)*numColumns*numRows)) == NULL)
+    if ((pGrid->gridObjects = GOLPoolAlloc(sizeof(GRIDITEM)*numColumns*numRows)) == NULL)
     {
-        free( pGrid );
+        GOLPoolFree( pGrid );
         return NULL;
     }
 
@@ -227,7 +227,7 @@ void GridFreeItems( GRID *pGrid )
 {
     if (pGrid && pGrid->gridObjects)
     {
-        free( pGrid->gridObjects );
+        GOLPoolFree( pGrid->gridObjects );
         pGrid->gridObjects = NULL;  // Just in case...
     }    
 }    
@@ -301,6 +301,8 @@ void * GridGetCell( GRID *pGrid, SHORT column, SHORT row, WORD *cellType )
 
 void GridMsgDefault( WORD translatedMsg, GRID *pGrid, GOL_MSG *pMsg )
 {
+    (void)pMsg;
+
     switch (translatedMsg)
     {
         case GRID_MSG_ITEM_SELECTED:
@@ -58,7 +58,7 @@ GROUPBOX *GbCreate(WORD ID, SHORT left, SHORT top, SHORT right, SHORT bottom,
 {
 	GROUPBOX *pGb = NULL;
 	
-	pGb = malloc(sizeof(GROUPBOX));
+	pGb = GOLPoolAlloc(sizeof(GROUPBOX));
 	if (pGb == NULL)
 		return pGb;
 	
@@ -157,14 +157,14 @@ typedef enum {
 static GB_DRAW_STATES state = GB_STATE_IDLE;
 static SHORT textLeft, textRight, top;						// used to draw lines that start/stops at text.
 
-    if(IsDeviceBusy())
+    if(GOLDrawBusy())
         return 0;
 
     switch(state){
 	    
         case GB_STATE_IDLE:
 
-            if(IsDeviceBusy())
+            if(GOLDrawBusy())
                 return 0;  
 
 	        if (GetState(pGb,GB_HIDE)) {					// Hide the Group Box (remove from screen)
@@ -184,7 +184,7 @@ static SHORT textLeft, textRight, top;						// used to draw lines that start/sto
 
         case GB_STATE_SETDIMENSION:
 
- 			if(IsDeviceBusy())
+ 			if(GOLDrawBusy())
                 return 0;    		    
                 
 	        if (GetState(pGb,GB_DISABLED)) {				// set color to inactive color
@@ -239,21 +239,21 @@ gb_state_draw_lines:
 
         case GB_STATE_DRAWTOPRIGHT:
         
-            if(IsDeviceBusy())
+            if(GOLDrawBusy())
                 return 0;    
 			Line(textRight, top + THREE_D_EFFECT, pGb->hdr.right, top + THREE_D_EFFECT);	// top line at right
 			state = GB_STATE_DRAWTOPLEFT;
 			
         case GB_STATE_DRAWTOPLEFT:
         
-            if(IsDeviceBusy())
+            if(GOLDrawBusy())
                 return 0;    
 			Line(pGb->hdr.left+THREE_D_EFFECT, top + THREE_D_EFFECT, textLeft, top + THREE_D_EFFECT);	// top line at left
 			state = GB_STATE_DRAWSIDELEFT;
 
         case GB_STATE_DRAWSIDELEFT:
         
-            if(IsDeviceBusy())
+            if(GOLDrawBusy())
                 return 0;    
 			Line(pGb->hdr.left+THREE_D_EFFECT, top + THREE_D_EFFECT, 					\
 			     pGb->hdr.left+THREE_D_EFFECT, pGb->hdr.bottom); 				// side line at left
@@ -261,7 +261,7 @@ gb_state_draw_lines:
 			
         case GB_STATE_DRAWSIDERIGHT:
         
-            if(IsDeviceBusy())
+            if(GOLDrawBusy())
                 return 0;    
 			Line(pGb->hdr.right, top + THREE_D_EFFECT, 					\
 			     pGb->hdr.right, pGb->hdr.bottom);   				// side line at right
@@ -269,7 +269,7 @@ gb_state_draw_lines:
 
         case GB_STATE_DRAWBOTTOM:
         
-            if(IsDeviceBusy())
+            if(GOLDrawBusy())
                 return 0;    
 			Line(pGb->hdr.left+THREE_D_EFFECT, pGb->hdr.bottom, 				\
 			     pGb->hdr.right, pGb->hdr.bottom);   				// bottom line
@@ -282,7 +282,7 @@ gb_state_draw_lines:
 #ifndef USE_MONOCHROME
         case GB_STATE_2DRAWTOPLEFT:
         
-            if(IsDeviceBusy())
+            if(GOLDrawBusy())
                 return 0;    
 			SetColor(pGb->hdr.pGolScheme->EmbossLtColor);		// 2nd line top line at left
 			Line(pGb->hdr.left, top, textLeft,  top);
@@ -290,21 +290,21 @@ gb_state_draw_lines:
             
         case GB_STATE_2DRAWTOPRIGHT:
         
-            if(IsDeviceBusy())
+            if(GOLDrawBusy())
                 return 0;    
 			Line(textRight, top, pGb->hdr.right, top);			// 2nd line top line at right
             state = GB_STATE_2DRAWSIDELEFT;
 
 	    case GB_STATE_2DRAWSIDELEFT:
 
-            if(IsDeviceBusy())
+            if(GOLDrawBusy())
    	            return 0;    
 			Line(pGb->hdr.left, top, pGb->hdr.left, pGb->hdr.bottom-1);	// 2nd line left
             state =  GB_STATE_2DRAWSIDERIGHT;
 
 	    case  GB_STATE_2DRAWSIDERIGHT:
 
-            if(IsDeviceBusy())
+            if(GOLDrawBusy())
    	            return 0;    
 			Line(pGb->hdr.right-1, top+2, 					\
 			     pGb->hdr.right-1, pGb->hdr.bottom-1);				// 2nd line right
@@ -312,7 +312,7 @@ gb_state_draw_lines:
 
 	    case GB_STATE_2DRAWBOTTOM:
 
-            if(IsDeviceBusy())
+            if(GOLDrawBusy())
    	            return 0;    
 			Line(pGb->hdr.left+2, pGb->hdr.bottom-1, 			\
 			     pGb->hdr.right-1, pGb->hdr.bottom-1);				// 2nd line bottom
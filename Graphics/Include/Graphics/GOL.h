@@ -284,9 +284,22 @@ extern OBJ_HEADER  *_pGolObjects;
 // Pointer to the object receiving keyboad input.
 extern OBJ_HEADER  *_pObjectFocused;
 
+// State of the index GOLFindObject() looks objects up in, cleared when the active list changes.
+extern WORD         _golIndexState;
+
 // Line type used for focus mark.
 #define FOCUS_LINE       2
 
+// Damaged rectangles kept for the next GOLDraw(), see GOLRedrawRec().
+#ifndef GOL_DAMAGE_RECS
+	#define GOL_DAMAGE_RECS		4
+#endif
+
+// Slots of the index GOLFindObject() looks objects up in, a power of two.
+#ifndef GOL_ID_INDEX_SIZE
+	#define GOL_ID_INDEX_SIZE	16
+#endif
+
 
 /*********************************************************************
 * Overview: The following are the style scheme default settings.
@@ -964,10 +977,12 @@ void  GOLAddObject(OBJ_HEADER* object);
 *	</PRE>
 *
 * Side Effects: This macro sets the focused object pointer 
-*				(_pObjectFocused) to NULL.
+*				(_pObjectFocused) to NULL. A GOLDraw() or 
+*				GOLDrawBudget() pass under way is ended by 
+*				GOLDrawAbort().
 *
 ********************************************************************/
-#define  GOLNewList()  _pGolObjects = NULL;  _pObjectFocused = NULL
+#define  GOLNewList()  GOLDrawAbort();  _pGolObjects = NULL;  _pObjectFocused = NULL;  _golIndexState = 0
 
 /*********************************************************************
 * Macros: GOLGetList()
@@ -1029,18 +1044,29 @@ void  GOLAddObject(OBJ_HEADER* object);
 *				(_pObjectFocused) to NULL. Previous active list 
 *				should be saved if needed to be referenced later. 
 *				If not, use GOLFree() function to free the memory 
-*				used by the objects before calling GOLSetList().
+*				used by the objects before calling GOLSetList(). 
+*				A GOLDraw() or GOLDrawBudget() pass under way is 
+*				ended by GOLDrawAbort().
 *
 ********************************************************************/
-#define  GOLSetList(objsList)  _pGolObjects = objsList; _pObjectFocused = NULL									
+#define  GOLSetList(objsList)  GOLDrawAbort(); _pGolObjects = objsList; _pObjectFocused = NULL; _golIndexState = 0									
 
 /*********************************************************************
 * Function: OBJ_HEADER* GOLFindObject(WORD ID)
 *
 * Overview: This function finds an object in the active list 
 *			pointed to by _pGolObjects using the given object ID.
-*
-* PreCondition: none
+*			Objects are looked up in an index of GOL_ID_INDEX_SIZE 
+*			slots, built on the first search after the active list 
+*			is changed by GOLNewList() or GOLSetList() and kept up 
+*			to date by GOLAddObject(). When objects share an ID the 
+*			one nearer the head of the list is found. While the 
+*			list has more objects than the index has room for, the 
+*			list is searched instead.
+*
+* PreCondition: If objects are taken out of the active list or their 
+*				IDs are changed directly, GOLSetList(GOLGetList()) 
+*				must be called before the next search.
 *
 * Input: ID - User assigned value set during the creation of the object.
 *
@@ -1134,12 +1160,97 @@ void GOLFree();
 ********************************************************************/
 WORD GOLDraw();
 
+/*********************************************************************
+* Function: WORD GOLDrawBudget(WORD us)
+*
+* Overview: This function redraws objects in the active list as 
+*			GOLDraw() does, but returns once the given time slice, 
+*			measured on Timer 1, is used up. The next call carries 
+*			on where drawing stopped, so the main loop can serve 
+*			keys and other tasks between slices of a long redraw. 
+*			The display is flushed when drawing is completed.
+*
+* PreCondition: timebaseInit() must have been called.
+*
+* Input: us - Time slice in microseconds. Drawing stops between 
+*			  objects, and inside an object where its draw 
+*			  function checks GOLDrawBusy(), so a call may run 
+*			  over by the longest step; at least one step is 
+*			  drawn on every call.
+*
+* Output: Non-zero if the active link list drawing is completed.
+*
+* Example:
+*	<PRE> 
+*	while(1){
+*		if(GOLDrawBudget(500)){     // draw for at most about 500 us
+*	    	// here GOL drawing is completed
+*			GOLMsg(&msg);           // evaluate each object is affected by the message
+*      	}
+*		schedulerYield();           // run due tasks between slices
+*	}
+*	</PRE>	
+*
+* Side Effects: none
+*
+********************************************************************/
+WORD GOLDrawBudget(WORD us);
+
+/*********************************************************************
+* Function: WORD GOLDrawBusy()
+*
+* Overview: This function tells an object's draw function to stop 
+*			and return 0, to be called again where it left off. It 
+*			is non-zero while IsDeviceBusy() is, and once the 
+*			GOLDrawBudget() time slice is used up. The first check 
+*			of a slice lets drawing through and gives it at least 
+*			GOL_DRAW_STEP_MIN_US, so every call draws something. 
+*			Draw functions check it where they could wait for the 
+*			controller.
+*
+* PreCondition: none
+*
+* Input: none
+*
+* Output: Non-zero if drawing should stop for now.
+*
+* Side Effects: none
+*
+********************************************************************/
+WORD GOLDrawBusy();
+
+/*********************************************************************
+* Function: void GOLDrawAbort()
+*
+* Overview: This function ends the drawing pass of the active list 
+*			under way, so the next GOLDraw() or GOLDrawBudget() 
+*			starts a new one. An object whose drawing stopped part 
+*			way in a GOLDrawBudget() time slice is drawn to the end 
+*			first, as its draw function keeps its place, then the 
+*			damage collected by GOLRedrawRec() is dropped. 
+*			GOLFree(), GOLNewList() and GOLSetList() call it.
+*
+* PreCondition: The objects of the active list have not been freed.
+*
+* Input: none
+*
+* Output: none
+*
+* Side Effects: none
+*
+********************************************************************/
+void GOLDrawAbort();
+
 /*********************************************************************
 * Function: void GOLRedrawRec(SHORT left, SHORT top, SHORT right, SHORT bottom)
 *
-* Overview: This function marks all objects in the active 
-*			list intersected by the given rectangular area 
-*			to be redrawn.
+* Overview: This function adds the given rectangular area to the 
+*			damaged area of the screen. On the next GOLDraw() 
+*			every object in the active list intersected by it 
+*			is redrawn, clipped to the damage, so only the part 
+*			of the object inside the rectangle is drawn again. 
+*			Overlapping damaged rectangles are merged, and at 
+*			most GOL_DAMAGE_RECS are kept.
 *
 * PreCondition: none
 *
@@ -1152,29 +1263,57 @@ WORD GOLDraw();
 *
 * Example:
 *	<PRE> 
-* 	OBJ_HEADER *pTemp;
-*	OBJ_HEADER *pAllObjects;
+*	// a message box drawn with primitives over the objects 
+*	// is taken away
+*	GOLRedrawRec(10,10,100,100);
+*	while(!GOLDraw());                     	// redraw what it covered
+*	</PRE>	
 *
-*	// assume *pAllObjects points to a list of all existing objects
-*	// created and initialized
+* Side Effects: An object that already waits for a partial redraw
+*				is marked to be redrawn whole instead.
 *
-*	// mark all objects inside the rectangle to be redrawn
-*	GOLRedrawRec(10,10,100,100);
+********************************************************************/
+void  GOLRedrawRec(SHORT left, SHORT top, SHORT right, SHORT bottom);
+
+/*********************************************************************
+* Function: void GOLSetClipRgn(SHORT left, SHORT top, SHORT right, SHORT bottom)
 *
-*	pTemp = pAllObjects;					
-*	GOLStartNewList();                     	// reset active list
-*	while(pTemp->pNxtObj != NULL) {
-*		if (pTemp->state&0x7C00)            // add only objects to be
-*		GOLAddObject(pTemp);          		// redrawn to the active list
-*		pTemp = pTemp->pNxtObj;
-*	}
-*	GOLDraw();                             	// redraw active list
-*	</PRE>	
+* Overview: Objects call this in place of SetClip(CLIP_ENABLE) and 
+*			SetClipRgn() when they clip their own drawing. While 
+*			GOLDraw() redraws the object for damage the region is 
+*			limited to the damaged rectangle.
+*
+* PreCondition: none
+*
+* Input: left - Defines the left clipping region border.
+*		 top - Defines the top clipping region border.
+*		 right - Defines the right clipping region border.
+*		 bottom - Defines the bottom clipping region border.
+*
+* Output: none
 *
 * Side Effects: none
 *
 ********************************************************************/
-void  GOLRedrawRec(SHORT left, SHORT top, SHORT right, SHORT bottom);
+void GOLSetClipRgn(SHORT left, SHORT top, SHORT right, SHORT bottom);
+
+/*********************************************************************
+* Function: void GOLClearClipRgn()
+*
+* Overview: Objects call this in place of SetClip(CLIP_DISABLE). 
+*			While GOLDraw() redraws the object for damage it 
+*			clips to the damaged rectangle instead.
+*
+* PreCondition: none
+*
+* Input: none
+*
+* Output: none
+*
+* Side Effects: none
+*
+********************************************************************/
+void GOLClearClipRgn(void);
 
 /*********************************************************************
 * Macros: GOLRedraw(pObj)
@@ -0,0 +1,124 @@
+/*****************************************************************************
+ *  Module for Microchip Graphics Library
+ *  GOL Layer
+ *  Object Memory Pools
+ *****************************************************************************
+ * FileName:        GOLPool.h
+ * Dependencies:    GraphicsConfig.h
+ * Processor:       PIC24
+ * Compiler:       	MPLAB C30 V3.00
+ * Linker:          MPLAB LINK30
+ *
+ * Objects, list items and style schemes are taken from fixed pools in
+ * place of the heap. The pools are sized at compile time in
+ * GraphicsConfig.h:
+ *	- GOL_POOL_ITEMS - blocks the size of the largest of GOL_SCHEME and
+ *	  LISTITEM.
+ *	- GOL_POOL_OBJECTS - blocks the size of the largest enabled object.
+ *	- GOL_POOL_ARENA_SIZE - bytes for requests that fit neither, such as
+ *	  the cells of a grid or an edit box with its text.
+ *
+ * Blocks of a size class are kept on a free list, so allocation and
+ * release take the same time whatever the pool holds. The arena hands
+ * out memory from its top and is reset as a whole once everything taken
+ * from it is released, which happens when the screen that used it is
+ * torn down by GOLFree().
+ *****************************************************************************/
+
+#ifndef _GOLPOOL_H
+#define _GOLPOOL_H
+
+#include "GenericTypeDefs.h"
+#include "GraphicsConfig.h"
+
+#ifndef GOL_POOL_ITEMS
+	#define GOL_POOL_ITEMS			4
+#endif
+#ifndef GOL_POOL_OBJECTS
+	#define GOL_POOL_OBJECTS		8
+#endif
+#ifndef GOL_POOL_ARENA_SIZE
+	#define GOL_POOL_ARENA_SIZE		128
+#endif
+
+/*********************************************************************
+* Overview: Memory pools of the GOL layer, for GOLPoolGetStats().
+*
+*********************************************************************/
+typedef enum {
+	GOL_POOL_ITEM = 0,				// Style schemes and list items.
+	GOL_POOL_OBJECT,				// Objects.
+	GOL_POOL_ARENA,					// Everything larger.
+	GOL_POOL_COUNT
+} GOL_POOL_ID;
+
+/*********************************************************************
+* Overview: Usage of a pool. Block counts for GOL_POOL_ITEM and
+*			GOL_POOL_OBJECT, bytes for GOL_POOL_ARENA.
+*
+*********************************************************************/
+typedef struct {
+	WORD	size;					// Block size in bytes, 1 for the arena.
+	WORD	total;					// Blocks (bytes) in the pool.
+	WORD	used;					// Blocks (bytes) in use.
+	WORD	highWater;				// Most blocks (bytes) ever in use at once.
+	WORD	failed;					// Requests the pool could not meet.
+} GOL_POOL_STATS;
+
+/*********************************************************************
+* Function: void *GOLPoolAlloc(WORD size)
+*
+* Overview: Takes a block of at least size bytes from the smallest
+*			pool it fits, in place of malloc().
+*
+* PreCondition: none
+*
+* Input: size - bytes needed.
+*
+* Output: Pointer to the block, NULL if the pool for that size is
+*		  used up. A larger pool is not tried in its place, so
+*		  objects cannot crowd out the arena or the other way round.
+*
+* Side Effects: none
+*
+********************************************************************/
+void *GOLPoolAlloc(WORD size);
+
+/*********************************************************************
+* Function: void GOLPoolFree(void *pBlock)
+*
+* Overview: Returns a block taken by GOLPoolAlloc(), in place of
+*			free(). When the last block taken from the arena is
+*			returned the arena is reset to empty.
+*
+* PreCondition: none
+*
+* Input: pBlock - block to release. NULL is ignored.
+*
+* Output: none
+*
+* Side Effects: none
+*
+********************************************************************/
+void GOLPoolFree(void *pBlock);
+
+/*********************************************************************
+* Function: void GOLPoolGetStats(GOL_POOL_ID pool, GOL_POOL_STATS *pStats)
+*
+* Overview: Copies the usage of a pool, including the high water
+*			mark, so the counts in GraphicsConfig.h can be trimmed to
+*			what the application needs.
+*
+* PreCondition: none
+*
+* Input: pool - pool of interest.
+*		 pStats - where the usage is copied.
+*
+* Output: none
+*
+* Side Effects: none
+*
+********************************************************************/
+void GOLPoolGetStats(GOL_POOL_ID pool, GOL_POOL_STATS *pStats);
+
+#endif // _GOLPOOL_H
@@ -62,6 +62,7 @@
 
 #include "ScanCodes.h"  // Scan codes for AT keyboard
 #include "GOL.h"        // GOL layer 
+#include "GOLPool.h"    // Memory for GOL objects
 #ifdef USE_BUTTON
     #include "Button.h"
 #endif
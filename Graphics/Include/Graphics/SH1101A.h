@@ -54,6 +54,9 @@
 // Define this to implement Font related functions in the driver.
 //#define USE_DRV_FONT
 
+// Define this to implement only the OutChar function in the driver.
+#define USE_DRV_OUTCHAR
+
 // Define this to implement Line function in the driver.
 //#define USE_DRV_LINE
 
@@ -64,7 +67,7 @@
 //#define USE_DRV_FILLCIRCLE
 
 // Define this to implement Bar function in the driver.
-//#define USE_DRV_BAR
+#define USE_DRV_BAR
 
 // Define this to implement ClearDevice function in the driver.
 #define USE_DRV_CLEARDEVICE
@@ -88,6 +91,10 @@
 
 // Defines the vertical screen size. Dependent on the display glass used.
 #define SCREEN_VER_SIZE    64
+// Columns of display RAM in the controller, wider than the glass.
+#define DISP_COLUMNS       132
+// 8 pixel high pages of display RAM, one byte per column in each.
+#define DISP_PAGES         (SCREEN_VER_SIZE/8)
 #endif
 /*********************************************************************
 * Overview: Clipping region control codes to be used with SetClip(...)
@@ -214,7 +221,11 @@ extern SHORT _clipBottom;
 * Side Effects: none
 *
 ********************************************************************/
+#ifdef HOST_BUILD
+#define WriteCommand(cmd)		hostDisplayCommand(cmd);
+#else
 #define WriteCommand(cmd)		PMADDR=0x4000;PMPWaitBusy();PMDIN1=cmd;PMPDelay();
+#endif
 
 /*********************************************************************
 * Macros:  WriteData(writeByte)
@@ -230,7 +241,11 @@ extern SHORT _clipBottom;
 * Side Effects: none
 *
 ********************************************************************/
+#ifdef HOST_BUILD
+#define WriteData(writeByte) 	hostDisplayWrite(writeByte);
+#else
 #define WriteData(writeByte) 	PMADDR=0x4001;PMPWaitBusy();PMDIN1=writeByte;PMPDelay();
+#endif
 
 /*********************************************************************
 * Macros:  ReadData(readByte)
@@ -247,7 +262,11 @@ extern SHORT _clipBottom;
 * Side Effects: none
 *
 ********************************************************************/
+#ifdef HOST_BUILD
+#define ReadData(readByte)		readByte=hostDisplayRead();
+#else
 #define ReadData(readByte)		PMADDR=0x4001;PMPWaitBusy();readByte=PMDIN1;PMPDelay();
+#endif
 
 /*********************************************************************
 * Macros:  SetAddress(lowerAddr,higherAddr)
@@ -417,6 +436,64 @@ void PutPixel(SHORT x, SHORT y);
 ********************************************************************/
 BYTE GetPixel(SHORT x, SHORT y);
 
+/*********************************************************************
+* Function: void FlushDisplay(void)
+*
+* Overview: Drawing only changes a RAM copy of the display. This sends
+*			the columns of each page that changed since the last flush
+*			to the controller.
+*
+* PreCondition: none
+*
+* Input: none
+*
+* Output: none
+*
+* Side Effects: none
+*
+********************************************************************/
+void FlushDisplay(void);
+
+/*********************************************************************
+* Function: void ClearRegion(SHORT left, SHORT top, SHORT right, SHORT bottom)
+*
+* Overview: Fills a rectangle with the current color like Bar(), a
+*			whole byte of each page at a time. Clipping is NOT
+*			supported, as for ClearDevice().
+*
+* PreCondition: none
+*
+* Input: left,top - top left corner coordinates,
+*        right,bottom - bottom right corner coordinates
+*
+* Output: none
+*
+* Side Effects: none
+*
+********************************************************************/
+void ClearRegion(SHORT left, SHORT top, SHORT right, SHORT bottom);
+
+/*********************************************************************
+* Function: void ScrollDisplay(SHORT lines)
+*
+* Overview: Moves the picture up by the given number of rows, or down
+*			if negative, with the display start line of the controller
+*			instead of redrawing it. The rows scrolled in are filled
+*			with the current color. Coordinates stay those of the
+*			screen, so row 0 is always the top row shown. The new
+*			start line is sent by the next FlushDisplay().
+*
+* PreCondition: none
+*
+* Input: lines - rows to scroll by
+*
+* Output: none
+*
+* Side Effects: none
+*
+********************************************************************/
+void ScrollDisplay(SHORT lines);
+
 /*********************************************************************
 * Macros: SetClipRgn(left, top, right, bottom)
 *
@@ -57,7 +57,7 @@ LISTBOX *LbCreate(WORD ID, SHORT left, SHORT top, SHORT right, SHORT bottom,
     XCHAR* pointer;
     WORD  counter;    
 
-  	pLb = malloc(sizeof(LISTBOX));
+  	pLb = GOLPoolAlloc(sizeof(LISTBOX));
 
 	if(pLb == NULL)
 	    return pLb;
@@ -130,7 +130,7 @@ LISTITEM* LbAddItem(LISTBOX *pLb, LISTITEM *pPrevItem, XCHAR *pText, void* pBitm
 LISTITEM* pItem;
 LISTITEM* pCurItem; 
 
-    pItem = (LISTITEM*) malloc(sizeof(LISTITEM));
+    pItem = (LISTITEM*) GOLPoolAlloc(sizeof(LISTITEM));
 
     if(pItem == NULL){
         return NULL;
@@ -191,7 +191,7 @@ void LbDelItem(LISTBOX *pLb, LISTITEM *pItem){
     if(pItem->pPrevItem != NULL)
         ((LISTITEM*)pItem->pPrevItem)->pNextItem = pItem->pNextItem;
 
-    free(pItem);
+    GOLPoolFree(pItem);
 
     pLb->itemsNumber--;
 
@@ -218,7 +218,7 @@ LISTITEM* pItem;
     while(pCurItem != NULL){
         pItem = pCurItem;
         pCurItem = pCurItem->pNextItem;
-        free(pItem);
+        GOLPoolFree(pItem);
     }
 	pLb->pItemList = NULL;
 }
@@ -501,7 +501,7 @@ static SHORT  temp;
         case LB_STATE_START:
 
           	if (GetState(pLb, LB_HIDE)) {
-                if(IsDeviceBusy())
+                if(GOLDrawBusy())
                     return 0;
    	   	        SetColor(pLb->pGolScheme->CommonBkColor);
     	        Bar(pLb->left,pLb->top,pLb->right,pLb->bottom);
@@ -544,12 +544,10 @@ if(GetState(pLb, LB_DRAW)){
 // DRAW ITEMS
 /////////////////////////////////////////////////////////////////////
 L_LB_DRAW:
-            SetClip(CLIP_ENABLE);
-
-            SetClipRgn(pLb->left+GOL_EMBOSS_SIZE+LB_INDENT,
-                       pLb->top+GOL_EMBOSS_SIZE+LB_INDENT,
-                       pLb->right-GOL_EMBOSS_SIZE-LB_INDENT,
-                       pLb->bottom-GOL_EMBOSS_SIZE-LB_INDENT);
+            GOLSetClipRgn(pLb->left+GOL_EMBOSS_SIZE+LB_INDENT,
+                          pLb->top+GOL_EMBOSS_SIZE+LB_INDENT,
+                          pLb->right-GOL_EMBOSS_SIZE-LB_INDENT,
+                          pLb->bottom-GOL_EMBOSS_SIZE-LB_INDENT);
 
 	        SetFont(pLb->pGolScheme->pFont);
 
@@ -565,7 +563,7 @@ L_LB_DRAW:
 L_LB_DRAWITEM:
             if( pCurItem == NULL ) {
                 state = LB_STATE_START;
-                SetClip(CLIP_DISABLE);
+                GOLClearClipRgn();
                 return 1;
             }
 
@@ -583,7 +581,7 @@ if((GetY()+ pLb->textHeight) >= (pLb->top+GOL_EMBOSS_SIZE+LB_INDENT)){
 
         case LB_STATE_ERASEITEM:
 
-            if(IsDeviceBusy())
+            if(GOLDrawBusy())
                 return 0;
 
             if( GetState(pLb, LB_DISABLED)){
@@ -654,7 +652,7 @@ L_LB_NEXTITEM:
         case LB_STATE_ITEMFOCUS:
 
             if(pLb->pFocusItem == pCurItem){
-                if(IsDeviceBusy())
+                if(GOLDrawBusy())
                     return 0;
 
                 if( GetState(pLb,LB_FOCUSED) ){
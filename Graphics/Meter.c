@@ -80,7 +80,7 @@ METER  *MtrCreate(WORD ID, SHORT left, SHORT top, SHORT right, SHORT bottom,
 	SHORT tempHeight, tempWidth;
 	XCHAR tempChar[2] = {'8',0};
 	
-	pMtr = malloc(sizeof(METER));
+	pMtr = GOLPoolAlloc(sizeof(METER));
 	if (pMtr == NULL) 
 		return NULL;
 	
@@ -264,7 +264,7 @@ typedef enum {
 	static float radian;
 	static DWORD_VAL dTemp, dRes;
 		
-    if(IsDeviceBusy())
+    if(GOLDrawBusy())
         return 0;
 
     switch(state) {
@@ -443,7 +443,7 @@ mtr_scale_compute:
 			
 		case SCALE_DRAW:
 			Line(x1,y1,x2,y2);							// now draw the scales
-			if(IsDeviceBusy())
+			if(GOLDrawBusy())
        			return 0;
 
 			if ((i%45) == 0) {
@@ -517,7 +517,7 @@ mtr_needle_draw_st:
 	
 		case NEEDLE_DRAW:
 
-			if(IsDeviceBusy())
+			if(GOLDrawBusy())
        			return 0;
 
 			// At this point, pMtr->value is assumed to contain the new value of the meter.
@@ -603,7 +603,7 @@ mtr_needle_draw_st:
 
 		#ifdef METER_DISPLAY_VALUES_ENABLE
 		case VALUE_ERASE:
-			if(IsDeviceBusy())
+			if(GOLDrawBusy())
        			return 0;
 
 			// reset the line to normal 
@@ -641,7 +641,7 @@ mtr_needle_draw_st:
 			state = VALUE_DRAW;
 		
 		case VALUE_DRAW:
-			if(IsDeviceBusy())
+			if(GOLDrawBusy())
        			return 0;
 		
 			if (angle > critical) {
@@ -56,7 +56,7 @@ PICTURE *PictCreate(WORD ID, SHORT left, SHORT top, SHORT right, SHORT bottom,
 {
 	PICTURE *pPict = NULL;
 	
-	pPict = malloc(sizeof(PICTURE));
+	pPict = GOLPoolAlloc(sizeof(PICTURE));
 	if (pPict == NULL)
 		return pPict;
 
@@ -90,6 +90,8 @@ PICTURE *PictCreate(WORD ID, SHORT left, SHORT top, SHORT right, SHORT bottom,
 ********************************************************************/
 WORD PictTranslateMsg(PICTURE *pPict, GOL_MSG *pMsg)
 {
+    (void)pMsg;                         // Only looked at with USE_TOUCHSCREEN
+
 	// Evaluate if the message is for the picture
     // Check if disabled first
 	if ( GetState(pPict,PICT_DISABLED) )
@@ -139,14 +141,14 @@ static SHORT postop;
 static SHORT posright;
 static SHORT posbottom;
 
-    if(IsDeviceBusy())
+    if(GOLDrawBusy())
         return 0;
 
     switch(state){
 
         case REMOVE:
             if(GetState(pPict,PICT_HIDE)){
-                if(IsDeviceBusy())
+                if(GOLDrawBusy())
                     return 0;
                 SetColor(pPict->pGolScheme->CommonBkColor);
                 Bar(pPict->left,pPict->top,pPict->right,pPict->bottom);
@@ -157,43 +159,49 @@ static SHORT posbottom;
             posright = (pPict->right+pPict->left+pPict->scale*GetImageWidth(pPict->pBitmap))>>1;
             posbottom = (pPict->bottom+pPict->top+pPict->scale*GetImageHeight(pPict->pBitmap))>>1;
             state = DRAW_IMAGE;
+            // fall through
 
         case DRAW_IMAGE:
             if(pPict->pBitmap != NULL){
-                if(IsDeviceBusy())
+                if(GOLDrawBusy())
                     return 0;
                 PutImage( posleft, postop,pPict->pBitmap, pPict->scale); 
             }
             SetColor(pPict->pGolScheme->CommonBkColor);
             state = DRAW_BACKGROUND1;
+            // fall through
 
         case DRAW_BACKGROUND1:
-            if(IsDeviceBusy())
+            if(GOLDrawBusy())
                 return 0;
             Bar(pPict->left+1, pPict->top+1, pPict->right-1, postop-1);
             state = DRAW_BACKGROUND2;
+            // fall through
 
         case DRAW_BACKGROUND2:
-            if(IsDeviceBusy())
+            if(GOLDrawBusy())
                 return 0;
             Bar(pPict->left+1, posbottom, pPict->right-1, pPict->bottom-1);
             state = DRAW_BACKGROUND3;
+            // fall through
 
         case DRAW_BACKGROUND3:
-            if(IsDeviceBusy())
+            if(GOLDrawBusy())
                 return 0;
             Bar(pPict->left+1, postop, posleft-1, posbottom);
             state = DRAW_BACKGROUND4;
+            // fall through
 
         case DRAW_BACKGROUND4:
-            if(IsDeviceBusy())
+            if(GOLDrawBusy())
                 return 0;
             Bar(posright, postop, pPict->right-1, posbottom);
             state = DRAW_FRAME;
+            // fall through
 
         case DRAW_FRAME:
             if(GetState(pPict,PICT_FRAME)){
-                if(IsDeviceBusy())
+                if(GOLDrawBusy())
                     return 0; 
 		        SetLineType(SOLID_LINE);
 		        SetColor(pPict->pGolScheme->TextColor0);
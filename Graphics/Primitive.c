@@ -324,6 +324,7 @@ CHECK,
 				x1Cur = x1; y1Cur = y1; y1New = y1;
 				x2Cur = x2; y2Cur = y2; y2New = y2;
 	            state = CHECK;
+	            // fall through
 	
 	        case CHECK:
 arc_check_state:	        
@@ -527,7 +528,8 @@ arc_draw_width_height_state:
 *
 * Overview: draws line
 *
-* Note: none
+* Note: solid horizontal and vertical lines are drawn with Bar(), which
+*		the driver may implement
 *
 ********************************************************************/
 #ifndef USE_DRV_LINE
@@ -546,6 +548,13 @@ SHORT style, type;
         if(y1>y2){
             temp = y1; y1 = y2; y2 = temp;
         }
+        if(_lineType == SOLID_LINE){
+            if(_lineThickness)
+                Bar(x1-1,y1,x1+1,y2);
+            else
+                Bar(x1,y1,x1,y2);
+            return;
+        }
         style = 0; type =1;
         for(temp=y1; temp<y2+1; temp++){
             if((++style)==_lineType){
@@ -568,6 +577,13 @@ SHORT style, type;
         if(x1>x2){
             temp = x1; x1 = x2; x2 = temp;
         }
+        if(_lineType == SOLID_LINE){
+            if(_lineThickness)
+                Bar(x1,y1-1,x2,y1+1);
+            else
+                Bar(x1,y1,x2,y1);
+            return;
+        }
         style = 0; type =1;
         for(temp=x1; temp<x2+1; temp++){
             if((++style)==_lineType){
@@ -849,6 +865,7 @@ while(1){
 			xPos 	 = rad; yPos = 0;
 			xCur     = xPos; yCur = yPos; yNew = yPos;
             state    = CHECK;
+            // fall through
 
         case CHECK:
 bevel_fill_check:
@@ -867,6 +884,7 @@ bevel_fill_check:
 	    		err += 3+(yPos<<1);
 			yPos++;	
 			state = Q6TOQ3;
+			// fall through
 
         case Q6TOQ3:
 			if (xCur != xPos) {
@@ -907,6 +925,7 @@ bevel_fill_check:
 			    state = BEGIN;
 		    	return 1;
 		    }
+		    // fall through
 		case WAITFORDONE:
 			if (IsDeviceBusy())
 				return 0;
@@ -1146,7 +1165,7 @@ static BYTE start = 1;
 * Note: none
 *
 ********************************************************************/
-#ifndef USE_DRV_FONT
+#if !defined(USE_DRV_FONT) && !defined(USE_DRV_OUTCHAR)
 void OutChar(XCHAR ch){
 
 GLYPH_ENTRY* pChTable;
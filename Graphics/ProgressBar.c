@@ -91,7 +91,7 @@ PROGRESSBAR *PbCreate(WORD ID, SHORT left, SHORT top, SHORT right, SHORT bottom,
 {
 	PROGRESSBAR *pPb = NULL;
 	
-	pPb = malloc(sizeof(PROGRESSBAR));
+	pPb = GOLPoolAlloc(sizeof(PROGRESSBAR));
 	if (pPb == NULL)
 		return pPb;
 
@@ -186,14 +186,14 @@ static DWORD x1;
 DWORD        x2;
 static XCHAR  text[5] = {'0','%',0};
 
-    if(IsDeviceBusy())
+    if(GOLDrawBusy())
         return 0;
 
     switch(state){
 
         case REMOVE:
             if(GetState(pPb,PB_HIDE)){
-                if(IsDeviceBusy())
+                if(GOLDrawBusy())
                     return 0;
                 SetColor(pPb->hdr.pGolScheme->CommonBkColor);
                 Bar(	pPb->hdr.left,
@@ -226,7 +226,7 @@ static XCHAR  text[5] = {'0','%',0};
             state = BAR_DRAW;
                         
         case BAR_DRAW:
-            if(IsDeviceBusy())
+            if(GOLDrawBusy())
                 return 0;
 
             x1 = ((DWORD)pPb->pos)*(pPb->hdr.right-pPb->hdr.left-(2*GOL_EMBOSS_SIZE))/pPb->range;
@@ -250,7 +250,7 @@ static XCHAR  text[5] = {'0','%',0};
             state = TEXT_DRAW1;
 
         case TEXT_DRAW1:
-            if(IsDeviceBusy())
+            if(GOLDrawBusy())
                 return 0;
             SetColor(pPb->hdr.pGolScheme->Color1);
             Bar((pPb->hdr.left+pPb->hdr.right-GetTextWidth(text,pPb->hdr.pGolScheme->pFont))>>1,
@@ -261,7 +261,7 @@ static XCHAR  text[5] = {'0','%',0};
             state = TEXT_DRAW2;
 
         case TEXT_DRAW2:
-            if(IsDeviceBusy())
+            if(GOLDrawBusy())
                 return 0;
 
             SetColor(pPb->hdr.pGolScheme->Color0);
@@ -59,7 +59,7 @@ RADIOBUTTON *RbCreate(WORD ID, SHORT left, SHORT top, SHORT right, SHORT bottom,
 	RADIOBUTTON *pRb = NULL;
     RADIOBUTTON *pointer;
 	
-	pRb = malloc(sizeof(RADIOBUTTON));
+	pRb = GOLPoolAlloc(sizeof(RADIOBUTTON));
 	if (pRb == NULL)
 		return pRb;
 	
@@ -298,14 +298,14 @@ static DWORD_VAL  temp;
 
 WORD faceClr;
 
-    if(IsDeviceBusy())
+    if(GOLDrawBusy())
         return 0;
 
     switch(state){
 
         case REMOVE:
             if(GetState(pRb,(RB_HIDE|RB_DRAW))){
-                if(IsDeviceBusy())
+                if(GOLDrawBusy())
                     return 0;
                	SetColor(pRb->hdr.pGolScheme->CommonBkColor);
                 Bar(pRb->hdr.left,pRb->hdr.top,pRb->hdr.right,pRb->hdr.bottom);
@@ -402,7 +402,7 @@ rb_draw_check:
         case DRAW_FOC:
 
 	        if(GetState(pRb,RB_DRAW|RB_DRAW_FOCUS)){
-                if(IsDeviceBusy())
+                if(GOLDrawBusy())
                     return 0;
 
     	        if(GetState(pRb,RB_FOCUSED)){
@@ -61,7 +61,7 @@ ROUNDDIAL  *RdiaCreate(	WORD ID, SHORT x, SHORT y, SHORT radius,
 {
 	ROUNDDIAL *pDia = NULL;
 	
-	pDia = malloc(sizeof(ROUNDDIAL));
+	pDia = GOLPoolAlloc(sizeof(ROUNDDIAL));
 	if (pDia == NULL) 
 		return NULL;
 	
@@ -100,6 +100,7 @@ ROUNDDIAL  *RdiaCreate(	WORD ID, SHORT x, SHORT y, SHORT radius,
 ********************************************************************/
 void RdiaMsgDefault(WORD translatedMsg, ROUNDDIAL *pDia, GOL_MSG* pMsg) 
 {
+    (void)pMsg;
 
     switch(translatedMsg){
 
@@ -354,10 +355,10 @@ WORD faceClr;
 
         case REMOVE:
 
-            if(IsDeviceBusy())
+            if(GOLDrawBusy())
                 return 0;  
 
-	        if (GetState(pDia,RDIA_HIDE)) {  				      // Hide the dial (remove from screen)
+            if (GetState(pDia,RDIA_HIDE)) {  				      // Hide the dial (remove from screen)
        	        SetColor(pDia->pGolScheme->CommonBkColor);
        	        Bar(pDia->xCenter-pDia->radius, pDia->yCenter-pDia->radius, 
        	        	pDia->xCenter+pDia->radius, pDia->yCenter+pDia->radius);
@@ -371,6 +372,7 @@ WORD faceClr;
 		    	goto erase_current_pos;
 		    }
 	        state = RND_PANEL_DRAW;
+	        // fall through
 
         case RND_PANEL_DRAW:
             if(!GetState(pDia,RDIA_DISABLED)){
@@ -382,6 +384,7 @@ WORD faceClr;
 			 			 pDia->radius, faceClr, pDia->pGolScheme->EmbossLtColor,  
 						 pDia->pGolScheme->EmbossDkColor, NULL, GOL_EMBOSS_SIZE);
             state = RND_PANEL_TASK;	
+            // fall through
 
  		case RND_PANEL_TASK:
             if(!GOLPanelDrawTsk()){
@@ -392,7 +395,7 @@ WORD faceClr;
 
 		case ERASE_POSITION:			
 erase_current_pos:
-			if(IsDeviceBusy())
+			if(GOLDrawBusy())
                 return 0;  			
 
 			SetColor(pDia->pGolScheme->Color0);
@@ -439,10 +442,11 @@ erase_current_pos:
 			ClrState(pDia, RDIA_ROT_CW|RDIA_ROT_CCW);				// make sure this is cleared to avoid
 																	// unwanted redraw
 			state = DRAW_POSITION;
+			// fall through
 
 		case DRAW_POSITION:			
 draw_current_pos:
-			if(IsDeviceBusy())
+			if(GOLDrawBusy())
                 return 0;  			
 		
 			SetColor(pDia->pGolScheme->EmbossLtColor);
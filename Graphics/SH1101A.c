@@ -40,6 +40,7 @@
  * Paolo Tamayo			12/20/07	Ported to PIC24 Kit
  *****************************************************************************/
 #include "Graphics\Graphics.h"
+#include "Profile.h"
 
 // Color
 BYTE    _color;
@@ -51,6 +52,19 @@ SHORT _clipTop;
 SHORT _clipRight;
 SHORT _clipBottom;
 
+// RAM copy of the display, one byte per column of each page
+static BYTE _displayBuffer[DISP_PAGES][DISP_COLUMNS];
+// Columns of each page not yet sent to the controller, none if left > right
+static BYTE _dirtyLeft[DISP_PAGES];
+static BYTE _dirtyRight[DISP_PAGES];
+// Display RAM row shown on the top line of the screen
+static BYTE _scrollLine;
+// Set when _scrollLine has not been sent to the controller yet
+static BYTE _scrollPending;
+
+// Display RAM row that holds row y of the screen
+#define DISP_LINE(y)	(((y) + _scrollLine) & (SCREEN_VER_SIZE-1))
+
 /////////////////////// LOCAL FUNCTIONS PROTOTYPES ////////////////////////////
 void PutImage1BPP(SHORT left, SHORT top, FLASH_BYTE* bitmap, BYTE stretch);
 void PutImage1BPPExt(SHORT left, SHORT top, void* bitmap, BYTE stretch);
@@ -99,6 +113,7 @@ unsigned delay;
 *
 ********************************************************************/
 void ResetDevice(void){
+BYTE page;
 
     // Set reset pin as output
     RST_TRIS_BIT = 0;
@@ -187,6 +202,14 @@ void ResetDevice(void){
 
 	// Display Start Line
 	WriteCommand(0x40);			// Set display start line
+	_scrollLine = 0;
+	_scrollPending = 0;
+
+	// Nothing to flush yet, the clean span FlushDisplay() leaves
+	for(page=0; page<DISP_PAGES; page++) {
+		_dirtyLeft[page] = DISP_COLUMNS;
+		_dirtyRight[page] = 0;
+	}
 
 	// Lower Column Address
 	WriteCommand(0x00+OFFSET);	// Set lower column address
@@ -198,6 +221,29 @@ void ResetDevice(void){
 }
 
 
+/*********************************************************************
+* Function: static void MarkDirty(BYTE page, BYTE left, BYTE right)
+*
+* PreCondition: none
+*
+* Input: page - display RAM page, left,right - columns that changed
+*
+* Output: none
+*
+* Side Effects: none
+*
+* Overview: widens the span of a page FlushDisplay() has to send
+*
+* Note: none
+*
+********************************************************************/
+static void MarkDirty(BYTE page, BYTE left, BYTE right){
+	if(left < _dirtyLeft[page])
+		_dirtyLeft[page] = left;
+	if(right > _dirtyRight[page])
+		_dirtyRight[page] = right;
+}
+
 /*********************************************************************
 * Function: void PutPixel(SHORT x, SHORT y)
 *
@@ -211,12 +257,11 @@ void ResetDevice(void){
 *
 * Overview: puts pixel
 *
-* Note: none
+* Note: only the RAM copy changes, FlushDisplay() sends it
 *
 ********************************************************************/
 void PutPixel(SHORT x, SHORT y) {
-BYTE page, add, lAddr, hAddr;
-BYTE mask, display;
+BYTE page, line, column, mask, display;
 
 	// check if point is in clipping region
     if(_clipRgn){
@@ -229,43 +274,24 @@ BYTE mask, display;
         if(y>_clipBottom)
             return;
     }
+	if((WORD)x >= SCREEN_HOR_SIZE || (WORD)y >= SCREEN_VER_SIZE)
+		return;
 
-	// Assign a page address
-    	 if(y < 8)  page = 0xB0;
-	else if(y < 16) page = 0xB1;
-	else if(y < 24) page = 0xB2;
-	else if(y < 32) page = 0xB3;
-	else if(y < 40) page = 0xB4;
-	else if(y < 48) page = 0xB5;
-	else if(y < 56) page = 0xB6;
-	else            page = 0xB7;
-
-	add = x+OFFSET;
-	lAddr = 0x0F & add;				// Low address
-	hAddr = 0x10 | (add >> 4);		// High address
-
-	// Calculate mask from rows basically do a y%8 and remainder is bit position
-	add = y>>3;						// Divide by 8
-	add <<= 3;						// Multiply by 8
-	add = y - add;					// Calculate bit position
-	mask = 1 << add;				// Left shift 1 by bit position
-
-	SetAddress(page, lAddr, hAddr);	// Set the address (sets the page, 
-									// lower and higher column address pointers)
-
-	ReadData(display);				// Read to initiate Read transaction on PMP
-	ReadData(display);				// Dummy Read (requirement for data synchronization in the controller)
-	ReadData(display);				// Read data from display buffer
+	line = DISP_LINE(y);
+	page = line >> 3;				// 8 rows per page
+	column = x + OFFSET;
+	mask = 1 << (line & 0x07);		// Bit of the row within the page
 
+	display = _displayBuffer[page][column];
 	if(_color > 0)					// If non-zero for pixel on
 		display |= mask;			// or in mask
 	else							// If 0 for pixel off
 		display &= ~mask;			// and with inverted mask
-		
-	WriteCommand(lAddr);			// Set column address low
-	WriteCommand(hAddr);			// Set column address high
 
-	WriteData(display);				// restore the byte with manipulated bit
+	if(display != _displayBuffer[page][column]){
+		_displayBuffer[page][column] = display;
+		MarkDirty(page, column, column);
+	}
 }
 
 /*********************************************************************
@@ -281,12 +307,10 @@ BYTE mask, display;
 *
 * Overview: return pixel color at x,y position
 *
-* Note: none
+* Note: read from the RAM copy, no controller access
 *
 ********************************************************************/
 BYTE GetPixel(SHORT x, SHORT y){
-BYTE page, add, lAddr, hAddr;
-BYTE mask, temp, display;
 
 	// check if point is in clipping region
     if(_clipRgn){
@@ -299,34 +323,53 @@ BYTE mask, temp, display;
         if(y>_clipBottom)
             return 0;
     }
+	if((WORD)x >= SCREEN_HOR_SIZE || (WORD)y >= SCREEN_VER_SIZE)
+		return 0;
 
-	// Assign a page address
-    	 if(y < 8)  page = 0xB0;
-	else if(y < 16) page = 0xB1;
-	else if(y < 24) page = 0xB2;
-	else if(y < 32) page = 0xB3;
-	else if(y < 40) page = 0xB4;
-	else if(y < 48) page = 0xB5;
-	else if(y < 56) page = 0xB6;
-	else            page = 0xB7;
-
-	add = x+OFFSET;
-	lAddr = 0x0F & add;				// Low address
-	hAddr = 0x10 | (add >> 4);		// High address
-
-	// Calculate mask from rows basically do a y%8 and remainder is bit position
-	temp = y>>3;					// Divide by 8
-	temp <<= 3;						// Multiply by 8
-	temp = y - temp;				// Calculate bit position
-	mask = 1 << temp;				// Left shift 1 by bit position
-
-	SetAddress(page, lAddr, hAddr);	// Set the address (sets the page, 
-									// lower and higher column address pointers)
-	ReadData(display);				// Read to initiate Read transaction on PMP
-	ReadData(display);				// Dummy Read (requirement for data synchronization in the controller)
-	ReadData(display);				// Read data from display buffer
-
-	return (display & mask);		// mask all other bits and return the result	
+	y = DISP_LINE(y);
+	return _displayBuffer[y >> 3][x + OFFSET] & (1 << (y & 0x07));
+}
+
+/*********************************************************************
+* Function: void FlushDisplay(void)
+*
+* PreCondition: none
+*
+* Input: none
+*
+* Output: none
+*
+* Side Effects: none
+*
+* Overview: sends the changed span of every page to the controller
+*
+* Note: one address set and one write per changed column, the
+*		controller advances the column itself. A new display start
+*		line from ScrollDisplay() is sent after the data.
+*
+********************************************************************/
+void FlushDisplay(void){
+BYTE page, column, right;
+
+	for(page=0; page<DISP_PAGES; page++) {
+		column = _dirtyLeft[page];
+		right = _dirtyRight[page];
+		if(column > right)
+			continue;
+
+		SetAddress(0xB0 + page, 0x0F & column, 0x10 | (column >> 4));
+		do {
+			WriteData(_displayBuffer[page][column]);
+		} while(column++ < right);
+
+		_dirtyLeft[page] = DISP_COLUMNS;
+		_dirtyRight[page] = 0;
+	}
+
+	if(_scrollPending) {
+		WriteCommand(0x40 | _scrollLine);
+		_scrollPending = 0;
+	}
 }
 
 /*********************************************************************
@@ -342,20 +385,393 @@ BYTE mask, temp, display;
 *
 * Overview: clears screen with current color 
 *
-* Note: none
+* Note: the whole display is sent by the next FlushDisplay()
 *
 ********************************************************************/
 void ClearDevice(void){
 	BYTE i,j;
 
-	for(i=0xB0;i<0xB8;i++) {			// Go through all 8 pages
-		SetAddress(i,0x00,0x10);
-		for(j=0;j<132;j++) {			// Write to all 132 bytes
-			WriteData(_color);			
+	PROFILE_BEGIN(PROFILE_CLEAR_DEVICE);
+	for(i=0;i<DISP_PAGES;i++) {			// Go through all 8 pages
+		for(j=0;j<DISP_COLUMNS;j++) {	// Fill all 132 bytes
+			_displayBuffer[i][j] = _color;
 		}
+		MarkDirty(i, 0, DISP_COLUMNS-1);
 	}
+	PROFILE_END(PROFILE_CLEAR_DEVICE);
+}
+
+/*********************************************************************
+* Function: static void FillLines(SHORT left, SHORT top, SHORT right, SHORT bottom)
+*
+* PreCondition: none
+*
+* Input: left,right - first and last screen column,
+*        top,bottom - first and last display RAM row
+*
+* Output: none
+*
+* Side Effects: none
+*
+* Overview: fills a rectangle of the RAM copy with the current color
+*
+* Note: rows within a page are set or cleared together through a mask,
+*		the top and bottom pages are masked to the rows of the rectangle
+*
+********************************************************************/
+static void FillLines(SHORT left, SHORT top, SHORT right, SHORT bottom){
+BYTE page, lastPage, column, lastColumn, first, last;
+BYTE mask, display;
+
+	lastPage = bottom >> 3;
+	lastColumn = right + OFFSET;
+	for(page = top >> 3; page <= lastPage; page++) {
+		mask = 0xFF;
+		if(page == (top >> 3))
+			mask &= 0xFF << (top & 0x07);
+		if(page == lastPage)
+			mask &= 0xFF >> (7 - (bottom & 0x07));
+
+		first = DISP_COLUMNS;
+		last = 0;
+		for(column = left + OFFSET; column <= lastColumn; column++) {
+			display = _displayBuffer[page][column];
+			if(_color > 0)
+				display |= mask;
+			else
+				display &= ~mask;
+			if(display != _displayBuffer[page][column]) {
+				_displayBuffer[page][column] = display;
+				if(first == DISP_COLUMNS)
+					first = column;
+				last = column;
+			}
+		}
+		if(first <= last)
+			MarkDirty(page, first, last);
+	}
+}
+
+/*********************************************************************
+* Function: static void FillRegion(SHORT left, SHORT top, SHORT right, SHORT bottom)
+*
+* PreCondition: none
+*
+* Input: left,top - top left corner coordinates,
+*        right,bottom - bottom right corner coordinates
+*
+* Output: none
+*
+* Side Effects: none
+*
+* Overview: fills a rectangle of the screen with the current color
+*
+* Note: with the display scrolled the rows of the rectangle may wrap
+*		around the end of display RAM, the two parts are filled apart
+*
+********************************************************************/
+static void FillRegion(SHORT left, SHORT top, SHORT right, SHORT bottom){
+
+	if(left < 0)
+		left = 0;
+	if(top < 0)
+		top = 0;
+	if(right > GetMaxX())
+		right = GetMaxX();
+	if(bottom > GetMaxY())
+		bottom = GetMaxY();
+	if(left > right || top > bottom)
+		return;
+
+	top = DISP_LINE(top);
+	bottom = DISP_LINE(bottom);
+	if(top <= bottom) {
+		FillLines(left, top, right, bottom);
+	} else {
+		FillLines(left, top, right, SCREEN_VER_SIZE-1);
+		FillLines(left, 0, right, bottom);
+	}
+}
+
+/*********************************************************************
+* Function: void ScrollDisplay(SHORT lines)
+*
+* PreCondition: none
+*
+* Input: lines - rows to move the picture up by, down if negative
+*
+* Output: none
+*
+* Side Effects: none
+*
+* Overview: scrolls the screen by moving the display start line
+*
+* Note: display RAM is not moved, so only the rows scrolled in are
+*		filled with the current color and sent by the next flush
+*
+********************************************************************/
+void ScrollDisplay(SHORT lines){
+
+	lines %= SCREEN_VER_SIZE;
+	if(lines == 0)
+		return;
+
+	_scrollLine = DISP_LINE(lines);
+	_scrollPending = 1;
+	if(lines > 0)
+		FillRegion(0, SCREEN_VER_SIZE - lines, GetMaxX(), GetMaxY());
+	else
+		FillRegion(0, 0, GetMaxX(), -lines - 1);
 }
 
+/*********************************************************************
+* Function: void Bar(SHORT left, SHORT top, SHORT right, SHORT bottom)
+*
+* PreCondition: none
+*
+* Input: left,top - top left corner coordinates,
+*        right,bottom - bottom right corner coordinates
+*
+* Output: none
+*
+* Side Effects: none
+*
+* Overview: draws rectangle filled with current color
+*
+* Note: same pixels as the PutPixel() loop in Primitive.c
+*
+********************************************************************/
+#ifdef USE_DRV_BAR
+void Bar(SHORT left, SHORT top, SHORT right, SHORT bottom){
+
+	// trim to the clipping region
+    if(_clipRgn){
+        if(left<_clipLeft)
+            left = _clipLeft;
+        if(right>_clipRight)
+            right = _clipRight;
+        if(top<_clipTop)
+            top = _clipTop;
+        if(bottom>_clipBottom)
+            bottom = _clipBottom;
+    }
+
+	FillRegion(left, top, right, bottom);
+}
+#endif
+
+/*********************************************************************
+* Function: void ClearRegion(SHORT left, SHORT top, SHORT right, SHORT bottom)
+*
+* PreCondition: none
+*
+* Input: left,top - top left corner coordinates,
+*        right,bottom - bottom right corner coordinates
+*
+* Output: none
+*
+* Side Effects: none
+*
+* Overview: fills a rectangle with current color, ignoring the clipping
+*			region
+*
+* Note: none
+*
+********************************************************************/
+void ClearRegion(SHORT left, SHORT top, SHORT right, SHORT bottom){
+	FillRegion(left, top, right, bottom);
+}
+
+/*********************************************************************
+* Function: static void TransposeBlock(BYTE* rows, BYTE* columns)
+*
+* PreCondition: none
+*
+* Input: rows - 8 rows of 8 pixels, bit 7 the leftmost pixel,
+*        columns - buffer for the 8 columns
+*
+* Output: none
+*
+* Side Effects: none
+*
+* Overview: turns 8 glyph rows into 8 display columns, leftmost column
+*			first, with bit 0 of each column taken from rows[0]
+*
+* Note: three rounds of swapping bit fields inside two 32 bit words,
+*		from Hacker's Delight, 7-3
+*
+********************************************************************/
+static void TransposeBlock(BYTE* rows, BYTE* columns){
+DWORD hi, lo, t;
+
+	hi = ((DWORD)rows[7]<<24) | ((DWORD)rows[6]<<16) | ((WORD)rows[5]<<8) | rows[4];
+	lo = ((DWORD)rows[3]<<24) | ((DWORD)rows[2]<<16) | ((WORD)rows[1]<<8) | rows[0];
+
+	t = (hi ^ (hi >> 7)) & 0x00AA00AAUL;	hi = hi ^ t ^ (t << 7);
+	t = (lo ^ (lo >> 7)) & 0x00AA00AAUL;	lo = lo ^ t ^ (t << 7);
+	t = (hi ^ (hi >> 14)) & 0x0000CCCCUL;	hi = hi ^ t ^ (t << 14);
+	t = (lo ^ (lo >> 14)) & 0x0000CCCCUL;	lo = lo ^ t ^ (t << 14);
+	t = (hi & 0xF0F0F0F0UL) | ((lo >> 4) & 0x0F0F0F0FUL);
+	lo = ((hi << 4) & 0xF0F0F0F0UL) | (lo & 0x0F0F0F0FUL);
+	hi = t;
+
+	columns[0] = hi >> 24;	columns[1] = hi >> 16;
+	columns[2] = hi >> 8;	columns[3] = hi;
+	columns[4] = lo >> 24;	columns[5] = lo >> 16;
+	columns[6] = lo >> 8;	columns[7] = lo;
+}
+
+/*********************************************************************
+* Function: void OutChar(XCHAR ch)
+*
+* PreCondition: none
+*
+* Input: character code
+*
+* Output: none
+*
+* Side Effects: none
+*
+* Overview: outputs a character
+*
+* Note: the glyph is stored a row at a time, the display a column of
+*		8 rows at a time. Each page of the glyph is taken 8 columns
+*		at a time, the rows that fall in the page are transposed into
+*		column bytes and each is set or cleared in a single write.
+*		Only the part of the glyph inside the screen and clipping
+*		region is drawn.
+*
+********************************************************************/
+#if defined(USE_DRV_FONT) || defined(USE_DRV_OUTCHAR)
+void OutChar(XCHAR ch){
+
+GLYPH_ENTRY* pChTable;
+BYTE*        pChImage = NULL;
+
+#ifdef USE_FONT_EXTERNAL
+GLYPH_ENTRY  chTable;
+BYTE         chImage[EXTERNAL_FONT_BUFFER_SIZE];
+WORD         imageSize;
+DWORD_VAL    glyphOffset;
+#endif
+
+SHORT        chWidth = 0, rowBytes;
+SHORT        left, top, xFirst, xLast, yFirst, yLast, yStart, yEnd;
+SHORT        line;
+SHORT        x, y, xBlock;
+BYTE*        pRow;
+BYTE         rows[8], columns[8];
+BYTE         page, column, first, last, i;
+BYTE         display;
+
+    if((unsigned XCHAR)ch<(unsigned XCHAR)_fontFirstChar)
+        return;
+    if((unsigned XCHAR)ch>(unsigned XCHAR)_fontLastChar)
+        return;
+
+    switch(*((SHORT*)_font)){
+#ifdef USE_FONT_FLASH
+        case FLASH:
+            pChTable = (GLYPH_ENTRY*)( ((FONT_FLASH*)_font)->address+sizeof(FONT_HEADER) ) + ((unsigned XCHAR)ch-(unsigned XCHAR)_fontFirstChar);
+            pChImage = (BYTE*)( ((FONT_FLASH*)_font)->address + pChTable->offsetLSB );
+            chWidth = pChTable->width;
+            break;
+#endif
+#ifdef USE_FONT_EXTERNAL
+        case EXTERNAL:
+            ExternalMemoryCallback(_font,
+                                   sizeof(FONT_HEADER)+((unsigned XCHAR)ch-(unsigned XCHAR)_fontFirstChar)*sizeof(GLYPH_ENTRY),
+                                   sizeof(GLYPH_ENTRY),
+                                   &chTable);
+            chWidth = chTable.width;
+            imageSize = ((chWidth+7)>>3)*_fontHeight;
+			glyphOffset.w[1] = chTable.offsetMSB;
+			glyphOffset.w[0] = chTable.offsetLSB;
+            ExternalMemoryCallback(_font,
+                                   glyphOffset.Val,
+                                   imageSize,
+                                   &chImage);
+            pChImage = (BYTE*)&chImage;
+            break;
+#endif
+        default:
+            break;
+    }
+
+    left = GetX();
+    top = GetY();
+    // move cursor
+    _cursorX = left + chWidth;
+
+    // visible part of the glyph
+    xFirst = left;
+    xLast = left + chWidth - 1;
+    yFirst = top;
+    yLast = top + _fontHeight - 1;
+    if(_clipRgn){
+        if(xFirst<_clipLeft)
+            xFirst = _clipLeft;
+        if(xLast>_clipRight)
+            xLast = _clipRight;
+        if(yFirst<_clipTop)
+            yFirst = _clipTop;
+        if(yLast>_clipBottom)
+            yLast = _clipBottom;
+    }
+    if(xFirst < 0)
+        xFirst = 0;
+    if(xLast > GetMaxX())
+        xLast = GetMaxX();
+    if(yFirst < 0)
+        yFirst = 0;
+    if(yLast > GetMaxY())
+        yLast = GetMaxY();
+    if(xFirst > xLast || yFirst > yLast)
+        return;
+
+    rowBytes = (chWidth+7)>>3;
+    for(yStart = yFirst; yStart <= yLast; yStart = yEnd + 1) {
+        // rows of the glyph that fall in one page of display RAM
+        line = DISP_LINE(yStart);
+        page = line >> 3;
+        yEnd = yStart + 7 - (line & 0x07);
+        if(yEnd > yLast)
+            yEnd = yLast;
+
+        first = DISP_COLUMNS;
+        last = 0;
+        for(xBlock = (xFirst-left) & ~0x07; left + xBlock <= xLast; xBlock += 8) {
+            for(i = 0; i < 8; i++)
+                rows[i] = 0;
+            pRow = pChImage + (yStart-top)*rowBytes + (xBlock>>3);
+            for(y = yStart; y <= yEnd; y++, pRow += rowBytes)
+                rows[DISP_LINE(y) & 0x07] = *pRow;
+            TransposeBlock(rows, columns);
+
+            for(i = 0, x = left + xBlock; i < 8; i++, x++) {
+                if(x < xFirst || x > xLast || columns[i] == 0)
+                    continue;
+
+                column = x + OFFSET;
+                display = _displayBuffer[page][column];
+                if(_color > 0)
+                    display |= columns[i];
+                else
+                    display &= ~columns[i];
+                if(display != _displayBuffer[page][column]) {
+                    _displayBuffer[page][column] = display;
+                    if(first == DISP_COLUMNS)
+                        first = column;
+                    last = column;
+                }
+            }
+        }
+        if(first <= last)
+            MarkDirty(page, first, last);
+    }
+}
+#endif
+
 /*********************************************************************
 * Function: void PutImage(SHORT left, SHORT top, void* bitmap, BYTE stretch)
 *
@@ -426,7 +842,6 @@ BYTE colorTemp;
 *
 ********************************************************************/
 void PutImage1BPP(SHORT left, SHORT top, FLASH_BYTE* bitmap, BYTE stretch){
-register WORD_VAL address;
 register FLASH_BYTE* flashAddress;
 
 register BYTE pos, temp;
@@ -434,23 +849,20 @@ register BYTE pos, temp;
 WORD sizeX, sizeY;
 WORD x,y;
 //BYTE stretchX,stretchY;
-WORD pallete[2];
+
+    (void)stretch;                      // Images are drawn 1:1
 
     // Move pointer to size information
     flashAddress = bitmap + 2;
 
-    // Set start address
-    address.Val = (LINE_MEM_PITCH*left) + top;
-
     // Read image size
     sizeY = *((FLASH_WORD*)flashAddress);
     flashAddress += 2;
     sizeX = *((FLASH_WORD*)flashAddress);
     flashAddress += 2;
-    pallete[0] = *((FLASH_WORD*)flashAddress);
-    flashAddress += 2;
-    pallete[1] = *((FLASH_WORD*)flashAddress);
-    flashAddress += 2;
+
+    // Skip the palette, set bits are drawn black and clear bits white
+    flashAddress += 4;
 
 
 	for (y=0; y<sizeY;y++) {
@@ -48,6 +48,7 @@ SHORT SldSetThumbSize(SLIDER *pSld, SHORT high, SHORT low);
 void SldGetMinMaxPos(SLIDER *pSld, WORD *minPos, WORD *maxPos);
 WORD SldGetWidth(SLIDER *pSld);
 WORD SldGetHeight(SLIDER *pSld);
+void SldRedrawThumb(SLIDER *pSld, WORD pos);
 
 /*********************************************************************
 * Function: SLIDER *SldCreate(WORD ID, SHORT left, SHORT top, SHORT right, 
@@ -64,7 +65,7 @@ SLIDER *SldCreate(WORD ID, SHORT left, SHORT top, SHORT right, SHORT bottom,
 {
 	SLIDER *pSld = NULL;
 	
-	pSld = malloc(sizeof(SLIDER));
+	pSld = GOLPoolAlloc(sizeof(SLIDER));
 	if (pSld == NULL)
 		return pSld;
 	
@@ -90,6 +91,10 @@ SLIDER *SldCreate(WORD ID, SHORT left, SHORT top, SHORT right, SHORT bottom,
 	pSld->thWidth = SldGetWidth(pSld);	
 	pSld->thHeight = SldGetHeight(pSld);	
 
+	// the thumb is placed when the slider is first drawn
+	pSld->currPos = 0;
+	pSld->prevPos = 0;
+
 	// Set the color scheme to be used
 	if (pScheme == NULL)
 		pSld->pGolScheme = _pDefaultGolScheme;          // use default scheme
@@ -323,8 +328,9 @@ void SldSetPage(SLIDER *pSld, WORD newPage)
 *
 * Notes: Sets the thumb to the new position. Checking is first 
 *        preformed if the new position is within the range (0 to range)
-*        of the slider. Object must be redrawn after this function is called to 
-*        reflect the changes to the object.
+*        of the slider. If the slider is on the screen, the areas the
+*        thumb leaves and moves to are added to the damage, so the
+*        next GOLDraw() redraws only them.
 *
 ********************************************************************/
 void SldSetPos(SLIDER *pSld, SHORT newPos)
@@ -390,6 +396,38 @@ void SldSetPos(SLIDER *pSld, SHORT newPos)
 		pSld->currPos = dTemp.w[1] + minPos;
 	}	
 #endif // ifndef SLD_INVERT_VERTICAL
+
+	// prevPos is where the thumb is on the screen
+	// and SLD_DRAW_THUMB already moves it from there
+	if (!GetState(pSld, SLD_DRAW|SLD_DRAW_THUMB|SLD_HIDE) && (pSld->currPos != pSld->prevPos)) {
+		SldRedrawThumb(pSld, pSld->prevPos);
+		SldRedrawThumb(pSld, pSld->currPos);
+	}
+}
+
+/*********************************************************************
+* Function: void SldRedrawThumb(SLIDER *pSld, WORD pos)
+*
+* Notes: An INTERNAL function that adds the area of the thumb at the
+*        given position in the coordinate domain to the damage, see
+*        GOLRedrawRec(). The area matches what SldDraw() clears and
+*        draws for the thumb.
+*
+********************************************************************/
+void SldRedrawThumb(SLIDER *pSld, WORD pos)
+{
+	WORD midPoint;
+
+	if (GetState(pSld, SLD_VERTICAL)) {
+		midPoint = (pSld->left + pSld->right)>>1;
+		GOLRedrawRec(midPoint-pSld->thWidth, pos-pSld->thHeight,
+					 midPoint+pSld->thWidth, pos+pSld->thHeight);
+	}
+	else {
+		midPoint = (pSld->top + pSld->bottom)>>1;
+		GOLRedrawRec(pos-pSld->thWidth, midPoint-pSld->thHeight,
+					 pos+pSld->thWidth, midPoint+pSld->thHeight);
+	}
 }
 
 /*********************************************************************
@@ -582,7 +620,7 @@ static WORD midPoint, thWidth, thHeight;
 static WORD minPos, maxPos;
 
 	
-    if(IsDeviceBusy())
+    if(GOLDrawBusy())
         return 0;
 
     switch(state){
@@ -635,6 +673,7 @@ static WORD minPos, maxPos;
 	           	state = SLD_STATE_CLEARTHUMB;					// go to thumb drawing 
                	goto sld_state_clearthumb;
             }
+            // fall through
 
 	    case SLD_STATE_PANEL:
 
@@ -646,6 +685,7 @@ static WORD minPos, maxPos;
 	        } else {
 	        	state = SLD_STATE_THUMBPATH1;					// slider: draw thumb path next
 	        }
+	        // fall through
         
 	    case SLD_STATE_THUMBPATH1:
 
@@ -658,10 +698,11 @@ static WORD minPos, maxPos;
 			}
 			
 	        state = SLD_STATE_THUMBPATH2;
+	        // fall through
 
 	    case SLD_STATE_THUMBPATH2:
 
-            if(IsDeviceBusy())
+            if(GOLDrawBusy())
    	            return 0;    
 
 			SetColor(WHITE);    								// draw the white line
@@ -678,12 +719,13 @@ static WORD minPos, maxPos;
             }	
 	        else 												// if just drawing the thumb
 	        	state = SLD_STATE_CLEARTHUMB;					// go to state to remove current position
+	        	// fall through
 
 	        
 	    case SLD_STATE_CLEARTHUMB:								// this removes the current thumb 
 
 sld_state_clearthumb:
-            if(IsDeviceBusy())
+            if(GOLDrawBusy())
    	            return 0;    
    	            
 			if (!GetState(pSld, SLD_DRAW_THUMB)) {				// SLD_DRAW_THUMB is only set when
@@ -708,10 +750,11 @@ sld_state_clearthumb:
 		        state = SLD_STATE_THUMB;					    // go directly to thumb drawing 
 	        	goto sld_state_thumb;							// thumb path is not drawn in scrollbar
 		    }
+		    // fall through
 
 		case SLD_STATE_REDRAWPATH1:								// redraws the lines that it covered
 
-            if(IsDeviceBusy())
+            if(GOLDrawBusy())
                 return 0;  
 
 			SetColor(BLACK);									// redraw the black line first
@@ -740,10 +783,11 @@ sld_state_clearthumb:
 	    		Line(midPoint, top, midPoint, bottom);
 	    	}
             state = SLD_STATE_REDRAWPATH2;
+            // fall through
 
         case SLD_STATE_REDRAWPATH2:
         
-            if(IsDeviceBusy())
+            if(GOLDrawBusy())
                 return 0;    
 			SetColor(WHITE);									// redraw the white line next
     		if (!GetState(pSld, SLD_VERTICAL))
@@ -751,12 +795,13 @@ sld_state_clearthumb:
     		else	
     			Line(midPoint+1, top, midPoint+1, bottom);
             state = SLD_STATE_THUMB;
+            // fall through
 				
         case SLD_STATE_THUMB:
 sld_state_thumb:        
-            if(IsDeviceBusy())
+            if(GOLDrawBusy())
                 return 0;    
-    		if (!GetState(pSld, SLD_VERTICAL)) {				// Draw the slider thumb based on the 
+            if (!GetState(pSld, SLD_VERTICAL)) {				// Draw the slider thumb based on the 
 	    														// current position
 	    		left   = pSld->currPos-thWidth;
 	    		top    = midPoint-thHeight;
@@ -778,6 +823,7 @@ sld_state_thumb:
    						 (GOL_EMBOSS_SIZE-1) ? GOL_EMBOSS_SIZE-1:1);
 
 	        state = SLD_STATE_THUMBPANEL;
+	        // fall through
 	    
 	    case SLD_STATE_THUMBPANEL:
 	    
@@ -796,6 +842,7 @@ sld_state_thumb:
     	   		return 1;
     	   	}	
           	state = SLD_STATE_FOCUS;
+          	// fall through
 
 	    case SLD_STATE_FOCUS:
 
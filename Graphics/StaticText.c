@@ -39,6 +39,7 @@
  * Paolo A. Tamayo		11/12/07	Version 1.0 release
 *****************************************************************************/
 #include "Graphics\Graphics.h"
+#include "Profile.h"
 
 #ifdef USE_STATICTEXT
 
@@ -56,7 +57,7 @@ STATICTEXT *StCreate(WORD ID, SHORT left, SHORT top, SHORT right, SHORT bottom,
 {
 	STATICTEXT *pSt = NULL;
 	
-	pSt = malloc(sizeof(STATICTEXT));
+	pSt = GOLPoolAlloc(sizeof(STATICTEXT));
 	if (pSt == NULL)
 		return pSt;
 	
@@ -107,6 +108,8 @@ void StSetText(STATICTEXT *pSt, XCHAR *pText)
 ********************************************************************/
 WORD StTranslateMsg(STATICTEXT *pSt, GOL_MSG *pMsg)
 {
+    (void)pMsg;                         // Only looked at with USE_TOUCHSCREEN
+
 	// Evaluate if the message is for the static text
     // Check if disabled first
 	if (GetState(pSt, ST_DISABLED))
@@ -129,12 +132,12 @@ WORD StTranslateMsg(STATICTEXT *pSt, GOL_MSG *pMsg)
 }
 
 /*********************************************************************
-* Function: WORD StDraw(STATICTEXT *pSt)
+* Function: static WORD StDrawState(STATICTEXT *pSt)
 *
 * Notes: This is the state machine to draw the static text.
 *
 ********************************************************************/
-WORD StDraw(STATICTEXT *pSt)
+static WORD StDrawState(STATICTEXT *pSt)
 {
 typedef enum {
 	ST_STATE_IDLE,
@@ -151,14 +154,14 @@ SHORT textWidth;
 XCHAR   ch = 0;
 
 
-    if(IsDeviceBusy())
+    if(GOLDrawBusy())
         return 0;
         
     switch(state){
 
         case ST_STATE_IDLE:
         
-            SetClip(CLIP_DISABLE);
+            GOLClearClipRgn();
 
            	if (GetState(pSt, ST_HIDE)) {
    	   	        SetColor(pSt->pGolScheme->CommonBkColor);
@@ -182,28 +185,29 @@ XCHAR   ch = 0;
     	        }
     	    }
     	    // set clipping area, text will only appear inside the static text area.    
-            SetClip(CLIP_ENABLE);
-            SetClipRgn(pSt->left+ST_INDENT, pSt->top,   		\
-                       pSt->right-ST_INDENT, pSt->bottom);    
+            GOLSetClipRgn(pSt->left+ST_INDENT, pSt->top,   		\
+                          pSt->right-ST_INDENT, pSt->bottom);    
             state = ST_STATE_CLEANAREA;
+            // fall through
 
         case ST_STATE_CLEANAREA:
         
-            if(IsDeviceBusy())
+            if(GOLDrawBusy())
                 return 0;
 
 			// clean area where text will be placed.
 			SetColor(pSt->pGolScheme->CommonBkColor);
     	    Bar(pSt->left+1,pSt->top + 2,pSt->right+1,pSt->bottom-1);
             state = ST_STATE_INIT;
+            // fall through
     	    
         case ST_STATE_INIT:
         
-            if(IsDeviceBusy())
+            if(GOLDrawBusy())
                 return 0;
 
 			// set the text color
-	        if(!GetState(pSt,ST_DISABLED)){
+            if(!GetState(pSt,ST_DISABLED)){
 	   	        SetColor(pSt->pGolScheme->TextColor0);
 	        }    
 	        else {
@@ -213,6 +217,7 @@ XCHAR   ch = 0;
 	        SetFont(pSt->pGolScheme->pFont);
 			pCurLine = pSt->pText;						// get first line of text
 			state = ST_STATE_SETALIGN;					// go to drawing of text
+			// fall through
 
         case ST_STATE_SETALIGN:
           
@@ -239,13 +244,14 @@ st_state_alignment:
 				}	
 			}	
 			state = ST_STATE_DRAWTEXT;
+			// fall through
 			
         case ST_STATE_DRAWTEXT:
 
 			ch = *(pCurLine + charCtr);
 			// output one character at time until a newline character or a NULL character is sampled
 		    while((0x0000 != ch) && (0x000A != ch )) {
-		        if(IsDeviceBusy()) {
+		        if(GOLDrawBusy()) {
 			        return 0;								// device is busy return 
 		        }	
 		        OutChar(ch);								// render the character
@@ -265,7 +271,7 @@ st_state_alignment:
 				pCurLine = NULL;							// reset static variables
 				lineCtr = 0;
 				charCtr = 0;
-	            SetClip(CLIP_DISABLE);						// remove clipping
+	            GOLClearClipRgn();							// remove clipping
 				state = ST_STATE_IDLE;						// go back to IDLE state
 				return 1;
 			}	
@@ -274,4 +280,20 @@ st_state_alignment:
     return 1;
 }
 
+/*********************************************************************
+* Function: WORD StDraw(STATICTEXT *pSt)
+*
+* Notes: Runs one step of StDrawState() under the StDraw probe.
+*
+********************************************************************/
+WORD StDraw(STATICTEXT *pSt)
+{
+WORD done;
+
+	PROFILE_BEGIN(PROFILE_ST_DRAW);
+	done = StDrawState(pSt);
+	PROFILE_END(PROFILE_ST_DRAW);
+	return done;
+}
+
 #endif // USE_STATICTEXT
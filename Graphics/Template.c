@@ -68,7 +68,7 @@ CUSTOM *CcCreate(WORD ID, SHORT left, SHORT top, SHORT right, SHORT bottom,
 {
 	CUSTOM *pCc = NULL;
 	
-	pCc = malloc(sizeof(CUSTOM));
+	pCc = GOLPoolAlloc(sizeof(CUSTOM));
 	if (pCc == NULL)
 		return pCc;
 
@@ -186,7 +186,7 @@ static CC_DRAW_STATES state = REMOVE;
 
         case REMOVE:
             if(GetState(pCc,CC_HIDE)){
-                if(IsDeviceBusy())
+                if(GOLDrawBusy())
                     return 0;
                 SetColor(pCc->pGolScheme->CommonBkColor);
                 Bar(pCc->left,pCc->top,pCc->right,pCc->bottom);
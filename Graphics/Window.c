@@ -55,7 +55,7 @@ WINDOW *WndCreate(WORD ID, SHORT left, SHORT top, SHORT right, SHORT bottom,
 {
 	WINDOW *pW;
 	
-	pW = malloc(sizeof(WINDOW));
+	pW = GOLPoolAlloc(sizeof(WINDOW));
 	if (pW == NULL)
 		return pW;
 
@@ -163,7 +163,7 @@ static WND_DRAW_STATES state = WND_REMOVE;
 
     while(1){
 
-        if(IsDeviceBusy())
+        if(GOLDrawBusy())
             return 0;
 
         switch(state){
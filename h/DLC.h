@@ -8,6 +8,11 @@
 #ifndef DLC_H
 #define	DLC_H
 
+#ifdef USE_PROFILING
+#define MENU_PAGES      4                   // Metronome, tuning, drum kit, diagnostics
+#else
+#define MENU_PAGES      3
+#endif
 
 void update_display( int pg );
 
@@ -36,7 +36,7 @@
 ************************************************************************/
 
 #ifndef	__G711_H__
-#define	__G711_H_
+#define	__G711_H__
 
 /************************************************************************
  Constants													
@@ -45,6 +45,17 @@
 #define BIAS 0x84   /* define the add-in bias for 16 bit samples */
 #define CLIP 32635
 
+/* Codec used behind the G711Alaw2Lin style names. G711_CODEC_ASM uses
+   the PIC24 routines in G711.s, G711_CODEC_C the tables in G711Codec.c.
+   Builds for anything other than the PIC24 always get the C codec.	*/
+#if !defined(G711_CODEC_ASM) && !defined(G711_CODEC_C)
+#define G711_CODEC_ASM
+#endif
+#if defined(G711_CODEC_ASM) && !defined(__C30__)
+#undef G711_CODEC_ASM
+#define G711_CODEC_C
+#endif
+
 /************************************************************************
  Function Prototypes													
  ************************************************************************/
@@ -53,4 +64,16 @@ extern void G711Ulaw2Lin(char* source, int *    destination, int size);
 extern void G711Lin2Alaw (int *   source, char * destination, int size);
 extern void G711Alaw2Lin(char* source, int *    destination, int size);
 
+extern void G711TblLin2Ulaw(int * source, char * destination, int size);
+extern void G711TblUlaw2Lin(char * source, int * destination, int size);
+extern void G711TblLin2Alaw(int * source, char * destination, int size);
+extern void G711TblAlaw2Lin(char * source, int * destination, int size);
+
+#ifdef G711_CODEC_C
+#define G711Lin2Ulaw	G711TblLin2Ulaw
+#define G711Ulaw2Lin	G711TblUlaw2Lin
+#define G711Lin2Alaw	G711TblLin2Alaw
+#define G711Alaw2Lin	G711TblAlaw2Lin
+#endif
+
 #endif
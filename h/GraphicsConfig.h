@@ -162,6 +162,43 @@
 #define USE_GRID                // Enable grid control.
 //#define USE_CUSTOM				// Enable Custom Control Object (an example to create customized Object).
 
+/*********************************************************************
+* Overview: Objects are created in fixed pools instead of the heap,
+*			see GOLPool.h. The sizes below set how much of each the
+*			application can have at the same time.
+*	- GOL_POOL_ITEMS - style schemes and list box items. The default
+*	  scheme takes one.
+*	- GOL_POOL_OBJECTS - objects of any enabled type.
+*	- GOL_POOL_ARENA_SIZE - bytes for grid cells, edit boxes and
+*	  anything else larger than the largest enabled object.
+*
+*********************************************************************/
+#define GOL_POOL_ITEMS			4
+#define GOL_POOL_OBJECTS		8
+#define GOL_POOL_ARENA_SIZE		128
+
+/*********************************************************************
+* Overview: GOLRedrawRec() and objects that know what part of them
+*			changed add rectangles to the damaged area of the screen.
+*			GOLDraw() redraws only the parts of the objects inside 
+*			it. GOL_DAMAGE_RECS rectangles are kept; a rectangle 
+*			added to a full list that overlaps none of them is 
+*			merged with the one that gives the smallest bounding 
+*			box.
+*
+*********************************************************************/
+#define GOL_DAMAGE_RECS			4
+
+/*********************************************************************
+* Overview: GOLFindObject() looks objects up by ID in an index of 
+*			GOL_ID_INDEX_SIZE slots instead of walking the active 
+*			list. It must be a power of two; IDs that differ only 
+*			above that are placed in the next free slot, so twice 
+*			the number of objects on a screen keeps searches short.
+*
+*********************************************************************/
+#define GOL_ID_INDEX_SIZE		16
+
 /*********************************************************************
 * Overview: To enable support for unicode fonts, USE_MULTIBYTECHAR  
 *			must be defined. This changes XCHAR definition. See XCHAR 
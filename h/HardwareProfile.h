@@ -49,13 +49,14 @@ This file defines all of the hardware-specific information for the project.
 #define USE_SH1101A
 //#define USE_SSD1303
 #define GO_FAST
+#define USE_PROFILING                   // Time ISRs and drawing into Profile.h probes, comment out to remove them
 
 #if defined( __C30__ )
     #ifdef USE_FRC
         #define GetSystemClock()            	32000000UL
         #define GetPeripheralClock()        	(GetSystemClock())
         #define GetInstructionClock()       	(GetSystemClock() / 2)
-        #define MILLISECONDS_PER_TICK       	10
+        #define MILLISECONDS_PER_TICK       	1
         #define TIMER_PRESCALER             	TIMER_PRESCALER_8 
         #define TIMER_PERIOD                	20000
     #else
@@ -63,14 +64,14 @@ This file defines all of the hardware-specific information for the project.
             #define GetSystemClock()            79227500L
             #define GetPeripheralClock()        (GetSystemClock())
             #define GetInstructionClock()       (GetSystemClock() / 2)
-            #define MILLISECONDS_PER_TICK       10
+            #define MILLISECONDS_PER_TICK       1                   // Timer 1 scheduler tick
             #define TIMER_PRESCALER             TIMER_PRESCALER_8
             //#define TIMER_PERIOD                40000
         #else
             #define GetSystemClock()            32000000UL
             #define GetPeripheralClock()        (GetSystemClock())
             #define GetInstructionClock()       (GetSystemClock() / 2)
-            #define MILLISECONDS_PER_TICK       10
+            #define MILLISECONDS_PER_TICK       1
             #define TIMER_PRESCALER             TIMER_PRESCALER_8   // 8MHz: TIMER_PRESCALER_1
             #define TIMER_PERIOD                20000               // 10ms=20000, 1ms=2000
         #endif
@@ -0,0 +1,32 @@
+/**********************************************************************
+* FileName:        		ImaAdpcm.h
+* Dependencies:    		None
+* Processor:       		PIC24HJ128GP504, or any host with a C compiler
+* Compiler:        		MPLAB C30 v3.11b or higher, gcc
+*
+* 4 bit IMA-ADPCM codec, two samples per byte with the earlier sample in
+* the low nibble. A clip in program memory starts with one header word
+* holding the initial predictor in its low 16 bits and the initial step
+* index in its upper 8 bits; the codes follow from the next word.
+************************************************************************/
+
+#ifndef	__IMA_ADPCM_H__
+#define	__IMA_ADPCM_H__
+
+/************************************************************************
+ Data Structures
+ ************************************************************************/
+typedef struct
+{
+	int				predictor;					// Last reconstructed sample
+	int				index;						// Position in the step size table, 0 to 88
+} IMA_ADPCM_STATE;
+
+/************************************************************************
+ Function Prototypes
+ ************************************************************************/
+extern void ImaAdpcmInit(IMA_ADPCM_STATE * state);
+extern void ImaAdpcmDecode(IMA_ADPCM_STATE * state, char * source, int * destination, int size);
+extern void ImaAdpcmEncode(IMA_ADPCM_STATE * state, int * source, char * destination, int size);
+
+#endif
@@ -13,14 +13,38 @@
 #define S2_SHORT        2
 #define S2_LONG         20
 
+#define KEY_PRESS       100                 // Added to S1_SHORT/S2_SHORT when the switch goes down
+#define KEY_RELEASE     200                 // Added to S1_SHORT/S2_SHORT when it comes back up
+#define S1_PRESS        (S1_SHORT + KEY_PRESS)
+#define S1_RELEASE      (S1_SHORT + KEY_RELEASE)
+#define S2_PRESS        (S2_SHORT + KEY_PRESS)
+#define S2_RELEASE      (S2_SHORT + KEY_RELEASE)
+
+#define KEY_DEBOUNCE_MS         8           // Stable readings before a change counts, keeps events within 10 ms of the pin
+#define KEY_LONG_MS             400         // Held this long a press is S1_LONG/S2_LONG
+#define KEY_QUEUE_DEPTH         16          // Events held for the application, a tap is three
+#define KEY_WAIT_FOREVER        0xFFFF
+#define KEY_GETKEY_TIMEOUT_MS   2400        // getKey() gives up after this, as the Timer 1 loop did
+
+typedef struct {
+    int code;                               // S1_SHORT ... S2_RELEASE
+    unsigned int time;                      // millis() when the event was classified
+    unsigned long micros;                   // micros() at the same moment, for timing hits
+} KEY_EVENT;
+
+extern unsigned int keyOverruns;
+
 //______________________________________________________________________________
 
 
 int getKey( void );
-void cTimer( void );
+int pollKey( void );
+int pollKeyEvent( KEY_EVENT *event );
+int waitKey( unsigned int timeout );
+void keyFlush( void );
+void keyScan( void );
 
 
 //______________________________________________________________________________
 
 #endif	/* KEYPRESS_H */
-
@@ -0,0 +1,79 @@
+/**********************************************************************
+* FileName:        		Profile.h
+* Dependencies:    		Timebase.h on the target, <time.h> in the host build
+* Processor:       		PIC24HJ128GP504, or any host with a C compiler
+* Compiler:        		MPLAB C30 v3.11b or higher, gcc
+*
+* Execution time probes. PROFILE_BEGIN() and PROFILE_END() around a
+* piece of code add its count, total, minimum and maximum time to a
+* static table, in instruction cycles on the target and nanoseconds on
+* a host. Times include any interrupt that ran in between. Without
+* USE_PROFILING (HardwareProfile.h) the probes compile to nothing.
+************************************************************************/
+
+#ifndef	__PROFILE_H__
+#define	__PROFILE_H__
+
+#include "GenericTypeDefs.h"
+#include "HardwareProfile.h"
+
+/************************************************************************
+ Constants
+ ************************************************************************/
+#if !defined(HOST_BUILD)
+#define PROFILE_CLOCK_HZ			GetInstructionClock()	// Timer 1 counts instruction cycles
+#else
+#define PROFILE_CLOCK_HZ			1000000000L			// Host probes read CLOCK_MONOTONIC in ns
+#endif
+#define PROFILE_REFRESH_MS			500					// Diagnostics screen redraw period
+
+typedef enum
+{
+	PROFILE_DMA0_ISR = 0,						// _DMA0Interrupt, duty buffer refill
+	PROFILE_T5_ISR,								// _T5Interrupt, audio frame fill
+	PROFILE_T4_ISR,								// _T4Interrupt, key scan
+	PROFILE_GOL_DRAW,							// One GOLDraw() call
+	PROFILE_ST_DRAW,							// One StDraw() call
+	PROFILE_CLEAR_DEVICE,						// ClearDevice()
+	PROFILE_PROBES
+} PROFILE_ID;
+
+/************************************************************************
+ Data Structures
+ ************************************************************************/
+typedef struct
+{
+	DWORD			start;						// profileNow() at PROFILE_BEGIN()
+	DWORD			count;						// Completed runs
+	DWORD			total;						// Sum of their times
+	DWORD			min;						// Shortest run
+	DWORD			max;						// Longest run
+} PROFILE_PROBE;
+
+/************************************************************************
+ Probes
+ ************************************************************************/
+#ifdef USE_PROFILING
+#define PROFILE_BEGIN(id)			(profileProbes[id].start = profileNow())
+#define PROFILE_END(id)				profileRecord(id, profileNow() - profileProbes[id].start)
+#else
+#define PROFILE_BEGIN(id)
+#define PROFILE_END(id)
+#endif
+
+/************************************************************************
+ Variables
+ ************************************************************************/
+extern PROFILE_PROBE profileProbes[PROFILE_PROBES];
+
+/************************************************************************
+ Function Prototypes
+ ************************************************************************/
+DWORD profileNow(void);
+void  profileRecord(PROFILE_ID id, DWORD time);
+void  profileReset(void);
+void  profileRead(PROFILE_ID id, PROFILE_PROBE * copy);
+const char * profileName(PROFILE_ID id);
+void  profileShowScreen(void);
+
+#endif
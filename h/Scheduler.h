@@ -0,0 +1,57 @@
+/**********************************************************************
+* FileName:        		Scheduler.h
+* Dependencies:    		Timebase.h
+* Processor:       		PIC24HJ128GP504
+* Compiler:        		MPLAB C30 v3.11b or higher
+*
+* Cooperative millisecond scheduler on the Timebase.h tick. Software
+* timers run their task from the main loop when they fall due, one at
+* a time and to completion. Code that has to wait calls schedulerYield()
+* or schedulerDelay(), which run due tasks and otherwise put the CPU in
+* Idle until the next interrupt.
+************************************************************************/
+
+#ifndef	__SCHEDULER_H__
+#define	__SCHEDULER_H__
+
+#include "GenericTypeDefs.h"
+#include "Timebase.h"
+
+/************************************************************************
+ Constants
+ ************************************************************************/
+#define SCHEDULER_MAX_TIMERS		8					// Software timers that can be started at once
+#define SCHEDULER_NO_TIMER			(-1)				// schedulerStart() found no free timer
+#define SCHEDULER_ONE_SHOT			0					// Period of a timer that runs its task once
+
+/************************************************************************
+ Data Structures
+ ************************************************************************/
+typedef void (*SCHEDULER_TASK)(void);			// Runs in the main loop, must return promptly
+
+typedef struct
+{
+	SCHEDULER_TASK	task;						// Function run when the timer falls due
+	DWORD			due;						// tick value it is next due on
+	unsigned int	period;						// ms between runs, SCHEDULER_ONE_SHOT to run once
+	unsigned int	active;						// Non-zero while the timer is started
+} SCHEDULER_TIMER;
+
+/************************************************************************
+ Variables
+ ************************************************************************/
+extern DWORD schedulerIdleCount;				// Times the main loop had nothing to do and idled
+extern unsigned int schedulerLateMax;			// Worst ms a task ran after it was due
+
+/************************************************************************
+ Function Prototypes
+ ************************************************************************/
+void schedulerInit(void);
+int  schedulerStart(SCHEDULER_TASK task, unsigned int delay, unsigned int period);
+void schedulerStop(int timer);
+int  schedulerRunPending(void);
+void schedulerYield(void);
+void schedulerDelay(unsigned int ms);
+void schedulerRun(void);
+
+#endif
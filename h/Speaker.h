@@ -35,21 +35,33 @@
 * certify, or support the code.
 ************************************************************************/
 
+#ifndef _SPEAKER_H
+#define _SPEAKER_H
+
 /************************************************************************
  Header Includes													
  ************************************************************************/
 #include "p24HJ128GP504.h"
 #include "G711.h"
+#include "ImaAdpcm.h"
 #include "utility.h"
 #include "HardwareProfile.h"
+#include "struct_queue.h"
+#include "SpeechAssets.h"
 
 /************************************************************************
  Constants													
  ************************************************************************/
-#define FS_SPEAK  					64000L
+#define FS_SPEAK  					1000L				// Frame fill backstop rate, normally kicked by DMA
 #define SAMPPRD_SPEAK    			(unsigned int)(GetInstructionClock()/FS_SPEAK)-1
+#ifndef FRAME_SIZE
 #define FRAME_SIZE 					30					// Each audio frame will have these many samples
+#endif
+#ifndef AUDIO_RING_DEPTH
+#define AUDIO_RING_DEPTH			3					// Decoded frames the producer keeps ahead of the DMA feed
+#endif
 #define PGM_MEM_FRAME_SIZE			((FRAME_SIZE*2)/3) 	// Every PGM element gives three samples	
+#define PGM_MEM_ADPCM_FRAME_SIZE	(FRAME_SIZE/3)		// Every PGM element gives six ADPCM samples
 #define FS							8000				// Speech Sampling Frequency = 8KHz
 #define FRAME						30
 #define OCPWM 						1              		// Specifies which Output compare to use			
@@ -58,7 +70,18 @@
 #define OCCON_WORD					0x0006	
 #define HIGHEST_INPUT_VALUE			32767
 #define LOWEST_INPUT_VALUE			-32768
-#define TIMER2_INT_PRIORITY			4
+#define DMA0_INT_PRIORITY			4					// Duty buffer refill, once per frame
+#define TIMER5_INT_PRIORITY			3					// Frame fill must not delay the PWM update
+#define SPEAKER_MAX_VOICES			4					// Sounds that can play at the same time
+#define SPEAKER_VOICE_CLIP			0					// Voice plays a G.711 segment from program memory
+#define SPEAKER_VOICE_TONE			1					// Voice plays a sustained sine
+#define SPEAKER_CODEC_G711			0					// Clip is 8 bit A-law, one sample per byte
+#define SPEAKER_CODEC_IMA_ADPCM		1					// Clip is 4 bit IMA-ADPCM, two samples per byte
+#define SPEAKER_CODECS				2
+#define SPEAKER_TONE_TABLE_SIZE		256					// Entries in one cycle of the tone wavetable
+#define SPEAKER_TONE_LEVEL			16383				// Tone peak, half of full scale to leave room to mix
+#define SPEAKER_TONE_MIN_STEP		((0x80000000UL/FS)*2)	// Phase step of 1 Hz
+#define SPEAKER_ALAW_SILENCE		0xD5				// A-law code of a zero sample
 #define	OCCON						OC1CON
 #define	OCRS 						OC1RS
 #define	OCR							OC1R
@@ -67,61 +90,124 @@
 #define PWM_FACTOR					(MAX_PWM_PERIOD/INPUT_RANGE)
 #define MAX_PWM_PERIOD				((GetInstructionClock()/FPWM)*TMRPRESCALE) - 1
 #define FPWM_FS_RATIO				(FPWM/FS) 
+#define PWM_MID_DUTY				((MAX_PWM_PERIOD)/2)	// 50% duty, output at Vdd/2
+#define DMA_FRAME_SIZE				(FRAME_SIZE*FPWM_FS_RATIO)	// Duty values per frame in each DMA buffer
+#define DMA_REQ_TIMER2				0b0000111			// DMAxREQ IRQSEL for Timer 2
+#if !defined(HOST_BUILD)
+#define DMA_PERIPHERAL_ADDRESS(reg)	((unsigned int)&(reg))	// DMAxPAD value of a special function register
+#else
+#define DMA_PERIPHERAL_ADDRESS(reg)	((unsigned int)(unsigned long)&(reg))	// Host pointers are wider, HostSim.c takes DMA0PAD to be OC1RS
+#endif
+
+#if (FRAME_SIZE % 6) != 0
+#error "FRAME_SIZE must be a multiple of 6, every PGM word holds three A-law or six ADPCM samples"
+#endif
+#if (DMA_FRAME_SIZE*2*2) > 2048
+#error "Both DMA duty buffers must fit in the 2 KB DMA RAM"
+#endif
+#if AUDIO_RING_DEPTH < 1
+#error "AUDIO_RING_DEPTH must hold at least one frame"
+#endif
+#if INPUT_RANGE != 0xFFFF
+#error "speakerLinToDuty() divides by INPUT_RANGE as 2^16 - 1"
+#endif
+#if (SPEECH_ASSET_FRAME_SIZE % FRAME_SIZE) != 0
+#error "SpeechAssets.h was generated for another FRAME_SIZE, rerun tools/wav2g711"
+#endif
+
+#define SPEECH_CLIP(name)			SPEECH_ADDR_##name, SPEECH_SIZE_##name, SPEECH_CODEC_##name	// Arguments of speakerActivateCodec()
 
 
-#define SPEECH_SIZE_START                   3585L
-#define SPEECH_SIZE_SELECT		513L
-#define SPEECH_SIZE_METRONOME1      2562L
-#define SPEECH_SIZE_ATUNE                   8193L
-#define SPEECH_SIZE_BTUNE                   8193L
-#define SPEECH_SIZE_CTUNE                   8193L
-#define SPEECH_SIZE_DTUNE                   8193L
-#define SPEECH_SIZE_ETUNE                   8193L
-#define SPEECH_SIZE_FTUNE                   8193L
-#define SPEECH_SIZE_GTUNE                   8193L
-
-
-#define SPEECH_ADDR_START                           __builtin_tbladdress(G711_Start)
-#define SPEECH_ADDR_SELECT			__builtin_tbladdress(G711_Select)
-#define SPEECH_ADDR_METRONOME1		__builtin_tbladdress(G711_metronome1)
-#define SPEECH_ADDR_ATUNE                           __builtin_tbladdress(G711_Atune)
-#define SPEECH_ADDR_BTUNE                           __builtin_tbladdress(G711_Btune)
-#define SPEECH_ADDR_CTUNE                           __builtin_tbladdress(G711_Ctune)
-#define SPEECH_ADDR_DTUNE                           __builtin_tbladdress(G711_Dtune)
-#define SPEECH_ADDR_ETUNE                           __builtin_tbladdress(G711_Etune)
-#define SPEECH_ADDR_FTUNE                           __builtin_tbladdress(G711_Ftune)
-#define SPEECH_ADDR_GTUNE                           __builtin_tbladdress(G711_Gtune)
-
+/************************************************************************
+ Data Structures
+ ************************************************************************/
+typedef struct
+{
+	unsigned long	samplePtr;					// Program memory address of the segment
+	unsigned int	pgmMemIndex;				// Offset of the next frame to read
+	unsigned int	segmentIndex;				// Frames already decoded
+	unsigned int	sampleLength;				// Frames in the segment
+	unsigned int	active;						// Non-zero while the voice is playing
+	unsigned int	type;						// SPEAKER_VOICE_CLIP or SPEAKER_VOICE_TONE
+	unsigned long	phase;						// Tone: position in the wavetable cycle
+	unsigned long	phaseStep;					// Tone: phase advance per sample
+	unsigned long	startSample;				// Sample clock value the voice starts on
+	unsigned int	pending;					// Non-zero until the start frame is reached
+	unsigned int	skew;						// Samples into its first frame the voice starts
+	unsigned int	codec;						// Clip: SPEAKER_CODEC_G711 or SPEAKER_CODEC_IMA_ADPCM
+	IMA_ADPCM_STATE	adpcm;						// Clip: decoder state of an ADPCM message
+	union
+	{
+		char		alaw[FRAME_SIZE];			// Last segment frame read, sent skew samples late
+		int			linear[FRAME_SIZE];			// The same for ADPCM, already decoded
+	} tail;
+} SPEAKER_VOICE;
+
+typedef struct
+{
+	unsigned int	duty[FRAME_SIZE];			// PWM duty values, one per sample
+} SPEAKER_FRAME;
+
+typedef struct
+{
+	int				head;						// struct_queue.h ring of decoded frames
+	int				tail;
+	int				count;
+	SPEAKER_FRAME	buffer[AUDIO_RING_DEPTH];
+} SPEAKER_RING;
+
+typedef enum
+{
+	SPEAKER_IDLE = 0,							// Output parked at 50%, no audio interrupts
+	SPEAKER_WARMING,							// DMA feed restarted on 50% while the ring fills
+	SPEAKER_PLAYING,							// Frame fill and DMA feed both running
+	SPEAKER_DRAINING,							// Nothing left to decode, sending the queued frames
+	SPEAKER_STATES
+} SPEAKER_STATE;
+
+typedef void (*SPEAKER_FRAME_HOOK)(unsigned long frameStart);	// Called with the sample clock of each new frame
 
 /************************************************************************
- Function Prototypes													
+ Variables
  ************************************************************************/
+extern unsigned int speakerFrameCycles;			// Cycles spent filling the last frame
+extern unsigned int speakerFrameCyclesMax;		// Worst frame fill seen
+extern unsigned int speakerVoiceCyclesMax;		// Worst fill cost of a single voice
+extern unsigned int speakerCodecCycles[SPEAKER_CODECS];		// Cycles to read and decode the last frame, by codec
+extern unsigned int speakerCodecCyclesMax[SPEAKER_CODECS];	// Worst frame read and decode, by codec
+extern unsigned int speakerUnderruns;			// DMA buffers sent at 50% while a voice played
+extern unsigned int speakerFillLatencyMax;		// Worst cycles from a frame leaving to a refill
+extern unsigned int speakerRingLevelMin;		// Fewest queued frames seen while playing
+extern volatile SPEAKER_STATE speakerState;		// Audio power state
+extern unsigned long speakerStateCycles[SPEAKER_STATES];	// Audio interrupt cycles spent in each state
+extern volatile unsigned long speakerSampleClock;	// Samples made since power up
+extern unsigned int speakerLateStarts;			// Scheduled voices started after their sample
 
-extern void G711_Start();
-extern void G711_Select();
-extern void G711_metronome1();
-extern void G711_Atune();
-extern void G711_Btune();
-extern void G711_Ctune();
-extern void G711_Dtune();
-extern void G711_Etune();
-extern void G711_Ftune();
-extern void G711_Gtune();
+/************************************************************************
+ Function Prototypes
+ ************************************************************************/
 
 void speakerInit(void);
 void speakerActivate(long SpeechSegment, long SpeechSegmentSize);
+void speakerActivateCodec(long SpeechSegment, long SpeechSegmentSize, unsigned int codec);
+void speakerActivateAt(long SpeechSegment, long SpeechSegmentSize, unsigned int codec, unsigned long startSample);
+void speakerSetFrameHook(SPEAKER_FRAME_HOOK hook);
+unsigned long speakerSampleNow(void);
 unsigned int speakerBusy(void);
+unsigned int speakerActiveVoices(void);
+unsigned long speakerToneStep(int semitone, int octave, int cents);
+int  speakerToneStart(unsigned long phaseStep);
+void speakerToneSet(int voice, unsigned long phaseStep);
+void speakerToneStop(int voice);
 void initTmr5(void);
 void StopTmr5(void);
 void StartTmr5(void);
 
 void OCPWMConfig(void);
 void OCPWMStart(void);
-void OCPWMWrite(int * sourceDataBuffer,	int size);
+void OCPWMResume(void);
+void OCPWMPark(void);
 int  OCPWMIsBusy(void);
 void OCPWMStop(void);
 
-
-
-
-
+#endif
@@ -0,0 +1,32 @@
+/**********************************************************************
+* FileName:        		SpeechAssets.h
+*
+* Size, address and codec of every speech clip. Sizes are in samples.
+* SPEECH_CODEC_* is the SPEAKER_CODEC_* each clip was encoded with.
+*
+* Written by hand in the layout tools/wav2g711 generates, for clips that
+* dsPICSpeechRecord encoded. Their sizes are as recorded, not padded to
+* a whole number of frames. Running the tool on WAV recordings of the
+* clips replaces this file.
+************************************************************************/
+
+#ifndef _SPEECH_ASSETS_H
+#define _SPEECH_ASSETS_H
+
+#define SPEECH_ASSET_FRAME_SIZE		30
+
+#define SPEECH_SIZE_START           3585L
+#define SPEECH_ADDR_START           __builtin_tbladdress(G711_Start)
+#define SPEECH_CODEC_START          SPEAKER_CODEC_G711
+#define SPEECH_SIZE_SELECT          513L
+#define SPEECH_ADDR_SELECT          __builtin_tbladdress(G711_Select)
+#define SPEECH_CODEC_SELECT         SPEAKER_CODEC_G711
+#define SPEECH_SIZE_METRONOME1      2562L
+#define SPEECH_ADDR_METRONOME1      __builtin_tbladdress(G711_metronome1)
+#define SPEECH_CODEC_METRONOME1     SPEAKER_CODEC_G711
+
+extern void G711_Start();
+extern void G711_Select();
+extern void G711_metronome1();
+
+#endif
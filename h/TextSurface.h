@@ -0,0 +1,51 @@
+/**********************************************************************
+* FileName:        		TextSurface.h
+* Dependencies:    		Graphics.h
+* Processor:       		PIC24HJ128GP504
+* Compiler:        		MPLAB C30 v3.11b or higher
+*
+* Retained text area drawn the way a STATICTEXT object draws, without a
+* GOL object or the heap. The surface keeps the text it shows, so a new
+* text only redraws the glyph cells that differ from the old one; cells
+* with the same character at the same position are left alone.
+************************************************************************/
+
+#ifndef	__TEXT_SURFACE_H__
+#define	__TEXT_SURFACE_H__
+
+#include "GenericTypeDefs.h"
+#include "Graphics\Graphics.h"
+
+/************************************************************************
+ Constants
+ ************************************************************************/
+#define TEXT_SURFACE_SIZE			64					// Characters kept, terminator included, longer text is cut
+
+/************************************************************************
+ Data Structures
+ ************************************************************************/
+typedef struct
+{
+	SHORT			left;						// Area, frame included
+	SHORT			top;
+	SHORT			right;
+	SHORT			bottom;
+	WORD			state;						// ST_FRAME and ST_CENTER_ALIGN or ST_RIGHT_ALIGN, as for StCreate()
+	GOL_SCHEME *	pScheme;					// Colours and font, NULL for the GOL default scheme
+	WORD			valid;						// Non-zero while the screen shows text[]
+	XCHAR			text[TEXT_SURFACE_SIZE];	// Text on the screen
+} TEXT_SURFACE;
+
+// Static initializer, the same as textSurfaceInit()
+#define TEXT_SURFACE_INIT(left, top, right, bottom, state, pScheme) \
+	{ (left), (top), (right), (bottom), (state), (pScheme), 0, { 0 } }
+
+/************************************************************************
+ Function Prototypes
+ ************************************************************************/
+void textSurfaceInit(TEXT_SURFACE * surface, SHORT left, SHORT top, SHORT right, SHORT bottom,
+					 WORD state, GOL_SCHEME * pScheme);
+void textSurfaceSetText(TEXT_SURFACE * surface, const XCHAR * text);
+void textSurfaceInvalidate(TEXT_SURFACE * surface);
+
+#endif
@@ -0,0 +1,37 @@
+/**********************************************************************
+* FileName:        		Timebase.h
+* Dependencies:    		Timer1Code.h
+* Processor:       		PIC24HJ128GP504
+* Compiler:        		MPLAB C30 v3.11b or higher
+*
+* Monotonic time base. Timer 1 interrupts once a millisecond and
+* _T1Interrupt advances tick; millis() reads that count and micros()
+* adds the Timer 1 count inside the current millisecond. Both can be
+* called from main() and from any interrupt without tearing.
+************************************************************************/
+
+#ifndef	__TIMEBASE_H__
+#define	__TIMEBASE_H__
+
+#include "GenericTypeDefs.h"
+
+/************************************************************************
+ Constants
+ ************************************************************************/
+#define TIMEBASE_TICK_RATE			1000				// Timer 1 interrupts per second, one tick per ms
+#define TIMEBASE_US_PER_TICK		(1000000L/TIMEBASE_TICK_RATE)
+
+/************************************************************************
+ Variables
+ ************************************************************************/
+extern volatile DWORD tick;						// ms since timebaseInit(), kept by _T1Interrupt
+
+/************************************************************************
+ Function Prototypes
+ ************************************************************************/
+void  timebaseInit(void);
+DWORD millis(void);
+DWORD micros(void);
+DWORD timebaseCycles(void);
+
+#endif
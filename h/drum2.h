@@ -8,7 +8,15 @@
 #ifndef DRUM2_H
 #define	DRUM2_H
 
+#ifndef DRUM_MAX_HITS
+#define DRUM_MAX_HITS           128                 // Hits one recording can hold, 4 bytes each
+#endif
+#define DRUM_US_PER_SAMPLE      (1000000L/FS)       // Hit times are kept on the audio sample clock
+#define DRUM_GRID_MS            {0, 50, 100, 125, 250}  // Quantise choices, 0 plays the hits as recorded
+#define DRUM_GRIDS              5
+
 void record_drum(void);
+unsigned long drumQuantise(unsigned long time, unsigned long grid);
+unsigned long drumLoopLength(unsigned long length, unsigned long grid);
 
 #endif	/* DRUM2_H */
-
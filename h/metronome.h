@@ -1,11 +1,14 @@
 
 #ifndef METRONOME_H
-#define	mETRONOME_H
+#define	METRONOME_H
+
+#define METRONOME_BPM10_MIN         300                 // 30.0 BPM, tempo is kept in tenths of a BPM
+#define METRONOME_BPM10_MAX         3000                // 300.0 BPM
+#define METRONOME_SAMPLES_MIN10     (FS*60L*10)         // Samples in ten minutes: beat interval = this/bpm10
 
 void play_metronome(void);
 int SelectTimeSignature(void);
 int SelectSpeed(void);
-void Initializetimer(void);
     
 
 
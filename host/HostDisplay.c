@@ -0,0 +1,168 @@
+/**********************************************************************
+* FileName:        		HostDisplay.c
+* Dependencies:    		Header (.h) files if applicable, see below
+* Processor:       		Any host with gcc
+* Compiler:        		gcc
+*
+* SH1101A controller behind the WriteCommand(), WriteData() and
+* ReadData() macros of the host build. Only what the driver uses is
+* modelled: the page and column address commands, column auto
+* increment on data access, the dummy read after an address change and
+* the one byte latency of the PMP read.
+************************************************************************/
+
+/************************************************************************
+ Header Includes
+ ************************************************************************/
+#include <stdio.h>
+#include "HostSim.h"
+
+/************************************************************************
+ Variables
+ ************************************************************************/
+static unsigned char	hostDisplayRam[HOST_DISPLAY_PAGES][HOST_DISPLAY_COLUMNS];
+static unsigned int		hostDisplayPage;
+static unsigned int		hostDisplayColumn;
+static unsigned int		hostDisplayStartLine;		// RAM row shown on the top line
+static unsigned int		hostDisplayDummy;			// Next controller read is the dummy one
+static unsigned int		hostDisplayArgument;		// Next command byte is a parameter
+static unsigned char	hostDisplayLatch;			// PMDIN1, last byte the PMP read
+static unsigned long	hostDisplayBusCycles;		// Bus cycles to the controller
+
+/****************************************************************************
+  Function:
+    void hostDisplayCommand(unsigned char command)
+  Description:
+	A byte written with the command/data line low.
+  Precondition:
+    None.
+  Parameters:
+    unsigned char command - command byte.
+  Returns:
+    None
+  Remarks:
+    The parameter byte of the two byte commands is skipped so that it is
+    not taken for a column address.
+  ***************************************************************************/
+void hostDisplayCommand(unsigned char command)
+{
+	hostDisplayBusCycles++;
+	if(hostDisplayArgument)
+	{
+		hostDisplayArgument = 0;
+		return;
+	}
+
+	if(command <= 0x0F)
+		hostDisplayColumn = (hostDisplayColumn & 0xF0) | command;
+	else if(command <= 0x1F)
+		hostDisplayColumn = (hostDisplayColumn & 0x0F) | ((command & 0x0F) << 4);
+	else if(command >= 0x40 && command <= 0x7F)
+		hostDisplayStartLine = command & 0x3F;
+	else if(command >= 0xB0 && command <= 0xB7)
+		hostDisplayPage = command & 0x07;
+	else if(command == 0x81 || command == 0xA8 || command == 0xAD || command == 0xD3 ||
+			command == 0xD5 || command == 0xD9 || command == 0xDA || command == 0xDB)
+		hostDisplayArgument = 1;
+	hostDisplayDummy = 1;
+}
+
+void hostDisplayWrite(unsigned char data)
+{
+	hostDisplayBusCycles++;
+	if(hostDisplayColumn < HOST_DISPLAY_COLUMNS)
+		hostDisplayRam[hostDisplayPage][hostDisplayColumn++] = data;
+}
+
+unsigned char hostDisplayRead(void)
+{
+	unsigned char data = hostDisplayLatch;
+
+	hostDisplayBusCycles++;
+	if(hostDisplayDummy)
+	{
+		hostDisplayDummy = 0;
+		hostDisplayLatch = 0xFF;
+	}
+	else if(hostDisplayColumn < HOST_DISPLAY_COLUMNS)
+		hostDisplayLatch = hostDisplayRam[hostDisplayPage][hostDisplayColumn++];
+	return data;
+}
+
+/****************************************************************************
+  Function:
+    unsigned long hostDisplayAccesses(void)
+  Description:
+	Number of commands, writes and reads sent to the controller.
+  Precondition:
+    None.
+  Parameters:
+    None.
+  Returns:
+    The count since reset.
+  Remarks:
+    Each one is a PMP bus cycle with its delay on the target.
+  ***************************************************************************/
+unsigned long hostDisplayAccesses(void)
+{
+	return hostDisplayBusCycles;
+}
+
+/****************************************************************************
+  Function:
+    int hostDisplayPixel(int x, int y)
+  Description:
+	Reads a pixel of the glass from the display RAM, with the display
+	start line applied as in hostDisplayDump().
+  Precondition:
+    None.
+  Parameters:
+    int x - column, 0 to HOST_DISPLAY_WIDTH-1.
+    int y - row, 0 to HOST_DISPLAY_HEIGHT-1.
+  Returns:
+    1 if the pixel is lit, else 0.
+  Remarks:
+    Only what has been sent to the controller shows.
+  ***************************************************************************/
+int hostDisplayPixel(int x, int y)
+{
+	int		line = (y + hostDisplayStartLine) % HOST_DISPLAY_HEIGHT;
+
+	return (hostDisplayRam[line >> 3][x + HOST_DISPLAY_OFFSET] >> (line & 7)) & 1;
+}
+
+/****************************************************************************
+  Function:
+    void hostDisplayDump(const char * path)
+  Description:
+	Writes the visible part of the display RAM as a PBM image, from
+	the display start line down as the glass shows it.
+  Precondition:
+    None.
+  Parameters:
+    const char * path - file to write.
+  Returns:
+    None
+  Remarks:
+    Lit pixels are black in the image.
+  ***************************************************************************/
+void hostDisplayDump(const char * path)
+{
+	FILE *	file = fopen(path, "w");
+	int		x, y;
+
+	if(file == NULL)
+	{
+		perror(path);
+		return;
+	}
+
+	fprintf(file, "P1\n%d %d\n", HOST_DISPLAY_WIDTH, HOST_DISPLAY_HEIGHT);
+	for(y = 0; y < HOST_DISPLAY_HEIGHT; y++)
+	{
+		for(x = 0; x < HOST_DISPLAY_WIDTH; x++)
+			fputc(hostDisplayPixel(x, y) ? '1' : '0', file);
+		fputc('\n', file);
+	}
+	fclose(file);
+}
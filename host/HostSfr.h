@@ -0,0 +1,59 @@
+/**********************************************************************
+* FileName:        		HostSfr.h
+* Dependencies:    		p24HJ128GP504.h, as copied by the host Makefile
+* Processor:       		Any host with gcc
+* Compiler:        		gcc
+*
+* Included ahead of every source file of the host build. It removes the
+* C30 attributes and builtins that gcc does not know, then includes the
+* device header with its inline assembler macros stripped, so the
+* firmware reads and writes the special function registers as ordinary
+* variables that the simulator in HostSim.c watches.
+************************************************************************/
+
+#ifndef	__HOST_SFR_H__
+#define	__HOST_SFR_H__
+
+/************************************************************************
+ C30 attributes and builtins
+ ************************************************************************/
+#define __PIC24HJ128GP504__			1
+
+#define interrupt
+#define __interrupt__
+#define no_auto_psv
+#define auto_psv
+#define shadow
+#define __sfr__						unused
+#define __unsafe__
+#define space(x)					unused
+#define __prog__
+
+#define __builtin_write_OSCCONH(x)	hostWriteOscconH(x)
+#define __builtin_write_OSCCONL(x)	hostWriteOscconL(x)
+#define __builtin_tbladdress(x)		hostTblAddress((void (*)(void))(x))
+#define __builtin_dmaoffset(x)		hostDmaOffset((void *)(x))
+
+/************************************************************************
+ Function Prototypes
+ ************************************************************************/
+void			hostWriteOscconH(unsigned int value);
+void			hostWriteOscconL(unsigned int value);
+long			hostTblAddress(void (*label)(void));
+unsigned int	hostDmaOffset(void * buffer);
+void			hostIdle(void);
+void			hostDisplayCommand(unsigned char command);
+void			hostDisplayWrite(unsigned char data);
+unsigned char	hostDisplayRead(void);
+
+/************************************************************************
+ Device header
+ ************************************************************************/
+#include "p24HJ128GP504.h"
+
+#define Nop()
+#define ClrWdt()
+#define Sleep()						hostIdle()
+#define Idle()						hostIdle()
+
+#endif
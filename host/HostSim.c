@@ -0,0 +1,557 @@
+/**********************************************************************
+* FileName:        		HostSim.c
+* Dependencies:    		Header (.h) files if applicable, see below
+* Processor:       		Any host with gcc
+* Compiler:        		gcc
+*
+* Virtual clock, Timers 1 to 5, DMA channel 0 and interrupt dispatch
+* for the host build, plus the switches, the run limit and the report
+* written when the run ends. The firmware is single threaded here: time
+* stands still while it computes, and moves on when it calls Idle() or
+* Delay(). Interrupts are called at the cycle their flag is raised, in
+* priority order against SRbits.IPL, so code that masks them by raising
+* the CPU priority behaves as on the target.
+*
+* Environment:
+*	HOST_RUN_MS		virtual milliseconds to run, HOST_RUN_MS_DEFAULT if unset
+*	HOST_KEYS		switch presses, "ms:S1:hold_ms,ms:S2:hold_ms,..."
+*	HOST_DISPLAY	PBM file the display is written to at the end
+*	HOST_AUDIO		raw signed 16 bit file of every duty value DMA 0
+*					moves to OC1RS, at the PWM rate
+************************************************************************/
+
+/************************************************************************
+ Header Includes
+ ************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include "HostSim.h"
+#include "HardwareProfile.h"
+#include "Profile.h"
+
+/************************************************************************
+ Constants
+ ************************************************************************/
+#define HOST_NEVER					(~0ULL)
+#define HOST_TIMERS					5
+#define HOST_MAX_EDGES				64					// Switch edges HOST_KEYS can hold
+#define HOST_MAX_RUNS				100000				// Interrupt calls without time moving
+#define HOST_DEFAULT_PRIORITY		0x4444				// IPCx reset value, priority 4 everywhere
+#define HOST_IRQ_TIMER2				7					// DMAxREQ IRQSEL of Timer 2
+#define HOST_CYCLES_PER_MS			(GetInstructionClock()/1000)
+
+/************************************************************************
+ Interrupt vectors, in natural order
+ ************************************************************************/
+#define HOST_VECTORS \
+	HOST_VECTOR(T1,		IFS0bits.T1IF,		IEC0bits.T1IE,		IPC0bits.T1IP,		_T1Interrupt)	\
+	HOST_VECTOR(DMA0,	IFS0bits.DMA0IF,	IEC0bits.DMA0IE,	IPC1bits.DMA0IP,	_DMA0Interrupt)	\
+	HOST_VECTOR(T2,		IFS0bits.T2IF,		IEC0bits.T2IE,		IPC1bits.T2IP,		_T2Interrupt)	\
+	HOST_VECTOR(T3,		IFS0bits.T3IF,		IEC0bits.T3IE,		IPC2bits.T3IP,		_T3Interrupt)	\
+	HOST_VECTOR(T4,		IFS1bits.T4IF,		IEC1bits.T4IE,		IPC6bits.T4IP,		_T4Interrupt)	\
+	HOST_VECTOR(T5,		IFS1bits.T5IF,		IEC1bits.T5IE,		IPC7bits.T5IP,		_T5Interrupt)
+
+#define HOST_VECTOR(name, flag, enable, priority, isr)	HOST_VECTOR_##name,
+typedef enum
+{
+	HOST_VECTORS
+	HOST_VECTOR_COUNT
+} HOST_VECTOR_ID;
+#undef HOST_VECTOR
+
+#define HOST_VECTOR(name, flag, enable, priority, isr)	extern void isr(void) __attribute__((weak));
+HOST_VECTORS
+#undef HOST_VECTOR
+
+/************************************************************************
+ Data Structures
+ ************************************************************************/
+typedef struct
+{
+	volatile unsigned int *	con;				// TxCON
+	volatile unsigned int *	tmr;				// TMRx
+	volatile unsigned int *	pr;					// PRx
+	HOST_VECTOR_ID		vector;					// Flag raised on a period match
+	unsigned long long	base;					// hostCycles the count below was taken at
+	unsigned int		count;					// TMRx at base
+	unsigned int		control;				// TxCON at base
+	unsigned int		published;				// Value last stored in TMRx
+} HOST_TIMER;
+
+typedef struct
+{
+	unsigned long long	at;						// hostCycles of the edge
+	int					sw;						// 1 for S1, 2 for S2
+	int					level;					// Pin level, 0 is pressed
+} HOST_EDGE;
+
+/************************************************************************
+ Variables
+ ************************************************************************/
+unsigned long long			hostCycles;
+
+static HOST_TIMER			hostTimers[HOST_TIMERS] =
+{
+	{ &T1CON, &TMR1, &PR1, HOST_VECTOR_T1 },
+	{ &T2CON, &TMR2, &PR2, HOST_VECTOR_T2 },
+	{ &T3CON, &TMR3, &PR3, HOST_VECTOR_T3 },
+	{ &T4CON, &TMR4, &PR4, HOST_VECTOR_T4 },
+	{ &T5CON, &TMR5, &PR5, HOST_VECTOR_T5 },
+};
+
+static const char * const	hostVectorNames[HOST_VECTOR_COUNT] = { "T1", "DMA0", "T2", "T3", "T4", "T5" };
+static unsigned long		hostVectorCalls[HOST_VECTOR_COUNT];
+static unsigned int			hostNesting;		// Interrupts being run
+static unsigned long long	hostLimit;			// hostCycles the run ends at
+
+static HOST_EDGE			hostEdges[HOST_MAX_EDGES];
+static int					hostEdgeCount;
+static int					hostEdgeNext;
+
+static unsigned int			hostDmaIndex;		// Transfer within the current DMA 0 buffer
+static unsigned int			hostDmaEnabled;		// CHEN as last seen
+static FILE *				hostAudio;
+
+/************************************************************************
+ Vector access
+ ************************************************************************/
+static int hostVectorPending(HOST_VECTOR_ID v)
+{
+	switch(v)
+	{
+#define HOST_VECTOR(name, flag, enable, priority, isr)	case HOST_VECTOR_##name: return flag && enable;
+	HOST_VECTORS
+#undef HOST_VECTOR
+	default: return 0;
+	}
+}
+
+static int hostVectorPriority(HOST_VECTOR_ID v)
+{
+	switch(v)
+	{
+#define HOST_VECTOR(name, flag, enable, priority, isr)	case HOST_VECTOR_##name: return priority;
+	HOST_VECTORS
+#undef HOST_VECTOR
+	default: return 0;
+	}
+}
+
+static void hostVectorRaise(HOST_VECTOR_ID v)
+{
+	switch(v)
+	{
+#define HOST_VECTOR(name, flag, enable, priority, isr)	case HOST_VECTOR_##name: flag = 1; break;
+	HOST_VECTORS
+#undef HOST_VECTOR
+	default: break;
+	}
+}
+
+static void (*hostVectorIsr(HOST_VECTOR_ID v))(void)
+{
+	switch(v)
+	{
+#define HOST_VECTOR(name, flag, enable, priority, isr)	case HOST_VECTOR_##name: return isr;
+	HOST_VECTORS
+#undef HOST_VECTOR
+	default: return NULL;
+	}
+}
+
+/************************************************************************
+ Reset state
+ ************************************************************************/
+static void __attribute__((constructor)) hostReset(void)
+{
+	IPC0 = IPC1 = IPC2 = IPC6 = IPC7 = HOST_DEFAULT_PRIORITY;
+	PORTAbits.RA8 = 1;
+	PORTCbits.RC2 = 1;
+}
+
+void hostWriteOscconH(unsigned int value)
+{
+	OSCCONbits.NOSC = value & 0x07;
+}
+
+void hostWriteOscconL(unsigned int value)
+{
+	if(value & 0x01)
+	{
+		OSCCONbits.COSC = OSCCONbits.NOSC;
+		OSCCONbits.LOCK = 1;
+	}
+}
+
+/****************************************************************************
+  Function:
+    static void hostReport(void)
+  Description:
+	Ends the run: writes the display and the audio, prints the interrupt
+	counts and the profile probes, and exits.
+  Precondition:
+    None.
+  Parameters:
+    None.
+  Returns:
+    Does not return.
+  Remarks:
+    Probe times are host nanoseconds, see Profile.h.
+  ***************************************************************************/
+static void hostReport(void)
+{
+	const char *	display = getenv("HOST_DISPLAY");
+	int				i;
+
+	if(display != NULL)
+		hostDisplayDump(display);
+	if(hostAudio != NULL)
+		fclose(hostAudio);
+
+	printf("ran %llu ms, %lu display bus cycles\n", hostCycles/HOST_CYCLES_PER_MS, hostDisplayAccesses());
+	printf("%-8s %10s\n", "vector", "calls");
+	for(i = 0; i < HOST_VECTOR_COUNT; i++)
+		printf("%-8s %10lu\n", hostVectorNames[i], hostVectorCalls[i]);
+
+#ifdef USE_PROFILING
+	printf("%-8s %10s %10s %10s %10s\n", "probe", "count", "min ns", "avg ns", "max ns");
+	for(i = 0; i < PROFILE_PROBES; i++)
+	{
+		PROFILE_PROBE probe;
+
+		profileRead(i, &probe);
+		printf("%-8s %10lu %10lu %10lu %10lu\n", profileName(i), (unsigned long)probe.count,
+			(unsigned long)probe.min, (unsigned long)(probe.count ? probe.total/probe.count : 0),
+			(unsigned long)probe.max);
+	}
+#endif
+
+	fflush(stdout);
+	exit(0);
+}
+
+/****************************************************************************
+  Function:
+    static void hostStart(void)
+  Description:
+	Reads the environment on the first call.
+  Precondition:
+    None.
+  Parameters:
+    None.
+  Returns:
+    None
+  Remarks:
+    A switch held across another edge of the same switch is not
+    checked for; later edges simply win.
+  ***************************************************************************/
+static int hostEdgeOrder(const void * a, const void * b)
+{
+	const HOST_EDGE * x = a;
+	const HOST_EDGE * y = b;
+
+	return (x->at > y->at) - (x->at < y->at);
+}
+
+static void hostStart(void)
+{
+	static int		started;
+	const char *	value;
+	unsigned long	at, hold;
+	int				sw, used;
+
+	if(started)
+		return;
+	started = 1;
+
+	value = getenv("HOST_RUN_MS");
+	hostLimit = (unsigned long long)(value ? strtoul(value, NULL, 0) : HOST_RUN_MS_DEFAULT)*HOST_CYCLES_PER_MS;
+
+	value = getenv("HOST_KEYS");
+	while(value != NULL && hostEdgeCount + 2 <= HOST_MAX_EDGES &&
+		  sscanf(value, "%lu:S%d:%lu%n", &at, &sw, &hold, &used) == 3)
+	{
+		hostEdges[hostEdgeCount].at		= (unsigned long long)at*HOST_CYCLES_PER_MS;
+		hostEdges[hostEdgeCount].sw		= sw;
+		hostEdges[hostEdgeCount].level	= 0;
+		hostEdgeCount++;
+		hostEdges[hostEdgeCount].at		= (unsigned long long)(at + hold)*HOST_CYCLES_PER_MS;
+		hostEdges[hostEdgeCount].sw		= sw;
+		hostEdges[hostEdgeCount].level	= 1;
+		hostEdgeCount++;
+
+		value += used;
+		value = (*value == ',') ? value + 1 : NULL;
+	}
+	qsort(hostEdges, hostEdgeCount, sizeof(HOST_EDGE), hostEdgeOrder);
+
+	value = getenv("HOST_AUDIO");
+	if(value != NULL && (hostAudio = fopen(value, "wb")) == NULL)
+		perror(value);
+}
+
+/************************************************************************
+ Timers
+ ************************************************************************/
+static unsigned int hostTimerPrescale(unsigned int control)
+{
+	static const unsigned int prescale[4] = { 1, 8, 64, 256 };
+
+	return prescale[(control >> 4) & 0x03];
+}
+
+/* Takes a new base when the firmware has written TMRx or TxCON */
+static void hostTimerCheck(HOST_TIMER * t)
+{
+	if(*t->tmr != t->published || *t->con != t->control)
+	{
+		t->base			= hostCycles;
+		t->count		= *t->tmr & 0xFFFF;
+		t->control		= *t->con;
+		t->published	= *t->tmr;
+	}
+}
+
+static unsigned long long hostTimerNext(HOST_TIMER * t)
+{
+	unsigned long	period = (*t->pr & 0xFFFF) + 1UL;
+	unsigned long	ticks;
+
+	if(!(t->control & 0x8000))
+		return HOST_NEVER;
+	ticks = (t->count < period) ? period - t->count : 0x10000UL - t->count + period;
+	return t->base + (unsigned long long)ticks*hostTimerPrescale(t->control);
+}
+
+static void hostTimerPublish(HOST_TIMER * t)
+{
+	if(t->control & 0x8000)
+		*t->tmr = (t->count + (hostCycles - t->base)/hostTimerPrescale(t->control)) & 0xFFFF;
+	t->published = *t->tmr;
+}
+
+/****************************************************************************
+  Function:
+    static void hostDmaRequest(unsigned int irq)
+  Description:
+	One DMA 0 transfer from the current ping-pong buffer to OC1RS.
+  Precondition:
+    None.
+  Parameters:
+    unsigned int irq - IRQ number of the peripheral asking.
+  Returns:
+    None
+  Remarks:
+    Only what Speaker.c uses: word transfers, peripheral indirect off,
+    continuous or one shot, with or without ping-pong. DMA0PAD is taken
+    to be OC1RS.
+  ***************************************************************************/
+static void hostDmaRequest(unsigned int irq)
+{
+	unsigned int *	buffer;
+	long			sample;
+	short			pcm;
+
+	if(!DMA0CONbits.CHEN)
+	{
+		hostDmaEnabled = 0;
+		return;
+	}
+	if(!hostDmaEnabled)
+	{
+		hostDmaEnabled		= 1;
+		hostDmaIndex		= 0;
+		DMACS1bits.PPST0	= 0;
+	}
+	if(DMA0REQbits.IRQSEL != irq)
+		return;
+
+	buffer = hostDmaBuffer(DMACS1bits.PPST0 ? DMA0STB : DMA0STA);
+	if(buffer == NULL)
+		return;
+	OC1RS = buffer[hostDmaIndex];
+
+	if(hostAudio != NULL && PR2 != 0)
+	{
+		sample	= ((long)OC1RS*2 - (long)PR2)*32767L/(long)PR2;
+		pcm		= (short)(sample > 32767 ? 32767 : sample < -32768 ? -32768 : sample);
+		fwrite(&pcm, sizeof(pcm), 1, hostAudio);
+	}
+
+	if(++hostDmaIndex > DMA0CNT)
+	{
+		hostDmaIndex = 0;
+		hostVectorRaise(HOST_VECTOR_DMA0);
+		if(DMA0CONbits.MODE & 0x02)
+			DMACS1bits.PPST0 ^= 1;
+		if(DMA0CONbits.MODE & 0x01)
+		{
+			DMA0CONbits.CHEN	= 0;
+			hostDmaEnabled		= 0;
+		}
+	}
+}
+
+static void hostTimerMatch(HOST_TIMER * t)
+{
+	t->base			= hostCycles;
+	t->count		= 0;
+	*t->tmr			= 0;
+	t->published	= 0;
+	hostVectorRaise(t->vector);
+	if(t->vector == HOST_VECTOR_T2)
+		hostDmaRequest(HOST_IRQ_TIMER2);
+}
+
+/****************************************************************************
+  Function:
+    static unsigned int hostDispatch(void)
+  Description:
+	Calls every pending interrupt above the CPU priority, highest
+	priority first and in natural order within a priority.
+  Precondition:
+    None.
+  Parameters:
+    None.
+  Returns:
+    Number of interrupts called.
+  Remarks:
+    An enabled interrupt without a handler stops the run, as it would
+    trap on the target. So does one that keeps its flag set.
+  ***************************************************************************/
+static unsigned int hostDispatch(void)
+{
+	void			(*isr)(void);
+	unsigned int	calls = 0;
+	unsigned int	saved;
+	int				v, best, priority;
+
+	while(1)
+	{
+		best		= -1;
+		priority	= SRbits.IPL;
+		for(v = 0; v < HOST_VECTOR_COUNT; v++)
+		{
+			if(hostVectorPending(v) && hostVectorPriority(v) > priority)
+			{
+				best		= v;
+				priority	= hostVectorPriority(v);
+			}
+		}
+		if(best < 0)
+			return calls;
+
+		isr = hostVectorIsr(best);
+		if(isr == NULL || ++calls > HOST_MAX_RUNS)
+		{
+			fprintf(stderr, "%s interrupt %s\n", hostVectorNames[best], isr ? "never clears its flag" : "has no handler");
+			hostReport();
+		}
+
+		saved		= SRbits.IPL;
+		SRbits.IPL	= priority;
+		hostNesting++;
+		hostVectorCalls[best]++;
+		isr();
+		hostNesting--;
+		SRbits.IPL	= saved;
+	}
+}
+
+/****************************************************************************
+  Function:
+    static void hostRun(unsigned long long until, int wake)
+  Description:
+	Moves the virtual clock on, event by event.
+  Precondition:
+    None.
+  Parameters:
+    unsigned long long until - hostCycles to stop at.
+    int wake - non-zero to stop after the first interrupt, as Idle does.
+  Returns:
+    None
+  Remarks:
+    Ends the run at hostLimit.
+  ***************************************************************************/
+static void hostRun(unsigned long long until, int wake)
+{
+	unsigned long long	next, at;
+	int					i, timer;
+
+	hostStart();
+	if(hostNesting)
+		return;								// Waiting inside an interrupt does not move time
+
+	if(until > hostLimit)
+		until = hostLimit;
+
+	while(1)
+	{
+		next	= HOST_NEVER;
+		timer	= -1;
+		for(i = 0; i < HOST_TIMERS; i++)
+		{
+			hostTimerCheck(&hostTimers[i]);
+			at = hostTimerNext(&hostTimers[i]);
+			if(at < next)
+			{
+				next	= at;
+				timer	= i;
+			}
+		}
+		if(hostEdgeNext < hostEdgeCount && hostEdges[hostEdgeNext].at <= next)
+		{
+			next	= hostEdges[hostEdgeNext].at;
+			timer	= -1;
+		}
+		if(next > until)
+			break;
+
+		hostCycles = next > hostCycles ? next : hostCycles;
+		if(timer < 0)
+		{
+			if(hostEdges[hostEdgeNext].sw == 1)
+				PORTAbits.RA8 = hostEdges[hostEdgeNext].level;
+			else
+				PORTCbits.RC2 = hostEdges[hostEdgeNext].level;
+			hostEdgeNext++;
+		}
+		else
+			hostTimerMatch(&hostTimers[timer]);
+
+		for(i = 0; i < HOST_TIMERS; i++)
+			hostTimerPublish(&hostTimers[i]);
+		if(hostDispatch() && wake)
+			return;
+	}
+
+	hostCycles = until > hostCycles ? until : hostCycles;
+	for(i = 0; i < HOST_TIMERS; i++)
+		hostTimerPublish(&hostTimers[i]);
+	if(hostCycles >= hostLimit)
+		hostReport();
+}
+
+void hostAdvance(unsigned long long cycles)
+{
+	hostRun(hostCycles + cycles, 0);
+}
+
+/****************************************************************************
+  Function:
+    void hostIdle(void)
+  Description:
+	Idle(): waits for the next interrupt.
+  Precondition:
+    None.
+  Parameters:
+    None.
+  Returns:
+    None
+  Remarks:
+    With nothing left that can interrupt, the run ends.
+  ***************************************************************************/
+void hostIdle(void)
+{
+	hostRun(HOST_NEVER, 1);
+}
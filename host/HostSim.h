@@ -0,0 +1,56 @@
+/**********************************************************************
+* FileName:        		HostSim.h
+* Dependencies:    		HostSfr.h
+* Processor:       		Any host with gcc
+* Compiler:        		gcc
+*
+* Simulator behind the host build. Time is a count of virtual
+* instruction cycles that only moves when the firmware waits, in Idle()
+* or Delay(); while it moves the timers count, raise their interrupt
+* flags and the pending interrupts are called in priority order. The
+* display, the speaker and the two switches live in memory.
+************************************************************************/
+
+#ifndef	__HOST_SIM_H__
+#define	__HOST_SIM_H__
+
+/************************************************************************
+ Constants
+ ************************************************************************/
+#define HOST_RUN_MS_DEFAULT			10000				// Virtual ms run when HOST_RUN_MS is not set
+#define HOST_PROGRAM_BASE			0x8000L				// Program memory address of the first clip
+#define HOST_PROGRAM_ERASED			0xFFFFFFL			// What unprogrammed flash reads as
+#define HOST_DISPLAY_COLUMNS		132					// SH1101A column RAM
+#define HOST_DISPLAY_PAGES			8					// 8 rows of pixels per page
+#define HOST_DISPLAY_OFFSET			2					// Column of the first visible pixel
+#define HOST_DISPLAY_WIDTH			128
+#define HOST_DISPLAY_HEIGHT			(HOST_DISPLAY_PAGES*8)
+
+/************************************************************************
+ Data Structures
+ ************************************************************************/
+typedef struct
+{
+	void			(*label)(void);				// Symbol __builtin_tbladdress() is given
+	const unsigned long * words;				// 24 bit program words
+	unsigned int	length;						// Number of words
+} HOST_PROGRAM_BLOCK;
+
+/************************************************************************
+ Variables
+ ************************************************************************/
+extern const HOST_PROGRAM_BLOCK hostProgramBlocks[];	// Generated from src/Sounds
+extern const int hostProgramBlockCount;
+extern unsigned long long hostCycles;					// Virtual instruction cycles since reset
+
+/************************************************************************
+ Function Prototypes
+ ************************************************************************/
+void			hostAdvance(unsigned long long cycles);
+unsigned long	hostProgramWord(long address);
+void *			hostDmaBuffer(unsigned int offset);
+void			hostDisplayDump(const char * path);
+int				hostDisplayPixel(int x, int y);
+unsigned long	hostDisplayAccesses(void);
+
+#endif
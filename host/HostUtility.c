@@ -0,0 +1,180 @@
+/**********************************************************************
+* FileName:        		HostUtility.c
+* Dependencies:    		Header (.h) files if applicable, see below
+* Processor:       		Any host with gcc
+* Compiler:        		gcc
+*
+* C versions of the routines the target takes from Utility.s, and the
+* program memory the sound clips are read from. Clips are laid out one
+* after another from HOST_PROGRAM_BASE, two address units per 24 bit
+* word as on the PIC24, so program memory arithmetic in Speaker.c is
+* unchanged.
+************************************************************************/
+
+/************************************************************************
+ Header Includes
+ ************************************************************************/
+#include "HostSim.h"
+#include "HardwareProfile.h"
+#include "Utility.h"
+
+/************************************************************************
+ Constants
+ ************************************************************************/
+#define HOST_DMA_BUFFERS			4					// Buffers __builtin_dmaoffset() can name
+
+/************************************************************************
+ Variables
+ ************************************************************************/
+static void *			hostDmaBuffers[HOST_DMA_BUFFERS];
+
+/****************************************************************************
+  Function:
+    long hostTblAddress(void (*label)(void))
+  Description:
+	Host __builtin_tbladdress(): program memory address of a clip.
+  Precondition:
+    None.
+  Parameters:
+    void (*label)(void) - symbol of the clip, see HostSim.h.
+  Returns:
+    Its address, or -1 for a symbol that is not a clip.
+  Remarks:
+    None.
+  ***************************************************************************/
+long hostTblAddress(void (*label)(void))
+{
+	long	address = HOST_PROGRAM_BASE;
+	int		i;
+
+	for(i = 0; i < hostProgramBlockCount; i++)
+	{
+		if(hostProgramBlocks[i].label == label)
+			return address;
+		address += 2L*hostProgramBlocks[i].length;
+	}
+	return -1;
+}
+
+/****************************************************************************
+  Function:
+    unsigned long hostProgramWord(long address)
+  Description:
+	Reads one 24 bit word of program memory.
+  Precondition:
+    None.
+  Parameters:
+    long address - even program memory address.
+  Returns:
+    The word, HOST_PROGRAM_ERASED outside the clips.
+  Remarks:
+    None.
+  ***************************************************************************/
+unsigned long hostProgramWord(long address)
+{
+	long	base = HOST_PROGRAM_BASE;
+	long	index;
+	int		i;
+
+	for(i = 0; i < hostProgramBlockCount; i++)
+	{
+		index = (address - base) >> 1;
+		if(index >= 0 && index < (long)hostProgramBlocks[i].length)
+			return hostProgramBlocks[i].words[index];
+		base += 2L*hostProgramBlocks[i].length;
+	}
+	return HOST_PROGRAM_ERASED;
+}
+
+/****************************************************************************
+  Function:
+    unsigned int hostDmaOffset(void * buffer)
+  Description:
+	Host __builtin_dmaoffset(): names a DMA buffer.
+  Precondition:
+    None.
+  Parameters:
+    void * buffer - buffer declared in DMA RAM.
+  Returns:
+    A small non-zero handle that hostDmaBuffer() turns back into the
+    buffer.
+  Remarks:
+    None.
+  ***************************************************************************/
+unsigned int hostDmaOffset(void * buffer)
+{
+	unsigned int i;
+
+	for(i = 0; i < HOST_DMA_BUFFERS; i++)
+	{
+		if(hostDmaBuffers[i] == 0)
+			hostDmaBuffers[i] = buffer;
+		if(hostDmaBuffers[i] == buffer)
+			return i + 1;
+	}
+	return 0;
+}
+
+void * hostDmaBuffer(unsigned int offset)
+{
+	if(offset == 0 || offset > HOST_DMA_BUFFERS)
+		return 0;
+	return hostDmaBuffers[offset - 1];
+}
+
+/****************************************************************************
+  Utility.s
+  ***************************************************************************/
+void Delay(unsigned int delay_count)
+{
+	hostAdvance((unsigned long long)delay_count*(GetInstructionClock()/1000));
+}
+
+void Delay_Us(unsigned int delayUs_count)
+{
+	hostAdvance((unsigned long long)delayUs_count*(GetInstructionClock()/1000000L));
+}
+
+void ReadProgramMemory(long programMemoryAddress, int * targetMemory, int size)
+{
+	unsigned long word;
+
+	for(; size > 0; size -= 2, programMemoryAddress += 2)
+	{
+		word			= hostProgramWord(programMemoryAddress);
+		*targetMemory++	= (short)(word & 0xFFFF);		// A 16 bit int on the device
+		*targetMemory++	= (int)((word >> 16) & 0xFF);
+	}
+}
+
+void ReadProgramMemoryWord(long programMemoryAddress, unsigned long * targetMemory)
+{
+	*targetMemory = hostProgramWord(programMemoryAddress);
+}
+
+void PackForG711(int * source, char * destination, int sizeOfSource)
+{
+	for(; sizeOfSource > 0; sizeOfSource -= 2, source += 2)
+	{
+		*destination++ = (char)(source[0] & 0xFF);
+		*destination++ = (char)((source[0] >> 8) & 0xFF);
+		*destination++ = (char)(source[1] & 0xFF);
+	}
+}
+
+int VectorMax(int numElems, int * srcV, int * maxIndex)
+{
+	int max = srcV[0];
+	int i;
+
+	*maxIndex = 0;
+	for(i = 1; i < numElems; i++)
+	{
+		if(srcV[i] >= max)
+		{
+			max			= srcV[i];
+			*maxIndex	= i;
+		}
+	}
+	return max;
+}
@@ -0,0 +1,35 @@
+# Turns the inline assembler bitmaps of src/Pictures.c into C arrays.
+# Each bitmap is declared extern, pointed to by a descriptor, and then
+# emitted byte by byte in asm(".byte ...") statements.
+function close_bitmap()
+{
+	if(bitmap == "")
+		return
+	print "};"
+	print descriptor
+	print ""
+	bitmap = ""
+}
+BEGIN {
+	print "/* Generated from src/Pictures.c by host/pictures.awk - do not edit */"
+	print ""
+}
+{ sub(/\r$/, "") }
+/^const struct/ { descriptor = $0; next }
+/^asm\("_L[0-9]+:"\)/ {
+	close_bitmap()
+	bitmap = $0
+	sub(/^asm\("_/, "", bitmap)
+	sub(/:.*/, "", bitmap)
+	print "char " bitmap "[] __attribute__((aligned(2))) = {"
+	next
+}
+/^asm\("\.byte/ && bitmap != "" {
+	line = $0
+	sub(/^asm\("\.byte[ \t]*/, "", line)
+	sub(/"\);.*/, "", line)
+	print "\t" line ","
+	next
+}
+/^\/\/\/\/\/\/\/\// { close_bitmap() }
+END { close_bitmap() }
@@ -0,0 +1,17 @@
+# Turns the __sfr__ declarations of the device header into storage.
+# Every register gets a 32 byte cell, and NAME and NAMEbits are both
+# aliases of it so a write through one reads back through the other.
+{ sub(/\r$/, "") }
+/^extern volatile .*__attribute__\(\(__sfr__\)\);/ {
+	name = $0
+	sub(/ *__attribute__.*/, "", name)
+	sub(/.* /, "", name)
+	base = name
+	sub(/bits$/, "", base)
+	if(!(base in cell))
+	{
+		cell[base] = 1
+		print "static union { unsigned char bytes[32]; unsigned int word; } hostSfr_" base " __attribute__((used));"
+	}
+	print "extern __typeof__(" name ") " name " __attribute__((alias(\"hostSfr_" base "\")));"
+}
@@ -0,0 +1,42 @@
+# Turns the .pword tables of src/Sounds/*.s into C arrays for the host
+# program memory, with an empty function per label for tbladdress.
+function close_clip()
+{
+	if(clip == "")
+		return
+	print "};"
+	print "void " clip "(void) {}"
+	print ""
+	clips[count++] = clip
+	clip = ""
+}
+BEGIN {
+	print "/* Generated from src/Sounds by host/sounds.awk - do not edit */"
+	print "#include \"HostSim.h\""
+	print ""
+}
+{ sub(/\r$/, "") }
+FNR == 1 { close_clip() }
+/^_[A-Za-z0-9_]+:/ {
+	close_clip()
+	clip = $0
+	sub(/^_/, "", clip)
+	sub(/:.*/, "", clip)
+	print "static const unsigned long " clip "_words[] = {"
+	next
+}
+/^\.pword/ && clip != "" {
+	line = $0
+	sub(/^\.pword[ \t]*/, "", line)
+	gsub(/[ \t]/, "", line)
+	print "\t" line ","
+}
+END {
+	close_clip()
+	print "const HOST_PROGRAM_BLOCK hostProgramBlocks[] ="
+	print "{"
+	for(i = 0; i < count; i++)
+		print "\t{ " clips[i] ", " clips[i] "_words, sizeof(" clips[i] "_words)/sizeof(" clips[i] "_words[0]) },"
+	print "};"
+	print "const int hostProgramBlockCount = " count ";"
+}
@@ -0,0 +1,198 @@
+/**********************************************************************
+* FileName:        		DrumTest.c
+* Dependencies:    		Header (.h) files if applicable, see below
+* Processor:       		Any host with gcc
+* Compiler:        		gcc
+*
+* Replays synthetic drum takes through drumFrameHook() of drum2.c, a
+* frame at a time as the audio fill calls it, and compares the samples
+* hits are started on with a schedule worked out here: each pass is
+* the take rounded up to whole grid steps, at least one, and a hit
+* quantised onto the end of a pass is left out. drum2.c is included
+* rather than linked so the hook and its state can be reached.
+************************************************************************/
+
+/************************************************************************
+ Header Includes
+ ************************************************************************/
+#include "HostTest.h"
+
+#define speakerActivateAt	DrumActivateAt			// Hits are recorded here instead of played
+#include "../../src/drum2.c"
+
+/************************************************************************
+ Constants
+ ************************************************************************/
+#define MAX_STARTS					2048
+#define PASSES						3
+#define TAKES						200
+#define FIRST_FRAME					123450UL			// Sample clock when playback starts
+
+/************************************************************************
+ Variables
+ ************************************************************************/
+static unsigned long	started[MAX_STARTS];			// Sample each hit was started on
+static unsigned long	startFrame[MAX_STARTS];			// Frame it was started from
+static unsigned int		starts;
+static unsigned long	expected[MAX_STARTS];
+static unsigned long	frame;							// Frame the hook is in
+static unsigned long	seed = 1;
+
+/****************************************************************************
+  Function:
+    void DrumActivateAt(long SpeechSegment, long SpeechSegmentSize, unsigned int codec, unsigned long startSample)
+  Description:
+	Stands in for speakerActivateAt(), recording the start sample.
+  Precondition:
+    None.
+  Parameters:
+    As speakerActivateAt().
+  Returns:
+    None
+  Remarks:
+    None.
+  ***************************************************************************/
+void DrumActivateAt(long SpeechSegment, long SpeechSegmentSize, unsigned int codec, unsigned long startSample)
+{
+	(void)SpeechSegment; (void)SpeechSegmentSize; (void)codec;
+	if(starts < MAX_STARTS)
+	{
+		startFrame[starts] = frame;
+		started[starts] = startSample;
+	}
+	starts++;
+}
+
+/****************************************************************************
+  Function:
+    static unsigned long Random(unsigned long range)
+  Description:
+	Pseudo random number, the same sequence every run.
+  Precondition:
+    None.
+  Parameters:
+    unsigned long range - number of values.
+  Returns:
+    0 to range-1.
+  Remarks:
+    None.
+  ***************************************************************************/
+static unsigned long Random(unsigned long range)
+{
+	seed = seed*1103515245UL + 12345UL;
+	return ((seed >> 16) & 0x7FFFFFFFUL) % range;
+}
+
+/****************************************************************************
+  Function:
+    static void Replay(const unsigned long * hits, unsigned int count, unsigned long length,
+                       unsigned long grid, unsigned int loop, const char * name)
+  Description:
+	Plays a take for PASSES pass lengths and checks every start.
+  Precondition:
+    None.
+  Parameters:
+    const unsigned long * hits - hit times in samples, the first 0.
+    unsigned int count - number of hits.
+    unsigned long length - samples from the first hit to the stop press.
+    unsigned long grid - quantise grid in samples, 0 for off.
+    unsigned int loop - nonzero to loop.
+    const char * name - take, for the messages.
+  Returns:
+    None
+  Remarks:
+    Hits quantised to the same step start together, so starts only
+    have to be in order, not apart.
+  ***************************************************************************/
+static void Replay(const unsigned long * hits, unsigned int count, unsigned long length,
+				   unsigned long grid, unsigned int loop, const char * name)
+{
+	unsigned long	pass, at, end;
+	unsigned int	hit, pending = 0, i, bad;
+
+	// The schedule: passes of the take rounded up to the grid, at least
+	// one step and one frame
+	pass = length;
+	if(grid != 0)
+		pass = (length/grid + (length % grid != 0))*grid;
+	if(pass < grid)
+		pass = grid;
+	if(pass < FRAME_SIZE)
+		pass = FRAME_SIZE;
+	end = FIRST_FRAME + PASSES*pass;
+	for(at = FIRST_FRAME; at < end && pending < MAX_STARTS; at += pass)
+	{
+		for(hit = 0; hit < count && pending < MAX_STARTS; hit++)
+			if(drumQuantise(hits[hit], grid) < pass)
+				expected[pending++] = at + drumQuantise(hits[hit], grid);
+		if(!loop)
+			break;
+	}
+
+	for(hit = 0; hit < count; hit++)
+		drumHit[hit] = hits[hit];
+	drumHits	= count;
+	drumLength	= length;
+	drumGrid	= grid;
+	drumLoop	= loop;
+	drumRunning	= 0;
+	starts		= 0;
+	for(frame = FIRST_FRAME; frame < end; frame += FRAME_SIZE)
+		drumFrameHook(frame);
+
+	// Starts at or after end belong to the next pass, the hook may have
+	// scheduled them from the last frame
+	while(starts > 0 && starts <= MAX_STARTS && started[starts - 1] >= end)
+		starts--;
+	HOST_CHECK(starts == pending, "%s grid %lu loop %u: %u hits started, %u expected", name, grid, loop, starts, pending);
+	for(i = 0, bad = 0; i < starts && i < pending && !bad; i++)
+	{
+		bad = 1;
+		if(started[i] != expected[i])
+			HOST_CHECK(0, "%s grid %lu loop %u: start %u on sample %lu, expected %lu", name, grid, loop, i,
+				started[i] - FIRST_FRAME, expected[i] - FIRST_FRAME);
+		else if(started[i] < startFrame[i] || started[i] - startFrame[i] >= FRAME_SIZE)
+			HOST_CHECK(0, "%s grid %lu loop %u: start %u on sample %lu from the frame at %lu", name, grid, loop, i,
+				started[i] - FIRST_FRAME, startFrame[i] - FIRST_FRAME);
+		else if(i > 0 && started[i] < started[i - 1])
+			HOST_CHECK(0, "%s grid %lu loop %u: start %u on sample %lu, before start %u", name, grid, loop, i,
+				started[i] - FIRST_FRAME, i - 1);
+		else
+			bad = 0;
+	}
+	HOST_CHECK(!bad, "%s grid %lu loop %u: starts differ", name, grid, loop);
+}
+
+int main(void)
+{
+	static const unsigned long	tap[] = { 0 };
+	static const unsigned long	late[] = { 0, 1000, 1990 };
+	unsigned long				hits[DRUM_MAX_HITS];
+	unsigned long				grid, length;
+	unsigned int				take, count, hit, g;
+
+	// A single tap stopped within half a 250 ms step loops once a step,
+	// not once a frame
+	Replay(tap, 1, 100, 250L*FS/1000, 1, "short take");
+	HOST_CHECK(starts == PASSES, "short take started %u times in %d steps", starts, PASSES);
+
+	// The last hit quantises to 2000 samples, the end of the pass, where
+	// the first hit of the next pass is
+	Replay(late, 3, 1995, 50L*FS/1000, 1, "late hit");
+
+	for(take = 0; take < TAKES; take++)
+	{
+		count = 1 + Random(12);
+		hits[0] = 0;
+		for(hit = 1; hit < count; hit++)
+			hits[hit] = hits[hit - 1] + 1 + Random(FS/2);
+		length = hits[count - 1] + 1 + Random(FS/4);
+		for(g = 0; g < DRUM_GRIDS; g++)
+		{
+			grid = (unsigned long)drumGridMs[g]*FS/1000;
+			Replay(hits, count, length, grid, 1, "random take");
+			Replay(hits, count, length, grid, 0, "random take");
+		}
+	}
+	return hostTestEnd("DrumTest");
+}
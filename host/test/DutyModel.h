@@ -0,0 +1,51 @@
+/**********************************************************************
+* FileName:        		DutyModel.h
+* Dependencies:    		Speaker.h
+* Processor:       		Any host with gcc
+* Compiler:        		gcc
+*
+* Reference model of speakerLinToDuty() of src/Speaker.c as it was
+* before its divide was taken out: the offset times MAX_PWM_PERIOD
+* divided by INPUT_RANGE, in the 16 bit int and 32 bit long of the
+* device. SpeakerTest.c checks speakerLinToDuty() against it for every
+* sample and ImaAdpcmBench.c times the two.
+************************************************************************/
+
+#ifndef	__DUTY_MODEL_H__
+#define	__DUTY_MODEL_H__
+
+/************************************************************************
+ Header Includes
+ ************************************************************************/
+#include "Speaker.h"
+
+/****************************************************************************
+  Function:
+    unsigned int modelLinToDuty(int sample)
+  Description:
+	Converts a linear sample to a duty cycle by a long divide.
+  Precondition:
+    None.
+  Parameters:
+    int sample - 16 bit linear sample.
+  Returns:
+    Duty cycle between 1 and MAX_PWM_PERIOD.
+  Remarks:
+    The product wraps for the lowest sample, as it did on the device,
+    and the quotient is cut to 16 bits before the clamps.
+  ***************************************************************************/
+static inline unsigned int modelLinToDuty(int sample)
+{
+	unsigned short	offset = (unsigned short)(sample - (LOWEST_INPUT_VALUE));
+	unsigned int	product = offset * MAX_PWM_PERIOD;
+	unsigned short	duty;
+
+	duty = (unsigned short)(product/(unsigned int)INPUT_RANGE);
+	if(duty > MAX_PWM_PERIOD)
+		duty = MAX_PWM_PERIOD - 1;
+	if(duty <= 0)
+		duty = 1;
+	return duty;
+}
+
+#endif
@@ -0,0 +1,137 @@
+/**********************************************************************
+* FileName:        		G711Bench.c
+* Dependencies:    		Header (.h) files if applicable, see below
+* Processor:       		Any host with gcc
+* Compiler:        		gcc
+*
+* Times the table codec of G711Codec.c against G711Model.h, the
+* branching algorithm of G711.s, in host nanoseconds per sample. The
+* samples are a sweep over the whole 16 bit range, so every segment
+* and both signs are taken equally often. G711_BENCH_PASSES sets the
+* passes over it.
+************************************************************************/
+
+/************************************************************************
+ Header Includes
+ ************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "G711Model.h"
+#include "G711.h"
+
+/************************************************************************
+ Constants
+ ************************************************************************/
+#define SAMPLES						65536
+#define PASSES_DEFAULT				200
+
+/************************************************************************
+ Variables
+ ************************************************************************/
+static int		samples[SAMPLES];
+static char		codes[SAMPLES];
+static int		decoded[SAMPLES];
+static int		passes;
+
+/****************************************************************************
+  Function:
+    static double Now(void)
+  Description:
+	Reads the monotonic clock.
+  Precondition:
+    None.
+  Parameters:
+    None.
+  Returns:
+    Nanoseconds.
+  Remarks:
+    None.
+  ***************************************************************************/
+static double Now(void)
+{
+	struct timespec	now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec*1e9 + now.tv_nsec;
+}
+
+/****************************************************************************
+  Function:
+    static void Report(const char * name, double start)
+  Description:
+	Prints the time per sample since start.
+  Precondition:
+    None.
+  Parameters:
+    const char * name - what was timed.
+    double start - Now() before the passes.
+  Returns:
+    None
+  Remarks:
+    None.
+  ***************************************************************************/
+static void Report(const char * name, double start)
+{
+	printf("%-24s %6.2f ns/sample\n", name, (Now() - start)/((double)passes*SAMPLES));
+}
+
+int main(void)
+{
+	const char *	value = getenv("G711_BENCH_PASSES");
+	double			start;
+	long			checksum = 0;
+	int				pass, i;
+
+	passes = value ? atoi(value) : PASSES_DEFAULT;
+	if(passes < 1)
+		passes = 1;
+	for(i = 0; i < SAMPLES; i++)
+		samples[i] = (short)(i*40503);			// Odd step, so every value once
+
+	start = Now();
+	for(pass = 0; pass < passes; pass++)
+		G711Lin2Alaw(samples, codes, SAMPLES);
+	Report("G711Codec.c Lin2Alaw", start);
+	start = Now();
+	for(pass = 0; pass < passes; pass++)
+		for(i = 0; i < SAMPLES; i++)
+			codes[i] = (char)modelLin2Alaw(samples[i]);
+	Report("G711.s model Lin2Alaw", start);
+
+	start = Now();
+	for(pass = 0; pass < passes; pass++)
+		G711Alaw2Lin(codes, decoded, SAMPLES);
+	Report("G711Codec.c Alaw2Lin", start);
+	start = Now();
+	for(pass = 0; pass < passes; pass++)
+		for(i = 0; i < SAMPLES; i++)
+			decoded[i] = modelAlaw2Lin((unsigned char)codes[i]);
+	Report("G711.s model Alaw2Lin", start);
+
+	start = Now();
+	for(pass = 0; pass < passes; pass++)
+		G711Lin2Ulaw(samples, codes, SAMPLES);
+	Report("G711Codec.c Lin2Ulaw", start);
+	start = Now();
+	for(pass = 0; pass < passes; pass++)
+		for(i = 0; i < SAMPLES; i++)
+			codes[i] = (char)modelLin2Ulaw(samples[i]);
+	Report("G711.s model Lin2Ulaw", start);
+
+	start = Now();
+	for(pass = 0; pass < passes; pass++)
+		G711Ulaw2Lin(codes, decoded, SAMPLES);
+	Report("G711Codec.c Ulaw2Lin", start);
+	start = Now();
+	for(pass = 0; pass < passes; pass++)
+		for(i = 0; i < SAMPLES; i++)
+			decoded[i] = modelUlaw2Lin((unsigned char)codes[i]);
+	Report("G711.s model Ulaw2Lin", start);
+
+	// Keeps the passes from being optimised away
+	for(i = 0; i < SAMPLES; i++)
+		checksum += decoded[i];
+	printf("checksum %ld\n", checksum);
+	return 0;
+}
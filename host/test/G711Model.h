@@ -0,0 +1,203 @@
+/**********************************************************************
+* FileName:        		G711Model.h
+* Dependencies:    		None
+* Processor:       		Any host with gcc
+* Compiler:        		gcc
+*
+* Reference model of the PIC24 routines in src/G711.s, one sample at a
+* time. Each follows its routine instruction by instruction on 16 bit
+* working registers, so neg, ff1l and the unsigned compares behave as
+* they do on the device. G711Test.c checks G711Codec.c against it and
+* G711Bench.c times the two.
+************************************************************************/
+
+#ifndef	__G711_MODEL_H__
+#define	__G711_MODEL_H__
+
+/************************************************************************
+ Constants
+ ************************************************************************/
+#define MODEL_BIAS					0x84
+#define MODEL_ULAW_MAXLIMIT			32635
+#define MODEL_ALAW_MAXLIMIT			32767
+
+/************************************************************************
+ Data Structures
+ ************************************************************************/
+typedef unsigned short	WREG;								// A PIC24 working register
+
+/****************************************************************************
+  Function:
+    int modelFf1l(WREG w, int * carry)
+  Description:
+	ff1l: position of the first set bit from the left.
+  Precondition:
+    None.
+  Parameters:
+    WREG w - value searched.
+    int * carry - set if w is zero.
+  Returns:
+    1 for bit 15 through 16 for bit 0, 0 if w is zero.
+  Remarks:
+    None.
+  ***************************************************************************/
+static inline int modelFf1l(WREG w, int * carry)
+{
+	int		position;
+
+	*carry = (w == 0);
+	for(position = 1; position <= 16; position++, w <<= 1)
+		if(w & 0x8000)
+			return position;
+	return 0;
+}
+
+/****************************************************************************
+  Function:
+    unsigned char modelLin2Ulaw(int sample)
+  Description:
+	_G711Lin2Ulaw for one sample.
+  Precondition:
+    None.
+  Parameters:
+    int sample - 16 bit linear sample.
+  Returns:
+    u-law code.
+  Remarks:
+    __CCITT_ZERO_TRAP is 0 in G711.s.
+  ***************************************************************************/
+static inline unsigned char modelLin2Ulaw(int sample)
+{
+	WREG	w0, w1, w2, w3, w4 = 0;
+	int		carry;
+
+	w0 = (WREG)sample;
+	w1 = (WREG)((w0 & 0x8000) >> 8);						// and, lsr
+	if(w0 & 0x8000)											// btsc, neg
+		w0 = (WREG)-w0;
+	if(w0 >= MODEL_ULAW_MAXLIMIT)							// cp, bra NC
+		w0 = MODEL_ULAW_MAXLIMIT;
+	w0 = (WREG)(w0 + MODEL_BIAS);
+	w2 = (WREG)modelFf1l(w0, &carry);
+	if(!carry)
+	{
+		w2 = (WREG)(9 - w2);
+		if(w2 & 0x8000)										// bra NN
+			w2 = 0;
+		w3 = (WREG)(w2 + 3);
+		w4 = (WREG)((w0 >> w3) & 0x000F);
+		w2 = (WREG)(w2 << 4);
+		w4 = (WREG)(w4 | w2 | w1);
+	}
+	w0 = (WREG)(~w4 & 0x00FF);								// com, and
+	return (unsigned char)w0;
+}
+
+/****************************************************************************
+  Function:
+    int modelUlaw2Lin(unsigned char code)
+  Description:
+	_G711Ulaw2Lin for one code.
+  Precondition:
+    None.
+  Parameters:
+    unsigned char code - u-law code.
+  Returns:
+    16 bit linear sample.
+  Remarks:
+    mov.b only loads the low byte of W0, and com inverts all 16 bits,
+    but only the low byte is masked out afterwards.
+  ***************************************************************************/
+static inline int modelUlaw2Lin(unsigned char code)
+{
+	WREG	w0, w1, w2, w4;
+
+	w0 = (WREG)~code;
+	w1 = (WREG)(w0 & 0x0080);
+	w2 = (WREG)(((w0 & 0x0070) >> 4) + 2);					// and, lsr, inc2
+	w4 = (WREG)(w0 & 0x000F);
+	w4 = (WREG)(((w4 | 0x10) << 1) + 1);					// ior, sl, inc
+	w4 = (WREG)(w4 << w2);
+	w4 = (WREG)(w4 - MODEL_BIAS);
+	if(w1 & 0x0080)
+		w4 = (WREG)-w4;
+	return (short)w4;
+}
+
+/****************************************************************************
+  Function:
+    unsigned char modelLin2Alaw(int sample)
+  Description:
+	_G711Lin2Alaw for one sample.
+  Precondition:
+    None.
+  Parameters:
+    int sample - 16 bit linear sample.
+  Returns:
+    A-law code.
+  Remarks:
+    A zero input is written as 0x55 before any other step.
+  ***************************************************************************/
+static inline unsigned char modelLin2Alaw(int sample)
+{
+	WREG	w0, w1, w2, w3, w4;
+	int		carry;
+
+	w0 = (WREG)sample;
+	if(w0 == 0)												// cp0, bra nz
+		return 0x55;
+	w1 = (WREG)((w0 & 0x8000) >> 8);
+	if(w0 & 0x8000)
+		w0 = (WREG)-w0;
+	if(w0 >= MODEL_ALAW_MAXLIMIT)
+		w0 = MODEL_ALAW_MAXLIMIT;
+	w2 = (WREG)modelFf1l(w0, &carry);
+	if(carry || (short)w2 >= 9)								// bra C, cp, bra GE
+	{
+		w2 = 0;
+		w3 = 4;
+	}
+	else
+	{
+		w2 = (WREG)(9 - w2);
+		w3 = (WREG)(w2 + 3);
+	}
+	w4 = (WREG)((w0 >> w3) & 0x000F);
+	w2 = (WREG)(w2 << 4);
+	w4 = (WREG)(w4 | w2 | w1);
+	return (unsigned char)(w4 ^ 0xD5);						// xor.b
+}
+
+/****************************************************************************
+  Function:
+    int modelAlaw2Lin(unsigned char code)
+  Description:
+	_G711Alaw2Lin for one code.
+  Precondition:
+    None.
+  Parameters:
+    unsigned char code - A-law code.
+  Returns:
+    16 bit linear sample.
+  Remarks:
+    W0 is cleared before mov.b, so its high byte is zero.
+  ***************************************************************************/
+static inline int modelAlaw2Lin(unsigned char code)
+{
+	WREG	w0, w1, w2, w4;
+
+	w0 = (WREG)(code ^ 0xD5);
+	w1 = (WREG)(w0 & 0x80);
+	w2 = (WREG)((w0 & 0x70) >> 4);
+	w4 = (WREG)((w0 & 0xF) << 4);
+	w0 = (WREG)(w4 + 8);
+	if(w2 != 0)
+		w0 = (WREG)(w0 + 0x100);
+	if((short)w2 > 1)										// cp, bra le
+		w0 = (WREG)(w0 << (w2 - 1));
+	if(w1 & 0x80)
+		w0 = (WREG)-w0;
+	return (short)w0;
+}
+
+#endif
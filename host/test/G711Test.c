@@ -0,0 +1,173 @@
+/**********************************************************************
+* FileName:        		G711Test.c
+* Dependencies:    		Header (.h) files if applicable, see below
+* Processor:       		Any host with gcc
+* Compiler:        		gcc
+*
+* Checks the table codec of G711Codec.c against G711Model.h, the
+* reference model of G711.s: every A-law and u-law code decoded, every
+* 16 bit sample encoded, and the zero code, the clip limits and an
+* empty call on their own.
+************************************************************************/
+
+/************************************************************************
+ Header Includes
+ ************************************************************************/
+#include "HostTest.h"
+#include "G711Model.h"
+#include "G711.h"
+
+/************************************************************************
+ Constants
+ ************************************************************************/
+#define CODES						256
+#define SAMPLES						65536
+#define FIRST_SAMPLE				(-32768)
+#define GUARD						0x5A				// Written around buffers to catch overruns
+
+/************************************************************************
+ Variables
+ ************************************************************************/
+static char		codes[SAMPLES + 1];
+static int		samples[SAMPLES + 1];
+
+/****************************************************************************
+  Function:
+    static void TestDecode(void)
+  Description:
+	Decodes all 256 codes of each law in one call.
+  Precondition:
+    None.
+  Parameters:
+    None.
+  Returns:
+    None
+  Remarks:
+    None.
+  ***************************************************************************/
+static void TestDecode(void)
+{
+	int		code;
+
+	for(code = 0; code < CODES; code++)
+		codes[code] = (char)code;
+
+	samples[CODES] = GUARD;
+	G711Alaw2Lin(codes, samples, CODES);
+	for(code = 0; code < CODES; code++)
+		HOST_CHECK(samples[code] == modelAlaw2Lin((unsigned char)code),
+			"A-law 0x%02X decodes to %d, G711.s gives %d", code, samples[code], modelAlaw2Lin((unsigned char)code));
+	HOST_CHECK(samples[CODES] == GUARD, "A-law decode wrote past size");
+
+	G711Ulaw2Lin(codes, samples, CODES);
+	for(code = 0; code < CODES; code++)
+		HOST_CHECK(samples[code] == modelUlaw2Lin((unsigned char)code),
+			"u-law 0x%02X decodes to %d, G711.s gives %d", code, samples[code], modelUlaw2Lin((unsigned char)code));
+	HOST_CHECK(samples[CODES] == GUARD, "u-law decode wrote past size");
+}
+
+/****************************************************************************
+  Function:
+    static void TestEncode(void)
+  Description:
+	Encodes every 16 bit sample with each law in one call.
+  Precondition:
+    None.
+  Parameters:
+    None.
+  Returns:
+    None
+  Remarks:
+    None.
+  ***************************************************************************/
+static void TestEncode(void)
+{
+	int		i;
+
+	for(i = 0; i < SAMPLES; i++)
+		samples[i] = FIRST_SAMPLE + i;
+
+	codes[SAMPLES] = GUARD;
+	G711Lin2Alaw(samples, codes, SAMPLES);
+	for(i = 0; i < SAMPLES; i++)
+		HOST_CHECK((unsigned char)codes[i] == modelLin2Alaw(samples[i]),
+			"%d encodes to A-law 0x%02X, G711.s gives 0x%02X", samples[i], (unsigned char)codes[i], modelLin2Alaw(samples[i]));
+	HOST_CHECK(codes[SAMPLES] == GUARD, "A-law encode wrote past size");
+
+	G711Lin2Ulaw(samples, codes, SAMPLES);
+	for(i = 0; i < SAMPLES; i++)
+		HOST_CHECK((unsigned char)codes[i] == modelLin2Ulaw(samples[i]),
+			"%d encodes to u-law 0x%02X, G711.s gives 0x%02X", samples[i], (unsigned char)codes[i], modelLin2Ulaw(samples[i]));
+	HOST_CHECK(codes[SAMPLES] == GUARD, "u-law encode wrote past size");
+}
+
+/****************************************************************************
+  Function:
+    static void TestLimits(void)
+  Description:
+	Checks the zero code, the clip limits and a call with no samples.
+  Precondition:
+    None.
+  Parameters:
+    None.
+  Returns:
+    None
+  Remarks:
+    The expected codes are spelled out rather than taken from the model,
+    so a slip shared by the model and the codec still shows.
+  ***************************************************************************/
+static void TestLimits(void)
+{
+	int		input[3], sample;
+	char	output[3];
+
+	// ALAW_ZERO_CODE, where the sign and segment arithmetic gives 0xD5
+	input[0] = 0;
+	input[1] = 1;
+	input[2] = -1;
+	G711Lin2Alaw(input, output, 3);
+	HOST_CHECK((unsigned char)output[0] == 0x55, "A-law zero is 0x%02X, not 0x55", (unsigned char)output[0]);
+	HOST_CHECK((unsigned char)output[1] == 0xD5, "A-law +1 is 0x%02X, not 0xD5", (unsigned char)output[1]);
+	HOST_CHECK((unsigned char)output[2] == 0x55, "A-law -1 is 0x%02X, not 0x55", (unsigned char)output[2]);
+
+	// ALAW_MAXLIMIT: the top of the scale, and -32768 whose negation is
+	// 0x8000, encode as the largest code of their sign
+	input[0] = 32767;
+	input[1] = -32767;
+	input[2] = -32768;
+	G711Lin2Alaw(input, output, 3);
+	HOST_CHECK((unsigned char)output[0] == 0xAA, "A-law 32767 is 0x%02X, not 0xAA", (unsigned char)output[0]);
+	HOST_CHECK((unsigned char)output[1] == 0x2A, "A-law -32767 is 0x%02X, not 0x2A", (unsigned char)output[1]);
+	HOST_CHECK((unsigned char)output[2] == 0x2A, "A-law -32768 is 0x%02X, not 0x2A", (unsigned char)output[2]);
+
+	// CLIP: every magnitude from CLIP up encodes as CLIP does
+	for(sample = CLIP; sample <= 32768; sample++)
+	{
+		input[0] = CLIP;
+		input[1] = (sample < 32768) ? sample : 32767;
+		input[2] = -sample;
+		G711Lin2Ulaw(input, output, 3);
+		HOST_CHECK((unsigned char)output[0] == 0x80, "u-law CLIP is 0x%02X, not 0x80", (unsigned char)output[0]);
+		HOST_CHECK(output[1] == output[0], "u-law %d is 0x%02X, CLIP 0x%02X", input[1], (unsigned char)output[1], (unsigned char)output[0]);
+		HOST_CHECK((unsigned char)output[2] == 0x00, "u-law %d is 0x%02X, not 0x00", input[2], (unsigned char)output[2]);
+	}
+
+	// size <= 0 writes nothing, as G711.s returns before its loop
+	output[0] = GUARD;
+	input[0] = 0;
+	G711Lin2Alaw(input, output, 0);
+	G711Lin2Ulaw(input, output, -1);
+	HOST_CHECK(output[0] == GUARD, "encode with no samples wrote 0x%02X", (unsigned char)output[0]);
+	input[0] = GUARD;
+	G711Alaw2Lin(output, input, 0);
+	G711Ulaw2Lin(output, input, -1);
+	HOST_CHECK(input[0] == GUARD, "decode with no codes wrote %d", input[0]);
+}
+
+int main(void)
+{
+	TestDecode();
+	TestEncode();
+	TestLimits();
+	return hostTestEnd("G711Test");
+}
@@ -0,0 +1,355 @@
+/**********************************************************************
+* FileName:        		GOLBudgetTest.c
+* Dependencies:    		Header (.h) files if applicable, see below
+* Processor:       		Any host with gcc
+* Compiler:        		gcc
+*
+* Checks the time slices of GOLDrawBudget() of GOL.c. GOL.c is included
+* rather than linked so its clock moves on by a fixed step at every
+* read, which makes the slices end at the same places every run. A
+* screen of a full screen static text, a slider and a framed static
+* text goes through whole redraws, thumb moves and GOLRedrawRec()
+* areas, once drawn by GOLDraw() and once a slice at a time with the
+* color, cursor, clipping region and line style disturbed between
+* slices. Every frame has to end on the same glass, and the objects
+* have to have stopped part way. Then a pass is cut short part way
+* into an object by GOLFree() and by GOLNewList(), and the screen
+* drawn next has to come out as it does on its own.
+************************************************************************/
+
+/************************************************************************
+ Header Includes
+ ************************************************************************/
+#include <stdlib.h>
+#include "HostTest.h"
+#include "HostSim.h"
+
+#define timebaseCycles		GOLBudgetTestNow		// Moves on at every read
+#include "../../Graphics/GOL.c"
+#undef timebaseCycles
+
+/************************************************************************
+ Constants
+ ************************************************************************/
+#define WIDTH						HOST_DISPLAY_WIDTH
+#define HEIGHT						HOST_DISPLAY_HEIGHT
+#define FRAMES						600
+#define CYCLES_PER_READ				40					// Clock step at each read
+#define MOST_SLICE_US				40
+#define CUTS						10
+
+/************************************************************************
+ Variables
+ ************************************************************************/
+static DWORD			now;
+static unsigned long	seed;
+static unsigned long	stopped;						// Calls that left an object part way
+static XCHAR			text[] = "Tempo 120 BPM\n4/4 accent on 1\nA4 440.0 Hz\n-3 cents";
+static XCHAR			footer[] = "Budget";
+static XCHAR			other[] = "Other screen\nwith two lines";
+static SLIDER *			pSlider;
+static BYTE				glass[FRAMES][HEIGHT][WIDTH];
+
+/****************************************************************************
+  Function:
+    DWORD GOLBudgetTestNow(void)
+  Description:
+	Stands in for timebaseCycles() in GOL.c.
+  Precondition:
+    None.
+  Parameters:
+    None.
+  Returns:
+    A clock CYCLES_PER_READ on from the last read.
+  Remarks:
+    None.
+  ***************************************************************************/
+DWORD GOLBudgetTestNow(void)
+{
+	now += CYCLES_PER_READ;
+	return now;
+}
+
+/****************************************************************************
+  Function:
+    static unsigned int Random(unsigned int range)
+  Description:
+	Pseudo random number, the same sequence every run.
+  Precondition:
+    None.
+  Parameters:
+    unsigned int range - number of values.
+  Returns:
+    0 to range-1.
+  Remarks:
+    None.
+  ***************************************************************************/
+static unsigned int Random(unsigned int range)
+{
+	seed = seed*1103515245UL + 12345UL;
+	return (unsigned int)((seed >> 16) & 0x7FFF) % range;
+}
+
+/****************************************************************************
+  Function:
+    static void Screen(void)
+  Description:
+	Clears the display and builds the screen of the frames.
+  Precondition:
+    GOLInit() has been called.
+  Parameters:
+    None.
+  Returns:
+    None
+  Remarks:
+    The list before is freed.
+  ***************************************************************************/
+static void Screen(void)
+{
+	GOLFree();
+	SetClip(CLIP_DISABLE);
+	SetColor(BLACK);
+	ClearDevice();
+	StCreate(1, 0, 0, GetMaxX(), GetMaxY(), ST_DRAW, text, NULL);
+	pSlider = SldCreate(2, 0, 34, GetMaxX(), 48, SLD_DRAW, 100, 5, 50, NULL);
+	StCreate(3, 20, 50, GetMaxX() - 20, GetMaxY(), ST_DRAW|ST_FRAME|ST_CENTER_ALIGN, footer, NULL);
+}
+
+/****************************************************************************
+  Function:
+    static void Disturb(void)
+  Description:
+	Changes the drawing state as other drawing between slices would.
+  Precondition:
+    None.
+  Parameters:
+    None.
+  Returns:
+    None
+  Remarks:
+    Uses rand(), so the frames pick the same changes either way. The
+    clipping is left off and the line style is changed only part way
+    into an object, as a whole object is drawn with the application's
+    clipping and the draw functions take solid thin lines for granted
+    at their start.
+  ***************************************************************************/
+static void Disturb(void)
+{
+	SetColor((rand() & 1) ? WHITE : BLACK);
+	MoveTo(rand() % WIDTH, rand() % HEIGHT);
+	SetClipRgn(rand() % 20, rand() % 20, WIDTH - 1 - rand() % 20, HEIGHT - 1 - rand() % 20);
+	SetClip(CLIP_DISABLE);
+	if(_drawResume)
+	{
+		SetLineType(rand() % 3);
+		SetLineThickness(rand() % 2);
+	}
+}
+
+/****************************************************************************
+  Function:
+    static void Change(int frame)
+  Description:
+	Makes the change of a frame.
+  Precondition:
+    None.
+  Parameters:
+    int frame - frame number.
+  Returns:
+    None
+  Remarks:
+    None.
+  ***************************************************************************/
+static void Change(int frame)
+{
+	OBJ_HEADER *	pObj;
+	SHORT			left, top;
+
+	switch(frame % 3)
+	{
+		case 0:
+			for(pObj = GOLGetList(); pObj != NULL; pObj = pObj->pNxtObj)
+				GOLRedraw(pObj);
+			break;
+		case 1:
+			SldSetPos(pSlider, Random(SldGetRange(pSlider) + 1));
+			break;
+		default:
+			left	= (SHORT)Random(WIDTH);
+			top		= (SHORT)Random(HEIGHT);
+			GOLRedrawRec(left, top, left + (SHORT)Random(WIDTH/2), top + (SHORT)Random(HEIGHT/2));
+			break;
+	}
+}
+
+/****************************************************************************
+  Function:
+    static void Read(BYTE pixels[HEIGHT][WIDTH])
+  Description:
+	Copies the glass.
+  Precondition:
+    None.
+  Parameters:
+    BYTE pixels[HEIGHT][WIDTH] - where to.
+  Returns:
+    None
+  Remarks:
+    None.
+  ***************************************************************************/
+static void Read(BYTE pixels[HEIGHT][WIDTH])
+{
+	int		x, y;
+
+	for(y = 0; y < HEIGHT; y++)
+		for(x = 0; x < WIDTH; x++)
+			pixels[y][x] = (BYTE)hostDisplayPixel(x, y);
+}
+
+/****************************************************************************
+  Function:
+    static int Differs(BYTE pixels[HEIGHT][WIDTH])
+  Description:
+	Compares the glass with a copy.
+  Precondition:
+    None.
+  Parameters:
+    BYTE pixels[HEIGHT][WIDTH] - copy.
+  Returns:
+    Index of the first pixel that differs, -1 if none does.
+  Remarks:
+    None.
+  ***************************************************************************/
+static int Differs(BYTE pixels[HEIGHT][WIDTH])
+{
+	int		x, y;
+
+	for(y = 0; y < HEIGHT; y++)
+		for(x = 0; x < WIDTH; x++)
+			if(hostDisplayPixel(x, y) != pixels[y][x])
+				return y*WIDTH + x;
+	return -1;
+}
+
+/****************************************************************************
+  Function:
+    static void TestSlices(void)
+  Description:
+	Draws the frames with GOLDraw() and then in time slices.
+  Precondition:
+    None.
+  Parameters:
+    None.
+  Returns:
+    None
+  Remarks:
+    One check per frame, reporting the first pixel that differs.
+  ***************************************************************************/
+static void TestSlices(void)
+{
+	int		frame, bad;
+
+	seed = 1;
+	Screen();
+	for(frame = 0; frame < FRAMES; frame++)
+	{
+		Change(frame);
+		while(!GOLDraw());
+		Read(glass[frame]);
+	}
+
+	seed = 1;
+	srand(1);
+	Screen();
+	for(frame = 0; frame < FRAMES; frame++)
+	{
+		Change(frame);
+		while(!GOLDrawBudget((WORD)(rand() % MOST_SLICE_US)))
+		{
+			if(_drawResume)
+				stopped++;
+			Disturb();
+		}
+		bad = Differs(glass[frame]);
+		HOST_CHECK(bad < 0, "frame %d: pixel %d,%d is %d, GOLDraw() gives %d", frame, bad % WIDTH, bad / WIDTH,
+			glass[frame][bad / WIDTH][bad % WIDTH] ^ 1, glass[frame][bad / WIDTH][bad % WIDTH]);
+	}
+	HOST_CHECK(stopped > FRAMES, "objects stopped part way only %lu times", stopped);
+}
+
+/****************************************************************************
+  Function:
+    static void TestAbort(int freeList)
+  Description:
+	Cuts a pass short part way into an object and draws another
+	screen.
+  Precondition:
+    None.
+  Parameters:
+    int freeList - nonzero to end the pass by GOLFree(), else by
+                   GOLNewList().
+  Returns:
+    None
+  Remarks:
+    The other screen is drawn on its own first for the glass to
+    compare with. Its static text comes first, as the one the pass is
+    cut short in, so a draw function that kept its place would carry
+    on there. The pass is cut after each of the first CUTS stops.
+  ***************************************************************************/
+static void TestAbort(int freeList)
+{
+	const char *	how = freeList ? "GOLFree()" : "GOLNewList()";
+	OBJ_HEADER *	pSave = NULL;
+	int				cut, stops, bad;
+
+	GOLFree();
+	SetClip(CLIP_DISABLE);
+	SetColor(BLACK);
+	ClearDevice();
+	StCreate(4, 0, 0, GetMaxX(), GetMaxY(), ST_DRAW|ST_CENTER_ALIGN, other, NULL);
+	while(!GOLDraw());
+	Read(glass[0]);
+
+	for(cut = 1; cut <= CUTS; cut++)
+	{
+		Screen();
+		stops = 0;
+		while(!GOLDrawBudget(0))
+			if(_drawResume && ++stops == cut)
+				break;
+		HOST_CHECK(_drawResume, "%s cut %d: the pass ended first", how, cut);
+
+		if(freeList)
+			GOLFree();
+		else
+		{
+			pSave = GOLGetList();
+			GOLNewList();
+		}
+		HOST_CHECK(!_drawResume && _pDrawObj == NULL && _damageCount == 0, "%s cut %d: pass still under way", how, cut);
+
+		SetClip(CLIP_DISABLE);
+		SetColor(BLACK);
+		ClearDevice();
+		StCreate(4, 0, 0, GetMaxX(), GetMaxY(), ST_DRAW|ST_CENTER_ALIGN, other, NULL);
+		while(!GOLDraw());
+		bad = Differs(glass[0]);
+		HOST_CHECK(bad < 0, "%s cut %d: pixel %d,%d is %d, drawn on its own it is %d", how, cut,
+			bad % WIDTH, bad / WIDTH, glass[0][bad / WIDTH][bad % WIDTH] ^ 1, glass[0][bad / WIDTH][bad % WIDTH]);
+
+		// Free the list kept aside too
+		if(!freeList)
+		{
+			GOLFree();
+			GOLSetList(pSave);
+		}
+	}
+}
+
+int main(void)
+{
+	GOLInit();
+	TestSlices();
+	TestAbort(1);
+	TestAbort(0);
+	return hostTestEnd("GOLBudgetTest");
+}
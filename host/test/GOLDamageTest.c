@@ -0,0 +1,291 @@
+/**********************************************************************
+* FileName:        		GOLDamageTest.c
+* Dependencies:    		Header (.h) files if applicable, see below
+* Processor:       		Any host with gcc
+* Compiler:        		gcc
+*
+* Golden image test of the damage redraw of GOL.c. A screen of a
+* slider, static texts and a static text over them is changed the ways
+* that add damage: the slider thumb moves through SldRedrawThumb(),
+* parts of the screen are scribbled over and handed to GOLRedrawRec(),
+* more of them at once than GOL_DAMAGE_RECS holds so the list has to
+* merge, and the top static text is hidden. The flushed glass of
+* HostDisplay.c after each damage redraw has to match the one left by
+* putting the screen back as it was before it and drawing every object
+* whole. The pixels no object draws, between objects and inside their
+* indents, keep the scribbles either way.
+************************************************************************/
+
+/************************************************************************
+ Header Includes
+ ************************************************************************/
+#include "HostTest.h"
+#include "HostSim.h"
+#include "Graphics/Graphics.h"
+
+/************************************************************************
+ Constants
+ ************************************************************************/
+#define WIDTH						HOST_DISPLAY_WIDTH
+#define HEIGHT						HOST_DISPLAY_HEIGHT
+#define THUMB_MOVES					300
+#define SCRIBBLE_FRAMES				2000
+#define MOST_RECS					(3*GOL_DAMAGE_RECS)	// Scribbles in a frame
+
+#define ID_TITLE					1
+#define ID_SLIDER					2
+#define ID_FOOTER					3
+#define ID_POPUP					4
+
+/************************************************************************
+ Variables
+ ************************************************************************/
+static unsigned long	seed = 1;
+static XCHAR			title[] = "Tempo 120";
+static XCHAR			footer[] = "Damage";
+static XCHAR			popup[] = "Popup";
+static SLIDER *			pSlider;
+static STATICTEXT *		pTitle;
+static STATICTEXT *		pFooter;
+static STATICTEXT *		pPopup;
+static BYTE				before[HEIGHT][WIDTH];		// Screen the damage is drawn over
+static BYTE				glass[HEIGHT][WIDTH];		// Glass after the damage redraw
+
+/****************************************************************************
+  Function:
+    static unsigned int Random(unsigned int range)
+  Description:
+	Pseudo random number, the same sequence every run.
+  Precondition:
+    None.
+  Parameters:
+    unsigned int range - number of values.
+  Returns:
+    0 to range-1.
+  Remarks:
+    None.
+  ***************************************************************************/
+static unsigned int Random(unsigned int range)
+{
+	seed = seed*1103515245UL + 12345UL;
+	return (unsigned int)((seed >> 16) & 0x7FFF) % range;
+}
+
+/****************************************************************************
+  Function:
+    static void Draw(void)
+  Description:
+	Runs GOLDraw() until the pass is done and flushed.
+  Precondition:
+    None.
+  Parameters:
+    None.
+  Returns:
+    None
+  Remarks:
+    None.
+  ***************************************************************************/
+static void Draw(void)
+{
+	while(!GOLDraw());
+}
+
+/****************************************************************************
+  Function:
+    static void Check(const char * what, int step, void * pHidden)
+  Description:
+	Draws the damage, then draws the same screen whole and compares
+	the glass.
+  Precondition:
+    The change has been made but not drawn.
+  Parameters:
+    const char * what - change made, for the message.
+    int step - its number.
+    void * pHidden - object the change hides, else NULL.
+  Returns:
+    None
+  Remarks:
+    The screen is put back from GetPixel() as it was before the damage
+    redraw, and the hidden object is hidden again, so the whole redraw
+    starts where the damage redraw did. It leaves the screen as it
+    should be for the next change. One check per call, reporting the
+    first pixel that differs.
+  ***************************************************************************/
+static void Check(const char * what, int step, void * pHidden)
+{
+	OBJ_HEADER *	pObj;
+	int				x, y, bad = -1;
+
+	SetClip(CLIP_DISABLE);
+	for(y = 0; y < HEIGHT; y++)
+		for(x = 0; x < WIDTH; x++)
+			before[y][x] = (BYTE)(GetPixel(x, y) != 0);
+	Draw();
+	for(y = 0; y < HEIGHT; y++)
+		for(x = 0; x < WIDTH; x++)
+			glass[y][x] = (BYTE)hostDisplayPixel(x, y);
+
+	SetClip(CLIP_DISABLE);
+	for(y = 0; y < HEIGHT; y++)
+		for(x = 0; x < WIDTH; x++)
+		{
+			SetColor(before[y][x] ? WHITE : BLACK);
+			PutPixel(x, y);
+		}
+	FlushDisplay();
+	for(pObj = GOLGetList(); pObj != NULL; pObj = pObj->pNxtObj)
+		SetState(pObj, pObj == pHidden ? HIDE : DRAW);
+	Draw();
+
+	for(y = 0; y < HEIGHT && bad < 0; y++)
+		for(x = 0; x < WIDTH && bad < 0; x++)
+			if(hostDisplayPixel(x, y) != glass[y][x])
+				bad = y*WIDTH + x;
+
+	HOST_CHECK(bad < 0, "%s %d: pixel %d,%d is %d, drawn whole it is %d", what, step,
+		bad % WIDTH, bad / WIDTH, glass[bad / WIDTH][bad % WIDTH], glass[bad / WIDTH][bad % WIDTH] ^ 1);
+}
+
+/****************************************************************************
+  Function:
+    static void Scribble(void)
+  Description:
+	Draws a random bar over the screen, flushes it, and hands its area
+	to GOLRedrawRec().
+  Precondition:
+    None.
+  Parameters:
+    None.
+  Returns:
+    None
+  Remarks:
+    The bar is flushed first, so the damage redraw has to mark what it
+    draws for FlushDisplay() itself. Bars may run off the screen.
+  ***************************************************************************/
+static void Scribble(void)
+{
+	SHORT	left, top, right, bottom;
+
+	left	= (SHORT)Random(WIDTH + 8) - 4;
+	top		= (SHORT)Random(HEIGHT + 8) - 4;
+	right	= left + (SHORT)Random(Random(4) ? 12 : WIDTH);
+	bottom	= top + (SHORT)Random(Random(4) ? 8 : HEIGHT);
+
+	SetClip(CLIP_DISABLE);
+	SetColor(Random(2) ? WHITE : BLACK);
+	Bar(left, top, right, bottom);
+	FlushDisplay();
+	GOLRedrawRec(left, top, right, bottom);
+}
+
+/****************************************************************************
+  Function:
+    static void TestThumb(void)
+  Description:
+	Moves the slider thumb a step or a jump at a time.
+  Precondition:
+    The screen is drawn.
+  Parameters:
+    None.
+  Returns:
+    None
+  Remarks:
+    SldSetPos() adds the old and the new thumb to the damage, and
+    the slider is redrawn clipped to them. Every other move also
+    scribbles, so the thumb's rectangles merge with others.
+  ***************************************************************************/
+static void TestThumb(void)
+{
+	int		move;
+
+	for(move = 0; move < THUMB_MOVES; move++)
+	{
+		if(Random(2))
+			SldSetPos(pSlider, SldGetPos(pSlider) + (Random(2) ? 1 : -1));
+		else
+			SldSetPos(pSlider, Random(SldGetRange(pSlider) + 1));
+		if(move & 1)
+			Scribble();
+		HOST_CHECK(!GetState(pSlider, SLD_DRAW|SLD_DRAW_THUMB), "thumb move %d asks for a whole redraw", move);
+		Check("thumb move", move, NULL);
+	}
+}
+
+/****************************************************************************
+  Function:
+    static void TestRedrawRec(void)
+  Description:
+	Scribbles over the screen and repairs it through GOLRedrawRec().
+  Precondition:
+    The screen is drawn.
+  Parameters:
+    None.
+  Returns:
+    None
+  Remarks:
+    Frames with more scribbles than GOL_DAMAGE_RECS fill the list, so
+    the rectangles that overlap nothing are merged with the nearest.
+    Some frames change a digit of the title first and damage its box.
+  ***************************************************************************/
+static void TestRedrawRec(void)
+{
+	int		frame, count, i;
+
+	for(frame = 0; frame < SCRIBBLE_FRAMES; frame++)
+	{
+		if(frame % 8 == 0)
+		{
+			title[8] = (XCHAR)('0' + Random(10));
+			GOLRedrawRec(pTitle->left, pTitle->top, pTitle->right, pTitle->bottom);
+		}
+		count = 1 + Random(frame & 1 ? MOST_RECS : GOL_DAMAGE_RECS);
+		for(i = 0; i < count; i++)
+			Scribble();
+		Check(count > GOL_DAMAGE_RECS ? "merged scribbles" : "scribbles", frame, NULL);
+	}
+}
+
+/****************************************************************************
+  Function:
+    static void TestHide(void)
+  Description:
+	Hides the static text drawn over the others.
+  Precondition:
+    The screen is drawn.
+  Parameters:
+    None.
+  Returns:
+    None
+  Remarks:
+    The pass clears it and redraws what was under it. It is then taken
+    off the end of the list, so the screen drawn whole leaves it out as
+    well.
+  ***************************************************************************/
+static void TestHide(void)
+{
+	SetState(pPopup, ST_HIDE);
+	Scribble();
+	Check("hide", 0, pPopup);
+	pFooter->pNxtObj = NULL;
+	GOLSetList(GOLGetList());
+}
+
+int main(void)
+{
+	GOLInit();
+	SetColor(BLACK);
+	ClearDevice();
+
+	pTitle	= StCreate(ID_TITLE, 0, 0, GetMaxX(), 17, ST_DRAW|ST_FRAME|ST_CENTER_ALIGN, title, NULL);
+	pSlider	= SldCreate(ID_SLIDER, 0, 20, GetMaxX(), 40, SLD_DRAW, 100, 5, 50, NULL);
+	pFooter	= StCreate(ID_FOOTER, 0, 44, GetMaxX(), GetMaxY(), ST_DRAW|ST_FRAME, footer, NULL);
+	pPopup	= StCreate(ID_POPUP, 30, 12, 97, 30, ST_DRAW|ST_FRAME|ST_CENTER_ALIGN, popup, NULL);
+	Check("first draw", 0, NULL);
+
+	TestThumb();
+	TestRedrawRec();
+	TestHide();
+	TestThumb();
+	TestRedrawRec();
+	return hostTestEnd("GOLDamageTest");
+}
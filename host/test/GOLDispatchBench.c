@@ -0,0 +1,210 @@
+/**********************************************************************
+* FileName:        		GOLDispatchBench.c
+* Dependencies:    		Header (.h) files if applicable, see below
+* Processor:       		Any host with gcc
+* Compiler:        		gcc
+*
+* Per frame object dispatch of GOL.c on a screen of 24 objects: static
+* texts, sliders and dials. GOLFindObject() of every ID is set against
+* a walk of the list, as it searched before the ID index, and GOLMsg()
+* of a key no object takes, GOLDraw() with nothing to draw and
+* GOLDraw() of one thumb move go through the table of type functions.
+* GOLPool.c and GOL.c are included rather than linked so the object
+* pool can hold the screen and the index has twice as many slots; at
+* the default GOL_ID_INDEX_SIZE of 16 the index of 24 IDs is full and
+* every search walks the list. The figures are host nanoseconds, the simulator runs code
+* in no virtual time.
+************************************************************************/
+
+/************************************************************************
+ Header Includes
+ ************************************************************************/
+#include <stdio.h>
+#include <time.h>
+#include "HostSim.h"
+#include "Graphics/Graphics.h"
+
+#undef GOL_POOL_OBJECTS
+#undef GOL_ID_INDEX_SIZE
+#define GOL_POOL_OBJECTS			24					// The whole screen
+#define GOL_ID_INDEX_SIZE			64					// Twice that, as GraphicsConfig.h asks
+#include "../../Graphics/GOLPool.c"
+#include "../../Graphics/GOL.c"
+
+/************************************************************************
+ Constants
+ ************************************************************************/
+#define OBJECTS						GOL_POOL_OBJECTS
+#define COLUMNS						8
+#define REPEATS						20000
+#define RUNS						5					// The lowest of each time is kept
+#define ID_NONE						0x7FFF				// No object has it
+
+/************************************************************************
+ Variables
+ ************************************************************************/
+static XCHAR			text[] = "St";
+static SLIDER *			pSliders[COLUMNS];
+static volatile WORD	sink;							// Keeps the results used
+
+/****************************************************************************
+  Function:
+    static double Now(void)
+  Description:
+	Reads the host clock.
+  Precondition:
+    None.
+  Parameters:
+    None.
+  Returns:
+    Host monotonic clock in nanoseconds.
+  Remarks:
+    None.
+  ***************************************************************************/
+static double Now(void)
+{
+	struct timespec	now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec*1e9 + now.tv_nsec;
+}
+
+/****************************************************************************
+  Function:
+    static OBJ_HEADER * Walk(WORD ID)
+  Description:
+	Finds an object by walking the current list.
+  Precondition:
+    None.
+  Parameters:
+    WORD ID - object ID.
+  Returns:
+    The first object with the ID, NULL if none has it.
+  Remarks:
+    GOLFindObject() before the index.
+  ***************************************************************************/
+static OBJ_HEADER * Walk(WORD ID)
+{
+	OBJ_HEADER *	pObj;
+
+	for(pObj = GOLGetList(); pObj != NULL; pObj = pObj->pNxtObj)
+		if(pObj->ID == ID)
+			return pObj;
+	return NULL;
+}
+
+/****************************************************************************
+  Function:
+    static int Screen(void)
+  Description:
+	Creates the objects of the screen and draws it.
+  Precondition:
+    GOLInit() has been called.
+  Parameters:
+    None.
+  Returns:
+    Nonzero if every object was created.
+  Remarks:
+    A column of a static text, a slider and a dial for each of
+    COLUMNS, with IDs 1 to OBJECTS.
+  ***************************************************************************/
+static int Screen(void)
+{
+	SHORT	left;
+	int		c, made = 0;
+
+	for(c = 0; c < COLUMNS; c++)
+	{
+		left = (SHORT)(c*GetMaxX()/COLUMNS);
+		made += StCreate(3*c + 1, left, 0, left + 14, 11, ST_DRAW, text, NULL) != NULL;
+		pSliders[c] = SldCreate(3*c + 2, left, 14, left + 14, 48, SLD_DRAW|SLD_VERTICAL, 100, 5, 50, NULL);
+		made += pSliders[c] != NULL;
+		made += RdiaCreate(3*c + 3, left + 7, 56, 6, RDIA_DRAW, 2, 50, 100, NULL) != NULL;
+	}
+	while(!GOLDraw());
+	return made == OBJECTS;
+}
+
+int main(void)
+{
+	GOL_MSG		msg;
+	double		start, find[RUNS], walk[RUNS], message[RUNS], idle[RUNS], thumb[RUNS];
+	double		best[5];
+	int			r, i, same = 1;
+	WORD		ID;
+
+	GOLInit();
+	SetColor(BLACK);
+	ClearDevice();
+	if(!Screen())
+	{
+		printf("the pools do not hold %d objects\n", OBJECTS);
+		return 1;
+	}
+	for(ID = 1; ID <= OBJECTS + 1; ID++)
+		if(GOLFindObject(ID) != Walk(ID))
+			same = 0;
+
+	msg.type	= TYPE_KEYBOARD;
+	msg.uiEvent	= EVENT_KEYSCAN;
+	msg.param1	= ID_NONE;
+	msg.param2	= 0;
+
+	for(r = 0; r < RUNS; r++)
+	{
+		start = Now();
+		for(i = 0; i < REPEATS; i++)
+			for(ID = 1; ID <= OBJECTS; ID++)
+				sink = GOLFindObject(ID)->ID;
+		find[r] = (Now() - start)/REPEATS;
+
+		start = Now();
+		for(i = 0; i < REPEATS; i++)
+			for(ID = 1; ID <= OBJECTS; ID++)
+				sink = Walk(ID)->ID;
+		walk[r] = (Now() - start)/REPEATS;
+
+		start = Now();
+		for(i = 0; i < REPEATS; i++)
+			GOLMsg(&msg);
+		message[r] = (Now() - start)/REPEATS;
+
+		start = Now();
+		for(i = 0; i < REPEATS; i++)
+			sink = GOLDraw();
+		idle[r] = (Now() - start)/REPEATS;
+
+		start = Now();
+		for(i = 0; i < REPEATS; i++)
+		{
+			SldSetPos(pSliders[i % COLUMNS], (i*7) % 100);
+			while(!GOLDraw());
+		}
+		thumb[r] = (Now() - start)/REPEATS;
+	}
+
+	best[0] = find[0];
+	best[1] = walk[0];
+	best[2] = message[0];
+	best[3] = idle[0];
+	best[4] = thumb[0];
+	for(r = 1; r < RUNS; r++)
+	{
+		best[0] = (find[r] < best[0]) ? find[r] : best[0];
+		best[1] = (walk[r] < best[1]) ? walk[r] : best[1];
+		best[2] = (message[r] < best[2]) ? message[r] : best[2];
+		best[3] = (idle[r] < best[3]) ? idle[r] : best[3];
+		best[4] = (thumb[r] < best[4]) ? thumb[r] : best[4];
+	}
+
+	printf("Host figures, the simulator runs code in no virtual time; lowest of %d runs\n", RUNS);
+	printf("%d objects, ns per frame\n", OBJECTS);
+	printf("%-36s %10.1f\n", "GOLFindObject() of every ID", best[0]);
+	printf("%-36s %10.1f\n", "list walk of every ID", best[1]);
+	printf("%-36s %10.1f\n", "GOLMsg() of a key for no object", best[2]);
+	printf("%-36s %10.1f\n", "GOLDraw() with nothing to draw", best[3]);
+	printf("%-36s %10.1f\n", "GOLDraw() of one thumb move", best[4]);
+	if(!same)
+		printf("GOLFindObject() and the list walk find different objects\n");
+	return !same;
+}
@@ -0,0 +1,343 @@
+/**********************************************************************
+* FileName:        		GOLDrawBench.c
+* Dependencies:    		Header (.h) files if applicable, see below
+* Processor:       		Any host with gcc
+* Compiler:        		gcc
+*
+* Main loop latency of GOLDraw() and GOLDrawBudget(). A screen of a
+* full screen static text under a slider goes through whole redraws,
+* thumb moves and GOLRedrawRec() areas, drawn by GOLDraw() and then at
+* several time slices. The time of one draw call is how long the main
+* loop waits, and its maximum is set against the bound of the slice
+* plus the longest drawing step plus FlushDisplay(). A step is timed
+* from one GOLDrawBusy() check to the next, counting the object
+* boundaries between them. Every slice has to end on the same glass as
+* GOLDraw(). GOL.c is included rather than linked so its time slice is
+* read from the host clock and its checks can be timed; the figures
+* are host microseconds, the simulator runs code in no virtual time.
+************************************************************************/
+
+/************************************************************************
+ Header Includes
+ ************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "HostSim.h"
+
+#define timebaseCycles		GOLDrawBenchNow			// Host clock instead of Timer 1
+#define GOLDrawBusy			GOLDrawBenchBusy		// Timed by GOLDrawBusy() below
+#include "../../Graphics/GOL.c"
+#undef GOLDrawBusy
+#undef timebaseCycles
+
+/************************************************************************
+ Constants
+ ************************************************************************/
+#define WIDTH						HOST_DISPLAY_WIDTH
+#define HEIGHT						HOST_DISPLAY_HEIGHT
+#define FRAMES						1000
+#define FLUSHES						200
+#define RUNS						5					// A maximum has to be reached in each
+#define BINS						10000				// Call times in 0.1 us up to 1 ms
+#define GOL_DRAW					-1					// Slice of a plain GOLDraw()
+#define COUNT(a)					((int)(sizeof(a)/sizeof((a)[0])))
+
+/************************************************************************
+ Data Structures
+ ************************************************************************/
+typedef struct
+{
+	double			max;							// Longest call, us
+	double			maxPart;						// Longest call that did not complete
+	double			step;							// Longest step
+	double			p999;							// 99.9th percentile of the calls
+	unsigned long	calls;
+} LATENCY;
+
+/************************************************************************
+ Variables
+ ************************************************************************/
+static const int	slices[] = { GOL_DRAW, 500, 100, 20, 5, 0 };
+static XCHAR		text[] = "Tempo 120 BPM\n4/4 accent on 1\nA4 440.0 Hz\n-3 cents\nMetronome on";
+static SLIDER *		pSlider;
+static BYTE			golden[HEIGHT][WIDTH];
+static double		lastCheck;						// When drawing was last able to stop
+static double		longestStep;
+static unsigned long	bins[BINS];						// Calls of a run by time
+
+/****************************************************************************
+  Function:
+    static double Now(void)
+  Description:
+	Reads the host clock.
+  Precondition:
+    None.
+  Parameters:
+    None.
+  Returns:
+    Host monotonic clock in microseconds.
+  Remarks:
+    None.
+  ***************************************************************************/
+static double Now(void)
+{
+	struct timespec	now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec*1e6 + now.tv_nsec/1e3;
+}
+
+/****************************************************************************
+  Function:
+    DWORD GOLDrawBenchNow(void)
+  Description:
+	Stands in for timebaseCycles() in GOL.c.
+  Precondition:
+    None.
+  Parameters:
+    None.
+  Returns:
+    Host clock in instruction cycles.
+  Remarks:
+    None.
+  ***************************************************************************/
+DWORD GOLDrawBenchNow(void)
+{
+	return (DWORD)(Now()*(GetInstructionClock()/1000000L));
+}
+
+/****************************************************************************
+  Function:
+    WORD GOLDrawBusy(void)
+  Description:
+	Times the drawing step since the last check, then checks.
+  Precondition:
+    None.
+  Parameters:
+    None.
+  Returns:
+    As GOLDrawBusy() of GOL.c.
+  Remarks:
+    The draw functions of the objects call this one.
+  ***************************************************************************/
+WORD GOLDrawBusy(void)
+{
+	double	now = Now();
+
+	if(now - lastCheck > longestStep)
+		longestStep = now - lastCheck;
+	lastCheck = now;
+	return GOLDrawBenchBusy();
+}
+
+/****************************************************************************
+  Function:
+    static void Frame(int frame, int slice, LATENCY * pLatency)
+  Description:
+	Makes one change to the screen and draws it, timing each call.
+  Precondition:
+    None.
+  Parameters:
+    int frame - frame number, picks the change.
+    int slice - time slice in us, GOL_DRAW for GOLDraw().
+    LATENCY * pLatency - times to add to.
+  Returns:
+    None
+  Remarks:
+    The steps of GOLDrawBudget() are timed from the start of a call
+    and up to the return of one that stops, the flush of the one that
+    completes is timed on its own by Flush().
+  ***************************************************************************/
+static void Frame(int frame, int slice, LATENCY * pLatency)
+{
+	OBJ_HEADER *	pObj;
+	double			start, time;
+	WORD			done;
+
+	if(frame % 3 == 0)
+	{
+		for(pObj = GOLGetList(); pObj != NULL; pObj = pObj->pNxtObj)
+			GOLRedraw(pObj);
+	}
+	else if(frame % 3 == 1)
+		SldSetPos(pSlider, (frame*7) % 100);
+	else
+		GOLRedrawRec(frame % 100, 10, frame % 100 + 20, 50);
+
+	do
+	{
+		start	= lastCheck = Now();
+		done	= (slice == GOL_DRAW) ? GOLDraw() : GOLDrawBudget((WORD)slice);
+		time	= Now() - start;
+		if(!done && slice != GOL_DRAW)
+			GOLDrawBusy();
+		if(time > pLatency->max)
+			pLatency->max = time;
+		if(!done && time > pLatency->maxPart)
+			pLatency->maxPart = time;
+		bins[(time*10 < BINS - 1) ? (int)(time*10) : BINS - 1]++;
+		pLatency->calls++;
+	} while(!done);
+}
+
+/****************************************************************************
+  Function:
+    static double Percentile(unsigned long calls)
+  Description:
+	Reads the 99.9th percentile call time of a run off bins[].
+  Precondition:
+    None.
+  Parameters:
+    unsigned long calls - calls of the run.
+  Returns:
+    Time in us, to 0.1 us.
+  Remarks:
+    None.
+  ***************************************************************************/
+static double Percentile(unsigned long calls)
+{
+	unsigned long	below = 0;
+	int				bin;
+
+	for(bin = 0; bin < BINS - 1; bin++)
+	{
+		below += bins[bin];
+		if(below*1000 >= calls*999)
+			break;
+	}
+	return (bin + 1)/10.0;
+}
+
+/****************************************************************************
+  Function:
+    static void Lowest(LATENCY * pBest, const LATENCY * pRun)
+  Description:
+	Keeps the lower of each time of two runs.
+  Precondition:
+    None.
+  Parameters:
+    LATENCY * pBest - lowest times so far, updated.
+    const LATENCY * pRun - times of a run.
+  Returns:
+    None
+  Remarks:
+    The host is preempted now and then for milliseconds, which sets
+    the maximum of a run; the lowest maximum of several is the code's.
+  ***************************************************************************/
+static void Lowest(LATENCY * pBest, const LATENCY * pRun)
+{
+	if(pRun->max < pBest->max)
+		pBest->max = pRun->max;
+	if(pRun->maxPart < pBest->maxPart)
+		pBest->maxPart = pRun->maxPart;
+	if(pRun->step < pBest->step)
+		pBest->step = pRun->step;
+	if(pRun->p999 < pBest->p999)
+		pBest->p999 = pRun->p999;
+	pBest->calls = pRun->calls;
+}
+
+/****************************************************************************
+  Function:
+    static double Flush(void)
+  Description:
+	Times FlushDisplay() of the whole screen.
+  Precondition:
+    None.
+  Parameters:
+    None.
+  Returns:
+    Longest of FLUSHES, in us.
+  Remarks:
+    None.
+  ***************************************************************************/
+static double Flush(void)
+{
+	double	start, time, max = 0;
+	int		i;
+
+	for(i = 0; i < FLUSHES; i++)
+	{
+		SetClip(CLIP_DISABLE);
+		SetColor((i & 1) ? WHITE : BLACK);
+		ClearDevice();
+		start	= Now();
+		FlushDisplay();
+		time	= Now() - start;
+		if(time > max)
+			max = time;
+	}
+	return max;
+}
+
+int main(void)
+{
+	LATENCY		best[COUNT(slices)], run;
+	double		flush = 1e9, step = 0, floor, time;
+	int			s, r, frame, x, y, same, bad = 0;
+
+	GOLInit();
+	StCreate(1, 0, 0, GetMaxX(), GetMaxY(), ST_DRAW, text, NULL);
+	pSlider = SldCreate(2, 0, 44, GetMaxX(), 60, SLD_DRAW, 100, 5, 50, NULL);
+
+	for(s = 0; s < COUNT(slices); s++)
+	{
+		best[s].max = best[s].maxPart = best[s].step = best[s].p999 = 1e9;
+		for(r = 0; r < RUNS; r++)
+		{
+			memset(&run, 0, sizeof(run));
+			memset(bins, 0, sizeof(bins));
+			longestStep = 0;
+			SetClip(CLIP_DISABLE);
+			SetColor(BLACK);
+			ClearDevice();
+			for(frame = 0; frame < FRAMES; frame++)
+				Frame(frame, slices[s], &run);
+			run.step = longestStep;
+			run.p999 = Percentile(run.calls);
+			Lowest(&best[s], &run);
+
+			same = 1;
+			for(y = 0; y < HEIGHT; y++)
+				for(x = 0; x < WIDTH; x++)
+				{
+					if(slices[s] == GOL_DRAW)
+						golden[y][x] = (BYTE)hostDisplayPixel(x, y);
+					else if(golden[y][x] != hostDisplayPixel(x, y))
+						same = 0;
+				}
+			if(!same)
+			{
+				printf("GOLDrawBudget(%d) ends on another screen than GOLDraw()\n", slices[s]);
+				bad = 1;
+			}
+		}
+		if(slices[s] != GOL_DRAW && best[s].step > step)
+			step = best[s].step;
+	}
+	for(r = 0; r < RUNS; r++)
+	{
+		time = Flush();
+		if(time < flush)
+			flush = time;
+	}
+
+	printf("Host figures, the simulator runs code in no virtual time; maximums are the lowest of %d runs\n", RUNS);
+	printf("longest step %.1f us, FlushDisplay() %.1f us, shortest slice %d us\n", step, flush,
+		GOL_DRAW_STEP_MIN_US);
+	printf("%-10s %8s %10s %10s %12s %10s\n", "slice us", "calls", "p99.9 us", "max us", "unfinished", "bound us");
+	for(s = 0; s < COUNT(slices); s++)
+	{
+		if(slices[s] == GOL_DRAW)
+			printf("%-10s %8lu %10.1f %10.1f %12s %10s\n", "GOLDraw", best[s].calls, best[s].p999, best[s].max,
+				"-", "-");
+		else
+		{
+			floor = (slices[s] > GOL_DRAW_STEP_MIN_US) ? slices[s] : GOL_DRAW_STEP_MIN_US;
+			printf("%-10d %8lu %10.1f %10.1f %12.1f %10.1f\n", slices[s], best[s].calls, best[s].p999,
+				best[s].max, best[s].maxPart, floor + step + flush);
+		}
+	}
+	return bad;
+}
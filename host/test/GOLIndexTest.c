@@ -0,0 +1,286 @@
+/**********************************************************************
+* FileName:        		GOLIndexTest.c
+* Dependencies:    		Header (.h) files if applicable, see below
+* Processor:       		Any host with gcc
+* Compiler:        		gcc
+*
+* Checks GOLFindObject() of GOL.c and its ID index against a walk of the
+* list. Lists of up to twice GOL_ID_INDEX_SIZE headers with random IDs,
+* many of them shared or equal in their low bits, are built by
+* GOLAddObject(), some of them searched half way so the rest is added
+* to a built index. Every ID, and some no object has, has to find the
+* object the walk finds first, and the index has to be marked full
+* exactly when the list has more IDs than slots. Lists switched by
+* GOLSetList() and IDs changed by hand before GOLSetList(GOLGetList())
+* have to be found in the new list. GOL.c is included rather than
+* linked so the index state can be read.
+************************************************************************/
+
+/************************************************************************
+ Header Includes
+ ************************************************************************/
+#include "HostTest.h"
+
+#include "../../Graphics/GOL.c"
+
+/************************************************************************
+ Constants
+ ************************************************************************/
+#define MOST_OBJECTS				(2*GOL_ID_INDEX_SIZE)
+#define LISTS						3000
+#define SWITCHES					1000
+
+/************************************************************************
+ Variables
+ ************************************************************************/
+static unsigned long	seed = 1;
+static OBJ_HEADER		objects[2][MOST_OBJECTS];		// Two lists to switch between
+static int				counts[2];
+
+/****************************************************************************
+  Function:
+    static unsigned int Random(unsigned int range)
+  Description:
+	Pseudo random number, the same sequence every run.
+  Precondition:
+    None.
+  Parameters:
+    unsigned int range - number of values.
+  Returns:
+    0 to range-1.
+  Remarks:
+    None.
+  ***************************************************************************/
+static unsigned int Random(unsigned int range)
+{
+	seed = seed*1103515245UL + 12345UL;
+	return (unsigned int)((seed >> 16) & 0x7FFF) % range;
+}
+
+/****************************************************************************
+  Function:
+    static WORD RandomID(void)
+  Description:
+	Picks an object ID.
+  Precondition:
+    None.
+  Parameters:
+    None.
+  Returns:
+    A small ID most of the time, else one that differs from a small one
+    only above the index bits, or the largest.
+  Remarks:
+    None.
+  ***************************************************************************/
+static WORD RandomID(void)
+{
+	switch(Random(8))
+	{
+		case 0:
+			return (WORD)(Random(4)*GOL_ID_INDEX_SIZE + Random(4));
+		case 1:
+			return 0xFFFF;
+		default:
+			return (WORD)Random(GOL_ID_INDEX_SIZE + 8);
+	}
+}
+
+/****************************************************************************
+  Function:
+    static OBJ_HEADER * Walk(WORD ID)
+  Description:
+	Finds an object by walking the current list.
+  Precondition:
+    None.
+  Parameters:
+    WORD ID - object ID.
+  Returns:
+    The first object with the ID, NULL if none has it.
+  Remarks:
+    GOLFindObject() before the index.
+  ***************************************************************************/
+static OBJ_HEADER * Walk(WORD ID)
+{
+	OBJ_HEADER *	pObj;
+
+	for(pObj = GOLGetList(); pObj != NULL; pObj = pObj->pNxtObj)
+		if(pObj->ID == ID)
+			return pObj;
+	return NULL;
+}
+
+/****************************************************************************
+  Function:
+    static int DistinctIDs(void)
+  Description:
+	Counts the IDs of the current list.
+  Precondition:
+    None.
+  Parameters:
+    None.
+  Returns:
+    Number of different IDs.
+  Remarks:
+    None.
+  ***************************************************************************/
+static int DistinctIDs(void)
+{
+	OBJ_HEADER *	pObj;
+	int				count = 0;
+
+	for(pObj = GOLGetList(); pObj != NULL; pObj = pObj->pNxtObj)
+		if(Walk(pObj->ID) == pObj)
+			count++;
+	return count;
+}
+
+/****************************************************************************
+  Function:
+    static void Check(const char * what, int step)
+  Description:
+	Searches the IDs of the current list and some others.
+  Precondition:
+    None.
+  Parameters:
+    const char * what - how the list came about, for the message.
+    int step - its number.
+  Returns:
+    None
+  Remarks:
+    One check for the IDs and one for the index state.
+  ***************************************************************************/
+static void Check(const char * what, int step)
+{
+	OBJ_HEADER *	pObj = GOLGetList();
+	OBJ_HEADER *	pFound;
+	WORD			ID;
+	int				i, full;
+
+	for(i = 0; ; i++)
+	{
+		if(pObj != NULL)
+		{
+			ID		= pObj->ID;
+			pObj	= pObj->pNxtObj;
+		}
+		else
+			ID		= RandomID();
+		pFound = GOLFindObject(ID);
+		if(pFound != Walk(ID) || (pObj == NULL && i >= MOST_OBJECTS))
+			break;
+	}
+	HOST_CHECK(pFound == Walk(ID), "%s %d: ID %u found %p, the list walk finds %p", what, step, ID,
+		(void *)pFound, (void *)Walk(ID));
+
+	full = (DistinctIDs() > GOL_ID_INDEX_SIZE);
+	HOST_CHECK((_golIndexState & GOL_INDEX_VALID) && full == !!(_golIndexState & GOL_INDEX_FULL),
+		"%s %d: %d IDs, index state 0x%04X", what, step, DistinctIDs(), _golIndexState);
+}
+
+/****************************************************************************
+  Function:
+    static void Build(int list, int count, int searchAt)
+  Description:
+	Makes a new list of headers with random IDs.
+  Precondition:
+    None.
+  Parameters:
+    int list - which of objects[] to use.
+    int count - number of objects.
+    int searchAt - object to search before, so the index is built and
+                   the rest are added to it; count for none.
+  Returns:
+    None
+  Remarks:
+    None.
+  ***************************************************************************/
+static void Build(int list, int count, int searchAt)
+{
+	OBJ_HEADER *	pObj;
+	int				i;
+
+	GOLNewList();
+	for(i = 0; i < count; i++)
+	{
+		if(i == searchAt)
+			GOLFindObject(RandomID());
+		pObj		= &objects[list][i];
+		pObj->ID	= RandomID();
+		pObj->type	= OBJ_STATICTEXT;
+		GOLAddObject(pObj);
+	}
+	counts[list] = count;
+}
+
+/****************************************************************************
+  Function:
+    static void TestLists(void)
+  Description:
+	Searches random lists built with and without the index.
+  Precondition:
+    None.
+  Parameters:
+    None.
+  Returns:
+    None
+  Remarks:
+    A third of the lists are searched half way through being built.
+  ***************************************************************************/
+static void TestLists(void)
+{
+	int		list, count;
+
+	for(list = 0; list < LISTS; list++)
+	{
+		count = Random(MOST_OBJECTS + 1);
+		Build(0, count, list % 3 ? count : Random(count + 1));
+		Check(list % 3 ? "list" : "list added to", list);
+	}
+}
+
+/****************************************************************************
+  Function:
+    static void TestSwitches(void)
+  Description:
+	Switches between two searched lists and changes IDs by hand.
+  Precondition:
+    None.
+  Parameters:
+    None.
+  Returns:
+    None
+  Remarks:
+    Each switch by GOLSetList() comes after a search of the list before,
+    so a stale index would find its objects.
+  ***************************************************************************/
+static void TestSwitches(void)
+{
+	OBJ_HEADER *	pLists[2];
+	int				step, list;
+
+	Build(1, 1 + Random(MOST_OBJECTS), 0);
+	pLists[1] = GOLGetList();
+	Build(0, 1 + Random(MOST_OBJECTS), 0);
+	pLists[0] = GOLGetList();
+
+	for(step = 0; step < SWITCHES; step++)
+	{
+		list = step & 1;
+		GOLFindObject(RandomID());
+		if(Random(2))
+		{
+			objects[list][Random(counts[list])].ID = RandomID();
+			GOLSetList(GOLGetList());
+			Check("ID changed", step);
+		}
+		GOLSetList(pLists[list ^ 1]);
+		Check("list switched", step);
+	}
+}
+
+int main(void)
+{
+	TestLists();
+	TestSwitches();
+	return hostTestEnd("GOLIndexTest");
+}
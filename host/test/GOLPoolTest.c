@@ -0,0 +1,286 @@
+/**********************************************************************
+* FileName:        		GOLPoolTest.c
+* Dependencies:    		Header (.h) files if applicable, see below
+* Processor:       		Any host with gcc
+* Compiler:        		gcc
+*
+* Stress test of the GOL memory pools of GOLPool.c. The free list of a
+* fixed size pool and the reset of a pool once its last block comes
+* back are checked on their own, then thousands of screens of random
+* objects are built and torn down by GOLFree(), some of them asking
+* for more than the pools hold. Every screen has to leave the pools as
+* it found them, and the only failed requests are the ones a screen
+* asked too much for.
+************************************************************************/
+
+/************************************************************************
+ Header Includes
+ ************************************************************************/
+#include "HostTest.h"
+#include "Graphics/Graphics.h"
+
+/************************************************************************
+ Constants
+ ************************************************************************/
+#define SCREENS						5000
+#define GREEDY_EVERY				16					// Every 16th screen asks for too much
+#define SCHEME_ITEMS				1					// GOLInit()'s default scheme
+
+/************************************************************************
+ Variables
+ ************************************************************************/
+static unsigned long	seed = 1;
+static unsigned long	expectedFailed;					// Requests meant to be refused
+static XCHAR			text[] = "Pool";
+
+/****************************************************************************
+  Function:
+    static unsigned int Random(unsigned int range)
+  Description:
+	Pseudo random number, the same sequence every run.
+  Precondition:
+    None.
+  Parameters:
+    unsigned int range - number of values.
+  Returns:
+    0 to range-1.
+  Remarks:
+    None.
+  ***************************************************************************/
+static unsigned int Random(unsigned int range)
+{
+	seed = seed*1103515245UL + 12345UL;
+	return (unsigned int)((seed >> 16) & 0x7FFF) % range;
+}
+
+/****************************************************************************
+  Function:
+    static GOL_POOL_STATS Stats(GOL_POOL_ID pool)
+  Description:
+	Reads the usage of a pool.
+  Precondition:
+    None.
+  Parameters:
+    GOL_POOL_ID pool - pool of interest.
+  Returns:
+    Its GOL_POOL_STATS.
+  Remarks:
+    None.
+  ***************************************************************************/
+static GOL_POOL_STATS Stats(GOL_POOL_ID pool)
+{
+	GOL_POOL_STATS	stats;
+
+	GOLPoolGetStats(pool, &stats);
+	return stats;
+}
+
+/****************************************************************************
+  Function:
+    static void TestFreeList(void)
+  Description:
+	Fills the object pool, then checks that released blocks are handed
+	out again last released first, and that once all are back the pool
+	hands them out from its start.
+  Precondition:
+    GOLInit() called, no objects created.
+  Parameters:
+    None.
+  Returns:
+    None
+  Remarks:
+    None.
+  ***************************************************************************/
+static void TestFreeList(void)
+{
+	static const int	order[GOL_POOL_OBJECTS] = { 3, 0, 7, 5, 1, 6, 2, 4 };
+	GOL_POOL_STATS		before = Stats(GOL_POOL_OBJECT);
+	BYTE *				block[GOL_POOL_OBJECTS];
+	BYTE *				first;
+	int					i;
+
+	for(i = 0; i < GOL_POOL_OBJECTS; i++)
+	{
+		block[i] = GOLPoolAlloc(before.size);
+		HOST_CHECK(block[i] != NULL, "object block %d of %d refused", i, GOL_POOL_OBJECTS);
+		HOST_CHECK(i == 0 || block[i] == block[i - 1] + before.size, "object block %d not next to the one before", i);
+	}
+	HOST_CHECK(Stats(GOL_POOL_OBJECT).used == GOL_POOL_OBJECTS, "%d objects taken, used %d", GOL_POOL_OBJECTS, Stats(GOL_POOL_OBJECT).used);
+	HOST_CHECK(GOLPoolAlloc(before.size) == NULL, "object pool gave out more than GOL_POOL_OBJECTS");
+	HOST_CHECK(Stats(GOL_POOL_OBJECT).failed == before.failed + 1, "refused object not counted as failed");
+
+	// A smaller request still takes a whole object block, never an item
+	GOLPoolFree(block[3]);
+	GOLPoolFree(block[5]);
+	HOST_CHECK(Stats(GOL_POOL_OBJECT).used == GOL_POOL_OBJECTS - 2, "used %d after 2 of %d freed", Stats(GOL_POOL_OBJECT).used, GOL_POOL_OBJECTS);
+	HOST_CHECK(GOLPoolAlloc(Stats(GOL_POOL_ITEM).size + 1) == block[5], "free list does not give back the last block freed");
+	HOST_CHECK(GOLPoolAlloc(before.size) == block[3], "free list does not give back the first block freed");
+	HOST_CHECK(GOLPoolAlloc(before.size) == NULL, "free list gave out a block twice");
+
+	for(i = 0; i < GOL_POOL_OBJECTS; i++)
+		GOLPoolFree(block[order[i]]);
+	HOST_CHECK(Stats(GOL_POOL_OBJECT).used == 0, "used %d with every object freed", Stats(GOL_POOL_OBJECT).used);
+
+	// With nothing taken the free list is dropped, the order it was freed
+	// in does not matter
+	first = GOLPoolAlloc(before.size);
+	HOST_CHECK(first == block[0], "emptied object pool does not start from its first block");
+	GOLPoolFree(first);
+	HOST_CHECK(Stats(GOL_POOL_OBJECT).highWater == GOL_POOL_OBJECTS, "object high water %d, not %d", Stats(GOL_POOL_OBJECT).highWater, GOL_POOL_OBJECTS);
+	expectedFailed += 2;
+}
+
+/****************************************************************************
+  Function:
+    static void TestArena(void)
+  Description:
+	Checks that the arena keeps its bytes taken until the last request
+	is released, in either order, and is whole again afterwards.
+  Precondition:
+    GOLInit() called, no objects created.
+  Parameters:
+    None.
+  Returns:
+    None
+  Remarks:
+    A request only goes to the arena if it is too large for an object
+    block. With host pointers two of them may not fit, and the release
+    order is then not checked.
+  ***************************************************************************/
+static void TestArena(void)
+{
+	GOL_POOL_STATS	arena = Stats(GOL_POOL_ARENA);
+	WORD			size = Stats(GOL_POOL_OBJECT).size + 1;
+	BYTE *			a;
+	BYTE *			b = NULL;
+	BYTE *			c;
+	int				outside;
+
+	HOST_CHECK(arena.used == 0, "arena starts with %d bytes used", arena.used);
+	a = GOLPoolAlloc(size);
+	HOST_CHECK(a != NULL && Stats(GOL_POOL_ARENA).used >= size, "arena request of %d bytes refused", size);
+
+	// Released space is not reused while anything is still taken
+	if(arena.total - Stats(GOL_POOL_ARENA).used >= size)
+	{
+		b = GOLPoolAlloc(size);
+		HOST_CHECK(b > a, "arena requests not handed out in order");
+		GOLPoolFree(a);
+		HOST_CHECK(Stats(GOL_POOL_ARENA).used == Stats(GOL_POOL_ARENA).highWater, "arena shrank with a request still taken");
+	}
+	c = GOLPoolAlloc(arena.total);
+	HOST_CHECK(c == NULL, "arena handed out its whole size with a request taken");
+	GOLPoolFree(NULL);
+	GOLPoolFree(&outside);
+	HOST_CHECK(Stats(GOL_POOL_ARENA).used != 0, "NULL or a foreign address released the arena");
+
+	GOLPoolFree(b != NULL ? b : a);
+	HOST_CHECK(Stats(GOL_POOL_ARENA).used == 0, "arena used %d once empty", Stats(GOL_POOL_ARENA).used);
+
+	// Reset, so the whole arena is there again from its start
+	c = GOLPoolAlloc(arena.total);
+	HOST_CHECK(c == a, "emptied arena does not start from its first byte");
+	HOST_CHECK(GOLPoolAlloc(size) == NULL, "arena gave out more than GOL_POOL_ARENA_SIZE");
+	GOLPoolFree(c);
+	HOST_CHECK(Stats(GOL_POOL_ARENA).used == 0 && Stats(GOL_POOL_ARENA).highWater == arena.total,
+		"arena used %d high water %d after a full request", Stats(GOL_POOL_ARENA).used, Stats(GOL_POOL_ARENA).highWater);
+	expectedFailed += 2;
+}
+
+/****************************************************************************
+  Function:
+    static void Screen(int greedy)
+  Description:
+	Builds a screen of random objects and tears it down with GOLFree().
+  Precondition:
+    GOLInit() called.
+  Parameters:
+    int greedy - nonzero to ask for more objects than the object pool
+                 holds and for grid cells larger than the arena.
+  Returns:
+    None
+  Remarks:
+    A screen has at most one grid, with cells too large for an object
+    block so they come from the arena. It may have a scheme of its own,
+    released by hand after GOLFree() as an application has to.
+  ***************************************************************************/
+static void Screen(int greedy)
+{
+	WORD			cellSize = sizeof(GRIDITEM);
+	WORD			fewest = Stats(GOL_POOL_OBJECT).size/cellSize + 1;
+	WORD			most = Stats(GOL_POOL_ARENA).total/cellSize;
+	GOL_SCHEME *	pScheme = NULL;
+	void *			pObj;
+	int				objects, grid, cells, i, refused = 0;
+
+	objects = greedy ? GOL_POOL_OBJECTS + 1 + Random(3) : 1 + Random(GOL_POOL_OBJECTS);
+	grid = Random(2*objects);					// No grid half the time
+	cells = greedy ? most + 1 + Random(most) : fewest + Random(most - fewest + 1);
+	if(Random(2))
+	{
+		pScheme = GOLCreateScheme();
+		HOST_CHECK(pScheme != NULL, "scheme refused with %d items in use", Stats(GOL_POOL_ITEM).used);
+	}
+
+	for(i = 0; i < objects; i++)
+	{
+		if(i == grid)
+			pObj = GridCreate(i + 1, 0, 0, 127, 63, 0, 1, cells, 8, 8, pScheme);
+		else switch(Random(4))
+		{
+		case 0:
+			pObj = StCreate(i + 1, 0, 0, 60, 10, 0, text, pScheme);
+			break;
+		case 1:
+			pObj = SldCreate(i + 1, 0, 20, 127, 30, 0, 100, 5, 50, pScheme);
+			break;
+		case 2:
+			pObj = PictCreate(i + 1, 0, 0, 10, 10, 0, 1, NULL, pScheme);
+			break;
+		default:
+			pObj = RdiaCreate(i + 1, 64, 32, 20, 0, 1, 0, 10, pScheme);
+			break;
+		}
+		if(pObj == NULL)
+			refused++;
+	}
+
+	if(greedy)
+		expectedFailed += refused;
+	else
+		HOST_CHECK(refused == 0, "%d of %d objects refused, grid of %d cells at %d", refused, objects, cells, grid);
+	HOST_CHECK(Stats(GOL_POOL_OBJECT).used <= GOL_POOL_OBJECTS, "object pool used %d", Stats(GOL_POOL_OBJECT).used);
+
+	GOLFree();
+	if(pScheme != NULL)
+		GOLPoolFree(pScheme);
+
+	HOST_CHECK(Stats(GOL_POOL_OBJECT).used == 0, "object pool used %d after GOLFree()", Stats(GOL_POOL_OBJECT).used);
+	HOST_CHECK(Stats(GOL_POOL_ITEM).used == SCHEME_ITEMS, "item pool used %d after GOLFree()", Stats(GOL_POOL_ITEM).used);
+	HOST_CHECK(Stats(GOL_POOL_ARENA).used == 0, "arena used %d after GOLFree()", Stats(GOL_POOL_ARENA).used);
+}
+
+int main(void)
+{
+	GOL_POOL_STATS	stats;
+	unsigned long	failed = 0;
+	int				screen, pool;
+
+	GOLInit();
+	TestFreeList();
+	TestArena();
+
+	for(screen = 0; screen < SCREENS; screen++)
+		Screen(screen % GREEDY_EVERY == GREEDY_EVERY - 1);
+
+	// Nothing leaked or fragmented into a failure of its own
+	for(pool = 0; pool < GOL_POOL_COUNT; pool++)
+	{
+		stats = Stats(pool);
+		failed += stats.failed;
+		HOST_CHECK(stats.highWater <= stats.total, "pool %d high water %d over its %d", pool, stats.highWater, stats.total);
+	}
+	HOST_CHECK(failed == expectedFailed, "%lu requests failed, %lu meant to", failed, expectedFailed);
+	HOST_CHECK(Stats(GOL_POOL_ARENA).highWater == Stats(GOL_POOL_ARENA).total, "arena high water %d", Stats(GOL_POOL_ARENA).highWater);
+	return hostTestEnd("GOLPoolTest");
+}
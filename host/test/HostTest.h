@@ -0,0 +1,67 @@
+/**********************************************************************
+* FileName:        		HostTest.h
+* Dependencies:    		None
+* Processor:       		Any host with gcc
+* Compiler:        		gcc
+*
+* Checks shared by the host tests. A test is a program of its own that
+* counts its failed checks, prints the first few, and ends with
+* hostTestEnd(), whose value main() returns so make test stops on it.
+************************************************************************/
+
+#ifndef	__HOST_TEST_H__
+#define	__HOST_TEST_H__
+
+/************************************************************************
+ Header Includes
+ ************************************************************************/
+#include <stdio.h>
+
+/************************************************************************
+ Constants
+ ************************************************************************/
+#define HOST_TEST_SHOWN				10					// Failed checks printed in full
+
+/************************************************************************
+ Variables
+ ************************************************************************/
+static unsigned long	hostTestChecks;
+static unsigned long	hostTestFailures;
+
+/************************************************************************
+ Macros
+ ************************************************************************/
+// Counts the check, and prints the printf style message if cond is false
+#define HOST_CHECK(cond, ...)												\
+	do																		\
+	{																		\
+		hostTestChecks++;													\
+		if(!(cond) && hostTestFailures++ < HOST_TEST_SHOWN)					\
+		{																	\
+			printf("%s:%d: ", __FILE__, __LINE__);							\
+			printf(__VA_ARGS__);											\
+			printf("\n");													\
+		}																	\
+	} while(0)
+
+/****************************************************************************
+  Function:
+    int hostTestEnd(const char * name)
+  Description:
+	Prints the totals of a test.
+  Precondition:
+    None.
+  Parameters:
+    const char * name - test name.
+  Returns:
+    Exit status for main(), nonzero if a check failed.
+  Remarks:
+    None.
+  ***************************************************************************/
+static inline int hostTestEnd(const char * name)
+{
+	printf("%s: %lu checks, %lu failed\n", name, hostTestChecks, hostTestFailures);
+	return hostTestFailures != 0;
+}
+
+#endif
@@ -0,0 +1,145 @@
+/**********************************************************************
+* FileName:        		ImaAdpcmBench.c
+* Dependencies:    		Header (.h) files if applicable, see below
+* Processor:       		Any host with gcc
+* Compiler:        		gcc
+*
+* Times the per frame work of a single clip voice in the frame fill of
+* Speaker.c, in host nanoseconds per FRAME_SIZE frame: decoding a G.711
+* frame with G711Alaw2Lin() against an IMA-ADPCM frame with
+* ImaAdpcmDecode(), and turning a frame into duty cycles through
+* speakerAlawDuty, as G.711 does, against speakerLinToDuty(), as ADPCM
+* does, and against the long divide of DutyModel.h it had before. The
+* clip is a second of a sine with noise. These are host figures only,
+* the simulator runs code in no virtual time. IMA_ADPCM_BENCH_PASSES
+* sets the passes over the clip. Speaker.c is included rather than
+* linked so its duty scaling can be reached.
+************************************************************************/
+
+/************************************************************************
+ Header Includes
+ ************************************************************************/
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../../src/Speaker.c"
+#include "DutyModel.h"
+
+/************************************************************************
+ Constants
+ ************************************************************************/
+#define FRAMES						(FS/FRAME_SIZE)		// About a second
+#define SAMPLES						(FRAMES*FRAME_SIZE)
+#define PASSES_DEFAULT				200
+
+/************************************************************************
+ Variables
+ ************************************************************************/
+static int				samples[SAMPLES];
+static char				alaw[SAMPLES];
+static char				adpcm[SAMPLES/2];
+static int				decoded[SAMPLES];
+static unsigned int		duties[SAMPLES];
+static int				passes;
+
+/****************************************************************************
+  Function:
+    static double Now(void)
+  Description:
+	Reads the monotonic clock.
+  Precondition:
+    None.
+  Parameters:
+    None.
+  Returns:
+    Nanoseconds.
+  Remarks:
+    None.
+  ***************************************************************************/
+static double Now(void)
+{
+	struct timespec	now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec*1e9 + now.tv_nsec;
+}
+
+/****************************************************************************
+  Function:
+    static void Report(const char * name, double start)
+  Description:
+	Prints the time per frame since start.
+  Precondition:
+    None.
+  Parameters:
+    const char * name - what was timed.
+    double start - Now() before the passes.
+  Returns:
+    None
+  Remarks:
+    None.
+  ***************************************************************************/
+static void Report(const char * name, double start)
+{
+	printf("%-28s %8.1f ns/frame\n", name, (Now() - start)/((double)passes*FRAMES));
+}
+
+int main(void)
+{
+	const char *	value = getenv("IMA_ADPCM_BENCH_PASSES");
+	IMA_ADPCM_STATE	state;
+	unsigned long	seed = 1;
+	double			start;
+	long			checksum = 0;
+	int				pass, frame, i;
+
+	passes = value ? atoi(value) : PASSES_DEFAULT;
+	if(passes < 1)
+		passes = 1;
+	for(i = 0; i < SAMPLES; i++)
+	{
+		seed = seed*1103515245UL + 12345UL;
+		samples[i] = (int)lrint(20000*sin(2*M_PI*440*i/FS)) + (int)((seed >> 16) & 0xFFF) - 0x800;
+	}
+	G711Lin2Alaw(samples, alaw, SAMPLES);
+	ImaAdpcmInit(&state);
+	ImaAdpcmEncode(&state, samples, adpcm, SAMPLES);
+	speakerBuildDutyTable();
+
+	start = Now();
+	for(pass = 0; pass < passes; pass++)
+		for(frame = 0; frame < FRAMES; frame++)
+			G711Alaw2Lin(&alaw[frame*FRAME_SIZE], &decoded[frame*FRAME_SIZE], FRAME_SIZE);
+	Report("G711Alaw2Lin", start);
+	start = Now();
+	for(pass = 0; pass < passes; pass++)
+	{
+		ImaAdpcmInit(&state);
+		for(frame = 0; frame < FRAMES; frame++)
+			ImaAdpcmDecode(&state, &adpcm[frame*FRAME_SIZE/2], &decoded[frame*FRAME_SIZE], FRAME_SIZE);
+	}
+	Report("ImaAdpcmDecode", start);
+
+	start = Now();
+	for(pass = 0; pass < passes; pass++)
+		for(i = 0; i < SAMPLES; i++)
+			duties[i] = speakerAlawDuty[(unsigned char)alaw[i]];
+	Report("speakerAlawDuty duty", start);
+	start = Now();
+	for(pass = 0; pass < passes; pass++)
+		for(i = 0; i < SAMPLES; i++)
+			duties[i] = speakerLinToDuty(decoded[i]);
+	Report("speakerLinToDuty duty", start);
+	start = Now();
+	for(pass = 0; pass < passes; pass++)
+		for(i = 0; i < SAMPLES; i++)
+			duties[i] = modelLinToDuty(decoded[i]);
+	Report("long divide duty (before)", start);
+
+	// Keeps the passes from being optimised away
+	for(i = 0; i < SAMPLES; i++)
+		checksum += decoded[i] + duties[i];
+	printf("Host figures, the simulator runs code in no virtual time; checksum %ld\n", checksum);
+	return 0;
+}
@@ -0,0 +1,356 @@
+/**********************************************************************
+* FileName:        		ImaAdpcmTest.c
+* Dependencies:    		Header (.h) files if applicable, see below
+* Processor:       		Any host with gcc
+* Compiler:        		gcc
+*
+* Round trip checks of ImaAdpcm.c. Sine, sweep, noise, square and burst
+* signals are encoded and decoded; the decoder has to give back the
+* samples the encoder reconstructed, one for one, with the same step
+* index. Code runs that drive the predictor and the step index to
+* their clamps must stop there. Then clips are served to
+* speakerReadAdpcm() of Speaker.c with header words of every kind of
+* predictor and step index, which has to decode them as ImaAdpcmDecode()
+* does from the state the header gives. HostUtility.c and Speaker.c are
+* included rather than linked so the clips are the test's own and
+* speakerReadAdpcm() can be reached.
+************************************************************************/
+
+/************************************************************************
+ Header Includes
+ ************************************************************************/
+#include <math.h>
+#include <string.h>
+#include "HostTest.h"
+
+#define hostProgramBlocks		ImaAdpcmTestBlocks		// Program memory holds the test clip
+#define hostProgramBlockCount	ImaAdpcmTestBlockCount
+#include "../HostUtility.c"
+#undef hostProgramBlockCount
+#undef hostProgramBlocks
+#include "../../src/Speaker.c"
+
+/************************************************************************
+ Constants
+ ************************************************************************/
+#define SAMPLES						8000				// One second of each signal
+#define SETTLE						100					// Samples left out of the noise figure
+#define SINE_SNR_DB					18.0				// Least signal to noise of the sine and sweep
+#define HEADER_FRAMES				20
+#define HEADER_BYTES				(HEADER_FRAMES*FRAME_SIZE/2)
+#define CLIP_WORDS					(1 + HEADER_BYTES/3)
+#define COUNT(a)					((int)(sizeof(a)/sizeof((a)[0])))
+
+/************************************************************************
+ Data Structures
+ ************************************************************************/
+typedef enum
+{
+	SIGNAL_SINE = 0,							// 440 Hz at half scale
+	SIGNAL_SWEEP,								// 50 Hz to 3.5 kHz near full scale
+	SIGNAL_NOISE,								// Full scale white noise
+	SIGNAL_SQUARE,								// Full scale 500 Hz square wave
+	SIGNAL_BURST,								// The square wave, then silence
+	SIGNALS
+} SIGNAL;
+
+// A run of one code byte for TestClamps() and the state it has to end in
+typedef struct
+{
+	unsigned char	code;
+	int				bytes;
+	int				predictor;
+	int				index;
+} CODE_RUN;
+
+/************************************************************************
+ Variables
+ ************************************************************************/
+static const char * const	signalNames[SIGNALS] = { "sine", "sweep", "noise", "square", "burst" };
+static const CODE_RUN		codeRuns[] =
+{
+	{ 0x77, 200, 32767, 88 },					// Largest rise, index up by 8
+	{ 0x00, 100, 32767, 0 },					// Smallest rise, index down by 1
+	{ 0xFF, 200, -32768, 88 },					// Largest fall
+	{ 0x88, 100, -32768, 0 },					// Smallest fall
+	{ 0x44, 25, 32767, 88 },					// Middle rise, index up by 2
+};
+static const int			headerPredictors[] = { 0, 1, -1, 12345, -12345, 32767, -32768 };
+static const unsigned int	headerIndexes[] = { 0, 1, 44, 88, 89, 0x7F, 0x80, 0x85, 0xD8, 0xFF };
+static unsigned long		seed = 1;
+static int					signal[SAMPLES];
+static char					codes[SAMPLES/2];
+static int					rebuilt[SAMPLES];				// Encoder reconstruction
+static int					rebuiltIndex[SAMPLES];
+static int					decoded[SAMPLES];
+static unsigned long		clipWords[CLIP_WORDS];
+const HOST_PROGRAM_BLOCK	ImaAdpcmTestBlocks[] = { { NULL, clipWords, CLIP_WORDS } };
+const int					ImaAdpcmTestBlockCount = 1;
+
+/****************************************************************************
+  Function:
+    static unsigned int Random(unsigned int range)
+  Description:
+	Pseudo random number, the same sequence every run.
+  Precondition:
+    None.
+  Parameters:
+    unsigned int range - number of values.
+  Returns:
+    0 to range-1.
+  Remarks:
+    None.
+  ***************************************************************************/
+static unsigned int Random(unsigned int range)
+{
+	seed = seed*1103515245UL + 12345UL;
+	return (unsigned int)((seed >> 16) & 0x7FFF) % range;
+}
+
+/****************************************************************************
+  Function:
+    static void MakeSignal(SIGNAL kind)
+  Description:
+	Fills signal[] with a test signal.
+  Precondition:
+    None.
+  Parameters:
+    SIGNAL kind - which.
+  Returns:
+    None
+  Remarks:
+    None.
+  ***************************************************************************/
+static void MakeSignal(SIGNAL kind)
+{
+	double	phase = 0, hz;
+	int		n;
+
+	for(n = 0; n < SAMPLES; n++)
+	{
+		switch(kind)
+		{
+			case SIGNAL_SINE:
+				signal[n] = (int)lrint(16384*sin(2*M_PI*440*n/FS));
+				break;
+			case SIGNAL_SWEEP:
+				hz		= 50 + (3500.0 - 50)*n/SAMPLES;
+				phase	+= 2*M_PI*hz/FS;
+				signal[n] = (int)lrint(30000*sin(phase));
+				break;
+			case SIGNAL_NOISE:
+				signal[n] = (int)((Random(256) << 8) | Random(256)) - 32768;
+				break;
+			case SIGNAL_BURST:
+				if(n >= SAMPLES/2)
+				{
+					signal[n] = 0;
+					break;
+				}
+				// Fall through
+			default:
+				signal[n] = ((n/8) & 1) ? HIGHEST_INPUT_VALUE : LOWEST_INPUT_VALUE;
+				break;
+		}
+	}
+}
+
+/****************************************************************************
+  Function:
+    static void TestRoundTrip(SIGNAL kind)
+  Description:
+	Encodes a signal and decodes it a pair of samples at a time.
+  Precondition:
+    None.
+  Parameters:
+    SIGNAL kind - signal to code.
+  Returns:
+    None
+  Remarks:
+    The encoder's reconstruction is read off a second encoder run a
+    sample per call, whose codes are dropped. The decoder has to give
+    the same samples and, after every pair, the same predictor and
+    step index; both encoders have to end in its state. Samples must
+    stay in the 16 bit range, the step index in 0 to 88. The square
+    wave has to reach both rails and step index 88, and the burst has
+    to bring the step index back to 0 in its silence.
+  ***************************************************************************/
+static void TestRoundTrip(SIGNAL kind)
+{
+	const char *	name = signalNames[kind];
+	IMA_ADPCM_STATE	encoder, stepper, decoder;
+	char			dropped[1];
+	int				n, bad = -1, range = -1, highest = 0, lowest = 0, most = 0;
+	double			power = 0, noise = 0;
+
+	MakeSignal(kind);
+	ImaAdpcmInit(&encoder);
+	ImaAdpcmInit(&stepper);
+	ImaAdpcmInit(&decoder);
+	ImaAdpcmEncode(&encoder, signal, codes, SAMPLES);
+	for(n = 0; n < SAMPLES; n++)
+	{
+		ImaAdpcmEncode(&stepper, &signal[n], dropped, 1);
+		rebuilt[n]		= stepper.predictor;
+		rebuiltIndex[n]	= stepper.index;
+	}
+
+	for(n = 0; n < SAMPLES; n += 2)
+	{
+		ImaAdpcmDecode(&decoder, &codes[n/2], &decoded[n], 2);
+		if(bad < 0 && (decoded[n] != rebuilt[n] || decoded[n + 1] != rebuilt[n + 1]
+			|| decoder.predictor != rebuilt[n + 1] || decoder.index != rebuiltIndex[n + 1]))
+			bad = n;
+	}
+	HOST_CHECK(bad < 0, "%s: samples %d and %d decode to %d %d, index %d, the encoder rebuilt %d %d, index %d", name,
+		bad, bad + 1, decoded[bad], decoded[bad + 1], decoder.index, rebuilt[bad], rebuilt[bad + 1], rebuiltIndex[bad + 1]);
+	HOST_CHECK(encoder.predictor == decoder.predictor && encoder.index == decoder.index
+		&& stepper.predictor == decoder.predictor && stepper.index == decoder.index,
+		"%s: encoders end on %d/%d and %d/%d, the decoder on %d/%d", name, encoder.predictor, encoder.index,
+		stepper.predictor, stepper.index, decoder.predictor, decoder.index);
+
+	for(n = 0; n < SAMPLES; n++)
+	{
+		if(range < 0 && (decoded[n] > HIGHEST_INPUT_VALUE || decoded[n] < LOWEST_INPUT_VALUE
+			|| rebuiltIndex[n] < 0 || rebuiltIndex[n] > 88))
+			range = n;
+		if(decoded[n] > highest)
+			highest = decoded[n];
+		if(decoded[n] < lowest)
+			lowest = decoded[n];
+		if(rebuiltIndex[n] > most)
+			most = rebuiltIndex[n];
+		if(n >= SETTLE)
+		{
+			power += (double)signal[n]*signal[n];
+			noise += (double)(decoded[n] - signal[n])*(decoded[n] - signal[n]);
+		}
+	}
+	HOST_CHECK(range < 0, "%s: sample %d decodes to %d with step index %d", name, range, decoded[range], rebuiltIndex[range]);
+
+	switch(kind)
+	{
+		case SIGNAL_SINE:
+		case SIGNAL_SWEEP:
+			HOST_CHECK(10*log10(power/noise) >= SINE_SNR_DB, "%s: signal to noise %.1f dB", name, 10*log10(power/noise));
+			break;
+		case SIGNAL_SQUARE:
+			HOST_CHECK(highest == HIGHEST_INPUT_VALUE && lowest == LOWEST_INPUT_VALUE && most == 88,
+				"%s: decodes to %d to %d, step index up to %d", name, lowest, highest, most);
+			break;
+		case SIGNAL_BURST:
+			HOST_CHECK(most == 88 && decoder.index == 0 && decoder.predictor == 0,
+				"%s: step index up to %d, ends on %d/%d", name, most, decoder.predictor, decoder.index);
+			break;
+		default:
+			break;
+	}
+}
+
+/****************************************************************************
+  Function:
+    static void TestClamps(void)
+  Description:
+	Decodes runs of one code byte that drive the predictor and the step
+	index against their clamps.
+  Precondition:
+    None.
+  Parameters:
+    None.
+  Returns:
+    None
+  Remarks:
+    The runs follow on from each other. The state after every byte has
+    to stay in range, and each run has to end in the state codeRuns[]
+    gives it.
+  ***************************************************************************/
+static void TestClamps(void)
+{
+	IMA_ADPCM_STATE	state;
+	int				run, byte, bad;
+	char			code[1];
+	int				pair[2];
+
+	ImaAdpcmInit(&state);
+	for(run = 0; run < COUNT(codeRuns); run++)
+	{
+		code[0]	= (char)codeRuns[run].code;
+		bad		= -1;
+		for(byte = 0; byte < codeRuns[run].bytes; byte++)
+		{
+			ImaAdpcmDecode(&state, code, pair, 2);
+			if(bad < 0 && (state.index < 0 || state.index > 88 || pair[0] > HIGHEST_INPUT_VALUE
+				|| pair[0] < LOWEST_INPUT_VALUE || pair[1] > HIGHEST_INPUT_VALUE || pair[1] < LOWEST_INPUT_VALUE))
+				bad = byte;
+		}
+		HOST_CHECK(bad < 0, "code 0x%02X: byte %d leaves the range", codeRuns[run].code, bad);
+		HOST_CHECK(state.predictor == codeRuns[run].predictor && state.index == codeRuns[run].index,
+			"code 0x%02X: ends on %d/%d, not %d/%d", codeRuns[run].code, state.predictor, state.index,
+			codeRuns[run].predictor, codeRuns[run].index);
+	}
+}
+
+/****************************************************************************
+  Function:
+    static void TestHeader(int predictor, unsigned int index)
+  Description:
+	Plays a clip of random codes with a header word through
+	speakerReadAdpcm().
+  Precondition:
+    None.
+  Parameters:
+    int predictor - initial predictor in the header.
+    unsigned int index - upper 8 bits of the header.
+  Returns:
+    None
+  Remarks:
+    The reference decoder starts from the predictor and from the index
+    less its top bit, clamped to 88. One check per frame.
+  ***************************************************************************/
+static void TestHeader(int predictor, unsigned int index)
+{
+	SPEAKER_VOICE	voice;
+	IMA_ADPCM_STATE	state;
+	unsigned char	bytes[HEADER_BYTES];
+	int				samples[FRAME_SIZE], reference[FRAME_SIZE];
+	int				frame, i, bad;
+
+	for(i = 0; i < HEADER_BYTES; i++)
+		bytes[i] = (unsigned char)Random(256);
+	clipWords[0] = ((unsigned long)predictor & 0xFFFF) | ((unsigned long)index << 16);
+	for(i = 0; i < HEADER_BYTES/3; i++)
+		clipWords[1 + i] = bytes[3*i] | ((unsigned long)bytes[3*i + 1] << 8) | ((unsigned long)bytes[3*i + 2] << 16);
+
+	memset(&voice, 0, sizeof(voice));
+	voice.samplePtr	= HOST_PROGRAM_BASE;
+	voice.codec		= SPEAKER_CODEC_IMA_ADPCM;
+	state.predictor	= predictor;
+	state.index		= ((index & 0x7F) > 88) ? 88 : (int)(index & 0x7F);
+
+	for(frame = 0; frame < HEADER_FRAMES; frame++)
+	{
+		speakerReadAdpcm(&voice, samples);
+		ImaAdpcmDecode(&state, (char *)&bytes[frame*FRAME_SIZE/2], reference, FRAME_SIZE);
+		for(bad = -1, i = 0; i < FRAME_SIZE && bad < 0; i++)
+			if(samples[i] != reference[i])
+				bad = i;
+		HOST_CHECK(bad < 0, "header %d/0x%02X frame %d: sample %d is %d, not %d", predictor, index, frame, bad,
+			samples[bad], reference[bad]);
+	}
+	HOST_CHECK(voice.adpcm.predictor == state.predictor && voice.adpcm.index == state.index,
+		"header %d/0x%02X: voice ends on %d/%d, not %d/%d", predictor, index, voice.adpcm.predictor,
+		voice.adpcm.index, state.predictor, state.index);
+}
+
+int main(void)
+{
+	int		kind, p, i;
+
+	for(kind = 0; kind < SIGNALS; kind++)
+		TestRoundTrip((SIGNAL)kind);
+	TestClamps();
+	for(p = 0; p < COUNT(headerPredictors); p++)
+		for(i = 0; i < COUNT(headerIndexes); i++)
+			TestHeader(headerPredictors[p], headerIndexes[i]);
+	return hostTestEnd("ImaAdpcmTest");
+}
@@ -0,0 +1,327 @@
+/**********************************************************************
+* FileName:        		KeyPressTest.c
+* Dependencies:    		Header (.h) files if applicable, see below
+* Processor:       		Any host with gcc
+* Compiler:        		gcc
+*
+* Replays scripted switch pin timelines, with contact bounce, glitches
+* and holds either side of the long press, through keyScan() of
+* KeyPress.c as the simulated Timer 4 interrupt runs it every
+* millisecond. The events queued have to come in order, within the
+* debounce time of the pin settling, and the long press exactly
+* KEY_LONG_MS after the press.
+************************************************************************/
+
+/************************************************************************
+ Header Includes
+ ************************************************************************/
+#include <stdlib.h>
+#include "HostTest.h"
+#include "HostSim.h"
+#include "Main.h"
+#include "KeyPress.h"
+#include "Timebase.h"
+#include "Timer4Code.h"
+
+/************************************************************************
+ Constants
+ ************************************************************************/
+#define CYCLES_PER_MS				(GetInstructionClock()/1000)
+#define MAX_EVENTS					KEY_QUEUE_DEPTH
+#define MAX_LATENCY_US				20000UL				// Pin settled to event, at the most
+#define LONG_TOLERANCE_US			50					// Timer 1 and Timer 4 periods differ slightly
+#define COUNT(a)					((int)(sizeof(a)/sizeof((a)[0])))
+
+/************************************************************************
+ Data Structures
+ ************************************************************************/
+// A pin change, at microseconds from the start of the timeline
+typedef struct
+{
+	unsigned long	at;
+	int				sw;							// 1 for S1, 2 for S2
+	int				level;						// 0 pressed, 1 released
+} EDGE;
+
+/************************************************************************
+ Variables
+ ************************************************************************/
+static KEY_EVENT		events[MAX_EVENTS];
+static unsigned long	eventAt[MAX_EVENTS];	// Microseconds from the start of the timeline
+static int				eventCount;
+
+/****************************************************************************
+  Function:
+    static void Play(const EDGE * edges, int count, unsigned long ms)
+  Description:
+	Drives the switch pins through a timeline and collects the events.
+  Precondition:
+    Timer 1 and Timer 4 running, both switches released.
+  Parameters:
+    const EDGE * edges - pin changes, in time order.
+    int count - number of edges.
+    unsigned long ms - length of the timeline.
+  Returns:
+    None
+  Remarks:
+    The events are left in events[] with their micros() taken back to
+    the start of the timeline in eventAt[].
+  ***************************************************************************/
+static void Play(const EDGE * edges, int count, unsigned long ms)
+{
+	unsigned long long	start = hostCycles;
+	DWORD				base = micros();
+	int					i;
+
+	for(i = 0; i < count; i++)
+	{
+		hostAdvance(start + (unsigned long long)edges[i].at*CYCLES_PER_MS/1000 - hostCycles);
+		if(edges[i].sw == 1)
+			PORTAbits.RA8 = edges[i].level;
+		else
+			PORTCbits.RC2 = edges[i].level;
+	}
+	hostAdvance(start + (unsigned long long)ms*CYCLES_PER_MS - hostCycles);
+
+	for(eventCount = 0; eventCount < MAX_EVENTS && pollKeyEvent(&events[eventCount]); eventCount++)
+		eventAt[eventCount] = events[eventCount].micros - base;
+	HOST_CHECK(keyOverruns == 0, "%u events dropped", keyOverruns);
+	keyFlush();
+}
+
+/****************************************************************************
+  Function:
+    static int Find(int code, int from)
+  Description:
+	Looks for an event from Play().
+  Precondition:
+    None.
+  Parameters:
+    int code - event code.
+    int from - first event to look at.
+  Returns:
+    Index of the first event with code, -1 if there is none.
+  Remarks:
+    None.
+  ***************************************************************************/
+static int Find(int code, int from)
+{
+	for(; from < eventCount; from++)
+		if(events[from].code == code)
+			return from;
+	return -1;
+}
+
+/****************************************************************************
+  Function:
+    static void CheckAt(int code, unsigned long first, unsigned long settled, const char * name)
+  Description:
+	Checks there is exactly one event of a kind and when it came.
+  Precondition:
+    Play() called.
+  Parameters:
+    int code - event code.
+    unsigned long first - microseconds the pin first changed at.
+    unsigned long settled - microseconds it last changed at.
+    const char * name - timeline, for the messages.
+  Returns:
+    None
+  Remarks:
+    The pin has to have read the same for KEY_DEBOUNCE_MS interrupts,
+    so the event is between KEY_DEBOUNCE_MS - 1 ms after the first
+    change and KEY_DEBOUNCE_MS after the last, and at most
+    MAX_LATENCY_US after the last.
+  ***************************************************************************/
+static void CheckAt(int code, unsigned long first, unsigned long settled, const char * name)
+{
+	int		i = Find(code, 0);
+
+	HOST_CHECK(i >= 0 && Find(code, i + 1) < 0, "%s: %d events of code %d", name, i < 0 ? 0 : 2, code);
+	if(i < 0)
+		return;
+	HOST_CHECK(eventAt[i] >= first + (KEY_DEBOUNCE_MS - 1)*1000UL && eventAt[i] <= settled + KEY_DEBOUNCE_MS*1000UL
+		&& eventAt[i] - settled <= MAX_LATENCY_US,
+		"%s: code %d at %lu us, pin changed at %lu us and settled at %lu us", name, code, eventAt[i], first, settled);
+}
+
+/****************************************************************************
+  Function:
+    static void CheckOrder(const int * codes, int count, const char * name)
+  Description:
+	Checks the events of a timeline came in a given order.
+  Precondition:
+    Play() called.
+  Parameters:
+    const int * codes - expected event codes.
+    int count - number of them.
+    const char * name - timeline, for the messages.
+  Returns:
+    None
+  Remarks:
+    None.
+  ***************************************************************************/
+static void CheckOrder(const int * codes, int count, const char * name)
+{
+	int		i, same = (eventCount == count);
+
+	for(i = 0; same && i < count; i++)
+		same = (events[i].code == codes[i]);
+	HOST_CHECK(same, "%s: %d events, the first %d, expected %d events from %d", name, eventCount,
+		eventCount ? events[0].code : 0, count, count ? codes[0] : 0);
+}
+
+/****************************************************************************
+  Function:
+    static void TestBounce(void)
+  Description:
+	A tap of S1 with clean edges and one of S2 that bounces on the way
+	down and up.
+  Precondition:
+    As Play().
+  Parameters:
+    None.
+  Returns:
+    None
+  Remarks:
+    None.
+  ***************************************************************************/
+static void TestBounce(void)
+{
+	static const EDGE	clean[] = { { 1000, 1, 0 }, { 101000, 1, 1 } };
+	static const EDGE	bouncy[] =
+	{
+		{ 2000, 2, 0 }, { 2300, 2, 1 }, { 2900, 2, 0 }, { 3400, 2, 1 }, { 4100, 2, 0 },
+		{ 150000, 2, 1 }, { 150600, 2, 0 }, { 151500, 2, 1 }, { 152200, 2, 0 }, { 153900, 2, 1 }
+	};
+	static const int	s1Tap[] = { S1_PRESS, S1_RELEASE, S1_SHORT };
+	static const int	s2Tap[] = { S2_PRESS, S2_RELEASE, S2_SHORT };
+
+	Play(clean, COUNT(clean), 200);
+	CheckOrder(s1Tap, COUNT(s1Tap), "clean tap");
+	CheckAt(S1_PRESS, 1000, 1000, "clean tap");
+	CheckAt(S1_RELEASE, 101000, 101000, "clean tap");
+	CheckAt(S1_SHORT, 101000, 101000, "clean tap");
+
+	Play(bouncy, COUNT(bouncy), 250);
+	CheckOrder(s2Tap, COUNT(s2Tap), "bouncy tap");
+	CheckAt(S2_PRESS, 2000, 4100, "bouncy tap");
+	CheckAt(S2_RELEASE, 150000, 153900, "bouncy tap");
+	CheckAt(S2_SHORT, 150000, 153900, "bouncy tap");
+}
+
+/****************************************************************************
+  Function:
+    static void TestGlitches(void)
+  Description:
+	Pulses shorter than the debounce time, and chatter that never holds
+	still, must not give any event.
+  Precondition:
+    As Play().
+  Parameters:
+    None.
+  Returns:
+    None
+  Remarks:
+    A pulse of KEY_DEBOUNCE_MS - 2 ms is read pressed by at most
+    KEY_DEBOUNCE_MS - 1 interrupts, whatever its phase.
+  ***************************************************************************/
+static void TestGlitches(void)
+{
+	static const int	tap[] = { S2_PRESS, S2_RELEASE, S2_SHORT };
+	EDGE				edges[64];
+	unsigned long		at;
+	int					count = 0, i;
+
+	for(i = 0; i < 10; i++)
+	{
+		at = 1000 + i*(20000 + 137);
+		edges[count].at = at;									edges[count].sw = 1 + i % 2;	edges[count++].level = 0;
+		edges[count].at = at + (KEY_DEBOUNCE_MS - 2)*1000UL;	edges[count].sw = 1 + i % 2;	edges[count++].level = 1;
+	}
+	for(i = 0; i < 40; i++)
+	{
+		edges[count].at = 250000 + i*1000UL + (i % 2)*300;	edges[count].sw = 1;	edges[count++].level = i % 2;
+	}
+	Play(edges, count, 350);
+	CheckOrder(NULL, 0, "glitches");
+
+	// Once pressed, a release shorter than the debounce time does not end the hold
+	edges[0].at = 1000;		edges[0].sw = 2;	edges[0].level = 0;
+	edges[1].at = 50000;	edges[1].sw = 2;	edges[1].level = 1;
+	edges[2].at = 55500;	edges[2].sw = 2;	edges[2].level = 0;
+	edges[3].at = 100000;	edges[3].sw = 2;	edges[3].level = 1;
+	Play(edges, 4, 150);
+	CheckOrder(tap, COUNT(tap), "release glitch");
+	CheckAt(S2_RELEASE, 100000, 100000, "release glitch");
+}
+
+/****************************************************************************
+  Function:
+    static void TestLong(void)
+  Description:
+	Holds either side of KEY_LONG_MS, and S1 tapped while S2 is held.
+  Precondition:
+    As Play().
+  Parameters:
+    None.
+  Returns:
+    None
+  Remarks:
+    Press and release are debounced alike, so the press events are as
+    far apart as the pin changes give or take a millisecond.
+  ***************************************************************************/
+static void TestLong(void)
+{
+	static const int	s1Short[] = { S1_PRESS, S1_RELEASE, S1_SHORT };
+	static const int	s1Long[] = { S1_PRESS, S1_LONG, S1_RELEASE };
+	static const int	both[] = { S2_PRESS, S1_PRESS, S1_RELEASE, S1_SHORT, S2_LONG, S2_RELEASE };
+	EDGE				edges[4];
+	unsigned long		hold, phase;
+	int					press, held;
+
+	for(phase = 0; phase < 1000; phase += 250)
+	{
+		for(hold = KEY_LONG_MS - 30; hold <= KEY_LONG_MS + 30; hold++)
+		{
+			// A millisecond either side of the threshold can go either way
+			if(hold >= KEY_LONG_MS - 1 && hold <= KEY_LONG_MS + 1)
+				continue;
+			edges[0].at = 1000 + phase;					edges[0].sw = 1;	edges[0].level = 0;
+			edges[1].at = edges[0].at + hold*1000UL;	edges[1].sw = 1;	edges[1].level = 1;
+			Play(edges, 2, KEY_LONG_MS + 100);
+			if(hold < KEY_LONG_MS)
+				CheckOrder(s1Short, COUNT(s1Short), "short hold");
+			else
+				CheckOrder(s1Long, COUNT(s1Long), "long hold");
+
+			press	= Find(S1_PRESS, 0);
+			held	= Find(S1_LONG, 0);
+			if(press >= 0 && held >= 0)
+				HOST_CHECK(labs((long)(eventAt[held] - eventAt[press]) - KEY_LONG_MS*1000L) <= LONG_TOLERANCE_US,
+					"hold of %lu ms: long press %lu us after the press", hold, eventAt[held] - eventAt[press]);
+		}
+	}
+
+	edges[0].at = 1000;		edges[0].sw = 2;	edges[0].level = 0;
+	edges[1].at = 100000;	edges[1].sw = 1;	edges[1].level = 0;
+	edges[2].at = 200000;	edges[2].sw = 1;	edges[2].level = 1;
+	edges[3].at = 900000;	edges[3].sw = 2;	edges[3].level = 1;
+	Play(edges, 4, 1000);
+	CheckOrder(both, COUNT(both), "tap during a hold");
+	CheckAt(S1_PRESS, 100000, 100000, "tap during a hold");
+	CheckAt(S1_SHORT, 200000, 200000, "tap during a hold");
+	CheckAt(S2_RELEASE, 900000, 900000, "tap during a hold");
+}
+
+int main(void)
+{
+	// The simulator ends the run at HOST_RUN_MS, longer than this test
+	setenv("HOST_RUN_MS", "1000000", 1);
+	timebaseInit();
+	initTmr4();
+
+	TestBounce();
+	TestGlitches();
+	TestLong();
+	return hostTestEnd("KeyPressTest");
+}
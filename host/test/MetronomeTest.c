@@ -0,0 +1,164 @@
+/**********************************************************************
+* FileName:        		MetronomeTest.c
+* Dependencies:    		Header (.h) files if applicable, see below
+* Processor:       		Any host with gcc
+* Compiler:        		gcc
+*
+* Runs metronomeFrameHook() of metronome.c a frame at a time, as the
+* audio fill calls it, for ten minutes at every tempo from 30.0 to
+* 300.0 BPM in 0.1 BPM steps, and while the tempo is stepped up and down
+* by 0.1 and 1 BPM. Every click has to start on the sample worked out
+* here in closed form, from the frame it falls in, with the accent on
+* the first beat of the bar. metronome.c is included rather than linked
+* so the hook and its state can be reached.
+************************************************************************/
+
+/************************************************************************
+ Header Includes
+ ************************************************************************/
+#include "HostTest.h"
+
+#define speakerActivateAt	MetronomeActivateAt		// Clicks are checked here instead of played
+#include "../../src/metronome.c"
+
+/************************************************************************
+ Constants
+ ************************************************************************/
+#define RUN_SAMPLES					(FS*600L)			// Ten minutes
+#define FIRST_FRAME					987654UL			// Sample clock when the metronome starts
+#define CHANGE_EVERY				7					// Clicks between tempo steps
+
+/************************************************************************
+ Variables
+ ************************************************************************/
+static unsigned long	frame;							// Frame the hook is in
+static unsigned long	anchor;							// Click the tempo in force was taken up on
+static unsigned long	since;							// Clicks since anchor
+static unsigned int		tempo;							// bpm10 in force
+static unsigned long	clicks;
+static unsigned int		bad;
+
+/****************************************************************************
+  Function:
+    static unsigned long Expected(void)
+  Description:
+	Works out the sample the next click is due on.
+  Precondition:
+    None.
+  Parameters:
+    None.
+  Returns:
+    Sample clock value.
+  Remarks:
+    Click k after the anchor is on anchor + k*METRONOME_SAMPLES_MIN10/
+    tempo rounded down, so there is nothing to drift.
+  ***************************************************************************/
+static unsigned long Expected(void)
+{
+	return anchor + since*METRONOME_SAMPLES_MIN10/tempo;
+}
+
+/****************************************************************************
+  Function:
+    void MetronomeActivateAt(long SpeechSegment, long SpeechSegmentSize, unsigned int codec, unsigned long startSample)
+  Description:
+	Stands in for speakerActivateAt(), checking the click.
+  Precondition:
+    None.
+  Parameters:
+    As speakerActivateAt().
+  Returns:
+    None
+  Remarks:
+    Only the first wrong click of a run is reported.
+  ***************************************************************************/
+void MetronomeActivateAt(long SpeechSegment, long SpeechSegmentSize, unsigned int codec, unsigned long startSample)
+{
+	unsigned long	expected = Expected();
+	long			accent = (clicks % metronomeBeats == 0) ? SPEECH_ADDR_METRONOME1 : SPEECH_ADDR_SELECT;
+
+	(void)SpeechSegmentSize; (void)codec;
+	if(!bad && startSample != expected)
+	{
+		bad = 1;
+		HOST_CHECK(0, "%u.%u bpm click %lu on sample %ld, expected %lu", tempo/10, tempo%10, clicks,
+			(long)(startSample - FIRST_FRAME), expected - FIRST_FRAME);
+	}
+	else if(!bad && (startSample < frame || startSample - frame >= FRAME_SIZE))
+	{
+		bad = 1;
+		HOST_CHECK(0, "%u.%u bpm click %lu on sample %lu from the frame at %lu", tempo/10, tempo%10, clicks,
+			startSample - FIRST_FRAME, frame - FIRST_FRAME);
+	}
+	else if(!bad && SpeechSegment != accent)
+	{
+		bad = 1;
+		HOST_CHECK(0, "%u.%u bpm click %lu of a %u beat bar is%s accented", tempo/10, tempo%10, clicks,
+			metronomeBeats, accent == SPEECH_ADDR_METRONOME1 ? " not" : "");
+	}
+	clicks++;
+	since++;
+}
+
+/****************************************************************************
+  Function:
+    static void Run(unsigned int bpm10, int step, unsigned int beats)
+  Description:
+	Plays the metronome for RUN_SAMPLES and checks every click.
+  Precondition:
+    None.
+  Parameters:
+    unsigned int bpm10 - tempo to start at, in tenths of a BPM.
+    int step - tenths of a BPM to change the tempo by every CHANGE_EVERY
+               clicks, 0 to keep it. It turns round at either limit.
+    unsigned int beats - beats in a bar.
+  Returns:
+    None
+  Remarks:
+    A new tempo is picked up between frames as play_metronome() sets
+    it. The click already scheduled keeps its sample and the new tempo
+    counts from there, so it becomes the anchor.
+  ***************************************************************************/
+static void Run(unsigned int bpm10, int step, unsigned int beats)
+{
+	unsigned long	end = FIRST_FRAME + RUN_SAMPLES;
+
+	metronomeBpm10		= tempo = bpm10;
+	metronomeBeats		= beats;
+	metronomeRunning	= 0;
+	anchor				= FIRST_FRAME;
+	since				= 0;
+	clicks				= 0;
+	bad					= 0;
+	for(frame = FIRST_FRAME; frame < end; frame += FRAME_SIZE)
+	{
+		if(step != 0 && since >= CHANGE_EVERY)
+		{
+			if(tempo + step < METRONOME_BPM10_MIN || tempo + step > METRONOME_BPM10_MAX)
+				step = -step;
+			anchor				= Expected();
+			since				= 0;
+			metronomeBpm10		= tempo = tempo + step;
+		}
+		metronomeFrameHook(frame);
+	}
+
+	// Ten minutes hold exactly bpm10 beats, the next one is due on end
+	if(step == 0)
+		HOST_CHECK(clicks == bpm10, "%u.%u bpm: %lu clicks in ten minutes", bpm10/10, bpm10%10, clicks);
+	HOST_CHECK(!bad, "%u.%u bpm step %d: clicks off", bpm10/10, bpm10%10, step);
+}
+
+int main(void)
+{
+	unsigned int	bpm10;
+
+	for(bpm10 = METRONOME_BPM10_MIN; bpm10 <= METRONOME_BPM10_MAX; bpm10++)
+		Run(bpm10, 0, 2 + bpm10 % 3);
+
+	Run(METRONOME_BPM10_MIN, 1, 4);
+	Run(METRONOME_BPM10_MAX, -1, 3);
+	Run(1200, 10, 4);
+	Run(1201, -10, 2);
+	return hostTestEnd("MetronomeTest");
+}
@@ -0,0 +1,118 @@
+/**********************************************************************
+* FileName:        		OutCharBench.c
+* Dependencies:    		Header (.h) files if applicable, see below
+* Processor:       		Any host with gcc
+* Compiler:        		gcc
+*
+* Times the OutChar() of SH1101A.c against OutCharModel.h, the
+* OutChar() of Primitive.c, in glyphs per host second. A line of the
+* default font is drawn across the screen on page aligned rows and on
+* rows that straddle two pages, white and black in turn so every glyph
+* changes display RAM. FlushDisplay() is not timed. OUTCHAR_BENCH_PASSES
+* sets the passes over the lines.
+************************************************************************/
+
+/************************************************************************
+ Header Includes
+ ************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "HostSim.h"
+#include "Graphics/Graphics.h"
+#include "OutCharModel.h"
+
+/************************************************************************
+ Constants
+ ************************************************************************/
+#define PASSES_DEFAULT				2000
+
+/************************************************************************
+ Variables
+ ************************************************************************/
+static const char	line[] = "Tempo 120 BPM A4";
+static int			passes;
+
+/****************************************************************************
+  Function:
+    static double Now(void)
+  Description:
+	Reads the monotonic clock.
+  Precondition:
+    None.
+  Parameters:
+    None.
+  Returns:
+    Nanoseconds.
+  Remarks:
+    None.
+  ***************************************************************************/
+static double Now(void)
+{
+	struct timespec	now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec*1e9 + now.tv_nsec;
+}
+
+/****************************************************************************
+  Function:
+    static void Run(const char * name, int driver, SHORT firstRow)
+  Description:
+	Draws the line passes times, in both colours, and prints the rate.
+  Precondition:
+    The default font is set.
+  Parameters:
+    const char * name - what is timed.
+    int driver - nonzero for the driver OutChar(), else modelOutChar().
+    SHORT firstRow - row of the first line; lines are 16 rows apart.
+  Returns:
+    None
+  Remarks:
+    None.
+  ***************************************************************************/
+static void Run(const char * name, int driver, SHORT firstRow)
+{
+	double			start;
+	unsigned long	glyphs = 0;
+	int				pass, i;
+	SHORT			y;
+
+	start = Now();
+	for(pass = 0; pass < passes; pass++)
+	{
+		SetColor((pass & 1) ? BLACK : WHITE);
+		for(y = firstRow; y + _fontHeight <= GetMaxY() + 1; y += 16)
+		{
+			MoveTo(0, y);
+			for(i = 0; line[i] != 0; i++, glyphs++)
+			{
+				if(driver)
+					OutChar(line[i]);
+				else
+					modelOutChar(line[i]);
+			}
+		}
+	}
+	printf("%-32s %10.0f glyphs/s\n", name, glyphs/((Now() - start)/1e9));
+}
+
+int main(void)
+{
+	const char *	value = getenv("OUTCHAR_BENCH_PASSES");
+
+	passes = value ? atoi(value) : PASSES_DEFAULT;
+	if(passes < 1)
+		passes = 1;
+	ResetDevice();
+	SetFont((void *)&GOLFontDefault);
+	SetClip(CLIP_DISABLE);
+
+	printf("Host figures, the simulator runs code in no virtual time\n");
+	Run("SH1101A.c OutChar, page rows", 1, 0);
+	Run("Primitive.c model, page rows", 0, 0);
+	Run("SH1101A.c OutChar, split rows", 1, 5);
+	Run("Primitive.c model, split rows", 0, 5);
+	FlushDisplay();
+	return 0;
+}
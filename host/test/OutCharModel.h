@@ -0,0 +1,66 @@
+/**********************************************************************
+* FileName:        		OutCharModel.h
+* Dependencies:    		Graphics/Graphics.h
+* Processor:       		Any host with gcc
+* Compiler:        		gcc
+*
+* Reference model of the OutChar() of Graphics/Primitive.c, which the
+* SH1101A driver replaces with its own under USE_DRV_OUTCHAR. It walks
+* the glyph a bit at a time and puts each set pixel through PutPixel(),
+* so clipping, the screen edges and the scrolled rows are PutPixel()'s.
+* Flash fonts only. SH1101ATest.c checks the driver OutChar() against
+* it and OutCharBench.c times the two.
+************************************************************************/
+
+#ifndef	__OUT_CHAR_MODEL_H__
+#define	__OUT_CHAR_MODEL_H__
+
+/****************************************************************************
+  Function:
+    void modelOutChar(XCHAR ch)
+  Description:
+	OutChar() of Primitive.c for the current flash font.
+  Precondition:
+    SetFont() has been called with a flash font.
+  Parameters:
+    XCHAR ch - character.
+  Returns:
+    None
+  Remarks:
+    Moves the cursor past the glyph, as OutChar() does.
+  ***************************************************************************/
+static inline void modelOutChar(XCHAR ch)
+{
+	GLYPH_ENTRY *	pChTable;
+	BYTE *			pChImage;
+	SHORT			chWidth, xCnt, yCnt, x, y;
+	BYTE			temp = 0, mask;
+
+	if((unsigned XCHAR)ch < (unsigned XCHAR)_fontFirstChar)
+		return;
+	if((unsigned XCHAR)ch > (unsigned XCHAR)_fontLastChar)
+		return;
+
+	pChTable	= (GLYPH_ENTRY *)(((FONT_FLASH *)_font)->address + sizeof(FONT_HEADER))
+				  + ((unsigned XCHAR)ch - (unsigned XCHAR)_fontFirstChar);
+	pChImage	= (BYTE *)(((FONT_FLASH *)_font)->address + pChTable->offsetLSB);
+	chWidth		= pChTable->width;
+
+	for(yCnt = 0, y = GetY(); yCnt < _fontHeight; yCnt++, y++)
+	{
+		mask = 0;
+		for(xCnt = 0, x = GetX(); xCnt < chWidth; xCnt++, x++, mask >>= 1)
+		{
+			if(mask == 0)
+			{
+				temp = *pChImage++;
+				mask = 0x80;
+			}
+			if(temp & mask)
+				PutPixel(x, y);
+		}
+	}
+	_cursorX = GetX() + chWidth;
+}
+
+#endif
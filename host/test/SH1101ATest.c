@@ -0,0 +1,585 @@
+/**********************************************************************
+* FileName:        		SH1101ATest.c
+* Dependencies:    		Header (.h) files if applicable, see below
+* Processor:       		Any host with gcc
+* Compiler:        		gcc
+*
+* Golden image test of the page byte fills in SH1101A.c. Every
+* rectangle is drawn twice over the same background, once pixel by
+* pixel through PutPixel(), as the Bar() of Primitive.c does, and once
+* through the driver's Bar() or ClearRegion(). Both are flushed and
+* the glass of HostDisplay.c has to match, so a column that is filled
+* but not marked for FlushDisplay() shows as well as a wrong pixel.
+* The driver's OutChar(), which transposes the glyph a block at a time,
+* is checked the same way against OutCharModel.h, the OutChar() of
+* Primitive.c, for random glyphs of a made up font as well as the
+* default one, in both colours, at random places, clipping regions and
+* scroll offsets. Last come the scrolled rows: pixels put at every
+* display start line are read back from the glass and by GetPixel(),
+* a random picture is scrolled by random amounts and has to move with
+* the rows scrolled in filled, and rectangles and glyphs are drawn
+* across the row where display RAM wraps from row 63 to row 0.
+************************************************************************/
+
+/************************************************************************
+ Header Includes
+ ************************************************************************/
+#include "HostTest.h"
+#include "HostSim.h"
+#include "Graphics/Graphics.h"
+#include "OutCharModel.h"
+
+/************************************************************************
+ Constants
+ ************************************************************************/
+#define WIDTH						HOST_DISPLAY_WIDTH
+#define HEIGHT						HOST_DISPLAY_HEIGHT
+#define COUNT(a)					((int)(sizeof(a)/sizeof((a)[0])))
+#define CHARS						20000
+#define SCROLLS						300
+#define TEST_FONT_FIRST				32
+#define TEST_FONT_GLYPHS			24
+#define TEST_FONT_HEIGHT			21					// Spans up to 4 pages
+#define TEST_FONT_WIDEST			20					// Spans up to 3 blocks of 8
+
+/************************************************************************
+ Data Structures
+ ************************************************************************/
+typedef struct
+{
+	SHORT	left, top, right, bottom;
+} RECT;
+
+/************************************************************************
+ Variables
+ ************************************************************************/
+// Columns off both sides, at the edges, and 1 and 0 wide
+static const SHORT spans[][2] =
+{
+	{ -5, 140 }, { -5, -1 }, { 0, 0 }, { 0, 127 }, { 1, 9 },
+	{ 63, 64 }, { 127, 127 }, { 127, 200 }, { 128, 130 }, { 20, 10 }
+};
+// Rows either side of page boundaries, off the screen and inverted
+static const SHORT rows[] = { -3, 0, 1, 6, 7, 8, 9, 15, 16, 56, 62, 63, 70 };
+// Unclipped, clip edges inside pages, clip on page edges
+static const RECT clips[] =
+{
+	{ 0, 0, 0, 0 }, { 3, 5, 100, 45 }, { 10, 8, 20, 15 }
+};
+static const SHORT scrolls[] = { 0, 5, 60 };
+
+static BYTE		golden[HEIGHT][WIDTH];
+static unsigned long	seed = 1;
+static union
+{
+	char		bytes[sizeof(FONT_HEADER) + TEST_FONT_GLYPHS*(sizeof(GLYPH_ENTRY) + 3*TEST_FONT_HEIGHT)];
+	WORD		align;
+} testFontImage;
+static FONT_FLASH	testFont = { FLASH, testFontImage.bytes };
+
+/****************************************************************************
+  Function:
+    static unsigned int Random(unsigned int range)
+  Description:
+	Pseudo random number, the same sequence every run.
+  Precondition:
+    None.
+  Parameters:
+    unsigned int range - number of values.
+  Returns:
+    0 to range-1.
+  Remarks:
+    None.
+  ***************************************************************************/
+static unsigned int Random(unsigned int range)
+{
+	seed = seed*1103515245UL + 12345UL;
+	return (unsigned int)((seed >> 16) & 0x7FFF) % range;
+}
+
+/****************************************************************************
+  Function:
+    static void MakeTestFont(void)
+  Description:
+	Fills testFont with glyphs of random widths and bits.
+  Precondition:
+    None.
+  Parameters:
+    None.
+  Returns:
+    None
+  Remarks:
+    Widths run from 0 to TEST_FONT_WIDEST, so glyphs take up to three
+    blocks of 8 columns, and the bits past the width in the last byte
+    of a row are set as well, which neither OutChar() may draw.
+  ***************************************************************************/
+static void MakeTestFont(void)
+{
+	FONT_HEADER *	pHeader = (FONT_HEADER *)testFontImage.bytes;
+	GLYPH_ENTRY *	pGlyph = (GLYPH_ENTRY *)(pHeader + 1);
+	WORD			offset = sizeof(FONT_HEADER) + TEST_FONT_GLYPHS*sizeof(GLYPH_ENTRY);
+	int				g, i, size;
+
+	pHeader->firstChar	= TEST_FONT_FIRST;
+	pHeader->lastChar	= TEST_FONT_FIRST + TEST_FONT_GLYPHS - 1;
+	pHeader->height		= TEST_FONT_HEIGHT;
+	for(g = 0; g < TEST_FONT_GLYPHS; g++, pGlyph++)
+	{
+		pGlyph->width		= (BYTE)Random(TEST_FONT_WIDEST + 1);
+		pGlyph->offsetLSB	= offset;
+		pGlyph->offsetMSB	= 0;
+		size = ((pGlyph->width + 7) >> 3)*TEST_FONT_HEIGHT;
+		for(i = 0; i < size; i++)
+			testFontImage.bytes[offset + i] = (char)Random(256);
+		offset += size;
+	}
+}
+
+/****************************************************************************
+  Function:
+    static void Background(void)
+  Description:
+	Draws and flushes the picture every rectangle is drawn over.
+  Precondition:
+    None.
+  Parameters:
+    None.
+  Returns:
+    None
+  Remarks:
+    Diagonal stripes, so a fill that leaves rows or columns alone in a
+    page leaves a pattern to compare with.
+  ***************************************************************************/
+static void Background(void)
+{
+	SHORT	x, y;
+
+	SetClip(CLIP_DISABLE);
+	SetColor(BLACK);
+	ClearDevice();
+	SetColor(WHITE);
+	for(y = 0; y < HEIGHT; y++)
+		for(x = 0; x < WIDTH; x++)
+			if((x + 3*y) % 5 == 0)
+				PutPixel(x, y);
+	FlushDisplay();
+}
+
+/****************************************************************************
+  Function:
+    static void Draw(int driver, int clear, const RECT * r, int clip, WORD color)
+  Description:
+	Draws one rectangle over Background() and flushes it.
+  Precondition:
+    None.
+  Parameters:
+    int driver - nonzero for the driver fill, else the PutPixel() loop.
+    int clear - nonzero for ClearRegion(), else Bar().
+    const RECT * r - rectangle.
+    int clip - index into clips, 0 for clipping off.
+    WORD color - BLACK or WHITE.
+  Returns:
+    None
+  Remarks:
+    ClearRegion() ignores the clipping region, so its PutPixel() loop
+    runs with clipping off.
+  ***************************************************************************/
+static void Draw(int driver, int clear, const RECT * r, int clip, WORD color)
+{
+	SHORT	x, y;
+
+	Background();
+	SetClipRgn(clips[clip].left, clips[clip].top, clips[clip].right, clips[clip].bottom);
+	SetClip(clip ? CLIP_ENABLE : CLIP_DISABLE);
+	SetColor(color);
+	if(driver)
+	{
+		if(clear)
+			ClearRegion(r->left, r->top, r->right, r->bottom);
+		else
+			Bar(r->left, r->top, r->right, r->bottom);
+	}
+	else
+	{
+		if(clear)
+			SetClip(CLIP_DISABLE);
+		for(y = r->top; y < r->bottom + 1; y++)
+			for(x = r->left; x < r->right + 1; x++)
+				PutPixel(x, y);
+	}
+	FlushDisplay();
+	SetClip(CLIP_DISABLE);
+}
+
+/****************************************************************************
+  Function:
+    static void Compare(int clear, const RECT * r, int clip, WORD color, SHORT scroll)
+  Description:
+	Draws a rectangle both ways and compares the glass.
+  Precondition:
+    None.
+  Parameters:
+    int clear - nonzero for ClearRegion(), else Bar().
+    const RECT * r - rectangle.
+    int clip - index into clips.
+    WORD color - BLACK or WHITE.
+    SHORT scroll - display start line, for the message.
+  Returns:
+    None
+  Remarks:
+    One check per rectangle, reporting the first pixel that differs.
+  ***************************************************************************/
+static void Compare(int clear, const RECT * r, int clip, WORD color, SHORT scroll)
+{
+	int		x, y, bad = -1;
+
+	Draw(0, clear, r, clip, color);
+	for(y = 0; y < HEIGHT; y++)
+		for(x = 0; x < WIDTH; x++)
+			golden[y][x] = (BYTE)hostDisplayPixel(x, y);
+
+	Draw(1, clear, r, clip, color);
+	for(y = 0; y < HEIGHT && bad < 0; y++)
+		for(x = 0; x < WIDTH && bad < 0; x++)
+			if(hostDisplayPixel(x, y) != golden[y][x])
+				bad = y*WIDTH + x;
+
+	HOST_CHECK(bad < 0, "%s(%d, %d, %d, %d) color %d clip %d scroll %d: pixel %d,%d is %d, PutPixel() gives %d",
+		clear ? "ClearRegion" : "Bar", r->left, r->top, r->right, r->bottom, color ? 1 : 0, clip, scroll,
+		bad % WIDTH, bad / WIDTH, golden[bad / WIDTH][bad % WIDTH] ^ 1, golden[bad / WIDTH][bad % WIDTH]);
+}
+
+/****************************************************************************
+  Function:
+    static void DrawChar(int driver, XCHAR ch, SHORT x, SHORT y, const RECT * pClip, WORD color)
+  Description:
+	Draws one character over Background() and flushes it.
+  Precondition:
+    The font is set.
+  Parameters:
+    int driver - nonzero for the driver OutChar(), else modelOutChar().
+    XCHAR ch - character.
+    SHORT x, y - top left of the glyph.
+    const RECT * pClip - clipping region, NULL for clipping off.
+    WORD color - BLACK or WHITE.
+  Returns:
+    None
+  Remarks:
+    None.
+  ***************************************************************************/
+static void DrawChar(int driver, XCHAR ch, SHORT x, SHORT y, const RECT * pClip, WORD color)
+{
+	Background();
+	if(pClip != NULL)
+	{
+		SetClipRgn(pClip->left, pClip->top, pClip->right, pClip->bottom);
+	}
+	SetClip(pClip != NULL ? CLIP_ENABLE : CLIP_DISABLE);
+	SetColor(color);
+	MoveTo(x, y);
+	if(driver)
+		OutChar(ch);
+	else
+		modelOutChar(ch);
+	FlushDisplay();
+	SetClip(CLIP_DISABLE);
+}
+
+/****************************************************************************
+  Function:
+    static void CompareChar(XCHAR ch, SHORT x, SHORT y, const RECT * pClip, WORD color, SHORT scroll)
+  Description:
+	Draws a character with both OutChar()s and compares the glass and
+	the cursor.
+  Precondition:
+    The font is set.
+  Parameters:
+    XCHAR ch - character.
+    SHORT x, y - top left of the glyph.
+    const RECT * pClip - clipping region, NULL for clipping off.
+    WORD color - BLACK or WHITE.
+    SHORT scroll - display start line, for the message.
+  Returns:
+    None
+  Remarks:
+    One check per character, reporting the first pixel that differs.
+  ***************************************************************************/
+static void CompareChar(XCHAR ch, SHORT x, SHORT y, const RECT * pClip, WORD color, SHORT scroll)
+{
+	SHORT	cursor;
+	int		px, py, bad = -1;
+
+	DrawChar(0, ch, x, y, pClip, color);
+	cursor = GetX();
+	for(py = 0; py < HEIGHT; py++)
+		for(px = 0; px < WIDTH; px++)
+			golden[py][px] = (BYTE)hostDisplayPixel(px, py);
+
+	DrawChar(1, ch, x, y, pClip, color);
+	for(py = 0; py < HEIGHT && bad < 0; py++)
+		for(px = 0; px < WIDTH && bad < 0; px++)
+			if(hostDisplayPixel(px, py) != golden[py][px])
+				bad = py*WIDTH + px;
+
+	HOST_CHECK(bad < 0 && GetX() == cursor,
+		"OutChar(%d) %s font at %d,%d color %d clip (%d, %d, %d, %d) scroll %d: pixel %d,%d is %d, "
+		"the model gives %d; cursor %d, the model %d", ch, _font == (void *)&testFont ? "test" : "default",
+		x, y, color ? 1 : 0, pClip ? pClip->left : 0, pClip ? pClip->top : 0, pClip ? pClip->right : 0,
+		pClip ? pClip->bottom : 0, scroll, bad < 0 ? -1 : bad % WIDTH, bad < 0 ? -1 : bad / WIDTH,
+		bad < 0 ? 0 : golden[bad / WIDTH][bad % WIDTH] ^ 1, bad < 0 ? 0 : golden[bad / WIDTH][bad % WIDTH],
+		GetX(), cursor);
+}
+
+/****************************************************************************
+  Function:
+    static void TestOutChar(void)
+  Description:
+	Draws random characters with both OutChar()s.
+  Precondition:
+    None.
+  Parameters:
+    None.
+  Returns:
+    None
+  Remarks:
+    Characters run one past either end of the font, glyphs start off
+    every edge of the screen, clipping regions cut them anywhere and
+    may lie off the screen, and the display is scrolled to a random
+    start line before each.
+  ***************************************************************************/
+static void TestOutChar(void)
+{
+	RECT		clip;
+	XCHAR		ch;
+	SHORT		x, y, scrolled = 0, scroll;
+	WORD		color;
+	int			n, clipped;
+
+	for(n = 0; n < CHARS; n++)
+	{
+		SetFont((n & 1) ? (void *)&testFont : (void *)&GOLFontDefault);
+		ch		= (XCHAR)(_fontFirstChar - 1 + Random(_fontLastChar - _fontFirstChar + 3));
+		x		= (SHORT)Random(WIDTH + 2*TEST_FONT_WIDEST) - TEST_FONT_WIDEST;
+		y		= (SHORT)Random(HEIGHT + 2*TEST_FONT_HEIGHT) - TEST_FONT_HEIGHT;
+		color	= Random(2) ? WHITE : BLACK;
+		clipped	= Random(3) != 0;
+		clip.left	= (SHORT)Random(WIDTH + 20) - 10;
+		clip.top	= (SHORT)Random(HEIGHT + 20) - 10;
+		clip.right	= clip.left + (SHORT)Random(WIDTH);
+		clip.bottom	= clip.top + (SHORT)Random(HEIGHT);
+		scroll	= (SHORT)Random(HEIGHT);
+		ScrollDisplay(scroll - scrolled);
+		scrolled = scroll;
+
+		CompareChar(ch, x, y, clipped ? &clip : NULL, color, scroll);
+	}
+	ScrollDisplay(-scrolled);
+}
+
+/****************************************************************************
+  Function:
+    static void TestPixels(void)
+  Description:
+	Puts pixels at every start line and reads them back from the glass
+	and through GetPixel().
+  Precondition:
+    The display is not scrolled.
+  Parameters:
+    None.
+  Returns:
+    None
+  Remarks:
+    Each row gets its own pattern, so a row that lands on another
+    shows. Two checks per start line, one for the glass and one for
+    GetPixel(), reporting the first pixel that differs.
+  ***************************************************************************/
+static void TestPixels(void)
+{
+	SHORT	scroll, x, y;
+	int		glassBad, readBad, set;
+
+	for(scroll = 0; scroll < HEIGHT; scroll++)
+	{
+		SetClip(CLIP_DISABLE);
+		SetColor(BLACK);
+		ClearDevice();
+		SetColor(WHITE);
+		for(y = 0; y < HEIGHT; y++)
+			for(x = 0; x < WIDTH; x++)
+				if((x + 5*y + scroll) % 11 == 0 || x == y)
+					PutPixel(x, y);
+		FlushDisplay();
+
+		glassBad = readBad = -1;
+		for(y = 0; y < HEIGHT; y++)
+			for(x = 0; x < WIDTH; x++)
+			{
+				set = ((x + 5*y + scroll) % 11 == 0 || x == y);
+				if(glassBad < 0 && hostDisplayPixel(x, y) != set)
+					glassBad = y*WIDTH + x;
+				if(readBad < 0 && (GetPixel(x, y) != 0) != set)
+					readBad = y*WIDTH + x;
+			}
+		HOST_CHECK(glassBad < 0, "PutPixel() scroll %d: pixel %d,%d is %d on the glass", scroll,
+			glassBad % WIDTH, glassBad / WIDTH, hostDisplayPixel(glassBad % WIDTH, glassBad / WIDTH));
+		HOST_CHECK(readBad < 0, "GetPixel() scroll %d: pixel %d,%d reads %d", scroll,
+			readBad % WIDTH, readBad / WIDTH, GetPixel(readBad % WIDTH, readBad / WIDTH) != 0);
+
+		// One line on, from 63 back round to 0 last
+		ScrollDisplay(1);
+	}
+}
+
+/****************************************************************************
+  Function:
+    static void TestScrollMoves(void)
+  Description:
+	Scrolls a random picture by random amounts and checks where it goes.
+  Precondition:
+    The display is not scrolled.
+  Parameters:
+    None.
+  Returns:
+    None
+  Remarks:
+    Amounts run past a screen height either way, as ScrollDisplay()
+    takes them modulo the height. The rows scrolled in have to come out
+    in the current color. One check per scroll.
+  ***************************************************************************/
+static void TestScrollMoves(void)
+{
+	SHORT	x, y, lines, moved, scrolled = 0, from;
+	WORD	color;
+	int		step, bad, expect;
+
+	SetClip(CLIP_DISABLE);
+	for(y = 0; y < HEIGHT; y++)
+		for(x = 0; x < WIDTH; x++)
+		{
+			golden[y][x] = (BYTE)Random(2);
+			SetColor(golden[y][x] ? WHITE : BLACK);
+			PutPixel(x, y);
+		}
+	FlushDisplay();
+
+	for(step = 0; step < SCROLLS; step++)
+	{
+		lines	= (SHORT)Random(4*HEIGHT + 1) - 2*HEIGHT;
+		moved	= lines % HEIGHT;
+		color	= Random(2) ? WHITE : BLACK;
+		SetColor(color);
+		ScrollDisplay(lines);
+		FlushDisplay();
+		scrolled = (scrolled + moved + HEIGHT) % HEIGHT;
+
+		bad = -1;
+		for(y = 0; y < HEIGHT && bad < 0; y++)
+		{
+			from = y + moved;
+			for(x = 0; x < WIDTH && bad < 0; x++)
+			{
+				expect = (from >= 0 && from < HEIGHT) ? golden[from][x] : (color != BLACK);
+				if(hostDisplayPixel(x, y) != expect || (GetPixel(x, y) != 0) != expect)
+					bad = y*WIDTH + x;
+			}
+		}
+		HOST_CHECK(bad < 0, "ScrollDisplay(%d) to start line %d, color %d: pixel %d,%d is %d, should be %d", lines,
+			scrolled, color ? 1 : 0, bad % WIDTH, bad / WIDTH, hostDisplayPixel(bad % WIDTH, bad / WIDTH),
+			hostDisplayPixel(bad % WIDTH, bad / WIDTH) ^ 1);
+
+		for(y = 0; y < HEIGHT; y++)
+			for(x = 0; x < WIDTH; x++)
+				golden[y][x] = (BYTE)hostDisplayPixel(x, y);
+	}
+	ScrollDisplay(-scrolled);
+}
+
+/****************************************************************************
+  Function:
+    static void TestWrap(void)
+  Description:
+	Draws across the screen row that display RAM row 63 wraps round to
+	0 in, at every start line.
+  Precondition:
+    The display is not scrolled.
+  Parameters:
+    None.
+  Returns:
+    None
+  Remarks:
+    At start line s screen row HEIGHT - s is RAM row 0, so a rectangle
+    or glyph over it is filled in two parts. Bar() and ClearRegion()
+    are set against the PutPixel() loop and OutChar() against the
+    model, for tops and bottoms either side of that row, whole and
+    clipped.
+  ***************************************************************************/
+static void TestWrap(void)
+{
+	static const RECT	clip = { 10, 20, 90, 50 };
+	RECT				r;
+	SHORT				scroll, wrap, above, below;
+	int					clear, clipped;
+
+	SetFont(&testFont);
+	for(scroll = 1; scroll < HEIGHT; scroll++)
+	{
+		ScrollDisplay(1);
+		wrap = HEIGHT - scroll;
+		for(above = 0; above <= 9; above += 3)
+			for(below = 0; below <= 9; below += 3)
+			{
+				r.left		= 3*above;
+				r.right		= WIDTH - 1 - 3*below;
+				r.top		= wrap - 1 - above;
+				r.bottom	= wrap + below;
+				for(clear = 0; clear < 2; clear++)
+					for(clipped = 0; clipped < 2 - clear; clipped++)
+						Compare(clear, &r, clipped ? 1 : 0, (above + below) & 1 ? WHITE : BLACK, scroll);
+			}
+		for(above = 0; above <= TEST_FONT_HEIGHT; above += 4)
+			CompareChar((XCHAR)(TEST_FONT_FIRST + Random(TEST_FONT_GLYPHS)), (SHORT)Random(WIDTH), wrap - above,
+				(above & 4) ? &clip : NULL, (above & 8) ? BLACK : WHITE, scroll);
+	}
+	ScrollDisplay(1);
+}
+
+int main(void)
+{
+	RECT	r;
+	SHORT	scrolled = 0;
+	int		s, span, top, bottom, clip, color, clear;
+
+	ResetDevice();
+	for(s = 0; s < COUNT(scrolls); s++)
+	{
+		// The driver fills the rows scrolled in, Background() redraws them
+		ScrollDisplay(scrolls[s] - scrolled);
+		scrolled = scrolls[s];
+
+		for(span = 0; span < COUNT(spans); span++)
+		for(top = 0; top < COUNT(rows); top++)
+		for(bottom = 0; bottom < COUNT(rows); bottom++)
+		{
+			r.left		= spans[span][0];
+			r.right		= spans[span][1];
+			r.top		= rows[top];
+			r.bottom	= rows[bottom];
+			for(clip = 0; clip < COUNT(clips); clip++)
+			for(color = 0; color < 2; color++)
+			for(clear = 0; clear < 2; clear++)
+			{
+				// ClearRegion() has no clipping, one region is enough
+				if(clear && clip)
+					continue;
+				Compare(clear, &r, clip, color ? WHITE : BLACK, scrolled);
+			}
+		}
+	}
+	ScrollDisplay(-scrolled);
+	MakeTestFont();
+	TestOutChar();
+	TestPixels();
+	TestScrollMoves();
+	TestWrap();
+	return hostTestEnd("SH1101ATest");
+}
@@ -0,0 +1,178 @@
+/**********************************************************************
+* FileName:        		SpeakerBench.c
+* Dependencies:    		Header (.h) files if applicable, see below
+* Processor:       		Any host with gcc
+* Compiler:        		gcc
+*
+* Drives Speaker.c through every power state on the simulated timers
+* and DMA: idle, a clip, a held tone, and three tones over a clip. The
+* audio interrupts are counted in the state they ran in, which is what
+* the target does too, and their time is read from the host clock in
+* place of timebaseCycles(), so speakerStateCycles[] holds host
+* nanoseconds. Those are host figures only, the simulator runs code in
+* no virtual time. Speaker.c is included rather than linked so its
+* interrupts can be counted.
+************************************************************************/
+
+/************************************************************************
+ Header Includes
+ ************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "HostSim.h"
+
+#define timebaseCycles		SpeakerBenchNow			// Host nanoseconds instead of cycles
+#define _DMA0Interrupt		SpeakerDma0Isr			// Counted by the handlers below
+#define _T5Interrupt		SpeakerT5Isr
+#include "../../src/Speaker.c"
+#undef _DMA0Interrupt
+#undef _T5Interrupt
+#undef timebaseCycles
+
+/************************************************************************
+ Constants
+ ************************************************************************/
+#define CYCLES_PER_MS				(GetInstructionClock()/1000)
+#define IDLE_MS						1000
+#define TONE_MS						2000
+
+/************************************************************************
+ Variables
+ ************************************************************************/
+static const char * const	stateNames[SPEAKER_STATES] = { "idle", "warming", "playing", "draining" };
+static unsigned long		stateMs[SPEAKER_STATES];		// Virtual ms spent in each state
+static unsigned long		dmaEntries[SPEAKER_STATES];
+static unsigned long		t5Entries[SPEAKER_STATES];
+
+/****************************************************************************
+  Function:
+    DWORD SpeakerBenchNow(void)
+  Description:
+	Stands in for timebaseCycles() in Speaker.c.
+  Precondition:
+    None.
+  Parameters:
+    None.
+  Returns:
+    Host monotonic clock in nanoseconds.
+  Remarks:
+    None.
+  ***************************************************************************/
+DWORD SpeakerBenchNow(void)
+{
+	struct timespec	now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (DWORD)now.tv_sec*1000000000UL + now.tv_nsec;
+}
+
+/****************************************************************************
+  Function:
+    void _DMA0Interrupt(void)
+  Description:
+	Counts the DMA feed interrupt in the state it runs in.
+  Precondition:
+    None.
+  Parameters:
+    None.
+  Returns:
+    None
+  Remarks:
+    None.
+  ***************************************************************************/
+void _DMA0Interrupt(void)
+{
+	dmaEntries[speakerState]++;
+	SpeakerDma0Isr();
+}
+
+/****************************************************************************
+  Function:
+    void _T5Interrupt(void)
+  Description:
+	Counts the frame fill interrupt in the state it runs in.
+  Precondition:
+    None.
+  Parameters:
+    None.
+  Returns:
+    None
+  Remarks:
+    None.
+  ***************************************************************************/
+void _T5Interrupt(void)
+{
+	t5Entries[speakerState]++;
+	SpeakerT5Isr();
+}
+
+/****************************************************************************
+  Function:
+    static void Run(unsigned long ms, int untilIdle)
+  Description:
+	Moves virtual time on a millisecond at a time, counting the state
+	the speaker is in at each.
+  Precondition:
+    None.
+  Parameters:
+    unsigned long ms - milliseconds to run.
+    int untilIdle - nonzero to carry on until the output is parked.
+  Returns:
+    None
+  Remarks:
+    None.
+  ***************************************************************************/
+static void Run(unsigned long ms, int untilIdle)
+{
+	while(ms > 0 || (untilIdle && speakerState != SPEAKER_IDLE))
+	{
+		stateMs[speakerState]++;
+		hostAdvance(CYCLES_PER_MS);
+		if(ms > 0)
+			ms--;
+	}
+}
+
+int main(void)
+{
+	int		state, voice[3], v;
+	double	seconds;
+
+	// The simulator ends the run at HOST_RUN_MS, longer than this bench
+	setenv("HOST_RUN_MS", "1000000", 1);
+	timebaseInit();
+	schedulerInit();
+	speakerInit();
+
+	Run(IDLE_MS, 0);
+	speakerActivate(SPEECH_ADDR_START, SPEECH_SIZE_START);
+	Run(0, 1);
+
+	voice[0] = speakerToneStart(speakerToneStep(9, 4, 0));
+	Run(TONE_MS, 0);
+	speakerToneStop(voice[0]);
+	Run(0, 1);
+
+	for(v = 0; v < 3; v++)
+		voice[v] = speakerToneStart(speakerToneStep(4*v, 4, 0));
+	speakerActivate(SPEECH_ADDR_START, SPEECH_SIZE_START);
+	Run(TONE_MS, 0);
+	for(v = 0; v < 3; v++)
+		speakerToneStop(voice[v]);
+	Run(0, 1);
+
+	printf("Host figures, the simulator runs code in no virtual time\n");
+	printf("%-10s %8s %12s %12s %14s %12s\n", "state", "ms", "DMA0 /s", "T5 /s", "host ns/s", "ns/entry");
+	for(state = 0; state < SPEAKER_STATES; state++)
+	{
+		seconds = stateMs[state]/1000.0;
+		printf("%-10s %8lu %12.1f %12.1f %14.0f %12.0f\n", stateNames[state], stateMs[state],
+			seconds > 0 ? dmaEntries[state]/seconds : 0, seconds > 0 ? t5Entries[state]/seconds : 0,
+			seconds > 0 ? speakerStateCycles[state]/seconds : 0,
+			dmaEntries[state] + t5Entries[state] ? (double)speakerStateCycles[state]/(dmaEntries[state] + t5Entries[state]) : 0);
+	}
+	printf("underruns %u, fewest frames queued %u, Timer 2 interrupt %s\n", speakerUnderruns, speakerRingLevelMin,
+		IEC0bits.T2IE ? "enabled" : "off");
+	return 0;
+}
@@ -0,0 +1,333 @@
+/**********************************************************************
+* FileName:        		SpeakerTest.c
+* Dependencies:    		Header (.h) files if applicable, see below
+* Processor:       		Any host with gcc
+* Compiler:        		gcc
+*
+* Checks of the duty scaling, frame fill and tone pitch of Speaker.c.
+* speakerLinToDuty() has to give what DutyModel.h, its old long divide,
+* gives for every 16 bit sample. Speaker.c and tuner.c are included
+* rather than linked so their tables and static functions can be
+* reached.
+************************************************************************/
+
+/************************************************************************
+ Header Includes
+ ************************************************************************/
+#include <math.h>
+#include <string.h>
+#include "HostTest.h"
+#include "G711Model.h"
+#include "../../src/Speaker.c"
+#include "DutyModel.h"
+#include "../../tuner.c"
+
+/************************************************************************
+ Constants
+ ************************************************************************/
+#define MIX_FRAMES					100					// Frames of each voice set, the clip has 119
+#define MIX_TOLERANCE				1.0					// Duty counts the fill may be off the float mix
+#define TONE_CENTS					0.1					// Cents a tone step may be off equal temperament
+#define TONE_FRAMES					1000				// Frames each tuner note is played for
+
+/************************************************************************
+ Data Structures
+ ************************************************************************/
+// A voice set for TestMix(): tones with their phase step and start phase,
+// whether the last voice is the START clip instead, and whether the mix
+// has to go past the 16 bit range
+typedef struct
+{
+	unsigned int	voices;
+	unsigned long	step[SPEAKER_MAX_VOICES];
+	unsigned long	phase[SPEAKER_MAX_VOICES];
+	unsigned int	clip;
+	unsigned int	saturates;
+	const char *	name;
+} MIX_SET;
+
+/************************************************************************
+ Variables
+ ************************************************************************/
+static const MIX_SET	mixSets[] =
+{
+	{ 2, { 176967447UL, 265151578UL }, { 0, 0 }, 0, 0, "E4 B4" },
+	{ 2, { 140459156UL, 140459156UL }, { 0, 0 }, 0, 0, "C4 twice in phase" },
+	{ 2, { 140459156UL }, { 0 }, 1, 0, "C4 and clip" },
+	{ 3, { 140459156UL, 176967447UL, 210450947UL }, { 0, 0x40000000UL, 0x80000000UL }, 0, 0, "C4 E4 G4" },
+	{ 3, { 280918312UL, 280918312UL, 280918312UL }, { 0, 0, 0 }, 0, 1, "C5 three times in phase" },
+	{ 3, { 250269764UL, 148811292UL }, { 0x12345678UL, 0 }, 1, 0, "A#4 C#4 and clip" },
+	{ 4, { 140459156UL, 176967447UL, 210450947UL, 265151578UL }, { 0, 0, 0, 0 }, 0, 0, "C4 E4 G4 B4" },
+	{ 4, { 222965012UL, 222965012UL, 222965012UL, 222965012UL }, { 0, 0, 0, 0 }, 0, 1, "A4 four times in phase" },
+	{ 4, { 445930024UL, 445930024UL, 445930024UL }, { 0, 0, 0 }, 1, 1, "A5 three times and clip" },
+};
+
+/****************************************************************************
+  Function:
+    static void TestLinToDuty(void)
+  Description:
+	Checks speakerLinToDuty() against the long divide of DutyModel.h
+	for every 16 bit sample.
+  Precondition:
+    None.
+  Parameters:
+    None.
+  Returns:
+    None
+  Remarks:
+    None.
+  ***************************************************************************/
+static void TestLinToDuty(void)
+{
+	long	sample;
+
+	for(sample = LOWEST_INPUT_VALUE; sample <= HIGHEST_INPUT_VALUE; sample++)
+		HOST_CHECK(speakerLinToDuty((int)sample) == modelLinToDuty((int)sample),
+			"sample %ld has duty %u, the long divide gives %u", sample, speakerLinToDuty((int)sample),
+			modelLinToDuty((int)sample));
+}
+
+/****************************************************************************
+  Function:
+    static void TestDutyTable(void)
+  Description:
+	Checks every entry of speakerAlawDuty against speakerLinToDuty() of
+	the code decoded by the G711.s model and by the codec in use.
+  Precondition:
+    None.
+  Parameters:
+    None.
+  Returns:
+    None
+  Remarks:
+    The duty must also stay within 1 to MAX_PWM_PERIOD, never fall as
+    the linear value rises, and put the two codes either side of zero
+    next to PWM_MID_DUTY.
+  ***************************************************************************/
+static void TestDutyTable(void)
+{
+	unsigned int	code, other, duty;
+	char			codes[1];
+	int				sample[1];
+
+	speakerBuildDutyTable();
+	for(code = 0; code < 256; code++)
+	{
+		duty = speakerLinToDuty(modelAlaw2Lin((unsigned char)code));
+		HOST_CHECK(speakerAlawDuty[code] == duty, "A-law 0x%02X has duty %u, speakerLinToDuty() of G711.s gives %u",
+			code, speakerAlawDuty[code], duty);
+
+		codes[0] = (char)code;
+		G711Alaw2Lin(codes, sample, 1);
+		HOST_CHECK(speakerAlawDuty[code] == speakerLinToDuty(sample[0]), "A-law 0x%02X has duty %u, the codec gives %u",
+			code, speakerAlawDuty[code], speakerLinToDuty(sample[0]));
+
+		HOST_CHECK(duty >= 1 && duty <= MAX_PWM_PERIOD, "A-law 0x%02X duty %u outside 1 to %ld", code, duty, (long)MAX_PWM_PERIOD);
+		for(other = 0; other < 256; other++)
+			if(modelAlaw2Lin((unsigned char)other) < modelAlaw2Lin((unsigned char)code) && speakerAlawDuty[other] > duty)
+				HOST_CHECK(0, "A-law 0x%02X is below 0x%02X but has the larger duty", other, code);
+	}
+
+	HOST_CHECK(speakerAlawDuty[0x55] <= PWM_MID_DUTY && speakerAlawDuty[0xD5] >= PWM_MID_DUTY
+		&& speakerAlawDuty[0xD5] - speakerAlawDuty[0x55] <= 1,
+		"A-law -8 and +8 have duty %u and %u, not either side of %ld", speakerAlawDuty[0x55], speakerAlawDuty[0xD5], (long)PWM_MID_DUTY);
+}
+
+/****************************************************************************
+  Function:
+    static void TestMix(const MIX_SET * pSet)
+  Description:
+	Plays a set of 2 to 4 voices through speakerFillFrame() and checks
+	every duty value against a float mix of the same voices.
+  Precondition:
+    speakerBuildDutyTable() called.
+  Parameters:
+    const MIX_SET * pSet - voices to mix.
+  Returns:
+    None
+  Remarks:
+    The float mix takes each tone from sin() at the phase the test keeps
+    itself, and the clip from the G711.s model. Where it goes past the
+    16 bit range the fill has to give exactly the duty of the limit.
+  ***************************************************************************/
+static void TestMix(const MIX_SET * pSet)
+{
+	unsigned int	duty[FRAME_SIZE];
+	int				words[PGM_MEM_FRAME_SIZE];
+	char			codes[FRAME_SIZE];
+	unsigned long	phase[SPEAKER_MAX_VOICES];
+	unsigned int	tones = pSet->voices - pSet->clip;
+	unsigned int	frame, i, v, voices, bad = 0, saturated = 0;
+	double			mix, expected, worst = 0;
+
+	memset(speakerVoices, 0, sizeof(speakerVoices));
+	speakerFrameHook	= NULL;
+	speakerSampleClock	= 0;
+	for(v = 0; v < tones; v++)
+	{
+		speakerVoices[v].type		= SPEAKER_VOICE_TONE;
+		speakerVoices[v].phase		= phase[v] = pSet->phase[v];
+		speakerVoices[v].phaseStep	= pSet->step[v];
+		speakerVoices[v].active		= 1;
+	}
+	if(pSet->clip)
+	{
+		speakerSetClip(&speakerVoices[tones], SPEECH_ADDR_START, SPEECH_SIZE_START, SPEECH_CODEC_START);
+		speakerVoices[tones].active = 1;
+	}
+
+	for(frame = 0; frame < MIX_FRAMES; frame++)
+	{
+		voices = speakerFillFrame(duty);
+		HOST_CHECK(voices == pSet->voices, "%s frame %u: %u voices mixed", pSet->name, frame, voices);
+
+		if(pSet->clip)
+		{
+			ReadProgramMemory(SPEECH_ADDR_START + (long)frame*PGM_MEM_FRAME_SIZE, words, PGM_MEM_FRAME_SIZE);
+			PackForG711(words, codes, PGM_MEM_FRAME_SIZE);
+		}
+		for(i = 0; i < FRAME_SIZE; i++)
+		{
+			mix = 0;
+			for(v = 0; v < tones; v++)
+			{
+				mix += SPEAKER_TONE_LEVEL*sin(2*M_PI*((phase[v] >> 24) & 0xFF)/SPEAKER_TONE_TABLE_SIZE);
+				phase[v] = (phase[v] + pSet->step[v]) & 0xFFFFFFFFUL;
+			}
+			if(pSet->clip)
+				mix += modelAlaw2Lin((unsigned char)codes[i]);
+
+			if(mix > HIGHEST_INPUT_VALUE || mix < LOWEST_INPUT_VALUE)
+			{
+				saturated++;
+				expected = speakerLinToDuty(mix > 0 ? HIGHEST_INPUT_VALUE : LOWEST_INPUT_VALUE);
+				if(duty[i] != expected && !bad++)
+					HOST_CHECK(0, "%s frame %u sample %u: mix %.0f has duty %u, the limit %.0f",
+						pSet->name, frame, i, mix, duty[i], expected);
+				continue;
+			}
+
+			expected = (mix - LOWEST_INPUT_VALUE)*(MAX_PWM_PERIOD)/INPUT_RANGE;
+			if(fabs(duty[i] - expected) > worst)
+				worst = fabs(duty[i] - expected);
+			if(fabs(duty[i] - expected) > MIX_TOLERANCE && !bad++)
+				HOST_CHECK(0, "%s frame %u sample %u: mix %.1f has duty %u, float gives %.2f",
+					pSet->name, frame, i, mix, duty[i], expected);
+		}
+	}
+	HOST_CHECK(!bad, "%s: %u of %u duty values wrong, worst %.2f counts off", pSet->name, bad, MIX_FRAMES*FRAME_SIZE, worst);
+	HOST_CHECK(saturated > 0 || !pSet->saturates, "%s never went past the 16 bit range", pSet->name);
+	memset(speakerVoices, 0, sizeof(speakerVoices));
+}
+
+/****************************************************************************
+  Function:
+    static double ToneCents(int semitone, int octave, int cents, unsigned long step)
+  Description:
+	Checks a phase step against the equal tempered pitch it was asked for.
+  Precondition:
+    None.
+  Parameters:
+    int semitone, int octave, int cents - pitch as for speakerToneStep().
+    unsigned long step - phase step speakerToneStep() gave for it.
+  Returns:
+    Cents the step is off the pitch, 0 where the step has to be 0.
+  Remarks:
+    The step plays step*FS/2^32 Hz. A pitch at or above FS/2 or below
+    1 Hz has to give 0, one within 0.01 cent of either limit may go
+    either way.
+  ***************************************************************************/
+static double ToneCents(int semitone, int octave, int cents, unsigned long step)
+{
+	double	pitch, error;
+
+	pitch = 440.0*pow(2.0, (12*(octave + 1) + semitone - 69)/12.0 + cents/1200.0);
+	if(fabs(1200*log2(pitch/(FS/2))) < 0.01 || fabs(1200*log2(pitch)) < 0.01)
+		return 0;
+	if(pitch >= FS/2 || pitch < 1)
+	{
+		HOST_CHECK(step == 0, "semitone %d octave %d cents %d is %.3f Hz, step %lu not 0", semitone, octave, cents, pitch, step);
+		return 0;
+	}
+	HOST_CHECK(step != 0, "semitone %d octave %d cents %d is %.3f Hz, step 0", semitone, octave, cents, pitch);
+	if(step == 0)
+		return 0;
+
+	error = 1200*log2(step*(double)FS/4294967296.0/pitch);
+	HOST_CHECK(fabs(error) <= TONE_CENTS, "semitone %d octave %d cents %d is %.3f Hz, step %lu is %.3f cents off",
+		semitone, octave, cents, pitch, step, error);
+	return fabs(error);
+}
+
+/****************************************************************************
+  Function:
+    static void TestToneStep(void)
+  Description:
+	Checks the pitch of every tuner note, and of every semitone in every
+	octave with cents offsets either way, against equal temperament.
+	Each tuner note is then played through speakerFillFrame() and has to
+	have stepped its phase by exactly its step every sample.
+  Precondition:
+    None.
+  Parameters:
+    None.
+  Returns:
+    None
+  Remarks:
+    The phase is only compared in its low 32 bits, long is wider on the
+    host.
+  ***************************************************************************/
+static void TestToneStep(void)
+{
+	unsigned int	duty[FRAME_SIZE];
+	unsigned long	step, phase;
+	unsigned int	frame, note;
+	int				semitone, octave, cents;
+	double			worst = 0, error;
+
+	for(octave = -5; octave <= 11; octave++)
+		for(semitone = 0; semitone < 12; semitone++)
+			for(cents = -250; cents <= 250; cents += 10)
+			{
+				error = ToneCents(semitone, octave, cents, speakerToneStep(semitone, octave, cents));
+				if(error > worst)
+					worst = error;
+			}
+	// The same pitch named from a neighbouring semitone or octave
+	HOST_CHECK(speakerToneStep(-1, 5, 0) == speakerToneStep(11, 4, 0) && speakerToneStep(12, 3, 0) == speakerToneStep(0, 4, 0)
+		&& speakerToneStep(9, 4, 1200) == speakerToneStep(9, 5, 0) && speakerToneStep(10, 4, -100) == speakerToneStep(9, 4, 0),
+		"wrapped semitones, octaves or cents give another step");
+
+	for(note = 1; note < sizeof(tuneSemitone)/sizeof(tuneSemitone[0]); note++)
+	{
+		step = speakerToneStep(tuneSemitone[note], 4, 0);
+		ToneCents(tuneSemitone[note], 4, 0, step);
+
+		memset(speakerVoices, 0, sizeof(speakerVoices));
+		speakerFrameHook	= NULL;
+		phase				= 0x9ABCDEF0UL;
+		speakerVoices[0].type		= SPEAKER_VOICE_TONE;
+		speakerVoices[0].phase		= phase;
+		speakerVoices[0].phaseStep	= step;
+		speakerVoices[0].active		= 1;
+		for(frame = 0; frame < TONE_FRAMES; frame++)
+			speakerFillFrame(duty);
+		phase += (unsigned long)TONE_FRAMES*FRAME_SIZE*step;
+		HOST_CHECK(((speakerVoices[0].phase ^ phase) & 0xFFFFFFFFUL) == 0, "tuner note %u step %lu: phase 0x%08lX after %d frames, not 0x%08lX",
+			note, step, speakerVoices[0].phase & 0xFFFFFFFFUL, TONE_FRAMES, phase & 0xFFFFFFFFUL);
+	}
+	memset(speakerVoices, 0, sizeof(speakerVoices));
+	HOST_CHECK(worst <= TONE_CENTS, "tone steps up to %.4f cents off", worst);
+}
+
+int main(void)
+{
+	unsigned int	set;
+
+	TestLinToDuty();
+	TestDutyTable();
+	for(set = 0; set < sizeof(mixSets)/sizeof(mixSets[0]); set++)
+		TestMix(&mixSets[set]);
+	TestToneStep();
+	return hostTestEnd("SpeakerTest");
+}
@@ -0,0 +1,288 @@
+/**********************************************************************
+* FileName:        		TextSurfaceTest.c
+* Dependencies:    		Header (.h) files if applicable, see below
+* Processor:       		Any host with gcc
+* Compiler:        		gcc
+*
+* Golden image test of the retained text surface of TextSurface.c. A
+* framed centred surface over the whole screen, as Display_Printf()
+* uses, a right aligned one and a framed left aligned one are given a
+* run of texts, each an edit of the one before: characters changed,
+* put in or taken out, so centred and right aligned lines move, lines
+* added and removed, a line longer than the surface, more lines than
+* fit, and texts longer than TEXT_SURFACE_SIZE - 1. The flushed glass
+* of HostDisplay.c after each textSurfaceSetText() has to match the one
+* left by drawing the text, cut to TEXT_SURFACE_SIZE - 1, whole on a
+* new surface over the same background. The screen outside the surface
+* is a checker pattern, so drawing outside it shows. The display
+* accesses of each update are counted against those of the whole draw.
+************************************************************************/
+
+/************************************************************************
+ Header Includes
+ ************************************************************************/
+#include <string.h>
+#include "HostTest.h"
+#include "HostSim.h"
+#include "TextSurface.h"
+
+/************************************************************************
+ Constants
+ ************************************************************************/
+#define WIDTH						HOST_DISPLAY_WIDTH
+#define HEIGHT						HOST_DISPLAY_HEIGHT
+#define UPDATES						2000
+#define LONGEST						(TEXT_SURFACE_SIZE + 16)	// Texts run past what is kept
+#define COUNT(a)					((int)(sizeof(a)/sizeof((a)[0])))
+
+/************************************************************************
+ Data Structures
+ ************************************************************************/
+typedef struct
+{
+	SHORT			left, top, right, bottom;
+	WORD			state;
+	const char *	name;
+} AREA;
+
+/************************************************************************
+ Variables
+ ************************************************************************/
+static const AREA		areas[] =
+{
+	{ 0, 0, GetMaxX(), GetMaxY(), ST_FRAME|ST_CENTER_ALIGN, "centred" },
+	{ 10, 8, 100, 40, ST_RIGHT_ALIGN, "right aligned" },
+	{ 4, 20, GetMaxX() - 4, GetMaxY(), ST_FRAME, "left aligned" }
+};
+static const char		letters[] = "il1.:WM0 -Aa8#";		// Narrow and wide glyphs
+static unsigned long	seed = 1;
+static XCHAR			text[LONGEST + 1];
+static BYTE				glass[HEIGHT][WIDTH];
+static unsigned long	updateAccesses, wholeAccesses;
+
+/****************************************************************************
+  Function:
+    static unsigned int Random(unsigned int range)
+  Description:
+	Pseudo random number, the same sequence every run.
+  Precondition:
+    None.
+  Parameters:
+    unsigned int range - number of values.
+  Returns:
+    0 to range-1.
+  Remarks:
+    None.
+  ***************************************************************************/
+static unsigned int Random(unsigned int range)
+{
+	seed = seed*1103515245UL + 12345UL;
+	return (unsigned int)((seed >> 16) & 0x7FFF) % range;
+}
+
+/****************************************************************************
+  Function:
+    static void Background(void)
+  Description:
+	Covers the screen in a checker pattern and flushes it.
+  Precondition:
+    None.
+  Parameters:
+    None.
+  Returns:
+    None
+  Remarks:
+    None.
+  ***************************************************************************/
+static void Background(void)
+{
+	int		x, y;
+
+	SetClip(CLIP_DISABLE);
+	for(y = 0; y < HEIGHT; y++)
+		for(x = 0; x < WIDTH; x++)
+		{
+			SetColor(((x ^ y) & 1) ? WHITE : BLACK);
+			PutPixel(x, y);
+		}
+	FlushDisplay();
+}
+
+/****************************************************************************
+  Function:
+    static void Edit(void)
+  Description:
+	Makes the next text out of the one before.
+  Precondition:
+    None.
+  Parameters:
+    None.
+  Returns:
+    None
+  Remarks:
+    Most edits change, put in or take out one character, so most lines
+    stay and the ones that change move when they are aligned. The
+    others add or remove a line or start again with a random text of up
+    to LONGEST characters.
+  ***************************************************************************/
+static void Edit(void)
+{
+	int		length = (int)strlen((char *)text), at, i;
+	char *	newline;
+
+	switch(Random(8))
+	{
+		case 0:
+		case 1:
+			if(length > 0)
+			{
+				at = Random(length);
+				if(text[at] != '\n')
+					text[at] = letters[Random(sizeof(letters) - 1)];
+			}
+			break;
+		case 2:
+		case 3:
+			if(length < LONGEST)
+			{
+				at = Random(length + 1);
+				memmove(&text[at + 1], &text[at], length - at + 1);
+				text[at] = letters[Random(sizeof(letters) - 1)];
+			}
+			break;
+		case 4:
+			if(length > 0)
+			{
+				at = Random(length);
+				memmove(&text[at], &text[at + 1], length - at);
+			}
+			break;
+		case 5:
+			if(length < LONGEST - 4)
+			{
+				text[length] = '\n';
+				for(i = 1; i < 4; i++)
+					text[length + i] = letters[Random(sizeof(letters) - 1)];
+				text[length + 4] = 0;
+			}
+			break;
+		case 6:
+			newline = strrchr((char *)text, '\n');
+			if(newline != NULL)
+				*newline = 0;
+			break;
+		default:
+			length = Random(LONGEST + 1);
+			for(i = 0; i < length; i++)
+				text[i] = Random(6) ? letters[Random(sizeof(letters) - 1)] : '\n';
+			text[length] = 0;
+			break;
+	}
+}
+
+/****************************************************************************
+  Function:
+    static void Check(const AREA * pArea, int update)
+  Description:
+	Draws the text whole on a new surface and compares the glass with
+	the one the update left.
+  Precondition:
+    The update has been made and flushed.
+  Parameters:
+    const AREA * pArea - area of the surface.
+    int update - its number.
+  Returns:
+    None
+  Remarks:
+    The whole draw is given the text cut to TEXT_SURFACE_SIZE - 1 by
+    hand. It leaves the screen as the update should have, to go on
+    from. One check per call, reporting the first pixel that differs.
+  ***************************************************************************/
+static void Check(const AREA * pArea, int update)
+{
+	TEXT_SURFACE	whole;
+	XCHAR			cut[TEXT_SURFACE_SIZE];
+	unsigned long	accesses;
+	int				x, y, bad = -1;
+
+	for(y = 0; y < HEIGHT; y++)
+		for(x = 0; x < WIDTH; x++)
+			glass[y][x] = (BYTE)hostDisplayPixel(x, y);
+
+	strncpy((char *)cut, (char *)text, TEXT_SURFACE_SIZE - 1);
+	cut[TEXT_SURFACE_SIZE - 1] = 0;
+	Background();
+	textSurfaceInit(&whole, pArea->left, pArea->top, pArea->right, pArea->bottom, pArea->state, NULL);
+	accesses = hostDisplayAccesses();
+	textSurfaceSetText(&whole, cut);
+	wholeAccesses += hostDisplayAccesses() - accesses;
+
+	for(y = 0; y < HEIGHT && bad < 0; y++)
+		for(x = 0; x < WIDTH && bad < 0; x++)
+			if(hostDisplayPixel(x, y) != glass[y][x])
+				bad = y*WIDTH + x;
+
+	HOST_CHECK(bad < 0, "%s update %d: pixel %d,%d is %d, drawn whole it is %d", pArea->name, update,
+		bad % WIDTH, bad / WIDTH, glass[bad / WIDTH][bad % WIDTH], glass[bad / WIDTH][bad % WIDTH] ^ 1);
+}
+
+/****************************************************************************
+  Function:
+    static void TestArea(const AREA * pArea)
+  Description:
+	Runs the texts on one surface.
+  Precondition:
+    GOLInit() has been called.
+  Parameters:
+    const AREA * pArea - area of the surface.
+  Returns:
+    None
+  Remarks:
+    The surface keeps only the first TEXT_SURFACE_SIZE - 1 characters,
+    checked as well. Setting the same text again must not touch the
+    display.
+  ***************************************************************************/
+static void TestArea(const AREA * pArea)
+{
+	TEXT_SURFACE	surface;
+	unsigned long	accesses;
+	int				update;
+
+	Background();
+	textSurfaceInit(&surface, pArea->left, pArea->top, pArea->right, pArea->bottom, pArea->state, NULL);
+	text[0] = 0;
+	for(update = 0; update < UPDATES; update++)
+	{
+		Edit();
+		accesses = hostDisplayAccesses();
+		textSurfaceSetText(&surface, text);
+		if(update > 0)
+			updateAccesses += hostDisplayAccesses() - accesses;
+		HOST_CHECK(strncmp((char *)surface.text, (char *)text, TEXT_SURFACE_SIZE - 1) == 0
+			&& surface.text[TEXT_SURFACE_SIZE - 1 < strlen((char *)text) ? TEXT_SURFACE_SIZE - 1 : strlen((char *)text)] == 0,
+			"%s update %d: the surface keeps another text", pArea->name, update);
+		Check(pArea, update);
+
+		if(update % 100 == 0)
+		{
+			accesses = hostDisplayAccesses();
+			textSurfaceSetText(&surface, text);
+			HOST_CHECK(hostDisplayAccesses() == accesses, "%s update %d: the same text again took %lu accesses",
+				pArea->name, update, hostDisplayAccesses() - accesses);
+		}
+	}
+}
+
+int main(void)
+{
+	int		a;
+
+	GOLInit();
+	for(a = 0; a < COUNT(areas); a++)
+		TestArea(&areas[a]);
+	HOST_CHECK(updateAccesses < wholeAccesses/2, "updates took %lu display accesses, whole draws %lu",
+		updateAccesses, wholeAccesses);
+	printf("display accesses per update %.0f, per whole draw %.0f\n",
+		updateAccesses/(double)(COUNT(areas)*(UPDATES - 1)), wholeAccesses/(double)(COUNT(areas)*UPDATES));
+	return hostTestEnd("TextSurfaceTest");
+}
@@ -0,0 +1,435 @@
+/**********************************************************************
+* FileName:        		Wav2G711Test.c
+* Dependencies:    		Header (.h) files if applicable, see below
+* Processor:       		Any host with gcc
+* Compiler:        		gcc
+*
+* Runs the clip compiler of tools/wav2g711 on WAV files written here:
+* an 8 kHz 16 bit mono A-law clip and IMA-ADPCM clip, each with silence
+* either side, and a 16 kHz 8 bit stereo A-law clip that has to be
+* resampled. The generated header has to give each clip a size that is
+* a multiple of the frame size, its address label and its codec. Each
+* .s file has to hold that many samples, and unpacked by PackForG711()
+* and decoded by the firmware codecs it has to give back the clip as
+* trimmed and normalised, and silence after it. The clips are built
+* again with -f 36. WAV2G711 names the tool, build/wav2g711 if unset,
+* which is where make test builds it.
+************************************************************************/
+
+/************************************************************************
+ Header Includes
+ ************************************************************************/
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "HostTest.h"
+#include "Speaker.h"
+
+/************************************************************************
+ Constants
+ ************************************************************************/
+#define MOST_SAMPLES				16000				// Longest WAV written, in frames
+#define MOST_WORDS					4000				// Longest .s file read
+#define SILENCE_DB					40.0				// Defaults of the tool
+#define PEAK_DB						1.0
+#define ALAW_SNR_DB					32.0				// Least signal to noise of each codec
+#define ADPCM_SNR_DB				18.0
+#define ALAW_SILENCE				8					// What A-law gives zero back as
+#define OTHER_FRAME_SIZE			36
+
+/************************************************************************
+ Data Structures
+ ************************************************************************/
+// A clip for the tool: its name, codec and WAV format, and the samples
+// of silence before it, of the signal and of silence after it
+typedef struct
+{
+	const char *	name;
+	const char *	upper;						// Name as the header spells it
+	int				adpcm;
+	long			rate;
+	int				channels;
+	int				bits;
+	long			lead;
+	long			length;
+	long			tail;
+} ASSET_CLIP;
+
+/************************************************************************
+ Variables
+ ************************************************************************/
+static const ASSET_CLIP	clips[] =
+{
+	{ "Beep", "BEEP", 0, 8000, 1, 16, 1234, 2001, 777 },
+	{ "Chirp", "CHIRP", 1, 8000, 1, 16, 500, 3000, 300 },
+	{ "Wide", "WIDE", 0, 16000, 2, 8, 1000, 4000, 1000 },
+};
+static char			dir[] = "/tmp/wav2g711XXXXXX";
+static double		wave[MOST_SAMPLES];					// Mono signal of the clip, +/-1
+static unsigned long	words[MOST_WORDS];
+static int			unpacked[2*MOST_WORDS];
+static char			bytes[3*MOST_WORDS];
+static int			decoded[2*3*MOST_WORDS];
+
+/****************************************************************************
+  Function:
+    static void MakeWave(const ASSET_CLIP * pClip)
+  Description:
+	Fills wave[] with the clip and its silence.
+  Precondition:
+    None.
+  Parameters:
+    const ASSET_CLIP * pClip - clip.
+  Returns:
+    None
+  Remarks:
+    A-law clips are two tones, ADPCM clips a sweep from 200 Hz to 2 kHz.
+    Every value is a whole 16 bit sample, so what the tool reads is
+    exactly wave[].
+  ***************************************************************************/
+static void MakeWave(const ASSET_CLIP * pClip)
+{
+	double	t, value;
+	long	n;
+
+	for(n = 0; n < pClip->lead + pClip->length + pClip->tail; n++)
+	{
+		t = (double)(n - pClip->lead)/pClip->rate;
+		if(n < pClip->lead || n >= pClip->lead + pClip->length)
+			value = 0;
+		else if(pClip->adpcm)
+			value = 15000*sin(2*M_PI*(200*t + 0.5*1800*t*t*pClip->rate/pClip->length));
+		else
+			value = 12000*sin(2*M_PI*440*t) + 6000*sin(2*M_PI*1250*t);
+		wave[n] = floor(value + 0.5)/32768;
+	}
+}
+
+/****************************************************************************
+  Function:
+    static void WriteLE(FILE * f, unsigned long value, int count)
+  Description:
+	Writes a little endian value.
+  Precondition:
+    None.
+  Parameters:
+    FILE * f - file.
+    unsigned long value - value.
+    int count - bytes.
+  Returns:
+    None
+  Remarks:
+    None.
+  ***************************************************************************/
+static void WriteLE(FILE * f, unsigned long value, int count)
+{
+	for(; count > 0; count--, value >>= 8)
+		fputc((int)(value & 0xFF), f);
+}
+
+/****************************************************************************
+  Function:
+    static void WriteWav(const ASSET_CLIP * pClip)
+  Description:
+	Writes wave[] as the clip's WAV file.
+  Precondition:
+    MakeWave() has been called for the clip.
+  Parameters:
+    const ASSET_CLIP * pClip - clip.
+  Returns:
+    None
+  Remarks:
+    A second channel gets the signal at half level, so the mix down is
+    three quarters of it. 8 bit samples are unsigned.
+  ***************************************************************************/
+static void WriteWav(const ASSET_CLIP * pClip)
+{
+	long			frames = pClip->lead + pClip->length + pClip->tail, n;
+	unsigned long	data = (unsigned long)frames*pClip->channels*(pClip->bits/8);
+	char			path[256];
+	FILE *			f;
+	int				c;
+	long			value;
+
+	snprintf(path, sizeof(path), "%s/%s.wav", dir, pClip->name);
+	f = fopen(path, "wb");
+	HOST_CHECK(f != NULL, "cannot write %s", path);
+	if(!f)
+		return;
+	fputs("RIFF", f);
+	WriteLE(f, 36 + data, 4);
+	fputs("WAVEfmt ", f);
+	WriteLE(f, 16, 4);
+	WriteLE(f, 1, 2);
+	WriteLE(f, (unsigned long)pClip->channels, 2);
+	WriteLE(f, (unsigned long)pClip->rate, 4);
+	WriteLE(f, (unsigned long)pClip->rate*pClip->channels*(pClip->bits/8), 4);
+	WriteLE(f, (unsigned long)(pClip->channels*(pClip->bits/8)), 2);
+	WriteLE(f, (unsigned long)pClip->bits, 2);
+	fputs("data", f);
+	WriteLE(f, data, 4);
+	for(n = 0; n < frames; n++)
+		for(c = 0; c < pClip->channels; c++)
+		{
+			if(pClip->bits == 8)
+			{
+				value = lrint(wave[n]*(c ? 64 : 128));
+				WriteLE(f, (unsigned long)(value + 128), 1);
+			}
+			else
+			{
+				value = lrint(wave[n]*(c ? 16384 : 32768));
+				WriteLE(f, (unsigned long)value & 0xFFFF, 2);
+			}
+		}
+	fclose(f);
+}
+
+/****************************************************************************
+  Function:
+    static int Run(const char * options, const char * header)
+  Description:
+	Runs the tool on every clip.
+  Precondition:
+    The WAV files are written.
+  Parameters:
+    const char * options - options before the clips.
+    const char * header - header file name in dir.
+  Returns:
+    The exit status of the tool.
+  Remarks:
+    None.
+  ***************************************************************************/
+static int Run(const char * options, const char * header)
+{
+	const char *	tool = getenv("WAV2G711");
+	char			command[1024];
+	int				length, i;
+
+	length = snprintf(command, sizeof(command), "%s -o %s -H %s/%s %s", tool ? tool : "build/wav2g711", dir, dir,
+		header, options);
+	for(i = 0; i < (int)(sizeof(clips)/sizeof(clips[0])); i++)
+		length += snprintf(command + length, sizeof(command) - length, " -c %s %s=%s/%s.wav",
+			clips[i].adpcm ? "adpcm" : "g711", clips[i].name, dir, clips[i].name);
+	strcat(command, " > /dev/null");
+	return system(command);
+}
+
+/****************************************************************************
+  Function:
+    static int Define(const char * header, const char * name, char * value)
+  Description:
+	Looks a #define up in a generated header.
+  Precondition:
+    None.
+  Parameters:
+    const char * header - header file name in dir.
+    const char * name - macro.
+    char * value - its first word, at most 63 characters.
+  Returns:
+    1 if the macro is there, else 0.
+  Remarks:
+    None.
+  ***************************************************************************/
+static int Define(const char * header, const char * name, char * value)
+{
+	char	path[256], line[256], macro[64];
+	FILE *	f;
+	int		found = 0;
+
+	snprintf(path, sizeof(path), "%s/%s", dir, header);
+	f = fopen(path, "r");
+	if(!f)
+		return 0;
+	while(!found && fgets(line, sizeof(line), f))
+		found = sscanf(line, "#define %63s %63s", macro, value) == 2 && !strcmp(macro, name);
+	fclose(f);
+	return found;
+}
+
+/****************************************************************************
+  Function:
+    static long ReadWords(const char * label)
+  Description:
+	Reads the .pword values of a generated .s file into words[].
+  Precondition:
+    None.
+  Parameters:
+    const char * label - array name, G711_<Name> or ADPCM_<Name>.
+  Returns:
+    Number of words, -1 if the file is missing.
+  Remarks:
+    None.
+  ***************************************************************************/
+static long ReadWords(const char * label)
+{
+	char			path[256], line[512], * p, * end;
+	FILE *			f;
+	long			count = 0;
+	unsigned long	word;
+
+	snprintf(path, sizeof(path), "%s/%s.s", dir, label);
+	f = fopen(path, "r");
+	if(!f)
+		return -1;
+	while(fgets(line, sizeof(line), f))
+	{
+		if(strncmp(line, ".pword", 6))
+			continue;
+		for(p = line + 6; count < MOST_WORDS; p = end + 1)
+		{
+			word = strtoul(p, &end, 16);
+			if(end == p)
+				break;
+			words[count++] = word;
+			if(*end != ',')
+				break;
+		}
+	}
+	fclose(f);
+	return count;
+}
+
+/****************************************************************************
+  Function:
+    static void CheckClip(const ASSET_CLIP * pClip, const char * header, int frameSize)
+  Description:
+	Checks the header entries and the .s file of a clip, and decodes it.
+  Precondition:
+    The tool has run.
+  Parameters:
+    const ASSET_CLIP * pClip - clip.
+    const char * header - header file name in dir.
+    int frameSize - frame size the tool was given.
+  Returns:
+    None
+  Remarks:
+    The clip is trimmed and normalised here as the tool does it, from
+    wave[] of an 8 kHz clip. A resampled clip is only checked for its
+    length and its peak after normalising.
+  ***************************************************************************/
+static void CheckClip(const ASSET_CLIP * pClip, const char * header, int frameSize)
+{
+	const char *	label = pClip->adpcm ? "ADPCM" : "G711";
+	char			name[64], value[64], expect[64];
+	long			frames = pClip->lead + pClip->length + pClip->tail;
+	long			size, count, first, last, n, got;
+	double			peak = 0, threshold, gain, power = 0, noise = 0, error, snr;
+	int				highest = 0, pad = 0;
+	IMA_ADPCM_STATE	state;
+
+	MakeWave(pClip);
+	snprintf(name, sizeof(name), "SPEECH_SIZE_%s", pClip->upper);
+	HOST_CHECK(Define(header, name, value), "%s: no %s", header, name);
+	size = strtol(value, NULL, 10);
+	HOST_CHECK(size > 0 && size % frameSize == 0, "%s: %s is %ld, not a multiple of %d", header, name, size, frameSize);
+
+	snprintf(name, sizeof(name), "SPEECH_CODEC_%s", pClip->upper);
+	HOST_CHECK(Define(header, name, value) && !strcmp(value, pClip->adpcm ? "SPEAKER_CODEC_IMA_ADPCM" : "SPEAKER_CODEC_G711"),
+		"%s: %s is %s", header, name, value);
+	snprintf(name, sizeof(name), "SPEECH_ADDR_%s", pClip->upper);
+	snprintf(expect, sizeof(expect), "__builtin_tbladdress(%s_%s)", label, pClip->name);
+	HOST_CHECK(Define(header, name, value) && !strcmp(value, expect), "%s: %s is %s", header, name, value);
+
+	snprintf(name, sizeof(name), "%s_%s", label, pClip->name);
+	got = ReadWords(name);
+	HOST_CHECK(got == (pClip->adpcm ? 1 + size/6 : size/3), "%s.s: %ld words for %ld samples", name, got, size);
+	if(got < 0 || size <= 0 || size > 2*3*MOST_WORDS || got != (pClip->adpcm ? 1 + size/6 : size/3))
+		return;
+
+	// As ReadProgramMemory() gives the words, then as the firmware decodes
+	for(n = 0; n < got; n++)
+	{
+		unpacked[2*n]		= (short)(words[n] & 0xFFFF);
+		unpacked[2*n + 1]	= (int)(words[n] >> 16);
+	}
+	PackForG711(unpacked, bytes, 2*got);
+	if(pClip->adpcm)
+	{
+		state.predictor	= unpacked[0];
+		state.index		= unpacked[1] & 0x7F;
+		HOST_CHECK(state.index <= 88, "%s.s: header step index %d", name, state.index);
+		ImaAdpcmDecode(&state, bytes + 3, decoded, (int)size);
+	}
+	else
+		G711Alaw2Lin(bytes, decoded, (int)size);
+
+	for(n = 0; n < size; n++)
+		if(abs(decoded[n]) > highest)
+			highest = abs(decoded[n]);
+	if(pClip->rate != FS)
+	{
+		count = pClip->length*FS/pClip->rate;
+		HOST_CHECK(labs(size - count) <= 2*frameSize, "%s: %ld samples for %ld", name, size, count);
+		HOST_CHECK(abs(highest - (int)(32767*pow(10, -PEAK_DB/20))) <= 1024, "%s: peak %d", name, highest);
+		return;
+	}
+
+	for(n = 0; n < frames; n++)
+		if(fabs(wave[n]) > peak)
+			peak = fabs(wave[n]);
+	threshold = peak*pow(10, -SILENCE_DB/20);
+	for(first = 0; first < frames && fabs(wave[first]) < threshold; first++)
+		;
+	for(last = frames - 1; last > first && fabs(wave[last]) < threshold; last--)
+		;
+	count	= last - first + 1;
+	gain	= pow(10, -PEAK_DB/20)*32767/peak;
+	HOST_CHECK(size == (count + frameSize - 1)/frameSize*frameSize, "%s: %ld samples, the clip trims to %ld", name, size, count);
+
+	for(n = 0; n < count && n < size; n++)
+	{
+		error	= decoded[n] - wave[first + n]*gain;
+		power	+= wave[first + n]*gain*wave[first + n]*gain;
+		noise	+= error*error;
+	}
+	snr = 10*log10(power/noise);
+	HOST_CHECK(snr >= (pClip->adpcm ? ADPCM_SNR_DB : ALAW_SNR_DB), "%s: signal to noise %.1f dB", name, snr);
+	for(n = count; n < size; n++)
+		if(abs(decoded[n]) > pad)
+			pad = abs(decoded[n]);
+	if(!pClip->adpcm)
+		HOST_CHECK(pad <= ALAW_SILENCE, "%s: padding decodes up to %d", name, pad);
+}
+
+int main(void)
+{
+	char	value[64], path[256];
+	int		i, count = (int)(sizeof(clips)/sizeof(clips[0]));
+
+	HOST_CHECK(mkdtemp(dir) != NULL, "cannot make %s", dir);
+	for(i = 0; i < count; i++)
+	{
+		MakeWave(&clips[i]);
+		WriteWav(&clips[i]);
+	}
+
+	HOST_CHECK(Run("", "Assets.h") == 0, "the tool failed");
+	HOST_CHECK(Define("Assets.h", "SPEECH_ASSET_FRAME_SIZE", value) && atoi(value) == FRAME_SIZE,
+		"SPEECH_ASSET_FRAME_SIZE is %s", value);
+	for(i = 0; i < count; i++)
+		CheckClip(&clips[i], "Assets.h", FRAME_SIZE);
+
+	snprintf(value, sizeof(value), "-f %d", OTHER_FRAME_SIZE);
+	HOST_CHECK(Run(value, "Other.h") == 0, "the tool failed with %s", value);
+	HOST_CHECK(Define("Other.h", "SPEECH_ASSET_FRAME_SIZE", value) && atoi(value) == OTHER_FRAME_SIZE,
+		"SPEECH_ASSET_FRAME_SIZE is %s with -f %d", value, OTHER_FRAME_SIZE);
+	for(i = 0; i < count; i++)
+		CheckClip(&clips[i], "Other.h", OTHER_FRAME_SIZE);
+
+	// Leave nothing behind
+	for(i = 0; i < count; i++)
+	{
+		snprintf(path, sizeof(path), "%s/%s.wav", dir, clips[i].name);
+		remove(path);
+		snprintf(path, sizeof(path), "%s/%s_%s.s", dir, clips[i].adpcm ? "ADPCM" : "G711", clips[i].name);
+		remove(path);
+	}
+	snprintf(path, sizeof(path), "%s/Assets.h", dir);
+	remove(path);
+	snprintf(path, sizeof(path), "%s/Other.h", dir);
+	remove(path);
+	rmdir(dir);
+	return hostTestEnd("Wav2G711Test");
+}
@@ -3,11 +3,11 @@
 #include "DisplayFunctions.h"
 
 void update_display( int pg ){
-    Display_ClearScreen();
     switch(pg){
         case 0: Display_Printf("\n\n< Metronome >"); break;
         case 1: Display_Printf("\n\n< Tuning Kit >"); break;
         case 2: Display_Printf("\n\n< Drum Kit >"); break;
+        case 3: Display_Printf("\n\n< Diagnostics >"); break;
     }
 }
 
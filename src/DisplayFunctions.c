@@ -1,8 +1,10 @@
 #include "Main.h"
 #include "DisplayFunctions.h"
+#include "TextSurface.h"
 
-// This has to be global based on how the library was written :-(
-GOL_SCHEME *pScheme;
+// The whole screen, framed with the text centred, kept between calls so that only the
+// characters that change are redrawn
+static TEXT_SURFACE displayText = TEXT_SURFACE_INIT(0, 0, GetMaxX(), GetMaxY(), ST_FRAME | ST_CENTER_ALIGN, NULL);
 
 // This is my version of 'printf' for the PIC - you call it with ONE parameter, the text to
 // be displayed. This can be fixed text e.g.
@@ -11,58 +13,14 @@ GOL_SCHEME *pScheme;
 //
 // Or a previously created string - for an example of this, see the Pic_DisplayInteger function
 //
+// Each '\n' starts a new line. The text looks the same as a STATICTEXT object with a frame and
+// centre aligned text (see section 6.2.1.22.1 of the 'Graphics Library Help' document), but no
+// object is created and no memory is taken from the heap: the screen remembers what it shows
+// and only the characters that differ from the last call are drawn again.
 
 void Display_Printf (char *TextToDisplay)
 {
-
-
-    STATICTEXT *pSt;			// A pointer to the newly displayed text object
-
-    // A variable that holds information on the formatting to use (centred, in a box etc).
-    WORD state;
-
-    // Before displaying NEW text we should clear the graphics memory to avoid a leak
-    GOLFree();
-
-    // This create a new scheme we will use when displaying text - again, feel free not too worry about this
-    // Note too that we do not need this if we are happy to use the defaults (see comment below)
-    pScheme = GOLCreateScheme();
-
-    // Set the options to use when displaying text (the '|' is OR so this approach 'adds' the various options)
-    // see section 6.2.1.22.1 of the 'Graphics Library Help' document for all the options.
-    //
-    // The options chosen are
-    //
-    //		1st: Text must be drawn,
-    //		2nd: A frame is to be drawn round the text box (from top-left to bottom-right) and
-    //		3rd: the text is to be centre aligned.
-
-    state = ST_DRAW | ST_FRAME | ST_CENTER_ALIGN;
-
-    // 	This is the important bit: StCreate
-    //
-    //	It creates an object that is then displayed on the screen. It has a number of
-    // 	parameters (for full details see secion 6.2.1.22.1.7 in the 'Graphis Library Help' ).
-    //	Basically they are
-    //
-    //	WORD ID	 				Unique user defined ID for the object instance.
-    //	SHORT left 				Left most position of the object.
-    //	SHORT top 				Top most position of the object.
-    //	SHORT right 			Right most position of the object.
-    //	SHORT bottom 			Bottom most position of the object.
-    //	WORD state 				Sets the initial state of the object.
-    //	XCHAR * pText 			Pointer to the text used in the static text.
-    //	GOL_SCHEME * pScheme 	Pointer to the style scheme. Set to NULL if default style scheme is used.
-    //
-    // Note: GetMaxX() and GetMaxY() return the height & width of the current display.
-
-    pSt = StCreate(7, 0,0,GetMaxX(),GetMaxY(),state,TextToDisplay, pScheme);
-
-    // While we have created the object (with its various settings) it is not yet 'Drawn' to the screen,
-    // to do this we use the StDraw function. Since rendering may take more than one call to the function
-    // we keep calling the function until it returns 1 ( 0 means 'the rendering is not yet finished').
-
-    while(!StDraw(pSt)); // draw the object	(we loop until it is actually done)
+    textSurfaceSetText(&displayText, TextToDisplay);    // draw the changes and send them to the display
 
     // Return to where the function was called from
 }
@@ -82,12 +40,15 @@ void Display_DisplayAnInteger ( int n )
 }
 
 
-// Clear the screen and free up graphics memory
+// Clear the screen and free up graphics memory. Call this before drawing anything other than
+// Display_Printf text, so the next Display_Printf draws the whole screen again.
 void Display_ClearScreen (void)
 {
     GOLFree();
     SetColor(BLACK);        // set color to BLACK
     ClearDevice();          // set screen to all BLACK
+    FlushDisplay();         // and send it to the display
+    textSurfaceInvalidate(&displayText);
 }
 
 
@@ -118,6 +79,8 @@ void InitializeScreen( void )
     GOLFree();
     SetColor(BLACK);        // set color to BLACK
     ClearDevice();          // set screen to all BLACK
+    FlushDisplay();         // and send it to the display
+    textSurfaceInvalidate(&displayText);
 
 }
 
@@ -129,6 +92,7 @@ WORD GOLDrawCallback ()
 
 WORD GOLMsgCallback( WORD translatedMsg, OBJ_HEADER* pObj, GOL_MSG* pMsg )
 {
+    (void)translatedMsg; (void)pObj; (void)pMsg;
     return 1;
 }
 
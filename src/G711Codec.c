@@ -0,0 +1,241 @@
+/**********************************************************************
+* FileName:        		G711Codec.c
+* Dependencies:    		Header (.h) files if applicable, see below
+* Processor:       		PIC24HJ128GP504, or any host with a C compiler
+* Compiler:        		MPLAB C30 v3.11b or higher, gcc
+*
+* Table driven G.711 A-law and u-law codec. The output is bit exact
+* with the assembly routines in G711.s, including the clipping limits
+* and the A-law code written for a zero input. G711.h selects which
+* implementation the G711Alaw2Lin style names refer to.
+************************************************************************/
+
+/************************************************************************
+ Header Includes													
+ ************************************************************************/
+#include "G711.h"
+
+/************************************************************************
+ Constants													
+ ************************************************************************/
+#define ALAW_MAXLIMIT	32767
+#define ALAW_ZERO_CODE	0x55		/* Code G711.s writes for a zero input	*/
+
+/************************************************************************
+ Variables													
+ ************************************************************************/
+/* Linear value of every A-law code	*/
+static const int alawToLinear[256] =
+{
+	 -5504,  -5248,  -6016,  -5760,  -4480,  -4224,  -4992,  -4736,
+	 -7552,  -7296,  -8064,  -7808,  -6528,  -6272,  -7040,  -6784,
+	 -2752,  -2624,  -3008,  -2880,  -2240,  -2112,  -2496,  -2368,
+	 -3776,  -3648,  -4032,  -3904,  -3264,  -3136,  -3520,  -3392,
+	-22016, -20992, -24064, -23040, -17920, -16896, -19968, -18944,
+	-30208, -29184, -32256, -31232, -26112, -25088, -28160, -27136,
+	-11008, -10496, -12032, -11520,  -8960,  -8448,  -9984,  -9472,
+	-15104, -14592, -16128, -15616, -13056, -12544, -14080, -13568,
+	  -344,   -328,   -376,   -360,   -280,   -264,   -312,   -296,
+	  -472,   -456,   -504,   -488,   -408,   -392,   -440,   -424,
+	   -88,    -72,   -120,   -104,    -24,     -8,    -56,    -40,
+	  -216,   -200,   -248,   -232,   -152,   -136,   -184,   -168,
+	 -1376,  -1312,  -1504,  -1440,  -1120,  -1056,  -1248,  -1184,
+	 -1888,  -1824,  -2016,  -1952,  -1632,  -1568,  -1760,  -1696,
+	  -688,   -656,   -752,   -720,   -560,   -528,   -624,   -592,
+	  -944,   -912,  -1008,   -976,   -816,   -784,   -880,   -848,
+	  5504,   5248,   6016,   5760,   4480,   4224,   4992,   4736,
+	  7552,   7296,   8064,   7808,   6528,   6272,   7040,   6784,
+	  2752,   2624,   3008,   2880,   2240,   2112,   2496,   2368,
+	  3776,   3648,   4032,   3904,   3264,   3136,   3520,   3392,
+	 22016,  20992,  24064,  23040,  17920,  16896,  19968,  18944,
+	 30208,  29184,  32256,  31232,  26112,  25088,  28160,  27136,
+	 11008,  10496,  12032,  11520,   8960,   8448,   9984,   9472,
+	 15104,  14592,  16128,  15616,  13056,  12544,  14080,  13568,
+	   344,    328,    376,    360,    280,    264,    312,    296,
+	   472,    456,    504,    488,    408,    392,    440,    424,
+	    88,     72,    120,    104,     24,      8,     56,     40,
+	   216,    200,    248,    232,    152,    136,    184,    168,
+	  1376,   1312,   1504,   1440,   1120,   1056,   1248,   1184,
+	  1888,   1824,   2016,   1952,   1632,   1568,   1760,   1696,
+	   688,    656,    752,    720,    560,    528,    624,    592,
+	   944,    912,   1008,    976,    816,    784,    880,    848
+};
+
+/* Linear value of every u-law code	*/
+static const int ulawToLinear[256] =
+{
+	-32124, -31100, -30076, -29052, -28028, -27004, -25980, -24956,
+	-23932, -22908, -21884, -20860, -19836, -18812, -17788, -16764,
+	-15996, -15484, -14972, -14460, -13948, -13436, -12924, -12412,
+	-11900, -11388, -10876, -10364,  -9852,  -9340,  -8828,  -8316,
+	 -7932,  -7676,  -7420,  -7164,  -6908,  -6652,  -6396,  -6140,
+	 -5884,  -5628,  -5372,  -5116,  -4860,  -4604,  -4348,  -4092,
+	 -3900,  -3772,  -3644,  -3516,  -3388,  -3260,  -3132,  -3004,
+	 -2876,  -2748,  -2620,  -2492,  -2364,  -2236,  -2108,  -1980,
+	 -1884,  -1820,  -1756,  -1692,  -1628,  -1564,  -1500,  -1436,
+	 -1372,  -1308,  -1244,  -1180,  -1116,  -1052,   -988,   -924,
+	  -876,   -844,   -812,   -780,   -748,   -716,   -684,   -652,
+	  -620,   -588,   -556,   -524,   -492,   -460,   -428,   -396,
+	  -372,   -356,   -340,   -324,   -308,   -292,   -276,   -260,
+	  -244,   -228,   -212,   -196,   -180,   -164,   -148,   -132,
+	  -120,   -112,   -104,    -96,    -88,    -80,    -72,    -64,
+	   -56,    -48,    -40,    -32,    -24,    -16,     -8,      0,
+	 32124,  31100,  30076,  29052,  28028,  27004,  25980,  24956,
+	 23932,  22908,  21884,  20860,  19836,  18812,  17788,  16764,
+	 15996,  15484,  14972,  14460,  13948,  13436,  12924,  12412,
+	 11900,  11388,  10876,  10364,   9852,   9340,   8828,   8316,
+	  7932,   7676,   7420,   7164,   6908,   6652,   6396,   6140,
+	  5884,   5628,   5372,   5116,   4860,   4604,   4348,   4092,
+	  3900,   3772,   3644,   3516,   3388,   3260,   3132,   3004,
+	  2876,   2748,   2620,   2492,   2364,   2236,   2108,   1980,
+	  1884,   1820,   1756,   1692,   1628,   1564,   1500,   1436,
+	  1372,   1308,   1244,   1180,   1116,   1052,    988,    924,
+	   876,    844,    812,    780,    748,    716,    684,    652,
+	   620,    588,    556,    524,    492,    460,    428,    396,
+	   372,    356,    340,    324,    308,    292,    276,    260,
+	   244,    228,    212,    196,    180,    164,    148,    132,
+	   120,    112,    104,     96,     88,     80,     72,     64,
+	    56,     48,     40,     32,     24,     16,      8,      0
+};
+
+/* Position of the highest set bit of an 8 bit value, 0 for 0 and 1	*/
+static const unsigned char segmentOf[256] =
+{
+	0, 0, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7
+};
+
+/****************************************************************************
+  Function:
+    void G711TblAlaw2Lin(char * source, int * destination, int size)
+  Description:
+	Expands A-law codes to 16 bit linear samples.
+  Precondition:
+    None.
+  Parameters:
+    char * source - A-law codes.
+    int * destination - linear samples.
+    int size - number of samples.
+  Returns:
+    None
+  Remarks:
+    One table read per sample.
+  ***************************************************************************/
+void G711TblAlaw2Lin(char * source, int * destination, int size)
+{
+	while(size-- > 0)
+		*destination++ = alawToLinear[(unsigned char)*source++];
+}
+
+/****************************************************************************
+  Function:
+    void G711TblUlaw2Lin(char * source, int * destination, int size)
+  Description:
+	Expands u-law codes to 16 bit linear samples.
+  Precondition:
+    None.
+  Parameters:
+    char * source - u-law codes.
+    int * destination - linear samples.
+    int size - number of samples.
+  Returns:
+    None
+  Remarks:
+    One table read per sample.
+  ***************************************************************************/
+void G711TblUlaw2Lin(char * source, int * destination, int size)
+{
+	while(size-- > 0)
+		*destination++ = ulawToLinear[(unsigned char)*source++];
+}
+
+/****************************************************************************
+  Function:
+    void G711TblLin2Alaw(int * source, char * destination, int size)
+  Description:
+	Compresses 16 bit linear samples to A-law codes.
+  Precondition:
+    None.
+  Parameters:
+    int * source - linear samples.
+    char * destination - A-law codes.
+    int size - number of samples.
+  Returns:
+    None
+  Remarks:
+    The segment comes from segmentOf instead of a search, so the only
+    data dependent choices left are the sign and the clip.
+  ***************************************************************************/
+void G711TblLin2Alaw(int * source, char * destination, int size)
+{
+	unsigned int	magnitude, sign, exponent, code;
+	int				sample;
+
+	while(size-- > 0)
+	{
+		sample		= *source++;
+		sign		= (sample < 0) ? 0x80 : 0x00;
+		magnitude	= (sample < 0) ? (unsigned int)(-(long)sample) : (unsigned int)sample;
+		if(magnitude > ALAW_MAXLIMIT)
+			magnitude = ALAW_MAXLIMIT;
+
+		exponent	= segmentOf[magnitude >> 7];
+		code		= (magnitude >> (exponent + 3 + (exponent == 0))) & 0x0F;
+		code		= (code | (exponent << 4) | sign) ^ 0xD5;
+
+		// G711.s writes 0x55 rather than 0xD5 for an exact zero
+		if(sample == 0)
+			code = ALAW_ZERO_CODE;
+		*destination++ = (char)code;
+	}
+}
+
+/****************************************************************************
+  Function:
+    void G711TblLin2Ulaw(int * source, char * destination, int size)
+  Description:
+	Compresses 16 bit linear samples to u-law codes.
+  Precondition:
+    None.
+  Parameters:
+    int * source - linear samples.
+    char * destination - u-law codes.
+    int size - number of samples.
+  Returns:
+    None
+  Remarks:
+    The CCITT zero trap is off, as it is in G711.s.
+  ***************************************************************************/
+void G711TblLin2Ulaw(int * source, char * destination, int size)
+{
+	unsigned int	magnitude, sign, exponent, code;
+	int				sample;
+
+	while(size-- > 0)
+	{
+		sample		= *source++;
+		sign		= (sample < 0) ? 0x80 : 0x00;
+		magnitude	= (sample < 0) ? (unsigned int)(-(long)sample) : (unsigned int)sample;
+		if(magnitude > CLIP)
+			magnitude = CLIP;
+		magnitude	+= BIAS;
+
+		exponent	= segmentOf[magnitude >> 7];
+		code		= (magnitude >> (exponent + 3)) & 0x0F;
+		*destination++ = (char)(~(code | (exponent << 4) | sign));
+	}
+}
@@ -0,0 +1,199 @@
+/**********************************************************************
+* FileName:        		ImaAdpcm.c
+* Dependencies:    		Header (.h) files if applicable, see below
+* Processor:       		PIC24HJ128GP504, or any host with a C compiler
+* Compiler:        		MPLAB C30 v3.11b or higher, gcc
+*
+* 4 bit IMA-ADPCM codec. Half the flash of G.711 for the same clip, at
+* the price of a few table reads and adds per sample. The arithmetic is
+* kept to 16 bit quantities so the firmware decoder and the host encoder
+* in tools/wav2g711 reconstruct exactly the same samples.
+************************************************************************/
+
+/************************************************************************
+ Header Includes
+ ************************************************************************/
+#include "ImaAdpcm.h"
+
+/************************************************************************
+ Constants
+ ************************************************************************/
+#define IMA_MAX_INDEX		88
+#define IMA_MAX_SAMPLE		32767
+#define IMA_MIN_SAMPLE		-32768
+
+/************************************************************************
+ Variables
+ ************************************************************************/
+/* Quantiser step size for every index	*/
+static const int imaStepSize[IMA_MAX_INDEX + 1] =
+{
+	    7,     8,     9,    10,    11,    12,    13,    14,
+	   16,    17,    19,    21,    23,    25,    28,    31,
+	   34,    37,    41,    45,    50,    55,    60,    66,
+	   73,    80,    88,    97,   107,   118,   130,   143,
+	  157,   173,   190,   209,   230,   253,   279,   307,
+	  337,   371,   408,   449,   494,   544,   598,   658,
+	  724,   796,   876,   963,  1060,  1166,  1282,  1411,
+	 1552,  1707,  1878,  2066,  2272,  2499,  2749,  3024,
+	 3327,  3660,  4026,  4428,  4871,  5358,  5894,  6484,
+	 7132,  7845,  8630,  9493, 10442, 11487, 12635, 13899,
+	15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794,
+	32767
+};
+
+/* Index change for each code, the sign bit does not matter	*/
+static const signed char imaIndexStep[16] =
+{
+	-1, -1, -1, -1, 2, 4, 6, 8,
+	-1, -1, -1, -1, 2, 4, 6, 8
+};
+
+/****************************************************************************
+  Function:
+    static int imaStep(IMA_ADPCM_STATE * state, unsigned int code)
+  Description:
+	Applies one 4 bit code to the decoder state.
+  Precondition:
+    None.
+  Parameters:
+    IMA_ADPCM_STATE * state - predictor and step index.
+    unsigned int code - ADPCM code, bit 3 is the sign.
+  Returns:
+    The reconstructed sample.
+  Remarks:
+    Shared by the decoder and the encoder so they stay in step.
+  ***************************************************************************/
+static int imaStep(IMA_ADPCM_STATE * state, unsigned int code)
+{
+	unsigned int	step = (unsigned int)imaStepSize[state->index];
+	unsigned int	diff = step >> 3;
+	long			sample;
+
+	if(code & 4)
+		diff += step;
+	if(code & 2)
+		diff += step >> 1;
+	if(code & 1)
+		diff += step >> 2;
+
+	sample = (code & 8) ? (long)state->predictor - (long)diff : (long)state->predictor + (long)diff;
+	if(sample > IMA_MAX_SAMPLE)
+		sample = IMA_MAX_SAMPLE;
+	else if(sample < IMA_MIN_SAMPLE)
+		sample = IMA_MIN_SAMPLE;
+	state->predictor = (int)sample;
+
+	state->index += imaIndexStep[code];
+	if(state->index < 0)
+		state->index = 0;
+	else if(state->index > IMA_MAX_INDEX)
+		state->index = IMA_MAX_INDEX;
+
+	return state->predictor;
+}
+
+/****************************************************************************
+  Function:
+    void ImaAdpcmInit(IMA_ADPCM_STATE * state)
+  Description:
+	Sets the state used when a clip has no header.
+  Precondition:
+    None.
+  Parameters:
+    IMA_ADPCM_STATE * state - state to reset.
+  Returns:
+    None
+  Remarks:
+    None.
+  ***************************************************************************/
+void ImaAdpcmInit(IMA_ADPCM_STATE * state)
+{
+	state->predictor	= 0;
+	state->index		= 0;
+}
+
+/****************************************************************************
+  Function:
+    void ImaAdpcmDecode(IMA_ADPCM_STATE * state, char * source,
+                        int * destination, int size)
+  Description:
+	Expands ADPCM codes to 16 bit linear samples.
+  Precondition:
+    ImaAdpcmInit() at the start of the clip.
+  Parameters:
+    IMA_ADPCM_STATE * state - decoder state, carried between calls.
+    char * source - codes, two per byte, low nibble first.
+    int * destination - linear samples.
+    int size - number of samples, must be even.
+  Returns:
+    None
+  Remarks:
+    None.
+  ***************************************************************************/
+void ImaAdpcmDecode(IMA_ADPCM_STATE * state, char * source, int * destination, int size)
+{
+	unsigned int	codes;
+
+	for(; size > 1; size -= 2)
+	{
+		codes = (unsigned char)*source++;
+		*destination++ = imaStep(state, codes & 0x0F);
+		*destination++ = imaStep(state, codes >> 4);
+	}
+}
+
+/****************************************************************************
+  Function:
+    void ImaAdpcmEncode(IMA_ADPCM_STATE * state, int * source,
+                        char * destination, int size)
+  Description:
+	Compresses 16 bit linear samples to ADPCM codes.
+  Precondition:
+    ImaAdpcmInit() at the start of the clip.
+  Parameters:
+    IMA_ADPCM_STATE * state - encoder state, carried between calls.
+    int * source - linear samples.
+    char * destination - codes, two per byte, low nibble first.
+    int size - number of samples, must be even.
+  Returns:
+    None
+  Remarks:
+    The state follows the decoder's reconstruction, not the input, so
+    quantisation errors do not build up.
+  ***************************************************************************/
+void ImaAdpcmEncode(IMA_ADPCM_STATE * state, int * source, char * destination, int size)
+{
+	unsigned int	code, step, half, byte = 0;
+	long			delta;
+	int				n;
+
+	for(n = 0; n < size; n++)
+	{
+		step	= (unsigned int)imaStepSize[state->index];
+		delta	= (long)*source++ - state->predictor;
+		code	= 0;
+		if(delta < 0)
+		{
+			code	= 8;
+			delta	= -delta;
+		}
+
+		// Successive approximation of delta/step in three bits
+		for(half = 4; half; half >>= 1)
+		{
+			if(delta >= (long)step)
+			{
+				code	|= half;
+				delta	-= step;
+			}
+			step >>= 1;
+		}
+
+		imaStep(state, code);
+		if(n & 1)
+			*destination++ = (char)(byte | (code << 4));
+		else
+			byte = code;
+	}
+}
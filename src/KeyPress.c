@@ -16,73 +16,140 @@
 
 #include "Main.h"
 #include "KeyPress.h"
+#include "struct_queue.h"
+#include "Timebase.h"
+#include "Scheduler.h"
 
-int getKey(void) {
-    int flag = 0;
-    int hold = 0;
-    int i = 0;
-    
-    int hold_duration = 4;
-    
-    for ( i = 0 ; i <= 5 ; i++ )
-        {
-            // we loop until the timer counter (TMR1) = PR1
-            while (TMR1 < PR1 )
-            {
-                //WHILE NUMBER IS SHOWN, WAIT FOR USER INPUT
-                if(SWITCH_S1 == 0 && SWITCH_S2 == 1 && flag != 2 && hold < 20){
-                    hold++;
-                    flag = 1;
-                    Delay(100);
-                }
-                if(SWITCH_S1 == 1 && SWITCH_S2 == 0 && flag != 1 && hold < 20){
-                    hold++;
-                    flag = 2;
-                    Delay(100);
-                }
-                else if(SWITCH_S1 == 1 && SWITCH_S2 == 1 && flag != 0){
-                    break;
-                }
-            }
-            cTimer();
-        }
-    if(flag == 1){
-        if(hold < hold_duration){
-            return(S1_SHORT);
-        }
-        else{return(S1_LONG);}
+typedef struct {
+    unsigned char level;            // Debounced state, 1 while pressed
+    unsigned char count;            // Milliseconds the pin has disagreed with level
+    unsigned char longSent;         // The long event of this press has been queued
+    unsigned int held;              // Milliseconds since the debounced press
+} KEY_SWITCH;
+
+typedef struct {
+    int head;                       // struct_queue.h ring of events, filled by _T4Interrupt
+    int tail;
+    int count;
+    KEY_EVENT buffer[KEY_QUEUE_DEPTH];
+} KEY_QUEUE;
+
+static KEY_SWITCH keySwitch[2];
+static KEY_QUEUE keyQueue;
+unsigned int keyOverruns;           // Events dropped because the queue was full
+
+//______________________________________________________________________________
+// Queues one event, called from the Timer 4 interrupt only
+static void keyPush(int code) {
+    KEY_EVENT *event;
+
+    if(StructQueueIsFull(&keyQueue, KEY_QUEUE_DEPTH)){
+        keyOverruns++;
+        return;
     }
-    if(flag == 2){
-        if(hold < hold_duration){
-            return(S2_SHORT);
+    event = StructQueueAdd(&keyQueue, KEY_QUEUE_DEPTH);
+    event->code = code;
+    event->time = (unsigned int)millis();
+    event->micros = micros();
+}
+
+//______________________________________________________________________________
+// Debounces one switch and classifies what it did in the last millisecond.
+// A press is reported once the pin has read pressed for KEY_DEBOUNCE_MS in a
+// row; held for KEY_LONG_MS it becomes a long press straight away, released
+// before that it is a short press. shortCode and longCode are the events of this
+// switch, the press and release events are shortCode plus KEY_PRESS/KEY_RELEASE.
+static void keyClassify(KEY_SWITCH *sw, unsigned int pressed, int shortCode, int longCode) {
+    // Counted before the debounce so the millisecond of the press is not held
+    if(sw->level && !sw->longSent && ++sw->held >= KEY_LONG_MS){
+        sw->longSent = 1;
+        keyPush(longCode);
+    }
+
+    if(pressed != sw->level){
+        if(++sw->count >= KEY_DEBOUNCE_MS){
+            sw->level = pressed;
+            sw->count = 0;
+            if(pressed){
+                sw->held = 0;
+                sw->longSent = 0;
+                keyPush(shortCode + KEY_PRESS);
+            }
+            else {
+                keyPush(shortCode + KEY_RELEASE);
+                if(!sw->longSent)
+                    keyPush(shortCode);
+            }
         }
-        else{return(S2_LONG);}
     }
-    return(0);
+    else
+        sw->count = 0;
 }
 
+//______________________________________________________________________________
+// Called every millisecond from _T4Interrupt
+void keyScan(void) {
+    keyClassify(&keySwitch[0], SWITCH_S1 == 0, S1_SHORT, S1_LONG);
+    keyClassify(&keySwitch[1], SWITCH_S2 == 0, S2_SHORT, S2_LONG);
+}
 
+//______________________________________________________________________________
+// Takes the oldest event of any kind off the queue, returns 0 if there is none
+int pollKeyEvent(KEY_EVENT *event) {
+    int found = 0;
+    int t4ie = IEC1bits.T4IE;
 
-//TIMER CONFIG
-void cTimer(void){
-    // We need to reset the timer ready to count again
-    // (we could put the next few lines in a function
-    T1CONbits.TON = 0;      // Stop timer
-    TMR1 = 0;               // Start value for the counter
-    PR1 = 61900;			// Value timer counts to
-    T1CONbits.TON = 1;      // Run timer
+    IEC1bits.T4IE = 0;
+    if(StructQueueIsNotEmpty(&keyQueue, KEY_QUEUE_DEPTH)){
+        *event = *StructQueueRemove(&keyQueue, KEY_QUEUE_DEPTH);
+        found = 1;
+    }
+    IEC1bits.T4IE = t4ie;
+    return found;
 }
 
-/*
- 
- for ( i = 0 ; i <= 5 ; i++ )
-    {
-        // we loop until the timer counter (TMR1) = PR1
-        while (TMR1 < PR1 )
-        {
-            ......
-        }
-        cTimer();
+//______________________________________________________________________________
+// Returns the next short or long press without waiting, 0 if there is none.
+// Press and release events on the way are dropped.
+int pollKey(void) {
+    KEY_EVENT event;
+
+    while(pollKeyEvent(&event)){
+        if(event.code == S1_SHORT || event.code == S1_LONG ||
+           event.code == S2_SHORT || event.code == S2_LONG)
+            return event.code;
     }
- 
- */
\ No newline at end of file
+    return 0;
+}
+
+//______________________________________________________________________________
+// Waits up to timeout milliseconds for a short or long press, 0 on timeout.
+// KEY_WAIT_FOREVER never times out.
+int waitKey(unsigned int timeout) {
+    unsigned int start = (unsigned int)millis();
+    int key;
+
+    while((key = pollKey()) == 0){
+        if(timeout != KEY_WAIT_FOREVER && (unsigned int)((unsigned int)millis() - start) >= timeout)
+            break;
+        schedulerYield();
+    }
+    return key;
+}
+
+//______________________________________________________________________________
+// Drops every queued event
+void keyFlush(void) {
+    KEY_EVENT event;
+
+    while(pollKeyEvent(&event))
+        ;
+}
+
+//______________________________________________________________________________
+// The menus' original call: returns as soon as a press is classified, or 0
+// after the same window the old Timer 1 polling loop gave
+int getKey(void) {
+    return waitKey(KEY_GETKEY_TIMEOUT_MS);
+}
+
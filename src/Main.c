@@ -45,11 +45,15 @@
 #include "DisplayFunctions.h"   // Needed to make use of graphics functions
 #include "SimpleGraphics.h"     // For the line, circle example functions
 #include "Timer1Code.h"         // For the timer 1 functions (including interrupt)
+#include "Timebase.h"           // millis() and micros()
+#include "Scheduler.h"          // Software timers and waits
 #include "SoundCode.h"          // For functions to do with playing sounds
 #include "KeyPress.h"
 #include "DLC.h"
+#include "Profile.h"
 #include "metronome.h"
 #include "drum1.h"
+#include "../tuner.h"
 
 /************************************************************************
  Configuration Bits													
@@ -75,39 +79,6 @@ DWORD               previousTick = 0;
 int                 slowFlag = 0;
 int                 T1IntCalled =0;	// How many times have we entered the interrupt?
 
-/****************************************************************************
-  Function:
-    void TickInit_NoInterrupt( void )
-  Description:
-    This function sets up Timer 1 to count to 32767 (longest delay possible)
-  Precondition:
-    None
-  Parameters:
-    None
-  Returns:
-    None
-  Remarks:
-    The timer period and prescaler values are defined in HardwareProfile.h,
-    since they are dependent on the oscillator speed.
-  ***************************************************************************/
-
-
-void TickInit_NoInterrupt( void )
-{
-    TMR1 = 0;					// Reset the timer
-    PR1 = 32767;				// Largest number that can be counted down from -> longest delay
-	
-   	T1CON = TIMER_ON | STOP_TIMER_IN_IDLE_MODE | TIMER_SOURCE_INTERNAL |
-       	    GATED_TIME_DISABLED | TIMER_16BIT_MODE | TIMER_PRESCALER;
-
-	// If you use a different pre-scalar the counter will count more slowly
-	T1CONbits.TCKPS = 3;		// Use a 1:1 pre-scalar
-
-    IFS0bits.T1IF = 0;              //Clear flag
-    IEC0bits.T1IE = 0;              // *** DO NOT **** enable interrupt
-    T1CONbits.TON = 1;              //Run timer
-}
-
 /************************************************************************
  Main
  ************************************************************************/
@@ -132,8 +103,10 @@ int main( void )
     while(OSCCONbits.COSC != 0b001);			// Wait for Clock switch to occur
     while(OSCCONbits.LOCK!=1);					// Wait for PLL to lock
 
-    // Starter Kit initialization delay
-    Delay(2000);
+    // Start the millisecond tick, then the Starter Kit initialization delay
+    timebaseInit();
+    schedulerInit();
+    schedulerDelay(2000);
 
     // Initialize Speaker and Switches
     PIC24HSKInit();
@@ -141,9 +114,6 @@ int main( void )
     // Initialize the OLED module and Microchip Graphics Library
     GOLInit(); // initialize graphics library
 
-    // Configure and turn on timer 1  (if you wish uncomment the line below)
-    TickInit();
-    TickInit_NoInterrupt();
     int page = 0;
     int flag = 0;
     int Loop = 1;
@@ -157,20 +127,12 @@ int main( void )
         flag = getKey();
 
         if(flag == S1_SHORT){
-            switch(page){
-                case 0: page = 2; break;
-                case 1:
-                case 2: page--; break;
-            }
+            page = (page == 0) ? MENU_PAGES - 1 : page - 1;
             update_display(page);
         }
 
         if(flag == S2_SHORT){
-            switch(page){
-                case 0: 
-                case 1: page++; break;
-                case 2: page = 0; break;
-            }
+            page = (page == MENU_PAGES - 1) ? 0 : page + 1;
             update_display(page);
         }
 
@@ -182,6 +144,9 @@ int main( void )
                 case 0: play_metronome(); break;
                 case 1: PlayTune(); break;
                 case 2: play_drum(); break;
+#ifdef USE_PROFILING
+                case 3: profileShowScreen(); break;
+#endif
             }
             
             
@@ -197,8 +162,7 @@ int main( void )
     }
 
     // This statement will run forever - any changes are done via the interrupt events
-    while (1)
-            ; // Null statement
+    schedulerRun();
 
 }
 
@@ -0,0 +1,290 @@
+/**********************************************************************
+* FileName:        		Profile.c
+* Dependencies:    		Header (.h) files if applicable, see below
+* Processor:       		PIC24HJ128GP504, or any host with a C compiler
+* Compiler:        		MPLAB C30 v3.11b or higher, gcc
+*
+* Probe table and the diagnostics screen that shows it. Each probe is
+* only ever recorded from one place, so an interrupt cannot interleave
+* two updates of the same entry; readers copy an entry until its count
+* holds still instead of masking interrupts.
+************************************************************************/
+
+/************************************************************************
+ Header Includes
+ ************************************************************************/
+#include <string.h>
+#include "Main.h"
+#include "Profile.h"
+#include "DisplayFunctions.h"
+#include "KeyPress.h"
+#include "Scheduler.h"
+#if !defined(HOST_BUILD)
+#include "Timebase.h"
+#else
+#include <time.h>
+#endif
+
+/************************************************************************
+ Variables
+ ************************************************************************/
+PROFILE_PROBE					profileProbes[PROFILE_PROBES];
+
+static const char * const		profileNames[PROFILE_PROBES] =
+{
+	"DMA0", "T5", "T4", "GOLDraw", "StDraw", "Clear"
+};
+
+static volatile unsigned int	profileRedraw;			// Set by the refresh timer
+
+/****************************************************************************
+  Function:
+    DWORD profileNow(void)
+  Description:
+	Reads the probe clock.
+  Precondition:
+    timebaseInit() must have been called on the target.
+  Parameters:
+    None.
+  Returns:
+    Instruction cycles on the target, nanoseconds on a host, in
+    PROFILE_CLOCK_HZ units. Only differences are meaningful.
+  Remarks:
+    None.
+  ***************************************************************************/
+DWORD profileNow(void)
+{
+#if !defined(HOST_BUILD)
+	return timebaseCycles();
+#else
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (DWORD)now.tv_sec*PROFILE_CLOCK_HZ + (DWORD)now.tv_nsec;
+#endif
+}
+
+/****************************************************************************
+  Function:
+    void profileRecord(PROFILE_ID id, DWORD time)
+  Description:
+	Adds one run to a probe.
+  Precondition:
+    None.
+  Parameters:
+    PROFILE_ID id - probe.
+    DWORD time - length of the run in PROFILE_CLOCK_HZ units.
+  Returns:
+    None
+  Remarks:
+    Called by PROFILE_END().
+  ***************************************************************************/
+void profileRecord(PROFILE_ID id, DWORD time)
+{
+	PROFILE_PROBE *probe = &profileProbes[id];
+
+	probe->count++;
+	probe->total += time;
+	if(probe->count == 1 || time < probe->min)
+		probe->min = time;
+	if(time > probe->max)
+		probe->max = time;
+}
+
+/****************************************************************************
+  Function:
+    void profileReset(void)
+  Description:
+	Clears every probe.
+  Precondition:
+    None.
+  Parameters:
+    None.
+  Returns:
+    None
+  Remarks:
+    A probe that is part way through a run when it is cleared still
+    records that run.
+  ***************************************************************************/
+void profileReset(void)
+{
+	int i;
+
+	for(i = 0; i < PROFILE_PROBES; i++)
+	{
+		profileProbes[i].count	= 0;
+		profileProbes[i].total	= 0;
+		profileProbes[i].min	= 0;
+		profileProbes[i].max	= 0;
+	}
+}
+
+/****************************************************************************
+  Function:
+    void profileRead(PROFILE_ID id, PROFILE_PROBE * copy)
+  Description:
+	Takes a consistent copy of one probe.
+  Precondition:
+    None.
+  Parameters:
+    PROFILE_ID id - probe.
+    PROFILE_PROBE * copy - receives the entry.
+  Returns:
+    None
+  Remarks:
+    Copies again if the probe recorded a run while it was being read.
+  ***************************************************************************/
+void profileRead(PROFILE_ID id, PROFILE_PROBE * copy)
+{
+	DWORD count;
+
+	do
+	{
+		count = profileProbes[id].count;
+		*copy = profileProbes[id];
+	} while(count != profileProbes[id].count);
+}
+
+/****************************************************************************
+  Function:
+    const char * profileName(PROFILE_ID id)
+  Description:
+	Short name of a probe for display.
+  Precondition:
+    None.
+  Parameters:
+    PROFILE_ID id - probe.
+  Returns:
+    The name.
+  Remarks:
+    None.
+  ***************************************************************************/
+const char * profileName(PROFILE_ID id)
+{
+	return profileNames[id];
+}
+
+/****************************************************************************
+  Function:
+    static DWORD profileMicros(DWORD time)
+  Description:
+	Converts a probe time to microseconds.
+  Precondition:
+    None.
+  Parameters:
+    DWORD time - time in PROFILE_CLOCK_HZ units.
+  Returns:
+    Microseconds.
+  Remarks:
+    Scaled through tenths of a microsecond so the 39.6 MHz instruction
+    clock does not round to 39.
+  ***************************************************************************/
+static DWORD profileMicros(DWORD time)
+{
+	return (time*10)/(PROFILE_CLOCK_HZ/100000L);
+}
+
+static void profileRefreshTask(void)
+{
+	profileRedraw = 1;
+}
+
+/****************************************************************************
+  Function:
+    static void profileDrawTable(void)
+  Description:
+	Draws minimum, average and maximum microseconds of every probe.
+  Precondition:
+    GOLInit() must have been called.
+  Parameters:
+    None.
+  Returns:
+    None
+  Remarks:
+    One line per probe under a header line, which fills the 64 rows of
+    the display with the default font.
+  ***************************************************************************/
+static void profileDrawTable(void)
+{
+	PROFILE_PROBE	probe;
+	SHORT			height, y;
+	char			str[21];						// Widest unsigned long or a probe name, and its terminator
+	int				i;
+
+	Display_ClearScreen();
+	SetColor(WHITE);
+	SetFont((void *)&FONTDEFAULT);
+	height = GetTextHeight((void *)&FONTDEFAULT);
+
+	while(!OutTextXY(0, 0, "us"));
+	while(!OutTextXY(44, 0, "min"));
+	while(!OutTextXY(72, 0, "avg"));
+	while(!OutTextXY(100, 0, "max"));
+
+	for(i = 0, y = height; i < PROFILE_PROBES; i++, y += height)
+	{
+		profileRead(i, &probe);
+		// OutTextXY() takes the text as writable, the names live in flash
+		strncpy(str, profileNames[i], sizeof(str) - 1);
+		str[sizeof(str) - 1] = 0;
+		while(!OutTextXY(0, y, str));
+		if(probe.count == 0)
+		{
+			while(!OutTextXY(44, y, "-"));
+			continue;
+		}
+		sprintf(str, "%lu", (unsigned long)profileMicros(probe.min));
+		while(!OutTextXY(44, y, str));
+		sprintf(str, "%lu", (unsigned long)profileMicros(probe.total/probe.count));
+		while(!OutTextXY(72, y, str));
+		sprintf(str, "%lu", (unsigned long)profileMicros(probe.max));
+		while(!OutTextXY(100, y, str));
+	}
+	FlushDisplay();
+}
+
+/****************************************************************************
+  Function:
+    void profileShowScreen(void)
+  Description:
+	Diagnostics screen. Redraws the probe table every PROFILE_REFRESH_MS;
+	S1 clears the probes and S2 long returns.
+  Precondition:
+    GOLInit() and schedulerInit() must have been called.
+  Parameters:
+    None.
+  Returns:
+    None
+  Remarks:
+    Drawing the table is itself measured by the GOL and ClearDevice
+    probes.
+  ***************************************************************************/
+void profileShowScreen(void)
+{
+	int timer, key;
+
+	profileRedraw	= 1;
+	timer			= schedulerStart(profileRefreshTask, PROFILE_REFRESH_MS, PROFILE_REFRESH_MS);
+
+	while(1)
+	{
+		if(profileRedraw)
+		{
+			profileRedraw = 0;
+			profileDrawTable();
+		}
+
+		key = pollKey();
+		if(key == S2_LONG)
+			break;
+		if(key == S1_SHORT)
+		{
+			profileReset();
+			profileRedraw = 1;
+		}
+		if(key == 0)
+			schedulerYield();
+	}
+
+	schedulerStop(timer);
+}
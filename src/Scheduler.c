@@ -0,0 +1,224 @@
+/**********************************************************************
+* FileName:        		Scheduler.c
+* Dependencies:    		Header (.h) files if applicable, see below
+* Processor:       		PIC24HJ128GP504
+* Compiler:        		MPLAB C30 v3.11b or higher
+*
+* Cooperative millisecond scheduler. Replaces the calibrated Delay() loop
+* and the Timer 1 polling loops: while the application waits, due tasks
+* run and the CPU otherwise idles, so the audio, display and switch
+* interrupts are the only work done between events.
+************************************************************************/
+
+/************************************************************************
+ Header Includes
+ ************************************************************************/
+#include "p24HJ128GP504.h"
+#include "Scheduler.h"
+
+/************************************************************************
+ Variables
+ ************************************************************************/
+static SCHEDULER_TIMER	schedulerTimers[SCHEDULER_MAX_TIMERS];
+static unsigned int		schedulerRunning = 0;		// Set while a task runs, so waits inside it do not nest
+DWORD					schedulerIdleCount = 0;
+unsigned int			schedulerLateMax = 0;
+
+/****************************************************************************
+  Function:
+    void schedulerInit(void)
+  Description:
+	Stops every software timer.
+  Precondition:
+    timebaseInit() must have been called.
+  Parameters:
+    None.
+  Returns:
+    None
+  Remarks:
+    None.
+  ***************************************************************************/
+void schedulerInit(void)
+{
+	int i;
+
+	for(i = 0; i < SCHEDULER_MAX_TIMERS; i++)
+		schedulerTimers[i].active = 0;
+	schedulerRunning = 0;
+}
+
+/****************************************************************************
+  Function:
+    int schedulerStart(SCHEDULER_TASK task, unsigned int delay,
+                       unsigned int period)
+  Description:
+	Starts a software timer.
+  Precondition:
+    schedulerInit() must have been called.
+  Parameters:
+    SCHEDULER_TASK task - function to run when the timer falls due.
+    unsigned int delay - ms until the first run.
+    unsigned int period - ms between later runs, or SCHEDULER_ONE_SHOT.
+  Returns:
+    Timer number for schedulerStop(), or SCHEDULER_NO_TIMER if all
+    SCHEDULER_MAX_TIMERS are in use.
+  Remarks:
+    A periodic timer is rescheduled from its due time, not from when its
+    task ran, so late runs do not add up to drift.
+  ***************************************************************************/
+int schedulerStart(SCHEDULER_TASK task, unsigned int delay, unsigned int period)
+{
+	int i;
+
+	for(i = 0; i < SCHEDULER_MAX_TIMERS; i++)
+	{
+		if(!schedulerTimers[i].active)
+		{
+			schedulerTimers[i].task		= task;
+			schedulerTimers[i].due		= millis() + delay;
+			schedulerTimers[i].period	= period;
+			schedulerTimers[i].active	= 1;
+			return i;
+		}
+	}
+	return SCHEDULER_NO_TIMER;
+}
+
+/****************************************************************************
+  Function:
+    void schedulerStop(int timer)
+  Description:
+	Stops a software timer before its next run.
+  Precondition:
+    None.
+  Parameters:
+    int timer - number returned by schedulerStart().
+  Returns:
+    None
+  Remarks:
+    Safe with SCHEDULER_NO_TIMER and with a one-shot timer that has
+    already run.
+  ***************************************************************************/
+void schedulerStop(int timer)
+{
+	if(timer >= 0 && timer < SCHEDULER_MAX_TIMERS)
+		schedulerTimers[timer].active = 0;
+}
+
+/****************************************************************************
+  Function:
+    int schedulerRunPending(void)
+  Description:
+	Runs the task of every timer that has fallen due.
+  Precondition:
+    schedulerInit() must have been called.
+  Parameters:
+    None.
+  Returns:
+    Number of tasks run.
+  Remarks:
+    Does nothing when called from inside a task, so a task that waits
+    cannot run itself again before it has returned.
+  ***************************************************************************/
+int schedulerRunPending(void)
+{
+	SCHEDULER_TIMER	*timer;
+	DWORD			now;
+	unsigned int	late;
+	int				i, ran = 0;
+
+	if(schedulerRunning)
+		return 0;
+	schedulerRunning = 1;
+
+	for(i = 0; i < SCHEDULER_MAX_TIMERS; i++)
+	{
+		timer	= &schedulerTimers[i];
+		now		= millis();
+		if(!timer->active || (long)(now - timer->due) < 0)
+			continue;
+
+		late = (unsigned int)(now - timer->due);
+		if(late > schedulerLateMax)
+			schedulerLateMax = late;
+
+		if(timer->period == SCHEDULER_ONE_SHOT)
+			timer->active = 0;
+		else
+			timer->due += timer->period;
+
+		timer->task();
+		ran++;
+	}
+
+	schedulerRunning = 0;
+	return ran;
+}
+
+/****************************************************************************
+  Function:
+    void schedulerYield(void)
+  Description:
+	One pass of the task loop: runs the due tasks, or idles the CPU until
+	the next interrupt if there were none.
+  Precondition:
+    schedulerInit() must have been called.
+  Parameters:
+    None.
+  Returns:
+    None
+  Remarks:
+    Called by every loop that waits for time or an event. An interrupt that
+    makes a task due just before Idle() is at most one tick late, since
+    Timer 1 wakes the CPU every millisecond.
+  ***************************************************************************/
+void schedulerYield(void)
+{
+	if(schedulerRunPending() == 0)
+	{
+		schedulerIdleCount++;
+		Idle();
+	}
+}
+
+/****************************************************************************
+  Function:
+    void schedulerDelay(unsigned int ms)
+  Description:
+	Waits a number of milliseconds without holding up the due tasks.
+  Precondition:
+    schedulerInit() must have been called.
+  Parameters:
+    unsigned int ms - time to wait.
+  Returns:
+    None
+  Remarks:
+    Takes the place of Delay(), to within one tick.
+  ***************************************************************************/
+void schedulerDelay(unsigned int ms)
+{
+	DWORD start = millis();
+
+	while((DWORD)(millis() - start) < ms)
+		schedulerYield();
+}
+
+/****************************************************************************
+  Function:
+    void schedulerRun(void)
+  Description:
+	The task loop for an application with nothing left to do in main().
+  Precondition:
+    schedulerInit() must have been called.
+  Parameters:
+    None.
+  Returns:
+    Never.
+  Remarks:
+    None.
+  ***************************************************************************/
+void schedulerRun(void)
+{
+	while(1)
+		schedulerYield();
+}
@@ -9,6 +9,9 @@
 
 #include "Main.h"               // To include information abous the board etc.
 #include "SimpleGraphics.h"     // Function prototypes
+#include "Scheduler.h"          // schedulerDelay()
+
+#define DRAW_SLICE_US	500		// Longest the display may hold up the main loop per pass
 
 // An example of how to use the slider
 void SliderExample ( void)
@@ -31,12 +34,13 @@ void SliderExample ( void)
 
 	while(1)
 	{
-		if (GOLDraw()) 	// Draw GOL object
+		if (GOLDrawBudget(DRAW_SLICE_US)) 	// Draw GOL object a slice at a time
 		{
-			SldIncPos(pSld);
-			SetState(pSld, SLD_DRAW);		// Required to foce a re-draw
-			Delay(1000);
+			SldIncPos(pSld);				// Marks the old and new thumb area for re-drawing
+			schedulerDelay(1000);
 		}
+		else
+			schedulerYield();				// Let due tasks run between slices
 	}
 }
 
@@ -45,6 +49,7 @@ void LineExample (void)		// A 'primitive' function (so needs 'Primitive.h') so N
 {
 	ClearDevice();	// Clear the screen
 	Line ( 0,0, GetMaxX(), GetMaxY() );
+	FlushDisplay();	// Send the drawing to the display
 	return;// Return to where the function was called from
 }
 
@@ -56,6 +61,7 @@ void SimpleCircleExample (void)	// A 'primitive' function (so needs 'Primitive.h
 	ClearDevice();	// Clear the screen
 	SetColor(WHITE); // set color to WHITE to draw
 	Circle ( GetMaxX()/2, GetMaxY()/2 , GetMaxY()/3 );
+	FlushDisplay();	// Send the drawing to the display
 	// Return to where the function was called from
 }
 
@@ -66,5 +72,6 @@ void FilledInCircleExample()
 	ClearDevice();	// Clear the screen
 	SetColor(WHITE); // set color to WHITE to draw
 	FillCircle ( GetMaxX()/2, GetMaxY()/2 , GetMaxY()/3 );
+	FlushDisplay();	// Send the drawing to the display
 	// Return to where the function was called from
 }
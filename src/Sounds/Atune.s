@@ -1,497 +0,0 @@
-/******************************************************************************
-*  Speech.s developed by AccelWork Inc. for Microchip Technology Inc. 
-*  Copyright (c) 2005 by Microchip. All rights are reserved. 
-*  
-*  This Copyright notice may not be removed or modified without prior written 
-*  consent of Microchip Technology Inc. 
-******************************************************************************/
-
-/******************************************************************************
-*  Speech.s
-*
-*  Description:
-*    This file is generated by dsPIC33F Speech Encoder Utility Version 1.00
-*    It contains the ALAW compressed data for a 8kHz,16-bit speech signal.The
-*    output array represents a 64kbps encoded bit stream.
-*
-*    Speech Encoder Utility settings:
-*       Input Source:  Atune.wav
-*       Output Array:  G711_Atune
-*       Array Size:    8193 bytes                
-*       Target Memory: Program Memory
-*       LAW:           ALAW
-*
-*    Modification History:
-*
-*       Date           Author              Description
-*       ----           ------              -----------
-*
-*    Dec-16-2005    Taruna Singh		   Created
-*    Dec-20-2005    Taruna Singh		   Ready for Alpha Release
-*
-******************************************************************************/
-
-/* There are 2731 elements in the data array. */
-   
-/* Data file for storing 24-bit constants in program memory */
-
-.global _G711_Atune
-
-.section .G711, code
-_G711_Atune:
-.pword 0x9A8691,  0xFD9599,  0x191779,  0x050705,  0x7F171E,  0x9F94F3
-.pword 0x848485,  0xFA9699,  0x1F1574,  0x040405,  0x641118,  0x9CEBCF
-.pword 0x848485,  0xE19098,  0x1D6947,  0x040405,  0x63131B,  0x92EFDC
-.pword 0x84849A,  0xED929A,  0x136DD5,  0x04041A,  0x6F121A,  0x93E35C
-.pword 0x84849B,  0xE99D85,  0x1061C7,  0x070418,  0x6B1C05,  0x91E74E
-.pword 0x878498,  0x959F85,  0x167AF7,  0x070419,  0x141E05,  0x97FE73
-.pword 0x87849E,  0x979E85,  0x1473FE,  0x07051E,  0x161904,  0x95F47A
-.pword 0x87859F,  0x919884,  0x6B4FE7,  0x04051C,  0x101804,  0xE9C461
-.pword 0x84859D,  0x939B84,  0x6F5DE3,  0x041A12,  0x121A04,  0xED556D
-.pword 0x849A92,  0x929A84,  0x63DCEF,  0x041B13,  0x1D0504,  0xE14769
-.pword 0x849890,  0x9C8584,  0x67CEEB,  0x041811,  0x1F0507,  0xFA7415
-.pword 0x849996,  0x9E8587,  0x7EF394,  0x041E17,  0x1E0407,  0xF27F17
-.pword 0x859E94,  0x998487,  0x77FA96,  0x051F15,  0x180407,  0xC96411
-.pword 0x859CEA,  0x988487,  0x46E190,  0x051D68,  0x1B0404,  0xDF6313
-.pword 0x9A9DEF,  0x9A8484,  0x54ED93,  0x1A126D,  0x1A0404,  0x5D6F12
-.pword 0x9B93E3,  0x858484,  0xC4E99D,  0x1B1061,  0x050704,  0x4F6B1C
-.pword 0x9891E7,  0x858784,  0xF4959F,  0x19167A,  0x050704,  0x73141E
-.pword 0x9E97FE,  0x848784,  0xFE979E,  0x1E1473,  0x040705,  0x7A1619
-.pword 0x9F95F4,  0x848785,  0xE79198,  0x1C6B4E,  0x040705,  0x611018
-.pword 0x9DE9C7,  0x848485,  0xE3939B,  0x1D6F5C,  0x04041A,  0x6D121A
-.pword 0x92EDD5,  0x84849A,  0xEF929A,  0x1363DC,  0x04041B,  0x691D05
-.pword 0x90E147,  0x878498,  0xEB9C85,  0x1164CE,  0x070418,  0x151F05
-.pword 0x96FA77,  0x878499,  0x949E85,  0x177EF3,  0x07041E,  0x171E04
-.pword 0x94F37E,  0x87859E,  0x969984,  0x1577FA,  0x07051F,  0x111804
-.pword 0xEBCF67,  0x87859C,  0x909884,  0x6947E1,  0x04051D,  0x131B04
-.pword 0xEFDC63,  0x849A9D,  0x939A84,  0x6D55ED,  0x041A12,  0x121A04
-.pword 0xE35D6F,  0x849B93,  0x9D8584,  0x61C4E9,  0x041810,  0x1C0504
-.pword 0xE44E6B,  0x849891,  0x9F8587,  0x7AF795,  0x041916,  0x1E0507
-.pword 0xFF7314,  0x849E97,  0x9E8487,  0x73FE97,  0x051E14,  0x190407
-.pword 0xF47A16,  0x859F95,  0x988487,  0x4FE791,  0x051C6B,  0x180407
-.pword 0xC46110,  0x859DE9,  0x9B8484,  0x5DE393,  0x1A126F,  0x1A0404
-.pword 0x556D12,  0x9A92ED,  0x9A8484,  0xDCEF92,  0x1B1363,  0x050404
-.pword 0x44691D,  0x9890E1,  0x858784,  0xCFEB9C,  0x181167,  0x050704
-.pword 0x74151F,  0x9996FA,  0x858784,  0xF3949E,  0x1E177E,  0x050705
-.pword 0x7F171E,  0x9E94F3,  0x848785,  0xFA9699,  0x1F1577,  0x040405
-.pword 0x641118,  0x9CEBCE,  0x848485,  0xE19098,  0x1D6947,  0x040405
-.pword 0x63131B,  0x92EFDC,  0x84849A,  0xED929A,  0x126DD5,  0x04041A
-.pword 0x6F121A,  0x93E35C,  0x84849B,  0xE99D85,  0x1061C7,  0x070418
-.pword 0x6B1C05,  0x91E44E,  0x878498,  0x959F85,  0x167AF7,  0x070419
-.pword 0x141E05,  0x97FF73,  0x87859E,  0x979E84,  0x1473FE,  0x07051E
-.pword 0x161904,  0x95F47A,  0x87859F,  0x919884,  0x6B4CE7,  0x07051C
-.pword 0x101804,  0xE9C461,  0x84859D,  0x939B84,  0x6F52E3,  0x041A12
-.pword 0x121A04,  0xED546D,  0x849A93,  0x9D9A84,  0x63DCEF,  0x041B13
-.pword 0x1D0504,  0xE14769,  0x849890,  0x9C8587,  0x64CEEB,  0x041811
-.pword 0x1F0507,  0xFA7715,  0x849996,  0x9E8587,  0x7FF394,  0x041E17
-.pword 0x1E0407,  0xF37E17,  0x859E94,  0x998487,  0x77FA96,  0x051F15
-.pword 0x180407,  0xCE6411,  0x859CEB,  0x988484,  0x44E190,  0x051D69
-.pword 0x1B0404,  0xDD6313,  0x9A92EF,  0x9A8484,  0xD5ED92,  0x1A136D
-.pword 0x1A0404,  0x5C6F12,  0x9B93E3,  0x858484,  0xC7E99D,  0x181061
-.pword 0x050704,  0x4E6B1C,  0x9891E7,  0x858784,  0xF7959F,  0x19167A
-.pword 0x050704,  0x73141E,  0x9E97FE,  0x848784,  0xFE979E,  0x1E1473
-.pword 0x040705,  0x7A1619,  0x9F95F7,  0x848785,  0xE49198,  0x1C6B4E
-.pword 0x040705,  0x611018,  0x9DE9C7,  0x848485,  0xE3939B,  0x126F5C
-.pword 0x04041A,  0x6D121A,  0x92EDD5,  0x84849A,  0xEF929A,  0x1363DD
-.pword 0x04041B,  0x691D05,  0x90E144,  0x848498,  0xEB9C85,  0x1164CE
-.pword 0x070418,  0x151F05,  0x96FA77,  0x878499,  0x949E85,  0x177FF2
-.pword 0x07041E,  0x171E04,  0x94F37E,  0x87859E,  0x969984,  0x1577FA
-.pword 0x07051F,  0x111804,  0xEBCE64,  0x87859C,  0x909884,  0x6947E1
-.pword 0x04051D,  0x131B04,  0xEFDC63,  0x849A92,  0x929A84,  0x6D55ED
-.pword 0x041A12,  0x121A04,  0xE35C6F,  0x849B93,  0x9D8584,  0x61C4E9
-.pword 0x041810,  0x1C0504,  0xE74F6B,  0x849891,  0x9F8587,  0x7AF495
-.pword 0x041916,  0x1E0507,  0xFE7314,  0x859E97,  0x9E8587,  0x73FE97
-.pword 0x051E14,  0x190407,  0xF77A16,  0x859F95,  0x988487,  0x4EE491
-.pword 0x051C6B,  0x180407,  0xC76110,  0x859DE9,  0x9B8484,  0x5CE393
-.pword 0x1A126F,  0x1A0404,  0xD56D13,  0x9A92ED,  0x9A8484,  0xDDEF92
-.pword 0x1B1363,  0x050404,  0x47691D,  0x9890E1,  0x858484,  0xCEEB9C
-.pword 0x181164,  0x050404,  0x77151F,  0x9996FA,  0x858784,  0xF3949E
-.pword 0x1E177F,  0x040705,  0x7E171E,  0x9E94F3,  0x848785,  0xFA9699
-.pword 0x1F1574,  0x040705,  0x671118,  0x9CEBCF,  0x848785,  0xE1909B
-.pword 0x1D6944,  0x040405,  0x63131B,  0x92EFDD,  0x84849A,  0xED929A
-.pword 0x126DD5,  0x04041A,  0x6F121A,  0x93E35C,  0x84849B,  0xE99D85
-.pword 0x1061C6,  0x070418,  0x6A1C05,  0x91E449,  0x878498,  0x959F85
-.pword 0x167AF7,  0x070419,  0x141E05,  0x97FF73,  0x87849E,  0x979E84
-.pword 0x1473FE,  0x07051E,  0x161904,  0x95F47A,  0x87859F,  0x919884
-.pword 0x6B4FE7,  0x07051C,  0x101B04,  0xE9C461,  0x84859D,  0x939B84
-.pword 0x6F5DE3,  0x041A12,  0x121A04,  0xED556D,  0x849A92,  0x929A84
-.pword 0x63DCEF,  0x041B13,  0x1D0504,  0xE14769,  0x849890,  0x9C8587
-.pword 0x67CEEB,  0x041811,  0x1F0507,  0xFA7715,  0x849996,  0x9E8587
-.pword 0x7FF394,  0x041E17,  0x1E0407,  0xF37E17,  0x859E94,  0x998487
-.pword 0x77FA96,  0x051F15,  0x180407,  0xCE6711,  0x859CEB,  0x988487
-.pword 0x47E190,  0x051D69,  0x1B0404,  0xDC6313,  0x9A92EF,  0x9A8484
-.pword 0x55ED92,  0x1A126D,  0x1A0404,  0x5D6F12,  0x9B93E3,  0x858484
-.pword 0xC4E99D,  0x181061,  0x050404,  0x4E6B1C,  0x9891E4,  0x858784
-.pword 0xF7959F,  0x19167A,  0x050704,  0x73141E,  0x9E97FE,  0x848784
-.pword 0xFF979E,  0x1E1473,  0x040705,  0x7A1619,  0x9F95F7,  0x848785
-.pword 0xE49198,  0x1C6B4E,  0x040705,  0x611018,  0x9DE9C7,  0x848485
-.pword 0xE3939B,  0x126F5C,  0x04041A,  0x6D131A,  0x92EDD5,  0x84849A
-.pword 0xEF929A,  0x1363DD,  0x04041B,  0x691D05,  0x90E144,  0x848498
-.pword 0xEB9C85,  0x1164CE,  0x070418,  0x151F05,  0x96FA77,  0x878499
-.pword 0x949E85,  0x177FF2,  0x07041E,  0x171E04,  0x94F37E,  0x87859E
-.pword 0x969984,  0x1577FA,  0x07051F,  0x111804,  0xEBCE64,  0x87859C
-.pword 0x909884,  0x6947E1,  0x04051D,  0x131B04,  0xEFDC63,  0x849A92
-.pword 0x929A84,  0x6DD5ED,  0x041A12,  0x121A04,  0xE35D6F,  0x849B93
-.pword 0x9D8584,  0x61C4E9,  0x041810,  0x1C0504,  0xE74F6B,  0x849891
-.pword 0x9F8587,  0x7AF795,  0x041916,  0x1E0507,  0xFE7314,  0x849E97
-.pword 0x9E8487,  0x73FE97,  0x051E14,  0x190407,  0xF77A16,  0x859F95
-.pword 0x988487,  0x4FE791,  0x051C6B,  0x180404,  0xC46110,  0x859DE9
-.pword 0x9B8484,  0x5DE393,  0x1A126F,  0x1A0404,  0x556D12,  0x9A92ED
-.pword 0x9A8484,  0xDCEF9D,  0x1B1363,  0x050404,  0x47691D,  0x9890E1
-.pword 0x858784,  0xCEEB9C,  0x181167,  0x050704,  0x74151F,  0x9996FA
-.pword 0x858784,  0xF3949E,  0x1E177E,  0x050704,  0x7F171E,  0x9E94F3
-.pword 0x848785,  0xFA9699,  0x1F1577,  0x040705,  0x641118,  0x9CEBCE
-.pword 0x848785,  0xE19098,  0x1D6947,  0x040405,  0x63131B,  0x92EFDC
-.pword 0x84849A,  0xED929A,  0x126D55,  0x04041A,  0x6F121A,  0x93E35D
-.pword 0x84849B,  0xE99D85,  0x1061C4,  0x07041B,  0x6B1C05,  0x91E74F
-.pword 0x878498,  0x959F85,  0x167AF7,  0x070419,  0x141E05,  0x97FE73
-.pword 0x87859E,  0x979E84,  0x1473FE,  0x07051E,  0x161904,  0x95F47A
-.pword 0x87859F,  0x919884,  0x6B4FE7,  0x04051C,  0x101804,  0xE9C461
-.pword 0x84859D,  0x939B84,  0x6F5DE3,  0x041A12,  0x121A04,  0xEDD56D
-.pword 0x849A92,  0x929A84,  0x63DDEF,  0x041B13,  0x1D0504,  0xE14469
-.pword 0x849890,  0x9C8584,  0x67CFEB,  0x041811,  0x1F0507,  0xFA7415
-.pword 0x849996,  0x9E8587,  0x7EF394,  0x051E17,  0x1E0507,  0xF37F17
-.pword 0x859E94,  0x998487,  0x77FA96,  0x051F15,  0x180407,  0xCE6711
-.pword 0x859CEB,  0x988487,  0x47E190,  0x051D69,  0x1B0404,  0xDC6313
-.pword 0x9A92EF,  0x9A8484,  0xD5ED92,  0x1A126D,  0x1A0404,  0x5C6F12
-.pword 0x9B93E3,  0x858484,  0xC7E99D,  0x181061,  0x050704,  0x4E6B1C
-.pword 0x9891E4,  0x858784,  0xF7959F,  0x19167A,  0x050704,  0x73141E
-.pword 0x9E97FE,  0x848784,  0xFE979E,  0x1E1473,  0x040705,  0x7A1619
-.pword 0x9F95F7,  0x848785,  0xE49198,  0x1C6B4E,  0x040405,  0x611018
-.pword 0x9DE9C7,  0x848485,  0xE3939B,  0x126F5C,  0x04041A,  0x6D131A
-.pword 0x92EDD5,  0x84849A,  0xEF929A,  0x1363DD,  0x04041B,  0x691D05
-.pword 0x90E144,  0x848498,  0xEB9C85,  0x1164CE,  0x070418,  0x151F05
-.pword 0x96FA77,  0x878499,  0x949E85,  0x177FF3,  0x07051E,  0x171E04
-.pword 0x94F37E,  0x87859E,  0x969984,  0x1574FA,  0x07051F,  0x111804
-.pword 0xEBCE67,  0x84859C,  0x909884,  0x6944E1,  0x04051D,  0x131B04
-.pword 0xEFDD63,  0x849A92,  0x929A84,  0x6DD5ED,  0x041A13,  0x121A04
-.pword 0xE35C6F,  0x849B93,  0x9D8584,  0x61C7E9,  0x041810,  0x1C0504
-.pword 0xE44E6B,  0x849891,  0x9F8587,  0x7AF795,  0x041916,  0x1E0507
-.pword 0xFF7214,  0x849E97,  0x9E8487,  0x73FE97,  0x051E14,  0x190407
-.pword 0xF47A16,  0x859F95,  0x988487,  0x4FE791,  0x051C6B,  0x1B0407
-.pword 0xC46110,  0x859DE9,  0x9B8484,  0x5DE393,  0x1A126F,  0x1A0404
-.pword 0x556D12,  0x9A93ED,  0x9A8484,  0xDCEF92,  0x1B1363,  0x050404
-.pword 0x47691D,  0x9890E1,  0x858484,  0xCEEB9C,  0x181164,  0x050704
-.pword 0x77151F,  0x9996FA,  0x858784,  0xF2949E,  0x1E177F,  0x040705
-.pword 0x7E171E,  0x9E94F3,  0x848785,  0xFA9699,  0x1F1574,  0x040705
-.pword 0x671118,  0x9CEBCF,  0x848485,  0xE19098,  0x1D6944,  0x040405
-.pword 0x63131B,  0x92EFDD,  0x84849A,  0xED929A,  0x126DD5,  0x04041A
-.pword 0x6F1D1A,  0x93E35C,  0x84849B,  0xE99D85,  0x1061C7,  0x070418
-.pword 0x6B1C05,  0x91E74F,  0x878498,  0x959F85,  0x167AF4,  0x070419
-.pword 0x141E05,  0x97FE73,  0x87849E,  0x979E84,  0x1473FF,  0x07051E
-.pword 0x161904,  0x95F77A,  0x87859F,  0x919884,  0x6B4EE4,  0x04051C
-.pword 0x101804,  0xE9C761,  0x84859D,  0x939B84,  0x6F5CE3,  0x041A12
-.pword 0x131A04,  0xEDD56D,  0x849A92,  0x929A84,  0x63DDEF,  0x041B13
-.pword 0x1D0504,  0xE14769,  0x849890,  0x9C8587,  0x67CEEB,  0x041811
-.pword 0x1F0507,  0xFA7715,  0x849996,  0x9E8587,  0x7EF394,  0x041E17
-.pword 0x1E0507,  0xF37F17,  0x859E94,  0x998487,  0x77FA96,  0x051F15
-.pword 0x180407,  0xCE6411,  0x859CEB,  0x988487,  0x47E190,  0x051D69
-.pword 0x1B0404,  0xDC6313,  0x9A92EF,  0x9A8484,  0xD5ED92,  0x1A126D
-.pword 0x1A0404,  0x5C6F12,  0x9B93E3,  0x858484,  0xC7E99D,  0x181061
-.pword 0x050704,  0x4E6B1C,  0x9891E7,  0x858784,  0xF7959F,  0x19167A
-.pword 0x050704,  0x73141E,  0x9E97FE,  0x848784,  0xFE979E,  0x1E1473
-.pword 0x040705,  0x7A1619,  0x9F95F4,  0x848785,  0xE79198,  0x1C6B4F
-.pword 0x040705,  0x611018,  0x9DE9C4,  0x848485,  0xE3939B,  0x126F5D
-.pword 0x04041A,  0x6D121A,  0x92ED55,  0x84849A,  0xEF929A,  0x1363DC
-.pword 0x04041B,  0x691D05,  0x90E147,  0x848498,  0xEB9C85,  0x1164CE
-.pword 0x070418,  0x151F05,  0x96FA77,  0x878499,  0x949E85,  0x177EF3
-.pword 0x07041E,  0x171E04,  0x94F37F,  0x87859E,  0x969984,  0x1577FA
-.pword 0x07051F,  0x111804,  0xEBCE64,  0x84859C,  0x909884,  0x6947E1
-.pword 0x04051D,  0x131B04,  0xEFDC63,  0x849A92,  0x939A84,  0x6D55ED
-.pword 0x041A13,  0x121A04,  0xE35C6F,  0x849B93,  0x9D8584,  0x61C7E9
-.pword 0x041810,  0x1C0504,  0xE74E6B,  0x849891,  0x9F8587,  0x7AF795
-.pword 0x041916,  0x1E0507,  0xFF7314,  0x859E97,  0x9E8587,  0x73FE97
-.pword 0x051E14,  0x190407,  0xF47A16,  0x859F95,  0x988487,  0x4FE791
-.pword 0x051C6B,  0x180407,  0xC76110,  0x859DE9,  0x9B8484,  0x5CE393
-.pword 0x1A126F,  0x1A0404,  0xD56D13,  0x9A93ED,  0x9A8484,  0xDCEF92
-.pword 0x1B1363,  0x050404,  0x46691D,  0x9890E6,  0x858784,  0xC9EA9C
-.pword 0x181164,  0x050704,  0x77151F,  0x9996FA,  0x858784,  0xF3949E
-.pword 0x1E177F,  0x040704,  0x7E171E,  0x9E94F3,  0x848785,  0xFA9699
-.pword 0x1F1574,  0x040705,  0x671118,  0x9CEBCE,  0x848785,  0xE1909B
-.pword 0x1D6944,  0x040405,  0x63131B,  0x92EFDC,  0x84849A,  0xED929A
-.pword 0x126D55,  0x04041A,  0x6F121A,  0x93E35C,  0x84849B,  0xE99D85
-.pword 0x1061C7,  0x040418,  0x6B1C05,  0x91E44E,  0x878498,  0x959F85
-.pword 0x167AF7,  0x070419,  0x141E05,  0x97FF73,  0x87849E,  0x979E84
-.pword 0x1473FE,  0x07051E,  0x161904,  0x95F47A,  0x87859F,  0x919884
-.pword 0x6B4FE7,  0x04051C,  0x101804,  0xE9C461,  0x84859D,  0x939B84
-.pword 0x6F5CE3,  0x041A12,  0x121A04,  0xEDD56D,  0x849A92,  0x929A84
-.pword 0x63DDEF,  0x041B13,  0x1D0504,  0xE14469,  0x849890,  0x9C8584
-.pword 0x67CFEB,  0x041811,  0x1F0507,  0xFA7415,  0x849996,  0x9E8587
-.pword 0x7EF394,  0x051E17,  0x1E0507,  0xF37E17,  0x859E94,  0x998487
-.pword 0x77FA96,  0x051F15,  0x180404,  0xCF6411,  0x859CEB,  0x988484
-.pword 0x44E190,  0x051D69,  0x1B0404,  0xDD6313,  0x9A92EF,  0x9A8484
-.pword 0xD5ED92,  0x1A126D,  0x1A0404,  0x5C6F12,  0x9B93E3,  0x858484
-.pword 0xC7E99D,  0x181061,  0x050704,  0x4E6B1C,  0x9891E4,  0x858784
-.pword 0xF7959F,  0x19167A,  0x050704,  0x73141E,  0x9E97FE,  0x848784
-.pword 0xFF979E,  0x1E1473,  0x040705,  0x7A1619,  0x9F95F7,  0x848485
-.pword 0xE79198,  0x1C6B4F,  0x040405,  0x611018,  0x9DE9C4,  0x848485
-.pword 0xE3939B,  0x126F5D,  0x04041A,  0x6D121A,  0x92ED55,  0x84849A
-.pword 0xEF929A,  0x1363DD,  0x04041B,  0x691D05,  0x90E144,  0x878498
-.pword 0xEB9C85,  0x1167CF,  0x070418,  0x151F05,  0x96FA77,  0x878499
-.pword 0x949E85,  0x177EF3,  0x07041E,  0x171E04,  0x94F37E,  0x87859E
-.pword 0x969984,  0x1577FA,  0x07051F,  0x111804,  0xEBCE67,  0x87859C
-.pword 0x909884,  0x6944E1,  0x04051D,  0x131B04,  0xEFDD63,  0x849A92
-.pword 0x929A84,  0x6DD4ED,  0x041A13,  0x1D1A04,  0xE35F6F,  0x849B93
-.pword 0x9D8584,  0x61C6E8,  0x041810,  0x1C0507,  0xE44E6A,  0x849891
-.pword 0x9F8587,  0x7AF795,  0x041916,  0x1E0507,  0xFF7314,  0x849E97
-.pword 0x9E8487,  0x73FE97,  0x051E14,  0x190407,  0xF47A16,  0x859F95
-.pword 0x988487,  0x4FE791,  0x051C6B,  0x180404,  0xC46110,  0x859DE9
-.pword 0x9B8484,  0x5DE393,  0x1A126F,  0x1A0404,  0x556D12,  0x9A93ED
-.pword 0x9A8484,  0xDCEF92,  0x1B1363,  0x050404,  0x47691D,  0x9890E1
-.pword 0x858484,  0xCEEB9C,  0x181164,  0x050704,  0x77151F,  0x9996FA
-.pword 0x858784,  0xF2949E,  0x1E177F,  0x040705,  0x7E171E,  0x9E94F3
-.pword 0x848785,  0xFA9699,  0x1F1574,  0x040705,  0x671118,  0x9CEBCF
-.pword 0x848785,  0xE1909B,  0x1D6944,  0x040405,  0x63131B,  0x92EFDD
-.pword 0x84849A,  0xED929A,  0x126DD5,  0x04041A,  0x6F1D1A,  0x93E35C
-.pword 0x87849B,  0xE99D85,  0x1061C7,  0x07041B,  0x6B1C05,  0x91E74F
-.pword 0x878498,  0x959F85,  0x167AF4,  0x070419,  0x141E05,  0x97FE73
-.pword 0x87849E,  0x979E85,  0x1473FF,  0x07051E,  0x161904,  0x95F77A
-.pword 0x87859F,  0x919884,  0x6B4EE7,  0x07051C,  0x101804,  0xE9C461
-.pword 0x84859D,  0x939B84,  0x6F5CE3,  0x041A12,  0x121A04,  0xEDD56D
-.pword 0x849A92,  0x929A84,  0x63DDEF,  0x041B13,  0x1D0504,  0xE14769
-.pword 0x849890,  0x9C8587,  0x64CEEB,  0x041811,  0x1F0507,  0xFA7715
-.pword 0x849996,  0x9E8587,  0x7EF394,  0x041E17,  0x1E0407,  0xF37E17
-.pword 0x859E94,  0x998487,  0x77FA96,  0x051F15,  0x180407,  0xCF6711
-.pword 0x859CEB,  0x9B8487,  0x44E190,  0x051D69,  0x1B0407,  0xDC6313
-.pword 0x9A92EF,  0x9A8484,  0xD5ED92,  0x1A126D,  0x1A0404,  0x5C6F12
-.pword 0x9B93E3,  0x858484,  0xC7E99D,  0x181061,  0x050704,  0x4E6B1C
-.pword 0x9891E4,  0x858784,  0xF7959F,  0x19167A,  0x050704,  0x73141E
-.pword 0x9E97FE,  0x848784,  0xFE979E,  0x1E1473,  0x040705,  0x7A1619
-.pword 0x9F95F7,  0x848785,  0xE79198,  0x1C6B4F,  0x040705,  0x611018
-.pword 0x9DE9C4,  0x848485,  0xE3939B,  0x126F5D,  0x04041A,  0x6D121A
-.pword 0x92ED55,  0x84849A,  0xEF929A,  0x1363DC,  0x04041B,  0x691D05
-.pword 0x90E147,  0x848498,  0xEB9C85,  0x1164CE,  0x070418,  0x151F05
-.pword 0x96FA77,  0x878499,  0x949E85,  0x177FF2,  0x07051E,  0x171E04
-.pword 0x94F37E,  0x87859E,  0x969984,  0x1574FA,  0x07051F,  0x111804
-.pword 0xEBCE64,  0x84859C,  0x909884,  0x6944E1,  0x04051D,  0x131B04
-.pword 0xEFDD63,  0x849A92,  0x929A84,  0x6DD5ED,  0x041A12,  0x121A04
-.pword 0xE35D6F,  0x849B93,  0x9D8584,  0x61C4E9,  0x041810,  0x1C0504
-.pword 0xE74F6B,  0x849891,  0x9F8587,  0x7AF795,  0x041916,  0x1E0507
-.pword 0xFE7314,  0x849E97,  0x9E8487,  0x72FF97,  0x051E14,  0x190407
-.pword 0xF77A16,  0x859F95,  0x988487,  0x49E491,  0x051C6A,  0x180404
-.pword 0xC76610,  0x859DE9,  0x9B8484,  0x5CE393,  0x1A126F,  0x1A0404
-.pword 0xD56D13,  0x9A92ED,  0x9A8484,  0xDDEF92,  0x1B1363,  0x050404
-.pword 0x44691D,  0x9890E1,  0x858484,  0xCFEB9C,  0x181167,  0x050704
-.pword 0x77151F,  0x9996FA,  0x858784,  0xF3949E,  0x1E177F,  0x040704
-.pword 0x7E171E,  0x9E94F3,  0x848785,  0xFA9699,  0x1F1574,  0x040705
-.pword 0x671118,  0x9CEBCE,  0x848785,  0xE19098,  0x1D6947,  0x040405
-.pword 0x63131B,  0x92EFDC,  0x84849A,  0xED929A,  0x126D55,  0x04041A
-.pword 0x6F121A,  0x93E35C,  0x84849B,  0xE99D85,  0x1061C7,  0x040418
-.pword 0x6B1C05,  0x91E74E,  0x878498,  0x959F85,  0x167AF4,  0x070419
-.pword 0x141E05,  0x97FE73,  0x87859E,  0x979E85,  0x1473FE,  0x07051E
-.pword 0x161904,  0x95F47A,  0x87859F,  0x919884,  0x6B4FE7,  0x04051C
-.pword 0x101804,  0xE9C761,  0x84859D,  0x939B84,  0x6F5CE3,  0x041A12
-.pword 0x131A04,  0xEDD56D,  0x849A92,  0x929A84,  0x63DDEF,  0x041B13
-.pword 0x1D0504,  0xE14469,  0x849890,  0x9C8587,  0x67CEEB,  0x041811
-.pword 0x1F0507,  0xFA7715,  0x849996,  0x9E8587,  0x7EF394,  0x051E17
-.pword 0x1E0507,  0xF37E17,  0x859E94,  0x998487,  0x74FA96,  0x051F15
-.pword 0x180407,  0xCF6711,  0x859CEB,  0x988484,  0x44E190,  0x051D69
-.pword 0x1B0404,  0xDD6313,  0x9A92EF,  0x9A8484,  0xD5ED92,  0x1A136D
-.pword 0x1A0404,  0x5C6F12,  0x9B93E3,  0x858484,  0xC7E99D,  0x181061
-.pword 0x050404,  0x4E6B1C,  0x9891E4,  0x858784,  0xF7959F,  0x19167A
-.pword 0x050704,  0x73141E,  0x9E97FF,  0x848785,  0xFE979E,  0x1E1473
-.pword 0x040705,  0x7A1619,  0x9F95F7,  0x848785,  0xE49198,  0x1C6B4E
-.pword 0x040405,  0x611018,  0x9DE9C7,  0x848485,  0xE3939B,  0x126F5C
-.pword 0x04041A,  0x6D121A,  0x92EDD5,  0x84849A,  0xEF929A,  0x1363DD
-.pword 0x04041B,  0x691D05,  0x90E147,  0x848498,  0xEB9C85,  0x1164CE
-.pword 0x070418,  0x151F05,  0x96FA77,  0x878499,  0x949E85,  0x177FF3
-.pword 0x07051E,  0x171E04,  0x94F37E,  0x87859E,  0x969984,  0x1574FA
-.pword 0x07051F,  0x111804,  0xEBCF67,  0x87859C,  0x909B84,  0x6944E1
-.pword 0x04051D,  0x131B04,  0xEFDD63,  0x849A92,  0x929A84,  0x6DD5ED
-.pword 0x041A12,  0x121A04,  0xE35C6F,  0x849B93,  0x9D8584,  0x61C7E9
-.pword 0x041810,  0x1C0507,  0xE44E6B,  0x849891,  0x9F8587,  0x7AF795
-.pword 0x041916,  0x1E0507,  0xFE7314,  0x849E97,  0x9E8487,  0x73FE97
-.pword 0x051E14,  0x190407,  0xF77A16,  0x859F95,  0x988487,  0x4EE491
-.pword 0x051C6B,  0x180404,  0xC76110,  0x859DE9,  0x9B8484,  0x5CE393
-.pword 0x1A126F,  0x1A0404,  0xD56D13,  0x9A92ED,  0x9A8484,  0xDCEF92
-.pword 0x1B1363,  0x050404,  0x47691D,  0x9890E1,  0x858784,  0xCEEB9C
-.pword 0x181164,  0x050704,  0x77151F,  0x9996FA,  0x858784,  0xF3949E
-.pword 0x1E177E,  0x040704,  0x7E171E,  0x9E94F3,  0x848785,  0xFA9699
-.pword 0x1F1577,  0x040705,  0x641118,  0x9CEBCE,  0x848485,  0xE19098
-.pword 0x1D6947,  0x040405,  0x63131B,  0x92EFDC,  0x84849A,  0xED929A
-.pword 0x126DD5,  0x04041A,  0x6F121A,  0x93E35C,  0x84849B,  0xE99D85
-.pword 0x1061C7,  0x070418,  0x6B1C05,  0x91E74E,  0x878498,  0x959F85
-.pword 0x167AF4,  0x070419,  0x141E05,  0x97FE73,  0x87849E,  0x979E84
-.pword 0x1473FE,  0x07051E,  0x161904,  0x95F77A,  0x87859F,  0x919884
-.pword 0x6B4EE4,  0x07051C,  0x101804,  0xE9C761,  0x84859D,  0x939B84
-.pword 0x6F5CE3,  0x041A12,  0x121A04,  0xED556D,  0x849A92,  0x929A84
-.pword 0x63DCEF,  0x041B13,  0x1D0504,  0xE14769,  0x849890,  0x9C8587
-.pword 0x67CEEB,  0x041811,  0x1F0507,  0xFA7715,  0x849996,  0x9E8587
-.pword 0x7EF394,  0x041E17,  0x1E0407,  0xF37E17,  0x859E94,  0x998487
-.pword 0x77FA96,  0x051F15,  0x180407,  0xCE6411,  0x859CEB,  0x988484
-.pword 0x47E190,  0x051D69,  0x1B0404,  0xDC6313,  0x9A92EF,  0x9A8484
-.pword 0x55ED92,  0x1A126D,  0x1A0404,  0x5D6F12,  0x9B93E3,  0x858484
-.pword 0xC4E99D,  0x181061,  0x050404,  0x4F6B1C,  0x9891E7,  0x858784
-.pword 0xF4959F,  0x19167A,  0x050704,  0x73141E,  0x9E97FF,  0x858785
-.pword 0xFE979E,  0x1F1473,  0x040705,  0x7A1619,  0x9F95F4,  0x848785
-.pword 0xE79198,  0x1C6B4F,  0x040405,  0x611018,  0x9DE9C7,  0x848485
-.pword 0xE3939B,  0x126F5C,  0x04041A,  0x6D121A,  0x92EDD5,  0x84849A
-.pword 0xEF929A,  0x1363DD,  0x04041B,  0x691D05,  0x90E144,  0x878498
-.pword 0xEB9C85,  0x1167CF,  0x070418,  0x151F05,  0x96FA74,  0x878499
-.pword 0x949E85,  0x177EF3,  0x07041E,  0x171E05,  0x94F27F,  0x87859E
-.pword 0x969984,  0x1577FA,  0x04051F,  0x111804,  0xEBCE64,  0x84859C
-.pword 0x909884,  0x6947E1,  0x04051D,  0x131B04,  0xEFDC63,  0x849A92
-.pword 0x929A84,  0x6DD5ED,  0x041A12,  0x121A04,  0xE35C6F,  0x849B93
-.pword 0x9D8584,  0x61C7E9,  0x041810,  0x1C0507,  0xE44E6B,  0x849891
-.pword 0x9F8587,  0x7AF795,  0x041916,  0x1E0507,  0xFE7314,  0x849E97
-.pword 0x9E8487,  0x73FE97,  0x051E14,  0x190407,  0xF77A16,  0x859F95
-.pword 0x988487,  0x4EE491,  0x051C6B,  0x180407,  0xC76110,  0x859DE9
-.pword 0x9B8484,  0x5CE393,  0x1A126F,  0x1A0404,  0xD56D13,  0x9A92ED
-.pword 0x9A8484,  0xDDEF92,  0x1B1363,  0x050404,  0x44691D,  0x9890E1
-.pword 0x858484,  0xCFEB9C,  0x181167,  0x050704,  0x74151F,  0x9996FA
-.pword 0x858784,  0xF3949E,  0x1E177E,  0x050705,  0x7F171E,  0x9E94F3
-.pword 0x848785,  0xFA9699,  0x1F1577,  0x040705,  0x641118,  0x9CEBCE
-.pword 0x848785,  0xE19098,  0x1D6947,  0x040405,  0x63131B,  0x92EFDC
-.pword 0x84849A,  0xED929A,  0x126D55,  0x04041A,  0x6F121A,  0x93E35C
-.pword 0x84849B,  0xE99D85,  0x1061C7,  0x040418,  0x6B1C05,  0x91E44E
-.pword 0x878498,  0x959F85,  0x167AF7,  0x070419,  0x141E05,  0x97FF73
-.pword 0x87859E,  0x979E84,  0x1473FE,  0x07051E,  0x161904,  0x95F47A
-.pword 0x87859F,  0x919884,  0x6B4FE7,  0x07051C,  0x101804,  0xE9C461
-.pword 0x84859D,  0x939B84,  0x6F5DE3,  0x041A12,  0x121A04,  0xEDD56D
-.pword 0x849A92,  0x929A84,  0x63DCEF,  0x041B13,  0x1D0504,  0xE14769
-.pword 0x849890,  0x9C8584,  0x64CEEB,  0x041811,  0x1F0507,  0xFA7715
-.pword 0x849996,  0x9E8587,  0x7FF394,  0x041E17,  0x1E0407,  0xF37E17
-.pword 0x859E94,  0x998487,  0x74FA96,  0x051F15,  0x180407,  0xCF6711
-.pword 0x859CEB,  0x988484,  0x44E190,  0x051D69,  0x1B0404,  0xDD6313
-.pword 0x9A92EF,  0x9A8484,  0xD5ED92,  0x1A126D,  0x1A0404,  0x5D6F12
-.pword 0x9B93E3,  0x858484,  0xC4E99D,  0x181061,  0x050404,  0x4E6B1C
-.pword 0x9891E7,  0x858784,  0xF7959F,  0x19167A,  0x050704,  0x73141E
-.pword 0x9E97FE,  0x848784,  0xFE979E,  0x1E1473,  0x040705,  0x7A1619
-.pword 0x9F95F7,  0x848785,  0xE79198,  0x1C6B4E,  0x040405,  0x611018
-.pword 0x9DE9C4,  0x848485,  0xE3939B,  0x126F5D,  0x04041A,  0x6D121A
-.pword 0x92ED55,  0x84849A,  0xEF929A,  0x1363DC,  0x04041B,  0x691D05
-.pword 0x90E147,  0x878498,  0xEB9C85,  0x1164CE,  0x070418,  0x151F05
-.pword 0x96FA77,  0x878499,  0x949E85,  0x177EF3,  0x07041E,  0x171E04
-.pword 0x94F37F,  0x87859E,  0x969984,  0x1577FA,  0x07051F,  0x111804
-.pword 0xEBC964,  0x84859C,  0x909884,  0x6947E6,  0x04051D,  0x131B04
-.pword 0xEFDC63,  0x849A92,  0x939A84,  0x6D55ED,  0x041A12,  0x121A04
-.pword 0xE35D6F,  0x849B93,  0x9D8584,  0x61C7E9,  0x041810,  0x1C0504
-.pword 0xE44E6B,  0x849891,  0x9F8587,  0x7AF795,  0x041916,  0x1E0507
-.pword 0xFE7314,  0x849E97,  0x9E8487,  0x73FF97,  0x051E14,  0x190407
-.pword 0xF77A16,  0x859F95,  0x988487,  0x4EE491,  0x051C6B,  0x180404
-.pword 0xC76110,  0x859DE9,  0x9B8484,  0x5DE393,  0x1A126F,  0x1A0404
-.pword 0x556D12,  0x9A92ED,  0x9A8484,  0xDCEF9D,  0x1B1363,  0x050404
-.pword 0x47691D,  0x9890E1,  0x858784,  0xCEEB9C,  0x181164,  0x050704
-.pword 0x77151F,  0x9996FA,  0x858784,  0xF2949E,  0x1E177F,  0x040704
-.pword 0x7E1719,  0x9E94F3,  0x848785,  0xFA9699,  0x1F1577,  0x040705
-.pword 0x671118,  0x9CEBCE,  0x848785,  0xE19098,  0x1D6944,  0x040405
-.pword 0x63131B,  0x92EFDD,  0x84849A,  0xED929A,  0x136DD4,  0x04041A
-.pword 0x6F1D1A,  0x93E35F,  0x84849B,  0xE89D85,  0x1066C6,  0x070418
-.pword 0x6A1C05,  0x91E449,  0x878498,  0x959F85,  0x167AF7,  0x070419
-.pword 0x141E05,  0x97FF72,  0x87849E,  0x979E84,  0x1473FE,  0x07051E
-.pword 0x161904,  0x95F47A,  0x87859F,  0x919884,  0x6B4EE7,  0x07051C
-.pword 0x101804,  0xE9C761,  0x84859D,  0x939B84,  0x6F5CE3,  0x041A1D
-.pword 0x121A04,  0xEDD56D,  0x849A92,  0x929A84,  0x63DDEF,  0x041B13
-.pword 0x1D0504,  0xE14469,  0x849890,  0x9C8587,  0x67CFEB,  0x041811
-.pword 0x1F0507,  0xFA7415,  0x849996,  0x9E8587,  0x7EF394,  0x051E17
-.pword 0x1E0407,  0xF37E17,  0x859E94,  0x998487,  0x77FA96,  0x051F15
-.pword 0x180407,  0xCE6711,  0x859CEB,  0x988487,  0x44E190,  0x051D69
-.pword 0x1B0404,  0xDD6313,  0x9A92EF,  0x9A8484,  0xD5ED92,  0x1A126D
-.pword 0x1A0404,  0x5C6F12,  0x9B93E3,  0x858484,  0xC7E99D,  0x181061
-.pword 0x050404,  0x4E6B1C,  0x9891E4,  0x858784,  0xF7959F,  0x19167A
-.pword 0x050704,  0x72141E,  0x9E97FF,  0x848784,  0xFE979E,  0x1E1473
-.pword 0x040705,  0x651619,  0x9F95F4,  0x848785,  0xE79198,  0x1C6B4F
-.pword 0x040705,  0x61101B,  0x9DE9C4,  0x848485,  0xE3939B,  0x126F5D
-.pword 0x04041A,  0x6D121A,  0x92ED55,  0x84849A,  0xEF929A,  0x1363DC
-.pword 0x04041B,  0x691D05,  0x90E147,  0x878498,  0xEB9C85,  0x1164CE
-.pword 0x070418,  0x151F05,  0x96FA77,  0x878499,  0x949E85,  0x177FF3
-.pword 0x07051E,  0x171E05,  0x94F37E,  0x87859E,  0x969984,  0x1574FA
-.pword 0x07051F,  0x111804,  0xEBCF67,  0x87859C,  0x909884,  0x6944E1
-.pword 0x04051D,  0x131B04,  0xEFDD63,  0x849A92,  0x929A84,  0x6D55ED
-.pword 0x041A12,  0x121A04,  0xE35D6F,  0x849B93,  0x9D8584,  0x61C7E9
-.pword 0x041810,  0x1C0504,  0xE44E6B,  0x849891,  0x9F8587,  0x7AF795
-.pword 0x041916,  0x1E0507,  0xFE7314,  0x849E97,  0x9E8487,  0x73FE97
-.pword 0x051E14,  0x190407,  0xF77A16,  0x859F95,  0x988487,  0x4EE791
-.pword 0x051C6B,  0x180407,  0xC76110,  0x859DE9,  0x9B8484,  0x5CE393
-.pword 0x1A126F,  0x1A0404,  0xD56D13,  0x9A92ED,  0x9A8484,  0xDDEF92
-.pword 0x1B1363,  0x050404,  0x47691D,  0x9890E1,  0x858484,  0xCEEB9C
-.pword 0x181164,  0x050704,  0x77151F,  0x9996FA,  0x858784,  0xF3949E
-.pword 0x1E177F,  0x040704,  0x7E171E,  0x9E94F3,  0x848785,  0xFA9699
-.pword 0x1F1574,  0x040705,  0x671118,  0x9CEBCF,  0x848785,  0xE19098
-.pword 0x1D6944,  0x040405,  0x63131B,  0x92EFDC,  0x84849A,  0xED929A
-.pword 0x126D55,  0x04041A,  0x6F121A,  0x93E35D,  0x84849B,  0xE99D85
-.pword 0x1061C4,  0x040418,  0x6B1C05,  0x91E74F,  0x878498,  0x959F85
-.pword 0x167AF7,  0x070419,  0x141E05,  0x97FE73,  0x87849E,  0x979E84
-.pword 0x1473FE,  0x07051E,  0x161904,  0x95F77A,  0x87859F,  0x919884
-.pword 0x6B4EE4,  0x04051C,  0x101804,  0xE9C761,  0x84859D,  0x939B84
-.pword 0x6F5DE3,  0x041A12,  0x121A04,  0xED556D,  0x849A92,  0x929A84
-.pword 0x63DDEF,  0x041B13,  0x1D0504,  0xE14469,  0x849890,  0x9C8587
-.pword 0x67CFEB,  0x041811,  0x1F0507,  0xFA7715,  0x849996,  0x9E8587
-.pword 0x7FF394,  0x041E17,  0x1E0407,  0xF37E17,  0x859E94,  0x998487
-.pword 0x74FA96,  0x051F15,  0x180407,  0xCF6711,  0x859CEB,  0x988487
-.pword 0x44E190,  0x051D69,  0x1B0404,  0xDD6313,  0x9A92EF,  0x9A8484
-.pword 0xD4ED92,  0x1A126D,  0x1A0404,  0x5F6F1D,  0x9B93E3,  0x858484
-.pword 0xC7E99D,  0x181061,  0x050704,  0x4E6B1C,  0x9891E7,  0x858784
-.pword 0xF7959F,  0x19167A,  0x050704,  0x73141E,  0x9E97FE,  0x848784
-.pword 0xFE979E,  0x1E1473,  0x040705,  0x7A1619,  0x9F95F7,  0x848785
-.pword 0xE79198,  0x1C6B4F,  0x040405,  0x611018,  0x9DE9C4,  0x848485
-.pword 0xE3939B,  0x126F5D,  0x04041A,  0x6D121A,  0x92EDD5,  0x84849A
-.pword 0xEF929A,  0x1363DC,  0x04041B,  0x691D05,  0x90E147,  0x848498
-.pword 0xEB9C85,  0x1164CE,  0x070418,  0x151F05,  0x96FA77,  0x878499
-.pword 0x949E85,  0x177EF3,  0x07041E,  0x171E05,  0x94F37F,  0x87859E
-.pword 0x969984,  0x1577FA,  0x07051F,  0x111804,  0xEBCE64,  0x84859C
-.pword 0x909884,  0x6947E1,  0x04051D,  0x131B04,  0xEFDC63,  0x849A92
-.pword 0x929A84,  0x6DD5ED,  0x041A12,  0x121A04,  0xE35C6F,  0x849B93
-.pword 0x9D8584,  0x61C7E9,  0x041810,  0x1C0507,  0xE74F6B,  0x849891
-.pword 0x9F8587,  0x7AF495,  0x041916,  0x1E0507,  0xFE7314,  0x849E97
-.pword 0x9E8587,  0x73FE97,  0x051E14,  0x190407,  0xF77A16,  0x859F95
-.pword 0x988487,  0x4EE491,  0x051C6B,  0x180404,  0xC76110,  0x859DE9
-.pword 0x9B8484,  0x5CE393,  0x1A126F,  0x1A0404,  0x556D12,  0x9A93ED
-.pword 0x9A8484,  0xDCEF92,  0x1B1363,  0x050404,  0x46691D,  0x9890E6
-.pword 0x858784,  0xC9EA9C,  0x181164,  0x050704,  0x77151F,  0x9996FA
-.pword 0x858784,  0xF3949E,  0x1E177E,  0x040704,  0x7E171E,  0x9E94F3
-.pword 0x848785,  0xFA9699,  0x1F1577,  0x040705,  0x671118,  0x9CEBCE
-.pword 0x848785,  0xE19098,  0x1D6947,  0x040405,  0x63131B,  0x92EFDC
-.pword 0x84849A,  0xED939A,  0x136D55,  0x04041A,  0x6F121A,  0x93E35C
-.pword 0x84849B,  0xE99D85,  0x1061C7,  0x040418,  0x6B1C05,  0x91E44E
-.pword 0x878498,  0x959F85,  0x167AF7,  0x070419,  0x141E05,  0x97FF73
-.pword 0x87859E,  0x979E85,  0x1473FE,  0x07051E,  0x161904,  0x95F77A
-.pword 0x87859F,  0x919884,  0x6B4EE7,  0x07051C,  0x101804,  0xE9C761
-.pword 0x84859D,  0x939B84,  0x6F5DE3,  0x041A12,  0x121A04,  0xEDD56D
-.pword 0x849A92,  0x929A84,  0x63DDEF,  0x041B13,  0x1D0504,  0xE14769
-.pword 0x849890,  0x9C8587,  0x67CEEB,  0x041811,  0x1F0507,  0xFA7715
-.pword 0x849996,  0x9E8587,  0x7FF394,  0x041E17,  0x1E0407,  0xF37E17
-.pword 0x859E94,  0x998487,  0x74FA96,  0x051F15,  0x180407,  0xCF6711
-.pword 0x859CEB,  0x988487,  0x44E190,  0x051D69,  0x1B0404,  0xDD6313
-.pword 0x9A92EF,  0x9A8484,  0xD5ED92,  0x1A126D,  0x1A0404,  0x5C6F12
-.pword 0x9B93E3,  0x858484,  0xC7E99D,  0x181061,  0x050704,  0x4E6B1C
-.pword 0x9891E4,  0x858784,  0xF7959F,  0x19167A,  0x050704,  0x73141E
-.pword 0x9E97FF,  0x848785,  0xFE979E,  0x1E1473,  0x040705,  0x651619
-.pword 0x9F95F4,  0x848785,  0xE79198,  0x1C6B4F,  0x040705,  0x611018
-.pword 0x9DE9C4,  0x848485,  0xE3939B,  0x126F5D,  0x04041A,  0x6D121A
-.pword 0x93ED55,  0x84849A,  0xEF929A,  0x1363DC,  0x04041B,  0x691D05
-.pword 0x90E147,  0x848498,  0xEB9C85,  0x1164CE,  0x070418,  0x151F05
-.pword 0x96FA77,  0x878499,  0x949E85,  0x177EF3,  0x07051E,  0x171E05
-.pword 0x94F37E,  0x87859E,  0x969984,  0x1577FA,  0x07051F,  0x111804
-.pword 0xEBCE64,  0x84859C,  0x909884,  0x6947E1,  0x04051D,  0x131B04
-.pword 0xEFDC63,  0x849A92,  0x929A84,  0x6DD5ED,  0x041A12,  0x121A04
-.pword 0xE35C6F,  0x849B93,  0x9D8584,  0x61C7E9,  0x041B10,  0x1C0507
-.pword 0xE74F6B,  0x849891,  0x9F8587,  0x65F495,  0x041916,  0x1E0507
-.pword 0xFE7314,  0x849E97,  0x9E8487,  0x73FF97,  0x051E14,  0x190407
-.pword 0xF77A16,  0x859F95,  0x988487,  0x4EE491,  0x051C6B,  0x180407
-.pword 0xC76110,  0x859DE9,  0x9B8484,  0x5CE393,  0x1A126F,  0x1A0404
-.pword 0x556D12,  0x9A93ED,  0x9A8484,  0xDCEF92,  0x1B1363,  0x050404
-.pword 0x46691D,  0x9890E6,  0x858784,  0xC9EA9C,  0x181164,  0x050704
-.pword 0x77151F,  0x9996FA,  0x858784,  0xF3949E,  0x1E177F,  0x040704
-.pword 0x7E171E,  0x9E94F3,  0x848785,  0xFA9699,  0x1F1574,  0x040705
-.pword 0x671118,  0x9CEBCF,  0x848485,  0xE19098,  0x1D6944,  0x040405
-.pword 0x63131B,  0x92EFDD,  0x84849A,  0xED929A,  0x126DD5,  0x04041A
-.pword 0x6F121A,  0x93E35C,  0x84849B,  0xE99D85,  0x1066C7,  0x070418
-.pword 0x6A1C05,  0x91E449,  0x878498,  0x959F85,  0x167AF7,  0x070419
-.pword 0x141E05,  0x97FE73,  0x87849E,  0x979E84,  0x1473FE,  0x07051E
-.pword 0x161904,  0x95F77A,  0x87859F,  0x919884,  0x6B4EE4,  0x04051C
-.pword 0x101804,  0xE9C761,  0x84859D,  0x939B84,  0x6F5CE3,  0x041A12
-.pword 0x121A04,  0xEDD56D,  0x849A92,  0x929A84,  0x63DCEF,  0x041B13
-.pword 0x1D0504,  0xE14769,  0x849890,  0x9C8584,  0x64CEEB,  0x041811
-.pword 0x1F0507,  0xFA7415,  0x849996,  0x9F8587,  0xE3F194,  0x126F5C
-.pword 0x04041A,  0x6D121A,  0x93ED55,  0x84849A,  0xEF929A,  0x1363DC
-.pword 0x04041B,  0x691D05,  0x90E646,  0x878498,  0xEA9C85,  0x1164C9
-.pword 0x070418,  0x151F05,  0x96FA77,  0x878499,  0x949E85,  0x177FF3
-.pword 0x07041E,  0x171E04,  0x94F37E,  0x87859E,  0x969984,  0x1574FA
-.pword 0x07051F,  0x111804,  0xEBCF67,  0x84859C,  0x909884,  0x6944E1
-.pword 0x04051D,  0x131B04,  0xEFDD63,  0x849A92,  0x929A84,  0x6DD5ED
-.pword 0x041A12,  0x121A04,  0xE35C6F,  0x849B93,  0x9D8584,  0x66C7E9
-.pword 0x041810,  0x1C0507,  0xE4496A,  0x849891,  0x9F8587,  0x7AF795
-.pword 0x041916,  0x1E0507,  0xFE7314,  0x849E97,  0x9E8487,  0x73FE97
-.pword 0x051E14,  0x190407,  0xF77A16,  0x859F95,  0x988487,  0x4EE491
-.pword 0x001C6B        
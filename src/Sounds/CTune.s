@@ -1,497 +0,0 @@
-/******************************************************************************
-*  Speech.s developed by AccelWork Inc. for Microchip Technology Inc. 
-*  Copyright (c) 2005 by Microchip. All rights are reserved. 
-*  
-*  This Copyright notice may not be removed or modified without prior written 
-*  consent of Microchip Technology Inc. 
-******************************************************************************/
-
-/******************************************************************************
-*  Speech.s
-*
-*  Description:
-*    This file is generated by dsPIC33F Speech Encoder Utility Version 1.00
-*    It contains the ALAW compressed data for a 8kHz,16-bit speech signal.The
-*    output array represents a 64kbps encoded bit stream.
-*
-*    Speech Encoder Utility settings:
-*       Input Source:  Ctune.wav
-*       Output Array:  G711_ctune
-*       Array Size:    8193 bytes                
-*       Target Memory: Program Memory
-*       LAW:           ALAW
-*
-*    Modification History:
-*
-*       Date           Author              Description
-*       ----           ------              -----------
-*
-*    Dec-16-2005    Taruna Singh		   Created
-*    Dec-20-2005    Taruna Singh		   Ready for Alpha Release
-*
-******************************************************************************/
-
-/* There are 2731 elements in the data array. */
-   
-/* Data file for storing 24-bit constants in program memory */
-
-.global _G711_ctune
-
-.section .G711, code
-_G711_ctune:
-.pword 0x859FE7,  0x928587,  0x1449E0,  0x040419,  0x72161B,  0x9A93E4
-.pword 0x9F8484,  0x6ED3EB,  0x07051C,  0x611205,  0x9897F7,  0x988484
-.pword 0x66F197,  0x070513,  0x691F04,  0x9FE8D4,  0x858784,  0x70E793
-.pword 0x041816,  0x171804,  0x92E075,  0x858785,  0x5CEF9C,  0x041E6A
-.pword 0x101A07,  0x91FC65,  0x84849B,  0xCD9499,  0x051D62,  0x1D0507
-.pword 0x95C76D,  0x848499,  0xF8919A,  0x1A107B,  0x1E0407,  0xEC5A15
-.pword 0x87859C,  0xE39D85,  0x19144F,  0x1B0404,  0xE47D16,  0x879A90
-.pword 0xEB9E84,  0x1C6EDD,  0x050705,  0xF46112,  0x849897,  0x969884
-.pword 0x1367F0,  0x04071A,  0x54681F,  0x849FE9,  0x938587,  0x1671E6
-.pword 0x040418,  0x741718,  0x8592E1,  0x9C8587,  0x6B53EE,  0x07041E
-.pword 0x64101A,  0x9B96FD,  0x998484,  0x63C994,  0x07051D,  0x6C1C05
-.pword 0x9E95DB,  0x9A8784,  0x79FB90,  0x041B11,  0x151904,  0x9DED46
-.pword 0x858785,  0x42E29D,  0x041914,  0x111B04,  0x90E57C,  0x84849A
-.pword 0xDEEA9E,  0x051C6F,  0x120507,  0x94CB60,  0x848499,  0xF3969B
-.pword 0x1A1367,  0x1F0407,  0xEE5168,  0x87859F,  0xE19285,  0x181777
-.pword 0x180404,  0xE17617,  0x878592,  0xEE9F84,  0x1F6B51,  0x1A0704
-.pword 0xF26413,  0x849B96,  0x949984,  0x1263C8,  0x050705,  0xD86C1C
-.pword 0x849EEA,  0x909A84,  0x117EFA,  0x04041B,  0x401519,  0x859DE2
-.pword 0x9D8587,  0x1541ED,  0x040419,  0x7E111B,  0x9A90FA,  0x9E8484
-.pword 0x6CD895,  0x07051C,  0x631205,  0x9994C9,  0x9B8484,  0x64FD96
-.pword 0x071A13,  0x6B1F04,  0x9CEE50,  0x858785,  0x77E192,  0x041817
-.pword 0x171804,  0x93E671,  0x858785,  0x54E99F,  0x041F68,  0x131A04
-.pword 0x96F067,  0x848498,  0xF59798,  0x051260,  0x1C0507,  0xEBDD6F
-.pword 0x84849E,  0xE5909A,  0x1B117C,  0x190404,  0xE34C14,  0x87859D
-.pword 0xED9D85,  0x1E1545,  0x1B0404,  0xF87811,  0x849B91,  0x959E84
-.pword 0x1D6DC5,  0x050705,  0xCC631D,  0x849994,  0x919B84,  0x1065FC
-.pword 0x04041A,  0x5C6A1E,  0x859CEF,  0x928587,  0x1775E0,  0x040418
-.pword 0x73161B,  0x9A93E7,  0x9F8487,  0x69D7E8,  0x07041F,  0x661305
-.pword 0x9897F1,  0x988484,  0x61F797,  0x070512,  0x6E1F05,  0x9EEBD3
-.pword 0x9A8784,  0x7DE493,  0x041B16,  0x141904,  0x9DE34E,  0x858785
-.pword 0x5BEC9C,  0x041E15,  0x101A04,  0x91F97B,  0x84849B,  0xC69599
-.pword 0x051D6D,  0x1D0507,  0x95C362,  0x848499,  0xFE919B,  0x1A1065
-.pword 0x1E0404,  0xEF5E6A,  0x87859C,  0xE09285,  0x191448,  0x1B0404
-.pword 0xE47216,  0x879A93,  0xE89F84,  0x1F6ED1,  0x050705,  0xF76612
-.pword 0x849897,  0x979884,  0x1366F6,  0x050705,  0xD6691F,  0x849FE8
-.pword 0x939A87,  0x1673E7,  0x040418,  0x4B1419,  0x8592E0,  0x9C8587
-.pword 0x6A5EEF,  0x04041E,  0x65101A,  0x9B91FF,  0x998484,  0x62C395
-.pword 0x07051D,  0x6D1D05,  0x9995C6,  0x9B8484,  0x7BF991,  0x041A10
-.pword 0x151E04,  0x9CEC5A,  0x858785,  0x4FE39D,  0x041914,  0x161B04
-.pword 0x90E47D,  0x84879A,  0xD3EB9E,  0x051C6E,  0x120507,  0x97F461
-.pword 0x848498,  0xF19798,  0x051366,  0x1F0407,  0xE8D769,  0x87849F
-.pword 0xE7939A,  0x181673,  0x180404,  0xE07517,  0x878592,  0xEF9C85
-.pword 0x1E6A5C,  0x1A0704,  0xFC6510,  0x849B91,  0x949984,  0x1D62CC
-.pword 0x050705,  0xC46D1C,  0x849E95,  0x919B84,  0x1178F8,  0x04041B
-.pword 0x45151E,  0x859CEC,  0x9D8587,  0x144CE3,  0x040419,  0x7C111B
-.pword 0x9A90E5,  0x9E8484,  0x6FDFEA,  0x07051C,  0x601205,  0x9894CA
-.pword 0x9B8484,  0x67F396,  0x071A13,  0x681F04,  0x9FE957,  0x858784
-.pword 0x71E693,  0x041817,  0x171804,  0x92E177,  0x858785,  0x53EE9F
-.pword 0x041E6B,  0x131A07,  0x96FD64,  0x84849B,  0xCE9499,  0x051D63
-.pword 0x1C0507,  0x95DB6C,  0x87849E,  0xFA909A,  0x1B1179,  0x190404
-.pword 0xED4115,  0x87859D,  0xE29D85,  0x191443,  0x1B0404,  0xE57F11
-.pword 0x879A90,  0xEA9E84,  0x1C6FD9,  0x050705,  0xC86012,  0x849994
-.pword 0x969B84,  0x1364F2,  0x04071A,  0x51681F,  0x849FE9,  0x928587
-.pword 0x1776E6,  0x040418,  0x761718,  0x8593E6,  0x9F8487,  0x6856E9
-.pword 0x07041F,  0x67131A,  0x9B96F3,  0x988484,  0x60CB94,  0x070512
-.pword 0x6F1C05,  0x9EEADE,  0x9A8484,  0x7FE590,  0x041B11,  0x141904
-.pword 0x9DE242,  0x858785,  0x47ED9D,  0x041915,  0x111B04,  0x90FB79
-.pword 0x84849A,  0xDA959E,  0x051C6C,  0x1D0507,  0x94CF63,  0x848499
-.pword 0xFD969B,  0x1A1064,  0x1E0404,  0xEE526B,  0x87859C,  0xE19285
-.pword 0x181774,  0x180404,  0xE77116,  0x879A93,  0xE99F84,  0x1F6955
-.pword 0x1A0704,  0xF06713,  0x849896,  0x979884,  0x1261F4,  0x050705
-.pword 0xD26E1C,  0x849EEB,  0x909A87,  0x167DE4,  0x04041B,  0x4F1419
-.pword 0x859DE3,  0x9C8587,  0x1545EC,  0x04041E,  0x78111A,  0x9A91F8
-.pword 0x9E8484,  0x6DC495,  0x07051C,  0x621D05,  0x9994CD,  0x9B8484
-.pword 0x65FF91,  0x041A10,  0x6A1E04,  0x9CEF5F,  0x858785,  0x4AE092
-.pword 0x041914,  0x161B04,  0x93E773,  0x84879A,  0xD7E89F,  0x041F69
-.pword 0x130507,  0x97F166,  0x848498,  0xF79798,  0x051261,  0x1C0507
-.pword 0xEBD36E,  0x84849F,  0xE4939A,  0x1B1672,  0x190404,  0xE34914
-.pword 0x878592,  0xEC9C85,  0x1E6A58,  0x1A0404,  0xFE7A10,  0x849B91
-.pword 0x959984,  0x1D6DC1,  0x050705,  0xC0621D,  0x849995,  0x919B84
-.pword 0x107AFE,  0x04041A,  0x596A1E,  0x859CEF,  0x928587,  0x1448E0
-.pword 0x040419,  0x72161B,  0x9A93E4,  0x9F8487,  0x6ED1E8,  0x07051F
-.pword 0x611205,  0x9897F7,  0x988484,  0x66F697,  0x070513,  0x691F04
-.pword 0x9FE8D7,  0x9A8784,  0x73E793,  0x041B16,  0x171804,  0x92E075
-.pword 0x858785,  0x5EEF9C,  0x041E6A,  0x101A04,  0x91FF65,  0x84849B
-.pword 0xC29499,  0x051D62,  0x1D0507,  0x95C66D,  0x848499,  0xF9919B
-.pword 0x1A107B,  0x1E0404,  0xEC5A15,  0x87859C,  0xE39D85,  0x19144E
-.pword 0x1B0404,  0xE47D16,  0x849A90,  0xEB9E84,  0x1C6ED2,  0x050705
-.pword 0xF46112,  0x849897,  0x969884,  0x1366F1,  0x04071A,  0xD5691F
-.pword 0x849FE8,  0x939A87,  0x1670E7,  0x040418,  0x751718,  0x8592E0
-.pword 0x9C8587,  0x6B5DEF,  0x04041E,  0x65101A,  0x9B96FC,  0x998484
-.pword 0x63CF94,  0x07051D,  0x6C1C05,  0x9E95DA,  0x9A8484,  0x79FB90
-.pword 0x041B11,  0x151904,  0x9DED47,  0x858785,  0x42E29D,  0x041914
-.pword 0x111B04,  0x90E57F,  0x84849A,  0xDFEA9E,  0x051C6F,  0x120507
-.pword 0x97CA60,  0x848498,  0xF39698,  0x1A1367,  0x1F0407,  0xE95768
-.pword 0x87849F,  0xE69385,  0x181776,  0x180404,  0xE17717,  0x878592
-.pword 0xEE9F85,  0x1F6B50,  0x1A0704,  0xF26413,  0x849B96,  0x949984
-.pword 0x1263C8,  0x050705,  0xD96C1C,  0x849EEA,  0x909A84,  0x117EFA
-.pword 0x04041B,  0x401519,  0x859DE2,  0x9D8587,  0x1541ED,  0x040419
-.pword 0x7E111B,  0x9A90FA,  0x9E8484,  0x6CD895,  0x07051C,  0x631205
-.pword 0x9994C9,  0x9B8484,  0x64F296,  0x071A13,  0x6B1E04,  0x9FEE51
-.pword 0x858784,  0x77E192,  0x041817,  0x171804,  0x93E676,  0x848785
-.pword 0x57E99F,  0x041F68,  0x131A07,  0x96F367,  0x848498,  0xCA9498
-.pword 0x051260,  0x1C0507,  0xEADF6F,  0x84849E,  0xE5909A,  0x1B117F
-.pword 0x190404,  0xE24D14,  0x87859D,  0xED9D85,  0x1E1547,  0x1B0404
-.pword 0xFB7811,  0x849A90,  0x959E84,  0x1C6CC5,  0x050705,  0xCC631D
-.pword 0x849994,  0x919B84,  0x1065FC,  0x04041A,  0x5D6B1E,  0x859CEF
-.pword 0x928587,  0x1775E0,  0x040418,  0x701618,  0x8593E7,  0x9F8487
-.pword 0x69D4E8,  0x07041F,  0x661305,  0x9896F1,  0x988484,  0x61F497
-.pword 0x070512,  0x6E1C05,  0x9EEBD2,  0x9A8784,  0x7DE490,  0x041B16
-.pword 0x141904,  0x9DE34F,  0x858785,  0x5AEC9C,  0x041E15,  0x101A04
-.pword 0x91F97B,  0x84849B,  0xC69599,  0x051D6D,  0x1D0507,  0x94C262
-.pword 0x848499,  0xFF919B,  0x1A1065,  0x1E0404,  0xEF5E6A,  0x87859C
-.pword 0xE09285,  0x19144B,  0x1B0404,  0xE77316,  0x879A93,  0xE89F84
-.pword 0x1F69D6,  0x050704,  0xF66613,  0x849897,  0x979884,  0x1261F7
-.pword 0x050705,  0xD06E1F,  0x849FEB,  0x939A87,  0x1672E4,  0x04041B
-.pword 0x481419,  0x8592E0,  0x9C8587,  0x6A59EF,  0x04041E,  0x7A101A
-.pword 0x9B91FE,  0x998484,  0x62C395,  0x07051D,  0x6D1D05,  0x9995C6
-.pword 0x9B8484,  0x7BF991,  0x041A10,  0x151E04,  0x9CEC5B,  0x858785
-.pword 0x4EE39D,  0x041914,  0x161B04,  0x93E47D,  0x84879A,  0xD0EB9E
-.pword 0x051F6E,  0x120507,  0x97F761,  0x848498,  0xF69798,  0x051366
-.pword 0x1F0407,  0xE8D769,  0x87849F,  0xE7939A,  0x1B1673,  0x180404
-.pword 0xE04A17,  0x878592,  0xEF9C85,  0x1E6A5E,  0x1A0404,  0xFF6510
-.pword 0x849B91,  0x949984,  0x1D62C2,  0x050705,  0xC76D1D,  0x849E95
-.pword 0x919B84,  0x1078F8,  0x04041A,  0x45151E,  0x859CEC,  0x9D8587
-.pword 0x144CE3,  0x040419,  0x7C111B,  0x9A93E4,  0x9E8487,  0x6ED2EB
-.pword 0x07051C,  0x611205,  0x9897F5,  0x988484,  0x67F096,  0x070513
-.pword 0x681F04,  0x9FE955,  0x858784,  0x71E693,  0x041816,  0x171804
-.pword 0x92E174,  0x858785,  0x52EE9C,  0x041E6B,  0x101A07,  0x91FC64
-.pword 0x84849B,  0xCF9499,  0x051D63,  0x1C0507,  0x95DA6C,  0x84849E
-.pword 0xFB909A,  0x1B1179,  0x190404,  0xED4615,  0x87859D,  0xE29D85
-.pword 0x191543,  0x1B0404,  0xE57F11,  0x879A90,  0xEA9E84,  0x1C6FDE
-.pword 0x050705,  0xCA6012,  0x849894,  0x969B84,  0x1367F3,  0x04071A
-.pword 0x57681F,  0x849FE9,  0x938587,  0x1771E6,  0x040418,  0x741718
-.pword 0x8592E1,  0x9C8587,  0x6B50EE,  0x04041F,  0x64101A,  0x9B96F2
-.pword 0x998484,  0x63C994,  0x070512,  0x6C1C05,  0x9EEAD9,  0x9A8484
-.pword 0x7FE590,  0x041B11,  0x141904,  0x9DE243,  0x858785,  0x46ED9D
-.pword 0x041915,  0x111B04,  0x90FB79,  0x84849A,  0xDB959E,  0x051C6C
-.pword 0x1D0507,  0x94CE63,  0x848499,  0xFD969B,  0x1A1364,  0x1E0407
-.pword 0xEE536B,  0x87859C,  0xE19285,  0x181774,  0x180404,  0xE67116
-.pword 0x878593,  0xE99F84,  0x1F6854,  0x1A0704,  0xF06713,  0x849896
-.pword 0x979884,  0x1260F5,  0x050705,  0xDC6F1C,  0x849EEA,  0x909A84
-.pword 0x117CE5,  0x04041B,  0x4D1419,  0x859DE2,  0x9D8587,  0x1544ED
-.pword 0x04041E,  0x78111B,  0x9B91F8,  0x9E8484,  0x6CC595,  0x07051C
-.pword 0x631D05,  0x9994CC,  0x9B8484,  0x65FC91,  0x041A10,  0x6B1E04
-.pword 0x9CEF5D,  0x858785,  0x75E092,  0x041817,  0x161804,  0x93E770
-.pword 0x848785,  0xD4E89F,  0x041F69,  0x130507,  0x97F166,  0x848498
-.pword 0xF49798,  0x051261,  0x1C0507,  0xEBD36E,  0x87849E,  0xE4939A
-.pword 0x1B167D,  0x190404,  0xE34E14,  0x878592,  0xEC9C85,  0x1E155B
-.pword 0x1A0404,  0xF97B10,  0x849B91,  0x959984,  0x1D6DC6,  0x050705
-.pword 0xC3621D,  0x849994,  0x919B84,  0x1065FF,  0x04041A,  0x596A1E
-.pword 0x859CEF,  0x928587,  0x1448E0,  0x040419,  0x72161B,  0x9A93E4
-.pword 0x9F8487,  0x6ED1E8,  0x07051F,  0x661205,  0x9897F6,  0x988484
-.pword 0x61F797,  0x070512,  0x6E1F05,  0x9FEBD1,  0x9A8784,  0x72E493
-.pword 0x041B16,  0x141904,  0x92E048,  0x858785,  0x59EF9C,  0x041E6A
-.pword 0x101A04,  0x91FF65,  0x84849B,  0xC39499,  0x051D62,  0x1D0507
-.pword 0x95C66D,  0x848499,  0xF9919B,  0x1A107B,  0x1E0404,  0xEC5B15
-.pword 0x87859C,  0xE39D85,  0x191449,  0x1B0404,  0xE47D16,  0x879A93
-.pword 0xEB9E84,  0x1C6ED3,  0x050705,  0xF46112,  0x849897,  0x969884
-.pword 0x1366F1,  0x040705,  0xD5691F,  0x849FE8,  0x938587,  0x1670E7
-.pword 0x040418,  0x751718,  0x8592E0,  0x9C8587,  0x6A5CEF,  0x07041E
-.pword 0x65101A,  0x9B91FF,  0x998484,  0x62CD94,  0x07051D,  0x6D1D05
-.pword 0x9E95C4,  0x9A8484,  0x78F891,  0x041A11,  0x151E04,  0x9CED44
-.pword 0x858785,  0x4DE29D,  0x041914,  0x111B04,  0x90E57C,  0x84879A
-.pword 0xDCEA9E,  0x051C6F,  0x120507,  0x97F560,  0x848498,  0xF39698
-.pword 0x1A1367,  0x1F0407,  0xE95768,  0x87849F,  0xE69385,  0x181771
-.pword 0x180404,  0xE17417,  0x878592,  0xEE9C85,  0x1F6851,  0x1A0704
-.pword 0xFD6413,  0x849B96,  0x949984,  0x1D63C9,  0x050705,  0xDB6C1C
-.pword 0x849E95,  0x909A84,  0x1179FB,  0x04041B,  0x411519,  0x859DED
-.pword 0x9D8587,  0x1540E2,  0x040419,  0x7E111B,  0x9A90FA,  0x9E8487
-.pword 0x6FD9EA,  0x07051C,  0x601205,  0x9894CB,  0x9B8484,  0x67F296
-.pword 0x071A13,  0x681F04,  0x9FE956,  0x858784,  0x76E693,  0x041817
-.pword 0x171804,  0x92E676,  0x858785,  0x56E99F,  0x041F68,  0x131A07
-.pword 0x96F367,  0x84849B,  0xCB9498,  0x051260,  0x1C0507,  0xEADE6F
-.pword 0x87849E,  0xE5909A,  0x1B117F,  0x190404,  0xE24214,  0x87859D
-.pword 0xED9D85,  0x191546,  0x1B0404,  0xFA7911,  0x879A90,  0x959E84
-.pword 0x1C6CD8,  0x050705,  0xC96312,  0x849994,  0x969B84,  0x1064FD
-.pword 0x04041A,  0x536B1E,  0x859CEE,  0x928587,  0x1774E1,  0x040418
-.pword 0x711618,  0x9A93E7,  0x9F8487,  0x6955E9,  0x07041F,  0x671305
-.pword 0x9896F0,  0x988484,  0x60F597,  0x070512,  0x6F1C05,  0x9EEBDD
-.pword 0x9A8484,  0x7CE590,  0x041B11,  0x141904,  0x9DE34C,  0x858785
-.pword 0x45EC9C,  0x041E15,  0x101A04,  0x91F97B,  0x84849B,  0xC7959E
-.pword 0x051D6D,  0x1D0507,  0x94CD62,  0x848499,  0xFF919B,  0x1A1065
-.pword 0x1E0404,  0xEF5C6A,  0x87859C,  0xE09285,  0x181775,  0x180404
-.pword 0xE77016,  0x879A93,  0xE89F84,  0x1F69D4,  0x050704,  0xF16613
-.pword 0x849897,  0x979884,  0x1261F7,  0x050705,  0xD06E1F,  0x849FEB
-.pword 0x939A87,  0x1672E4,  0x04041B,  0x491419,  0x8592E3,  0x9C8587
-.pword 0x6A58EC,  0x07041E,  0x7B101A,  0x9B91F9,  0x998484,  0x62C095
-.pword 0x07051D,  0x621D05,  0x9995C0,  0x9B8484,  0x7AFE91,  0x071A10
-.pword 0x6A1E04,  0x9CEF59,  0x858785,  0x48E092,  0x041914,  0x161B04
-.pword 0x93E472,  0x84879A,  0xD1E89F,  0x051F6E,  0x120507,  0x97F666
-.pword 0x848498,  0xF69798,  0x051366,  0x1F0507,  0xE8D669,  0x87849F
-.pword 0xE7939A,  0x1B1673,  0x180404,  0xE04B14,  0x878592,  0xEF9C85
-.pword 0x1E6A5E,  0x1A0404,  0xFF6510,  0x849B91,  0x949984,  0x1D62C2
-.pword 0x050705,  0xC76D1D,  0x849E95,  0x919B84,  0x107BF9,  0x04041A
-.pword 0x5A151E,  0x859CEC,  0x9D8587,  0x144FE3,  0x040419,  0x7D161B
-.pword 0x9A90E4,  0x9E8487,  0x6ED3EB,  0x07051C,  0x611205,  0x9897F4
-.pword 0x988484,  0x66F196,  0x070513,  0x691F04,  0x9FE8D5,  0x9A8784
-.pword 0x70E793,  0x041816,  0x171804,  0x92E175,  0x858785,  0x5DEE9C
-.pword 0x041E6B,  0x101A07,  0x96FC65,  0x84849B,  0xCF9499,  0x051D63
-.pword 0x1C0507,  0x95DA6C,  0x84849E,  0xFB909A,  0x1B1179,  0x190404
-.pword 0xED4715,  0x87859D,  0xE29D85,  0x191442,  0x1B0404,  0xE57F11
-.pword 0x849A90,  0xEA9E84,  0x1C6FDF,  0x050705,  0xCA6012,  0x849897
-.pword 0x969884,  0x1367F3,  0x04071A,  0x57681F,  0x849FE9,  0x938587
-.pword 0x1776E6,  0x040418,  0x771718,  0x8592E1,  0x9F8587,  0x6B50EE
-.pword 0x07041E,  0x64131A,  0x9B96F2,  0x998484,  0x63C994,  0x070512
-.pword 0x6C1C05,  0x9EEAD8,  0x9A8484,  0x7EFA90,  0x041B11,  0x151904
-.pword 0x9DED41,  0x858785,  0x40E29D,  0x041915,  0x111B04,  0x90FA7E
-.pword 0x84849A,  0xD8959E,  0x051C6C,  0x120507,  0x94C963,  0x848499
-.pword 0xFD969B,  0x1A1364,  0x1E0407,  0xEE506B,  0x87859F,  0xE19285
-.pword 0x181777,  0x180404,  0xE67117,  0x878593,  0xE99F84,  0x1F6857
-.pword 0x050704,  0xF36713,  0x849B96,  0x979884,  0x1260F5,  0x050705
-.pword 0xDF6F1C,  0x849EEA,  0x909A87,  0x117FE5,  0x04041B,  0x421419
-.pword 0x859DE2,  0x9D8587,  0x1547ED,  0x04041E,  0x79111B,  0x9A90FB
-.pword 0x9E8484,  0x6CC595,  0x07051C,  0x631D05,  0x9994CF,  0x9B8484
-.pword 0x64FD96,  0x071A10,  0x6B1E04,  0x9CEE52,  0x858785,  0x74E192
-.pword 0x041817,  0x161804,  0x93E770,  0x848785,  0xD5E89F,  0x041F69
-.pword 0x130507,  0x96F066,  0x848498,  0xF49798,  0x051261,  0x1C0507
-.pword 0xEBD26E,  0x87849E,  0xE4909A,  0x1B117C,  0x190404,  0xE34F14
-.pword 0x87859D,  0xEC9C85,  0x1E155A,  0x1A0404,  0xF97B10,  0x849B91
-.pword 0x959984,  0x1D6DC7,  0x050705,  0xC2621D,  0x849994,  0x919B84
-.pword 0x1065FF,  0x04041A,  0x5E6A1E,  0x859CEF,  0x928587,  0x144BE0
-.pword 0x040419,  0x731618,  0x9A93E7,  0x9F8487,  0x69D6E8,  0x07051F
-.pword 0x661305,  0x9897F6,  0x988484,  0x61F797,  0x070512,  0x6E1F05
-.pword 0x9FEBD0,  0x9A8784,  0x72E493,  0x041B16,  0x141904,  0x92E348
-.pword 0x858785,  0x59EF9C,  0x041E6A,  0x101A04,  0x91FE7A,  0x84849B
-.pword 0xC09599,  0x051D62,  0x1D0507,  0x95C16D,  0x848499,  0xF9919B
-.pword 0x1A107B,  0x1E0404,  0xEC5B15,  0x87859C,  0xE39D85,  0x191449
-.pword 0x1B0404,  0xE47216,  0x879A93,  0xEB9E84,  0x1F69D0,  0x050704
-.pword 0xF76112,  0x849897,  0x979884,  0x1366F1,  0x040705,  0xD7691F
-.pword 0x849FE8,  0x939A87,  0x1673E7,  0x04041B,  0x4A1418,  0x8592E0
-.pword 0x9C8587,  0x6A5EEF,  0x07041E,  0x65101A,  0x9B91FF,  0x998484
-.pword 0x62C394,  0x07051D,  0x6D1D05,  0x9995C6,  0x9B8484,  0x7BF991
-.pword 0x041A10,  0x151E04,  0x9CEC45,  0x858785,  0x4CE39D,  0x041914
-.pword 0x111B04,  0x90E57C,  0x84849A,  0xDCEA9E,  0x051C6F,  0x120507
-.pword 0x97F560,  0x848498,  0xF09698,  0x1A1367,  0x1F0407,  0xE95468
-.pword 0x87849F,  0xE69385,  0x181671,  0x180404,  0xE17417,  0x878592
-.pword 0xEE9C85,  0x1E6B52,  0x1A0404,  0xFD6410,  0x849B96,  0x949984
-.pword 0x1D63CF,  0x050705,  0xDA6C1C,  0x849E95,  0x909A84,  0x1179FB
-.pword 0x04041B,  0x461519,  0x859DED,  0x9D8587,  0x1543E2,  0x040419
-.pword 0x7E111B,  0x9A90FA,  0x9E8484,  0x6FD9EA,  0x07051C,  0x601205
-.pword 0x9994CB,  0x9B8484,  0x67F396,  0x071A13,  0x681F04,  0x9FE956
-.pword 0x858784,  0x76E693,  0x041817,  0x171804,  0x92E177,  0x858785
-.pword 0x51EE9F,  0x041F6B,  0x131A07,  0x96F264,  0x84849B,  0xC89499
-.pword 0x051260,  0x1C0507,  0xEAD96C,  0x84849E,  0xFA909A,  0x1B117E
-.pword 0x190404,  0xE24315,  0x87859D,  0xED9D85,  0x191541,  0x1B0404
-.pword 0xFB7911,  0x849A90,  0x959E84,  0x1C6CDB,  0x050705,  0xCE631D
-.pword 0x849994,  0x969B84,  0x1064FD,  0x04071A,  0x536B1E,  0x859CEE
-.pword 0x928587,  0x1777E1,  0x040418,  0x711718,  0x8593E6,  0x9F8587
-.pword 0x6854E9,  0x07041F,  0x67131A,  0x9896F0,  0x988484,  0x60F597
-.pword 0x070512,  0x6F1C05,  0x9EEBDC,  0x9A8484,  0x7CE590,  0x041B11
-.pword 0x141904,  0x9DE24C,  0x858785,  0x44ED9D,  0x041E15,  0x111B04
-.pword 0x90F878,  0x84849A,  0xC5959E,  0x051C6C,  0x1D0507,  0x94CF63
-.pword 0x848499,  0xFC919B,  0x1A1065,  0x1E0404,  0xEF5D6B,  0x87859C
-.pword 0xE09285,  0x181775,  0x180404,  0xE77016,  0x879A93,  0xE89F84
-.pword 0x1F69D4,  0x050704,  0xF16613,  0x849897,  0x979884,  0x1261F4
-.pword 0x050705,  0xD36E1C,  0x849EEB,  0x909A87,  0x167DE4,  0x04041B
-.pword 0x4E1419,  0x859DE3,  0x9C8587,  0x155AEC,  0x04041E,  0x7B101A
-.pword 0x9B91F9,  0x998484,  0x6DC695,  0x07051D,  0x621D05,  0x9994C3
-.pword 0x9B8484,  0x65FF91,  0x041A10,  0x6A1E04,  0x9CEF5E,  0x858785
-.pword 0x4BE092,  0x041914,  0x161B04,  0x93E773,  0x84879A,  0xD6E89F
-.pword 0x051F69,  0x130507,  0x97F666,  0x848498,  0xF69798,  0x051366
-.pword 0x1F0507,  0xE8D769,  0x87849F,  0xE7939A,  0x1B1673,  0x180404
-.pword 0xE04B14,  0x878592,  0xEF9C85,  0x1E6A5E,  0x1A0704,  0xFE6510
-.pword 0x849B91,  0x959984,  0x1D62C0,  0x050705,  0xC16D1D,  0x849995
-.pword 0x919B84,  0x107BF9,  0x04041A,  0x5B151E,  0x859CEC,  0x9D8587
-.pword 0x144EE3,  0x040419,  0x7D161B,  0x9A93E4,  0x9E8487,  0x6ED3EB
-.pword 0x07051C,  0x611205,  0x9897F4,  0x988484,  0x66F197,  0x041A13
-.pword 0x691F05,  0x9FE9D5,  0x9A8784,  0x70E793,  0x041816,  0x171804
-.pword 0x92E075,  0x858785,  0x5CEF9C,  0x041E6B,  0x101A04,  0x96FD65
-.pword 0x84849B,  0xCC9499,  0x051D62,  0x1C0507,  0x95C46D,  0x848499
-.pword 0xF8919A,  0x1A1078,  0x1E0404,  0xEC4515,  0x87859C,  0xE39D85
-.pword 0x19144C,  0x1B0404,  0xE57C11,  0x879A90,  0xEA9E84,  0x1C6FDC
-.pword 0x050705,  0xF56012,  0x849897,  0x969B84,  0x1367F0,  0x040705
-.pword 0x54681F,  0x849FE9,  0x938587,  0x1671E6,  0x040418,  0x741718
-.pword 0x8592E1,  0x9C8587,  0x6B53EE,  0x07041E,  0x64131A,  0x9B96FD
-.pword 0x998484,  0x63CE94,  0x07051D,  0x6C1C05,  0x9E95DB,  0x9A8484
-.pword 0x7EFA90,  0x041B11,  0x151904,  0x9DED41,  0x858785,  0x43E29D
-.pword 0x041915,  0x111B04,  0x90E57F,  0x84879A,  0xDEEA9E,  0x051C6F
-.pword 0x120507,  0x94CA60,  0x848498,  0xF39698,  0x1A1367,  0x1F0404
-.pword 0xE95668,  0x84859F,  0xE69385,  0x181777,  0x180404,  0xE67617
-.pword 0x878593,  0xE99F85,  0x1F6856,  0x1A0704,  0xF36713,  0x849B96
-.pword 0x949884,  0x1260CB,  0x050705,  0xD96F1C,  0x849EEA,  0x909A87
-.pword 0x117EE5,  0x04041B,  0x431519,  0x859DE2,  0x9D8587,  0x1546ED
-.pword 0x040419,  0x79111B,  0x9A90FB,  0x9E8484,  0x6CDA95,  0x07051C
-.pword 0x631D05,  0x9994CE,  0x9B8484,  0x64FD96,  0x041A10,  0x6B1E04
-.pword 0x9CEE52,  0x858785,  0x74E192,  0x041817,  0x171804,  0x93E671
-.pword 0x848785,  0x55E99F,  0x041F68,  0x131A07,  0x96F067,  0x848498
-.pword 0xF59798,  0x051261,  0x1C0507,  0xEBDD6E,  0x87849E,  0xE4909A
-.pword 0x1B167C,  0x190404,  0xE34F14,  0x87859D,  0xEC9C85,  0x1E1545
-.pword 0x1A0404,  0xF87B10,  0x849B91,  0x959984,  0x1D6DC5,  0x050705
-.pword 0xCD621D,  0x849994,  0x919B84,  0x1065FC,  0x04071A,  0x5C6A1E
-.pword 0x859CEF,  0x928587,  0x1775E0,  0x040418,  0x701618,  0x9A93E7
-.pword 0x9F8487,  0x69D4E8,  0x07051F,  0x661305,  0x9897F6,  0x988484
-.pword 0x61F797,  0x070512,  0x6E1C05,  0x9FEBD0,  0x9A8484,  0x72E493
-.pword 0x041B16,  0x141904,  0x9DE349,  0x858785,  0x58EC9C,  0x041E15
-.pword 0x101A04,  0x91FE7A,  0x84849B,  0xC19599,  0x051D6D,  0x1D0507
-.pword 0x95C062,  0x848499,  0xFE919B,  0x1A107A,  0x1E0404,  0xEC586A
-.pword 0x87859C,  0xE39285,  0x191448,  0x1B0404,  0xE47216,  0x879A93
-.pword 0xE89F84,  0x1F6ED1,  0x050705,  0xF66612,  0x849897,  0x979884
-.pword 0x1366F6,  0x050705,  0xD6691F,  0x849FE8,  0x939A87,  0x1673E7
-.pword 0x040418,  0x4B1419,  0x8592E0,  0x9C8587,  0x6A5EEF,  0x04041E
-.pword 0x65101A,  0x9B91FF,  0x998484,  0x62C294,  0x07051D,  0x6D1D05
-.pword 0x9995C6,  0x9B8484,  0x7BF991,  0x041A10,  0x151E04,  0x9CEC5A
-.pword 0x858785,  0x4FE39D,  0x041914,  0x161B04,  0x90E47D,  0x84879A
-.pword 0xD2EB9E,  0x051C6E,  0x120507,  0x97F461,  0x848498,  0xF19698
-.pword 0x051366,  0x1F0407,  0xE9D569,  0x87849F,  0xE79385,  0x181670
-.pword 0x180404,  0xE17517,  0x878592,  0xEE9C85,  0x1E6B52,  0x1A0704
-.pword 0xFC6410,  0x849B91,  0x949984,  0x1D63CF,  0x050705,  0xC56C1C
-.pword 0x849E95,  0x919B84,  0x1178F8,  0x04041B,  0x44151E,  0x859DED
-.pword 0x9D8587,  0x144DE2,  0x040419,  0x7F111B,  0x9A90E5,  0x9E8484
-.pword 0x6FDFEA,  0x07051C,  0x601205,  0x9897CA,  0x9B8484,  0x67F396
-.pword 0x071A13,  0x681F04,  0x9FE956,  0x858784,  0x76E693,  0x041817
-.pword 0x171804,  0x92E177,  0x858785,  0x50EE9F,  0x041F6B,  0x131A07
-.pword 0x96F264,  0x84849B,  0xC89499,  0x051263,  0x1C0507,  0xEAD86C
-.pword 0x87849E,  0xFA909A,  0x1B117E,  0x190404,  0xED4115,  0x87859D
-.pword 0xE29D85,  0x191540,  0x1B0404,  0xFA7E11,  0x849A90,  0xEA9E84
-.pword 0x1C6CD8,  0x050705,  0xC96312,  0x849994,  0x969B84,  0x1364F2
-.pword 0x04071A,  0x506B1F,  0x859FEE,  0x928587,  0x1777E1,  0x040418
-.pword 0x761718,  0x8593E6,  0x9F8487,  0x6857E9,  0x07041F,  0x67131A
-.pword 0x9B96F3,  0x988484,  0x60CA97,  0x070512,  0x6F1C05,  0x9EEADF
-.pword 0x9A8784,  0x7FE590,  0x041B11,  0x141904,  0x9DE242,  0x858785
-.pword 0x47ED9D,  0x041915,  0x111B04,  0x90FB79,  0x84849A,  0xDA959E
-.pword 0x051C6C,  0x1D0507,  0x94CF63,  0x848499,  0xFD969B,  0x1A1064
-.pword 0x1E0404,  0xEE5D6B,  0x87859C,  0xE19285,  0x181775,  0x180404
-.pword 0xE77016,  0x878593,  0xE89F84,  0x1F69D5,  0x050704,  0xF16613
-.pword 0x849896,  0x979884,  0x1261F4,  0x050705,  0xD26E1C,  0x849EEB
-.pword 0x909A87,  0x117CE4,  0x04041B,  0x4F1419,  0x859DE3,  0x9C8587
-.pword 0x155AEC,  0x04041E,  0x7B101A,  0x9B91F9,  0x998484,  0x6DC795
-.pword 0x07051D,  0x621D05,  0x9994C2,  0x9B8484,  0x65FF91,  0x041A10
-.pword 0x6A1E04,  0x9CEF5E,  0x858785,  0x4AE092,  0x041817,  0x161B04
-.pword 0x93E773,  0x848785,  0xD7E89F,  0x041F69,  0x120507,  0x96F166
-.pword 0x848498,  0xF49798,  0x051261,  0x1C0507,  0xEBD06E,  0x87849F
-.pword 0xE4939A,  0x1B1672,  0x190404,  0xE34914,  0x878592,  0xEC9C85
-.pword 0x1E6A58,  0x1A0704,  0xFE7A10,  0x849B91,  0x959984,  0x1D6DC1
-.pword 0x050705,  0xC0621D,  0x849995,  0x919B84,  0x107AFE,  0x04041A
-.pword 0x596A1E,  0x859CEC,  0x928587,  0x1448E0,  0x040419,  0x72161B
-.pword 0x9A90E4,  0x9F8484,  0x6ED3EB,  0x07051C,  0x611205,  0x9897F4
-.pword 0x988484,  0x66F197,  0x070513,  0x691F04,  0x9FE8D4,  0x9A8784
-.pword 0x70E793,  0x041816,  0x171804,  0x92E075,  0x858785,  0x5FEF9C
-.pword 0x041E6A,  0x101A04,  0x91FF65,  0x84849B,  0xC29499,  0x051D62
-.pword 0x1D0507,  0x95C76D,  0x848499,  0xF9919B,  0x1A107B,  0x1E0404
-.pword 0xEC4515,  0x87859C,  0xE29D85,  0x19144C,  0x1B0404,  0xE57C11
-.pword 0x849A90,  0xEA9E84,  0x1C6FDC,  0x050705,  0xF56012,  0x849897
-.pword 0x969884,  0x1367F0,  0x04071A,  0x54681F,  0x849FE9,  0x938587
-.pword 0x1671E6,  0x040418,  0x741718,  0x8592E1,  0x9C8587,  0x6B52EE
-.pword 0x04041E,  0x64101A,  0x9B96FD,  0x998484,  0x63CF94,  0x07051D
-.pword 0x6C1C05,  0x9E95DA,  0x9A8484,  0x79FB90,  0x041B11,  0x151904
-.pword 0x9DED47,  0x858785,  0x42E29D,  0x041914,  0x111B04,  0x90E57F
-.pword 0x84879A,  0xDEEA9E,  0x051C6F,  0x120507,  0x94CB60,  0x848498
-.pword 0xF2969B,  0x1A1367,  0x1F0407,  0xE95668,  0x87849F,  0xE69385
-.pword 0x181776,  0x180404,  0xE17717,  0x878592,  0xEE9F85,  0x1F6B50
-.pword 0x1A0704,  0xF26413,  0x849B96,  0x949984,  0x1263C8,  0x050705
-.pword 0xD96C1C,  0x849EEA,  0x909A84,  0x117EE5,  0x04041B,  0x431419
-.pword 0x859DE2,  0x9D8587,  0x1546ED,  0x040419,  0x79111B,  0x9A90FB
-.pword 0x9E8484,  0x6CDB95,  0x07051C,  0x631205,  0x9994C9,  0x9B8484
-.pword 0x64F296,  0x071A13,  0x6B1F04,  0x9FEE50,  0x858785,  0x77E192
-.pword 0x041817,  0x171804,  0x93E671,  0x848785,  0x54E99F,  0x041F68
-.pword 0x131A07,  0x96F067,  0x848498,  0xF59798,  0x051260,  0x1C0507
-.pword 0xEADC6F,  0x87849E,  0xE5909A,  0x1B117C,  0x190404,  0xE24D14
-.pword 0x87859D,  0xED9C85,  0x191544,  0x1B0404,  0xF87811,  0x849A90
-.pword 0x959E84,  0x1C6CC5,  0x050705,  0xCC631D,  0x849994,  0x919B84
-.pword 0x1065FC,  0x04041A,  0x5D6B1E,  0x859CEF,  0x928587,  0x1775E1
-.pword 0x040418,  0x701618,  0x8593E7,  0x9F8487,  0x6955E9,  0x07041F
-.pword 0x671305,  0x9896F0,  0x988484,  0x61F497,  0x070512,  0x6E1C05
-.pword 0x9FEBD3,  0x9A8484,  0x72E493,  0x041B16,  0x141904,  0x9DE349
-.pword 0x858785,  0x5BEC9C,  0x041E15,  0x101A07,  0x91F97B,  0x84849B
-.pword 0xC69599,  0x051D6D,  0x1D0507,  0x94C262,  0x848499,  0xFF919B
-.pword 0x1A1065,  0x1E0407,  0xEF5F6A,  0x87859C,  0xE09285,  0x18144B
-.pword 0x1B0404,  0xE77216,  0x879A93,  0xE89F84,  0x1F69D6,  0x050704
-.pword 0xF66612,  0x849897,  0x979884,  0x1266F6,  0x050705,  0xD6691F
-.pword 0x849FE8,  0x939A84,  0x1673E7,  0x040418,  0x4A1419,  0x8592E0
-.pword 0x9C8587,  0x6A59EF,  0x04041E,  0x7A101A,  0x9B91FE,  0x998484
-.pword 0x62C294,  0x07051D,  0x6D1D05,  0x9995C1,  0x9B8484,  0x7AF991
-.pword 0x071A10,  0x151E04,  0x9CEC58,  0x858785,  0x49E392,  0x041914
-.pword 0x161B04,  0x93E47D,  0x84849A,  0xD3EB9E,  0x051C6E,  0x120507
-.pword 0x97F461,  0x848498,  0xF19698,  0x051366,  0x1F0407,  0xE8D469
-.pword 0x87849F,  0xE79385,  0x181670,  0x180404,  0xE07517,  0x878592
-.pword 0xEF9C85,  0x1E6A5C,  0x1A0404,  0xFC6510,  0x849B91,  0x949984
-.pword 0x1D62CD,  0x050705,  0xC46D1D,  0x849E95,  0x919B84,  0x1178F8
-.pword 0x04041B,  0x44151E,  0x859DED,  0x9D8587,  0x144DE2,  0x040419
-.pword 0x7C111B,  0x9A90E5,  0x9E8484,  0x6FDCEB,  0x07051C,  0x611205
-.pword 0x9897F5,  0x988484,  0x67F096,  0x071A13,  0x691F04,  0x9FE955
-.pword 0x9A8784,  0x71E693,  0x041817,  0x171804,  0x92E174,  0x858485
-.pword 0x50EE9C,  0x041F6B,  0x131A04,  0x96F264,  0x84849B,  0xC99499
-.pword 0x051263,  0x1C0507,  0x95DB6C,  0x87849E,  0xFB909A,  0x1B1179
-.pword 0x190404,  0xED4615,  0x87859D,  0xE29D85,  0x191443,  0x1B0404
-.pword 0xE57F11,  0x849A90,  0xEA9E84,  0x1C6FDE,  0x050705,  0xCB6012
-.pword 0x849994,  0x969B84,  0x1364F2,  0x04071A,  0x56681F,  0x859FE9
-.pword 0x928587,  0x1776E6,  0x040418,  0x761718,  0x8592E6,  0x9F8587
-.pword 0x6856E9,  0x07041F,  0x67131A,  0x9B96F3,  0x998484,  0x60CB94
-.pword 0x070512,  0x6F1C05,  0x9EEADE,  0x9A8484,  0x7FE590,  0x041B11
-.pword 0x141904,  0x9DE242,  0x858785,  0x47ED9D,  0x041915,  0x111B04
-.pword 0x90FB79,  0x84849A,  0xDA959E,  0x051C6C,  0x1D0507,  0x94C963
-.pword 0x848499,  0xFD969B,  0x1A1064,  0x1E0407,  0xEE536B,  0x87859C
-.pword 0xE19285,  0x181774,  0x180404,  0xE67116,  0x878593,  0xE99F84
-.pword 0x1F6854,  0x1A0704,  0xF06713,  0x849896,  0x979884,  0x1260F5
-.pword 0x050705,  0xDD6F1C,  0x849EEB,  0x909A84,  0x117CE5,  0x04041B
-.pword 0x4C1419,  0x859DE3,  0x9C8587,  0x1545EC,  0x04041E,  0x78111A
-.pword 0x9B91F8,  0x9E8484,  0x6DC495,  0x07051D,  0x621D05,  0x9994CD
-.pword 0x9B8484,  0x65FC91,  0x041A10,  0x6A1E04,  0x9CEF5F,  0x858785
-.pword 0x75E092,  0x041817,  0x161804,  0x93E773,  0x84879A,  0xD4E89F
-.pword 0x041F69,  0x130507,  0x97F166,  0x848498,  0xF49798,  0x051261
-.pword 0x1C0507,  0xEBD36E,  0x84849E,  0xE4939A,  0x1B1672,  0x190404
-.pword 0xE34914,  0x878592,  0xEC9C85,  0x1E6A58,  0x1A0404,  0xFE7A10
-.pword 0x849B91,  0x959984,  0x1D6DC1,  0x050705,  0xC0621D,  0x849995
-.pword 0x919B84,  0x107AFE,  0x04041A,  0x586A1E,  0x859CEC,  0x928587
-.pword 0x1448E3,  0x040419,  0x72161B,  0x9A93E4,  0x9F8487,  0x6ED1EB
-.pword 0x07041F,  0x611205,  0x9897F7,  0x988484,  0x66F697,  0x070513
-.pword 0x691F05,  0x9FE8D6,  0x9A8784,  0x73E793,  0x041B16,  0x141804
-.pword 0x92E04A,  0x858785,  0x5EEF9C,  0x041E6A,  0x101A07,  0x91FF65
-.pword 0x84849B,  0xC29499,  0x051D62,  0x1D0507,  0x95C76D,  0x848499
-.pword 0xF9919B,  0x1A107B,  0x1E0404,  0xEC5A15,  0x87859C,  0xE39D85
-.pword 0x19144F,  0x1B0404,  0xE47D16,  0x849A90,  0xEB9E84,  0x1C6ED2
-.pword 0x050705,  0xF46112,  0x849897,  0x969884,  0x1367F0,  0x040705
-.pword 0xD5691F,  0x849FE9,  0x938587,  0x1670E7,  0x040418,  0x751718
-.pword 0x8592E1,  0x9C8587,  0x6B5DEE,  0x07041E,  0x65101A,  0x9B91FC
-.pword 0x998484,  0x63CC94,  0x07051D,  0x6C1C05,  0x9E95C5,  0x9A8484
-.pword 0x78F890,  0x041B11,  0x151904,  0x9DED47,  0x858785,  0x4DE29D
-.pword 0x041914,  0x111B04,  0x90E57F,  0x84849A,  0xDFEA9E,  0x051C6F
-.pword 0x120507,  0x94CA60,  0x848499,  0xF39698,  0x1A1367,  0x1F0407
-.pword 0xE95768,  0x87849F,  0xE69385,  0x181776,  0x180404,  0xE17717
-.pword 0x878592,  0xEE9F85,  0x1F6B50,  0x1A0704,  0xF26413,  0x849B96
-.pword 0x949984,  0x1263C9,  0x050705,  0xD86C1C,  0x849EEA,  0x909A84
-.pword 0x117EFA,  0x04041B,  0x411519,  0x859DED,  0x9D8587,  0x1540E2
-.pword 0x040419,  0x7E111B,  0x9A90FA,  0x9E8484,  0x6FD9EA,  0x07051C
-.pword 0x601205,  0x9994C8,  0x9B8484,  0x64F296,  0x071A13,  0x6B1F04
-.pword 0x9FEE51,  0x858785,  0x77E192,  0x041817,  0x171804,  0x93E676
-.pword 0x848785,  0x57E99F,  0x041F68,  0x131A07,  0x96F367,  0x848498
-.pword 0xCA9798,  0x051260,  0x1C0507,  0xEADF6F,  0x87849E,  0xE5909A
-.pword 0x1B117F,  0x190404,  0xE24214,  0x87859D,  0xED9D85,  0x191547
-.pword 0x1B0404,  0xFB7911,  0x879A90,  0x959E84,  0x1C6CDA,  0x050705
-.pword 0xCF631D,  0x849994,  0x969B84,  0x1064FD,  0x04041A,  0x526B1E
-.pword 0x859CEE,  0x928587,  0x1775E1,  0x040418,  0x701618,  0x8593E7
-.pword 0x9F8487,  0x6855E9,  0x07041F,  0x671305,  0x9896F0,  0x988484
-.pword 0x60F597,  0x070512,  0x6F1C05,  0x9EEBDC,  0x9A8484,  0x7CE590
-.pword 0x041B11,  0x141904,  0x9DE24C,  0x858785,  0x45EC9C,  0x041E15
-.pword 0x101A04,  0x91F878,  0x84849B,  0xC79599,  0x051D6D,  0x1D0507
-.pword 0x94CD62,  0x848499,  0xFC919B,  0x1A1065,  0x1E0404,  0xEF5C6A
-.pword 0x87859C,  0xE09285,  0x181775,  0x180404,  0xE77316,  0x849A93
-.pword 0xE89F84,  0x1F69D7,  0x050405,  0xF66613,  0x849897,  0x979884
-.pword 0x1266F6,  0x050705,  0xD16E1F,  0x849FE8,  0x939A87,  0x1672E4
-.pword 0x04041B,  0x4B1418,  0x8592E0,  0x9C8587,  0x6A59EF,  0x07041E
-.pword 0x7A101A,  0x9B91FE,  0x998484,  0x6DC195,  0x07051D,  0x621D05
-.pword 0x9995C0,  0x9B8484,  0x7AFE91,  0x041A10,  0x6A1E04,  0x9CEC59
-.pword 0x858785,  0x48E392,  0x041914,  0x161B04,  0x93E472,  0x84879A
-.pword 0xD3EB9E,  0x051F6E,  0x120507,  0x97F461,  0x848498,  0xF19798
-.pword 0x051366,  0x1F0407,  0xE8D469,  0x87849F,  0xE7939A,  0x1B1673
-.pword 0x180404,  0xE04A17,  0x878592,  0xEF9C85,  0x1E6A5F,  0x1A0404
-.pword 0xFF6510,  0x849B91,  0x949984,  0x1D62C2,  0x050705,  0xC76D1D
-.pword 0x849995,  0x919B84,  0x107BF9,  0x04041A,  0x5A151E,  0x859CEC
-.pword 0x9D8587,  0x144FE3,  0x040419,  0x7C161B,  0x9A90E5,  0x9E8487
-.pword 0x6FDDEB,  0x07051C,  0x601205,  0x9897F5,  0x988484,  0x67F096
-.pword 0x071A13,  0x681F04,  0x9FE955,  0x858784,  0x71E693,  0x041816
-.pword 0x171804,  0x92E174,  0x858785,  0x52EE9C,  0x041E6B,  0x101A07
-.pword 0x96FD64,  0x84849B,  0xCE9499,  0x051D63,  0x1C0507,  0x95DA6C
-.pword 0x84849E,  0xFB909A,  0x1B1179,  0x190404,  0xED4615,  0x87859D
-.pword 0xE29D85,  0x191443,  0x1B0404,  0xE57E11,  0x849A90,  0xEA9E84
-.pword 0x1C6FDE,  0x050705,  0x84611D,  0xFE919B,  0x1A107A,  0x1E0404
-.pword 0xEC596A,  0x87859C,  0xE39285,  0x191448,  0x1B0404,  0xE47216
-.pword 0x879A93,  0xEB9E84,  0x1F6ED3,  0x050705,  0xF46112,  0x849897
-.pword 0x979884,  0x1366F1,  0x040705,  0xD4691F,  0x849FE8,  0x939A87
-.pword 0x1673E7,  0x04041B,  0x4A1718,  0x8592E0,  0x9C8587,  0x6A5FEF
-.pword 0x04041E,  0x65101A,  0x9B91FF,  0x998484,  0x62C294,  0x07051D
-.pword 0x6D1D05,  0x9995C7,  0x9B8484,  0x7BF991,  0x041A10,  0x151E04
-.pword 0x00EC5A        
@@ -1,497 +0,0 @@
-/******************************************************************************
-*  Speech.s developed by AccelWork Inc. for Microchip Technology Inc. 
-*  Copyright (c) 2005 by Microchip. All rights are reserved. 
-*  
-*  This Copyright notice may not be removed or modified without prior written 
-*  consent of Microchip Technology Inc. 
-******************************************************************************/
-
-/******************************************************************************
-*  Speech.s
-*
-*  Description:
-*    This file is generated by dsPIC33F Speech Encoder Utility Version 1.00
-*    It contains the ALAW compressed data for a 8kHz,16-bit speech signal.The
-*    output array represents a 64kbps encoded bit stream.
-*
-*    Speech Encoder Utility settings:
-*       Input Source:  Dtune.wav
-*       Output Array:  G711_Dtune
-*       Array Size:    8193 bytes                
-*       Target Memory: Program Memory
-*       LAW:           ALAW
-*
-*    Modification History:
-*
-*       Date           Author              Description
-*       ----           ------              -----------
-*
-*    Dec-16-2005    Taruna Singh		   Created
-*    Dec-20-2005    Taruna Singh		   Ready for Alpha Release
-*
-******************************************************************************/
-
-/* There are 2731 elements in the data array. */
-   
-/* Data file for storing 24-bit constants in program memory */
-
-.global _G711_Dtune
-
-.section .G711, code
-_G711_Dtune:
-.pword 0x9C8691,  0x1441EA,  0x04041B,  0xF6621C,  0x879A91,  0xE59285
-.pword 0x051265,  0x111A07,  0x9CE070,  0x9B8485,  0x69C497,  0x04041E
-.pword 0xDD6B19,  0x849894,  0xED9F84,  0x1A1675,  0x120507,  0x93F867
-.pword 0x858785,  0x61FD90,  0x07051D,  0x4D171B,  0x849FEF,  0xEA9984
-.pword 0x191554,  0x1F0404,  0x96CE6C,  0x85879B,  0x7CE19D,  0x070510
-.pword 0x791305,  0x859DE7,  0x969A87,  0x1F6DCA,  0x180404,  0xEB5315
-.pword 0x848499,  0x46EE9E,  0x071B17,  0x601C04,  0x9A91F3,  0x938587
-.pword 0x1264FA,  0x1A0705,  0xE27611,  0x84849C,  0xD89498,  0x041E68
-.pword 0x681E04,  0x9894D9,  0x9C8484,  0x1177E2,  0x05071A,  0xFA6412
-.pword 0x878593,  0xF3919A,  0x041C60,  0x171B04,  0x9EEE41,  0x998484
-.pword 0x1550EA,  0x040418,  0xCB6C1F,  0x879A96,  0xE69D85,  0x05137E
-.pword 0x100507,  0x9DE17F,  0x9B8485,  0x6CCE96,  0x04041F,  0x571519
-.pword 0x8499EA,  0xEE9E84,  0x1B1743,  0x1D0504,  0x90F260,  0x85879A
-.pword 0x67F893,  0x040512,  0x74161A,  0x849CED,  0x949884,  0x196BDD
-.pword 0x1E0404,  0x94C469,  0x84849B,  0x71E39C,  0x071A11,  0x651305
-.pword 0x8592E5,  0x919A87,  0x1C63F1,  0x180404,  0xE95A14,  0x84849E
-.pword 0x5CEB99,  0x041814,  0x6D1C04,  0x9A96F4,  0x928587,  0x1378E7
-.pword 0x050705,  0xE17210,  0x84859D,  0xC3979B,  0x041E6F,  0x6A1904
-.pword 0x9895D7,  0x9F8484,  0x1649EC,  0x05071B,  0xFF661D,  0x878590
-.pword 0xFF9085,  0x051D66,  0x161B04,  0x9FEC48,  0x988484,  0x6AD195
-.pword 0x040419,  0xC06E1E,  0x849B97,  0xE09D84,  0x051072,  0x130507
-.pword 0x92E47B,  0x9A8785,  0x62F796,  0x04041C,  0x5E1418,  0x849EE8
-.pword 0xE99E84,  0x181458,  0x1C0404,  0x91F662,  0x85879A,  0x7AE492
-.pword 0x070513,  0x70111A,  0x849CE0,  0x979B84,  0x1E6EC7,  0x190404
-.pword 0x95D36B,  0x848498,  0x75ED9F,  0x071A16,  0x671205,  0x8593F9
-.pword 0x908587,  0x1D61FC,  0x1B0705,  0xEF4C17,  0x84849F,  0x559599
-.pword 0x041915,  0x6F1F04,  0x9B97CC,  0x9D8587,  0x107CE1,  0x050705
-.pword 0xE77913,  0x87859D,  0xCA969A,  0x041F6D,  0x151804,  0x99EB53
-.pword 0x9E8484,  0x1746EE,  0x04041B,  0xF3601C,  0x879A91,  0xFA9385
-.pword 0x051264,  0x111A07,  0x9CE276,  0x988484,  0x68D894,  0x04041E
-.pword 0xDE681E,  0x849894,  0xE29C84,  0x1A1177,  0x120507,  0x93FB64
-.pword 0x858785,  0x60F290,  0x07041C,  0x40171B,  0x849EEE,  0xEA9984
-.pword 0x181556,  0x1F0404,  0x96C96C,  0x85879B,  0x7EE69D,  0x070510
-.pword 0x7F1005,  0x859DE6,  0x969B87,  0x1F6CC9,  0x180404,  0xEA5615
-.pword 0x848499,  0x43EE9E,  0x071B17,  0x601D04,  0x8590F2,  0x938587
-.pword 0x1267F8,  0x1A0705,  0xED7416,  0x84849C,  0xDC9498,  0x04196B
-.pword 0x691E04,  0x9894DA,  0x9C8484,  0x1171E3,  0x05071A,  0xE56512
-.pword 0x878592,  0xF1919A,  0x041C63,  0x141804,  0x9EE945,  0x998484
-.pword 0x145DEB,  0x040418,  0xF46D1F,  0x879A96,  0xE79285,  0x051378
-.pword 0x100507,  0x9DE17D,  0x9B8785,  0x6FCD97,  0x04041F,  0xD51519
-.pword 0x849995,  0xEF9F84,  0x1B164E,  0x1D0504,  0x90FC61,  0x858785
-.pword 0x66F993,  0x07051D,  0x4B161A,  0x849FEC,  0x959884,  0x196BD0
-.pword 0x1E0404,  0x97C66E,  0x84849B,  0x70E09C,  0x071A11,  0x7A1305
-.pword 0x8592E4,  0x919A87,  0x1C62F6,  0x180404,  0xE85914,  0x848499
-.pword 0x58E89E,  0x041814,  0x621C04,  0x9A91F6,  0x928587,  0x1365E5
-.pword 0x1A0705,  0xE37011,  0x84849C,  0xC7979B,  0x041E6E,  0x6B1904
-.pword 0x9895D3,  0x9F8484,  0x1675ED,  0x05071A,  0xF9671D,  0x878593
-.pword 0xFC9085,  0x051D61,  0x171B07,  0x9FEF4C,  0x998484,  0x15D595
-.pword 0x040419,  0xCD6F1F,  0x879B97,  0xE19D85,  0x05107D,  0x130507
-.pword 0x92E778,  0x9A8785,  0x6DF596,  0x04041F,  0x5D1418,  0x8499EB
-.pword 0xE99E84,  0x1B1444,  0x1C0404,  0x91F063,  0x85879A,  0x65E592
-.pword 0x070512,  0x76111A,  0x849CE3,  0x949884,  0x1E69DB,  0x190404
-.pword 0x94DF68,  0x848498,  0x74ED9C,  0x071A11,  0x641205,  0x8593FB
-.pword 0x908587,  0x1D60F2,  0x1B0704,  0xEE4017,  0x84849E,  0x56EA99
-.pword 0x041815,  0x6C1F04,  0x9B96C8,  0x9D8587,  0x107EE6,  0x050705
-.pword 0xE67F10,  0x87859D,  0xC9969B,  0x041F6C,  0x151804,  0x99EA56
-.pword 0x9E8484,  0x1740EE,  0x04071B,  0xF2601D,  0x878590,  0xFB9385
-.pword 0x051264,  0x161A07,  0x9CED74,  0x988484,  0x68DF94,  0x040419
-.pword 0xDA691E,  0x849894,  0xE39C84,  0x1A1171,  0x120507,  0x93E565
-.pword 0x9A8785,  0x63F091,  0x04041C,  0x44171B,  0x849EE9,  0xEB9984
-.pword 0x181552,  0x1F0404,  0x96F56D,  0x85879A,  0x79E792,  0x070513
-.pword 0x7C1005,  0x859DE1,  0x979B87,  0x1F6FCD,  0x190404,  0x95D515
-.pword 0x848499,  0x4CEF9F,  0x071B17,  0x611D05,  0x8590FC,  0x938587
-.pword 0x1D67F9,  0x1A0705,  0xED4A16,  0x84849F,  0xD39598,  0x04196B
-.pword 0x6E1E04,  0x9B97C6,  0x9C8484,  0x1173E0,  0x05071A,  0xE47A13
-.pword 0x878592,  0xF6919A,  0x041C62,  0x141804,  0x9EE859,  0x9E8484
-.pword 0x1459E8,  0x040418,  0xF7621C,  0x879A91,  0xE49285,  0x05137A
-.pword 0x101A07,  0x9CE073,  0x9B8484,  0x6EC697,  0x04041E,  0xD06B19
-.pword 0x849895,  0xEC9F84,  0x1B164B,  0x1D0507,  0x93FE66,  0x858785
-.pword 0x61FF90,  0x07051D,  0x4F161B,  0x849FEF,  0x959984,  0x196AD4
-.pword 0x1F0404,  0x97C26F,  0x85879B,  0x7DE19D,  0x070510,  0x781305
-.pword 0x8592E7,  0x969A87,  0x1F6DF4,  0x180404,  0xEB5C14,  0x848499
-.pword 0x5AE99E,  0x041B14,  0x631C04,  0x9A91F1,  0x928587,  0x1265E5
-.pword 0x1A0705,  0xE37111,  0x84849C,  0xC4979B,  0x041E69,  0x6B1904
-.pword 0x9894DD,  0x9F8484,  0x1675ED,  0x05071A,  0xF86712,  0x878593
-.pword 0xFD9085,  0x051D61,  0x171B07,  0x9FEF42,  0x998484,  0x1554EA
-.pword 0x040419,  0xCC6F1F,  0x849B97,  0xE19D85,  0x05107C,  0x130507
-.pword 0x9DE779,  0x9B8785,  0x6CCB96,  0x04041F,  0x501518,  0x8499EA
-.pword 0xEE9E84,  0x1B1741,  0x1D0504,  0x90F260,  0x85879A,  0x64FB93
-.pword 0x040512,  0x77161A,  0x849CE2,  0x949884,  0x1E68DE,  0x1E0404
-.pword 0x94D968,  0x848498,  0x77E29C,  0x071A11,  0x641205,  0x8593FA
-.pword 0x919A87,  0x1C60F3,  0x1B0404,  0xE94617,  0x84849E,  0x53EB99
-.pword 0x041815,  0x6C1F04,  0x9B96CB,  0x9D8587,  0x1379E6,  0x050705
-.pword 0xE17C10,  0x87859D,  0xCF979B,  0x041F6F,  0x151904,  0x999555
-.pword 0x9F8484,  0x174DEF,  0x05071B,  0xFD611D,  0x878590,  0xF99385
-.pword 0x051267,  0x161A07,  0x9FED75,  0x988484,  0x6BD295,  0x040419
-.pword 0xC4691E,  0x849B97,  0xE39C84,  0x1A1170,  0x130507,  0x92E465
-.pword 0x9A8785,  0x62F691,  0x04041C,  0x581418,  0x849EE8,  0xE89E84
-.pword 0x18145E,  0x1C0404,  0x91F762,  0x85879A,  0x7BE492,  0x070513
-.pword 0x72101A,  0x859DE0,  0x979B84,  0x1E6EC0,  0x190404,  0x95D66A
-.pword 0x848498,  0x49EC9F,  0x071B16,  0x661D05,  0x8590FF,  0x908587
-.pword 0x1D66FF,  0x1B0405,  0xEC4916,  0x84849F,  0xD69598,  0x04196A
-.pword 0x6E1E04,  0x9B97C3,  0x9D8584,  0x1072E0,  0x05071A,  0xE47B13
-.pword 0x878592,  0xF4969A,  0x041C62,  0x141804,  0x99E85F,  0x9E8484
-.pword 0x145BE9,  0x040418,  0xF6631C,  0x879A91,  0xE59285,  0x051365
-.pword 0x111A07,  0x9CE370,  0x9B8484,  0x69C497,  0x04041E,  0xDD6B19
-.pword 0x849894,  0xED9F84,  0x1A1675,  0x120507,  0x93F867,  0x858785
-.pword 0x61FD90,  0x04051D,  0x42171B,  0x849FEF,  0xEA9984,  0x191554
-.pword 0x1F0404,  0x96CF6F,  0x85879B,  0x7FE19D,  0x070510,  0x7E1005
-.pword 0x859DE6,  0x969B87,  0x1F6CCB,  0x180404,  0xEA5015,  0x848499
-.pword 0x46EE9E,  0x041B17,  0x601C04,  0x9A91F3,  0x938587,  0x1264FA
-.pword 0x1A0705,  0xE27611,  0x84849C,  0xD89498,  0x041E68,  0x681E04
-.pword 0x9894DE,  0x9C8484,  0x1177E2,  0x05071A,  0xFA6412,  0x878593
-.pword 0xF3909A,  0x041C60,  0x171B04,  0x9EEE41,  0x998484,  0x1550EA
-.pword 0x040418,  0xCB6C1F,  0x879A96,  0xE69D85,  0x05137E,  0x100507
-.pword 0x9DE17C,  0x9B8785,  0x6FCF96,  0x04041F,  0x541519,  0x8499EA
-.pword 0xEF9F84,  0x1B1742,  0x1D0507,  0x90FD61,  0x858785,  0x67F893
-.pword 0x070512,  0x75161A,  0x849FED,  0x959884,  0x196BD2,  0x1E0404
-.pword 0x97C469,  0x84849B,  0x70E39C,  0x071A11,  0x651205,  0x8592E5
-.pword 0x919A87,  0x1C63F1,  0x180404,  0xE95A14,  0x84849E,  0x5CE899
-.pword 0x041814,  0x6D1C04,  0x9A96F4,  0x928587,  0x137BE7,  0x050705
-.pword 0xE07210,  0x84859D,  0xC3979B,  0x041E6E,  0x6A1904,  0x9895D7
-.pword 0x9F8484,  0x164EEC,  0x05071B,  0xFF661D,  0x878590,  0xFE9085
-.pword 0x051D66,  0x161B04,  0x9FEC48,  0x988484,  0x6AD195,  0x040419
-.pword 0xC16E1E,  0x849B97,  0xE09D84,  0x1A1072,  0x130507,  0x92E47B
-.pword 0x9A8785,  0x62F791,  0x04041C,  0x5F1418,  0x8499E8,  0xE99E84
-.pword 0x18145B,  0x1C0404,  0x91F662,  0x85879A,  0x7AE492,  0x070513
-.pword 0x70111A,  0x849CE3,  0x979B84,  0x1E6EC7,  0x190404,  0x95D36B
-.pword 0x848498,  0x4AED9F,  0x071A16,  0x671205,  0x8593F9,  0x908587
-.pword 0x1D61FC,  0x1B0405,  0xEF4C17,  0x84849F,  0x559599,  0x041915
-.pword 0x6F1F04,  0x9B97CF,  0x9D8584,  0x107CE1,  0x050705,  0xE67E13
-.pword 0x87859D,  0xCB969B,  0x041F6C,  0x151804,  0x99EB50,  0x9E8484
-.pword 0x1746EE,  0x04041B,  0xF3601C,  0x879A91,  0xE59385,  0x051264
-.pword 0x111A07,  0x9CE277,  0x988484,  0x68D994,  0x04041E,  0xD9681E
-.pword 0x849894,  0xE29C84,  0x1A1176,  0x120507,  0x93FA64,  0x9A8785
-.pword 0x60F390,  0x04051D,  0x40171B,  0x849EEE,  0xEA9984,  0x181556
-.pword 0x1F0404,  0x96C96C,  0x85879B,  0x7EE69D,  0x070510,  0x7F1005
-.pword 0x859DE6,  0x969B87,  0x1F6CCE,  0x180404,  0xEA5715,  0x848499
-.pword 0x42EF9F,  0x041B17,  0x611D05,  0x8590FD,  0x938587,  0x1267F8
-.pword 0x1A0705,  0xED7516,  0x84849F,  0xDD9498,  0x04196B,  0x691E04
-.pword 0x9B94C5,  0x9C8484,  0x1171E3,  0x05071A,  0xE56512,  0x878592
-.pword 0xF1919A,  0x041C63,  0x141804,  0x9EE945,  0x998484,  0x145CEB
-.pword 0x040418,  0xF46D1C,  0x879A96,  0xE79285,  0x051378,  0x100507
-.pword 0x9DE072,  0x9B8785,  0x6EC397,  0x04041E,  0xD76A19,  0x849895
-.pword 0xEC9F84,  0x1B164E,  0x1D0507,  0x90FF61,  0x858785,  0x66FE93
-.pword 0x07051D,  0x4B161B,  0x849FEC,  0x959884,  0x196BD0,  0x1E0404
-.pword 0x97C66E,  0x84849B,  0x73E09C,  0x071A11,  0x7A1305,  0x8592E4
-.pword 0x919A87,  0x1C62F7,  0x180404,  0xE85914,  0x84849E,  0x59E89E
-.pword 0x041814,  0x621C04,  0x9A91F7,  0x928587,  0x137AE4,  0x1A0705
-.pword 0xE07311,  0x84849C,  0xC6979B,  0x041E6E,  0x6B1904,  0x9895D3
-.pword 0x9F8484,  0x164AED,  0x05071A,  0xF9671D,  0x878593,  0xFC9085
-.pword 0x051D61,  0x171B07,  0x9FEF4C,  0x998484,  0x15D595,  0x040419
-.pword 0xCD6F1F,  0x879B97,  0xE19D85,  0x05107D,  0x130507,  0x92E778
-.pword 0x9A8785,  0x6DF596,  0x04041F,  0x521518,  0x8499EB,  0xE99E84
-.pword 0x1B1744,  0x1C0404,  0x91F063,  0x85879A,  0x65E593,  0x070512
-.pword 0x76111A,  0x849CE3,  0x949884,  0x1E69DB,  0x190404,  0x94DF68
-.pword 0x848498,  0x74ED9C,  0x071A16,  0x641205,  0x8593FB,  0x908587
-.pword 0x1D60F2,  0x1B0405,  0xEE4317,  0x84849E,  0x56EA99,  0x041815
-.pword 0x6C1F04,  0x9B96C9,  0x9D8587,  0x107FE6,  0x050705,  0xE67F10
-.pword 0x87859D,  0xC9969B,  0x041F6C,  0x151804,  0x99EA56,  0x9E8484
-.pword 0x1740EE,  0x04071B,  0xF2601D,  0x878590,  0xFB9385,  0x051267
-.pword 0x161A07,  0x9FED74,  0x988484,  0x68DF94,  0x040419,  0xDA691E
-.pword 0x849B94,  0xE39C84,  0x1A1171,  0x120507,  0x93E565,  0x9A8785
-.pword 0x63F091,  0x04041C,  0x44171B,  0x849EE9,  0xEB9984,  0x18145D
-.pword 0x1F0404,  0x96F56D,  0x85879A,  0x79E792,  0x070513,  0x7C1005
-.pword 0x859DE1,  0x979B87,  0x1F6FCC,  0x190404,  0x95D515,  0x848499
-.pword 0x4DEF9F,  0x041B17,  0x611D05,  0x8590FD,  0x938587,  0x1D67F9
-.pword 0x1A0705,  0xEC4A16,  0x84849F,  0xD39598,  0x04196B,  0x6E1E04
-.pword 0x9B97C6,  0x9C8484,  0x1173E0,  0x05071A,  0xE47A13,  0x878592
-.pword 0xF6919A,  0x041C62,  0x141804,  0x9EE858,  0x9E8484,  0x1458E8
-.pword 0x040418,  0xF6621C,  0x879A91,  0xE49285,  0x05137A,  0x111A07
-.pword 0x9CE370,  0x9B8484,  0x69C797,  0x04041E,  0xD36B19,  0x849895
-.pword 0xED9F84,  0x1A164A,  0x1D0507,  0x93F966,  0x858785,  0x61FC90
-.pword 0x07051D,  0x4F161B,  0x849FEF,  0x959984,  0x196AD4,  0x1F0404
-.pword 0x97C36F,  0x84879B,  0x7DE19D,  0x070510,  0x781305,  0x8592E7
-.pword 0x969A87,  0x1F6DF4,  0x180404,  0xEB5C14,  0x848499,  0x5AE99E
-.pword 0x041B14,  0x631C04,  0x9A91F1,  0x928587,  0x1265E5,  0x1A0705
-.pword 0xE37111,  0x84849C,  0xC5949B,  0x041E69,  0x6B1904,  0x9894DC
-.pword 0x9C8484,  0x1674ED,  0x05071A,  0xF86712,  0x878593,  0xF29085
-.pword 0x051D60,  0x171B04,  0x9EEF43,  0x998484,  0x1557EA,  0x040418
-.pword 0xCE6C1F,  0x879B96,  0xE69D85,  0x05107F,  0x100507,  0x9DE67E
-.pword 0x9B8785,  0x6CCB96,  0x04041F,  0x511518,  0x8499EA,  0xEE9E84
-.pword 0x1B1741,  0x1C0504,  0x91F360,  0x85879A,  0x64FA93,  0x070512
-.pword 0x77111A,  0x849CE2,  0x949884,  0x1E68D9,  0x1E0404,  0x94D968
-.pword 0x848498,  0x76E29C,  0x071A11,  0x641205,  0x8593FA,  0x919A87
-.pword 0x1C63F0,  0x1B0404,  0xE94717,  0x84849E,  0x52EB99,  0x041815
-.pword 0x6D1F04,  0x9A96F5,  0x928587,  0x1379E7,  0x050705,  0xE17C10
-.pword 0x87859D,  0xCC979B,  0x041F6F,  0x151904,  0x9995D5,  0x9F8484
-.pword 0x174CEF,  0x05071B,  0xFC611D,  0x878590,  0xF99385,  0x051267
-.pword 0x161A07,  0x9FED75,  0x988484,  0x6BD295,  0x040419,  0xC4691E
-.pword 0x849B97,  0xE39C84,  0x1A1170,  0x130507,  0x92E465,  0x9A8785
-.pword 0x62F691,  0x04041C,  0x5B1418,  0x849EE9,  0xE89984,  0x18145E
-.pword 0x1C0404,  0x91F762,  0x85879A,  0x7BE492,  0x070513,  0x72101A
-.pword 0x849DE0,  0x979B84,  0x1E6EC0,  0x190404,  0x95D66A,  0x848498
-.pword 0x48EC9F,  0x071B16,  0x661D05,  0x8590FF,  0x908587,  0x1D66FF
-.pword 0x1B0705,  0xEC4916,  0x84849F,  0xD69598,  0x04196A,  0x6E1E04
-.pword 0x9B97C0,  0x9D8584,  0x1072E0,  0x05071A,  0xE47B13,  0x878592
-.pword 0xF4969A,  0x041C62,  0x141804,  0x99E85F,  0x9E8484,  0x145BE9
-.pword 0x040418,  0xF1631C,  0x879A91,  0xE59285,  0x051365,  0x111A07
-.pword 0x9CE370,  0x9B8484,  0x69C497,  0x04041E,  0xDD6B19,  0x849894
-.pword 0xED9F84,  0x1A1675,  0x120507,  0x93F867,  0x858785,  0x61FD90
-.pword 0x07041D,  0x42171B,  0x849EEF,  0xEA9984,  0x181554,  0x1F0404
-.pword 0x96CF6F,  0x85879B,  0x7CE19D,  0x070510,  0x791305,  0x859DE6
-.pword 0x969A87,  0x1F6CCA,  0x180404,  0xEB5315,  0x848499,  0x46EE9E
-.pword 0x041B17,  0x601C04,  0x9A91F3,  0x938587,  0x1264FA,  0x1A0705
-.pword 0xE27711,  0x84849C,  0xD99498,  0x041E68,  0x681E04,  0x9894D8
-.pword 0x9C8484,  0x1176E2,  0x05071A,  0xFA6412,  0x878593,  0xF0919A
-.pword 0x041C63,  0x171B04,  0x9EEE47,  0x998484,  0x1553EB,  0x040418
-.pword 0xCA6D1F,  0x879A96,  0xE79285,  0x051379,  0x100507,  0x9DE17C
-.pword 0x9B8785,  0x6FCF97,  0x04041F,  0x541519,  0x8499EA,  0xEF9F84
-.pword 0x1B1742,  0x1D0504,  0x90FD61,  0x858785,  0x67F893,  0x070512
-.pword 0x75161A,  0x849FED,  0x959884,  0x196BD2,  0x1E0404,  0x97C469
-.pword 0x84849B,  0x70E39C,  0x071A11,  0x651305,  0x8592E5,  0x919A87
-.pword 0x1C63F6,  0x180404,  0xE95B14,  0x84849E,  0x5FE899,  0x041814
-.pword 0x6D1C04,  0x9A96F4,  0x928587,  0x137BE7,  0x050705,  0xE07210
-.pword 0x84849D,  0xC3979B,  0x041F6E,  0x6A1904,  0x9895D6,  0x9F8484
-.pword 0x1649EC,  0x05041B,  0xFF661D,  0x878590,  0xFE9085,  0x051D66
-.pword 0x161B07,  0x9FEC48,  0x988484,  0x6AD195,  0x040419,  0xC16E1E
-.pword 0x849B97,  0xE09D85,  0x1A1173,  0x130507,  0x92E47B,  0x9A8785
-.pword 0x62F796,  0x04041C,  0x5E1418,  0x849EE8,  0xE99E84,  0x18145B
-.pword 0x1C0404,  0x91F662,  0x85879A,  0x65E592,  0x070513,  0x70111A
-.pword 0x849CE3,  0x979B84,  0x1E6EC7,  0x190404,  0x95D26B,  0x848498
-.pword 0x75ED9F,  0x071A16,  0x671205,  0x8593F8,  0x908587,  0x1D61FD
-.pword 0x1B0705,  0xEF4D17,  0x84849F,  0x54EA99,  0x041915,  0x6F1F04
-.pword 0x9B97CF,  0x9D8584,  0x107CE1,  0x050705,  0xE67913,  0x87859D
-.pword 0xCA969A,  0x041F6C,  0x151804,  0x99EB50,  0x9E8484,  0x1746EE
-.pword 0x04041B,  0xF3631C,  0x879A91,  0xFA9385,  0x051264,  0x111A07
-.pword 0x9CE276,  0x988484,  0x68D894,  0x04041E,  0xDE681E,  0x849894
-.pword 0xE29C84,  0x1A1177,  0x120507,  0x93FA64,  0x9A8785,  0x60F390
-.pword 0x04041C,  0x41171B,  0x849EEE,  0xEA9984,  0x181551,  0x1F0404
-.pword 0x96CB6C,  0x85879A,  0x7EE69D,  0x070510,  0x7F1005,  0x859DE6
-.pword 0x969B84,  0x1F6CCE,  0x190404,  0xEA5415,  0x848499,  0x42EF9F
-.pword 0x041B17,  0x611D05,  0x8590FD,  0x938587,  0x1267F8,  0x1A0705
-.pword 0xED7516,  0x84849F,  0xDC9498,  0x04196B,  0x691E04,  0x9894DA
-.pword 0x9C8484,  0x1171E3,  0x05071A,  0xE56512,  0x878592,  0xF1919A
-.pword 0x041C63,  0x141B04,  0x9EE945,  0x998484,  0x1452EB,  0x040418
-.pword 0xF46D1F,  0x879A96,  0xE79285,  0x051379,  0x100507,  0x9DE17D
-.pword 0x9B8784,  0x6FC297,  0x04041E,  0xD46A19,  0x849995,  0xEF9F84
-.pword 0x1B164F,  0x1D0507,  0x90FC61,  0x858785,  0x66FE93,  0x07051D
-.pword 0x4B161B,  0x849FEC,  0x959884,  0x196AD1,  0x1E0404,  0x97C16E
-.pword 0x85849B,  0x73E09D,  0x071A11,  0x7B1305,  0x8592E4,  0x919A87
-.pword 0x1C62F7,  0x180404,  0xE85E14,  0x84849E,  0x58E89E,  0x041814
-.pword 0x621C04,  0x9A91F6,  0x928587,  0x1365E4,  0x1A0705,  0xE37011
-.pword 0x84849C,  0xC7979B,  0x041E6E,  0x6B1904,  0x9895D3,  0x9F8484
-.pword 0x164AED,  0x05071A,  0xF9671D,  0x878593,  0xFC9085,  0x051D61
-.pword 0x171B07,  0x9FEF4F,  0x998484,  0x6AD595,  0x040419,  0xCD6F1F
-.pword 0x849B97,  0xE19D85,  0x05107D,  0x130507,  0x92E779,  0x9A8785
-.pword 0x6DF596,  0x04041F,  0x521518,  0x8499EB,  0xE99E84,  0x1B1444
-.pword 0x1C0404,  0x91F063,  0x85879A,  0x65E592,  0x070512,  0x71111A
-.pword 0x849CE3,  0x949B84,  0x1E69DA,  0x190404,  0x94DF68,  0x848498
-.pword 0x74ED9C,  0x071A16,  0x641205,  0x8593FB,  0x909A87,  0x1D60F2
-.pword 0x1B0405,  0xEE4017,  0x84849E,  0x56EA99,  0x041815,  0x6C1F04
-.pword 0x9B96C9,  0x9D8587,  0x107FE6,  0x050705,  0xE67F10,  0x87859D
-.pword 0xC9969B,  0x041F6C,  0x151804,  0x99EA56,  0x9E8484,  0x1740EE
-.pword 0x05041B,  0xF2601D,  0x879A90,  0xFB9385,  0x051264,  0x111A07
-.pword 0x9CE277,  0x988484,  0x68DF94,  0x04041E,  0xDB691E,  0x849894
-.pword 0xE39C84,  0x1A1176,  0x120507,  0x93E565,  0x9A8785,  0x63F091
-.pword 0x04041C,  0x44171B,  0x849EE9,  0xEB9984,  0x181552,  0x1F0404
-.pword 0x96F56D,  0x85879A,  0x78E792,  0x070513,  0x7D1005,  0x859DE1
-.pword 0x979B84,  0x1F6FC2,  0x190404,  0x95D46A,  0x848499,  0x4FEF9F
-.pword 0x071B16,  0x611D05,  0x8590FC,  0x938587,  0x1D66FE,  0x1A0705
-.pword 0xEC4A16,  0x84849F,  0xD09598,  0x04196B,  0x6E1E04,  0x9B97C6
-.pword 0x9C8484,  0x1173E0,  0x05071A,  0xE47A13,  0x878592,  0xF6919A
-.pword 0x041C62,  0x141804,  0x9EE859,  0x9E8484,  0x1459E8,  0x040418
-.pword 0xF7621C,  0x879A91,  0xE49285,  0x05137A,  0x111A07,  0x9CE073
-.pword 0x9B8484,  0x6EC197,  0x04041E,  0xD16A19,  0x849895,  0xEC9F84
-.pword 0x1B1648,  0x1D0507,  0x90FE66,  0x858785,  0x66FF90,  0x07051D
-.pword 0x4E161B,  0x849FEC,  0x959884,  0x196AD7,  0x1E0404,  0x97C26F
-.pword 0x85879B,  0x7DE19D,  0x070510,  0x781305,  0x8592E7,  0x969A87
-.pword 0x1F6DF4,  0x180404,  0xEB5C14,  0x848499,  0x45E99E,  0x071B14
-.pword 0x631C04,  0x9A91F1,  0x928587,  0x1265E5,  0x1A0705,  0xE37111
-.pword 0x87849C,  0xDA949B,  0x041E69,  0x6B1904,  0x9894DC,  0x9F8484
-.pword 0x1674ED,  0x05071A,  0xF86712,  0x878593,  0xFD9085,  0x051D61
-.pword 0x171B07,  0x9EEF42,  0x998484,  0x1554EA,  0x040418,  0xCE6F1F
-.pword 0x879B96,  0xE69D85,  0x05107F,  0x100507,  0x9DE67E,  0x9B8785
-.pword 0x6CC896,  0x04041F,  0x511518,  0x8499EA,  0xEE9E84,  0x1B1741
-.pword 0x1C0404,  0x90F360,  0x858785,  0x64FB93,  0x070512,  0x77111A
-.pword 0x849CE2,  0x949884,  0x196BDF,  0x1E0404,  0x94DB69,  0x848498
-.pword 0x76E29C,  0x071A11,  0x641205,  0x8593E5,  0x919A87,  0x1C63F0
-.pword 0x1B0404,  0xE94417,  0x84849E,  0x52EB99,  0x041815,  0x6D1F04
-.pword 0x9A96F5,  0x928587,  0x1378E7,  0x050705,  0xE17D10,  0x87859D
-.pword 0xCD979B,  0x041F6F,  0x151904,  0x999555,  0x9F8484,  0x174DEF
-.pword 0x05041B,  0xFC611D,  0x878590,  0xF99385,  0x051267,  0x161A07
-.pword 0x9FED75,  0x988484,  0x6BD395,  0x040419,  0xC76E1E,  0x849B97
-.pword 0xE39C84,  0x1A1170,  0x130507,  0x92E565,  0x9A8785,  0x62F691
-.pword 0x04041C,  0x5B1418,  0x849EE9,  0xE89984,  0x18145F,  0x1F0404
-.pword 0x91F46D,  0x85879A,  0x7BE792,  0x070513,  0x721005,  0x849CE0
-.pword 0x979B87,  0x1E6EC0,  0x190404,  0x95D16A,  0x848498,  0x4BEC9F
-.pword 0x071A16,  0x661D05,  0x8593FE,  0x908587,  0x1D66FF,  0x1B0705
-.pword 0xEC4E16,  0x84849F,  0xD79598,  0x04196A,  0x6F1E04,  0x9B97C3
-.pword 0x9D8584,  0x1072E0,  0x050705,  0xE77813,  0x878592,  0xF4969A
-.pword 0x041C6D,  0x141804,  0x99E85C,  0x9E8484,  0x145AE9,  0x040418
-.pword 0xF1631C,  0x849A91,  0xE59285,  0x051365,  0x111A07,  0x9CE371
-.pword 0x988484,  0x69C594,  0x04041E,  0xDD6B19,  0x849894,  0xED9F84
-.pword 0x1A1675,  0x120507,  0x93F867,  0x858785,  0x61FD90,  0x04051D
-.pword 0x42171B,  0x849FEF,  0xEA9984,  0x191554,  0x1F0404,  0x96CF6F
-.pword 0x85879B,  0x7CE19D,  0x070510,  0x7E1305,  0x859DE6,  0x969B87
-.pword 0x1F6CCA,  0x180404,  0xEB5015,  0x848499,  0x46EE9E,  0x041B17
-.pword 0x601C04,  0x9A91F3,  0x938587,  0x1264FA,  0x1A0705,  0xE27711
-.pword 0x84849C,  0xD99498,  0x041E68,  0x681E04,  0x9894D9,  0x9C8484
-.pword 0x1176E2,  0x05071A,  0xFA6412,  0x878593,  0xF3919A,  0x041C60
-.pword 0x171B04,  0x9EEE46,  0x998484,  0x1550EB,  0x040418,  0xCA6C1F
-.pword 0x879A96,  0xE69D85,  0x05137E,  0x100507,  0x9DE17C,  0x9B8785
-.pword 0x6FCF96,  0x04041F,  0x541519,  0x8499EA,  0xEF9E84,  0x1B1742
-.pword 0x1D0507,  0x90FD61,  0x858785,  0x67F893,  0x070512,  0x75161A
-.pword 0x849FED,  0x949884,  0x196BDD,  0x1E0404,  0x97C469,  0x84849B
-.pword 0x70E39C,  0x071A11,  0x651205,  0x8592E5,  0x919A87,  0x1C63F1
-.pword 0x1B0404,  0xE95A14,  0x84849E,  0x5FEB99,  0x041814,  0x6D1F04
-.pword 0x9A96F4,  0x928587,  0x137BE7,  0x050705,  0xE07210,  0x87849D
-.pword 0xC3979B,  0x041E6E,  0x6A1904,  0x9895D6,  0x9F8484,  0x1649EC
-.pword 0x05071B,  0xFF661D,  0x878590,  0xFE9085,  0x051D66,  0x161B07
-.pword 0x9FEC48,  0x988484,  0x6AD695,  0x040419,  0xC06E1E,  0x879B97
-.pword 0xE09C84,  0x051072,  0x130507,  0x92E47B,  0x9A8785,  0x62F791
-.pword 0x04041F,  0x5F1418,  0x8499E8,  0xE89E84,  0x18145B,  0x1C0404
-.pword 0x91F162,  0x85879A,  0x65E592,  0x070512,  0x70111A,  0x849CE3
-.pword 0x949B84,  0x1E69C4,  0x190404,  0x94DD6B,  0x848498,  0x75ED9F
-.pword 0x071A16,  0x671205,  0x8593F8,  0x908587,  0x1D61FD,  0x1B0705
-.pword 0xEF4D17,  0x84849F,  0x559599,  0x041915,  0x6F1F04,  0x9B97CC
-.pword 0x9D8587,  0x107CE1,  0x050705,  0xE77913,  0x87859D,  0xCA969A
-.pword 0x041F6D,  0x151804,  0x99EB52,  0x9E8484,  0x1744E9,  0x04041B
-.pword 0xF0631C,  0x879A91,  0xE59385,  0x051265,  0x111A07,  0x9CE276
-.pword 0x988484,  0x69DB94,  0x04041E,  0xDE681E,  0x849894,  0xE29C84
-.pword 0x1A1177,  0x120507,  0x93FB64,  0x9A8785,  0x60F391,  0x04051D
-.pword 0x40171B,  0x849EEE,  0xEA9984,  0x181551,  0x1F0404,  0x96C86C
-.pword 0x85879B,  0x7EE69D,  0x070510,  0x7F1005,  0x859DE6,  0x969B87
-.pword 0x1F6FCE,  0x180404,  0xEA5415,  0x848499,  0x43EF9E,  0x041B17
-.pword 0x601D05,  0x8590FD,  0x938587,  0x1267F8,  0x1A0705,  0xED7416
-.pword 0x84849C,  0xDC9498,  0x041968,  0x691E04,  0x9B94DA,  0x9C8484
-.pword 0x1171E3,  0x05071A,  0xE56512,  0x878592,  0xF1919A,  0x041C63
-.pword 0x141B04,  0x9EE945,  0x998484,  0x145DEB,  0x040418,  0xF56D1F
-.pword 0x879A96,  0xE79285,  0x051378,  0x100507,  0x9DE17D,  0x9B8485
-.pword 0x6FC297,  0x04041F,  0xD46A19,  0x849995,  0xEF9F84,  0x1B164E
-.pword 0x1D0507,  0x90FF66,  0x858785,  0x66FE93,  0x07051D,  0x4B161B
-.pword 0x849FEC,  0x959884,  0x196AD1,  0x1E0404,  0x97C16E,  0x84849B
-.pword 0x73E09C,  0x071A11,  0x7B1305,  0x8592E4,  0x919A87,  0x1C62F7
-.pword 0x180404,  0xE85E14,  0x84849E,  0x5BE89E,  0x041814,  0x621C04
-.pword 0x9A91F6,  0x928587,  0x1365E4,  0x1A0705,  0xE37011,  0x84849C
-.pword 0xC7979B,  0x041E69,  0x6B1904,  0x9895D3,  0x9F8484,  0x164AED
-.pword 0x05071A,  0xF96712,  0x878593,  0xFC9085,  0x051D61,  0x171B07
-.pword 0x9FEF4F,  0x998484,  0x6AD595,  0x040419,  0xCD6F1F,  0x879B97
-.pword 0xE19D85,  0x05107D,  0x130507,  0x92E778,  0x9A8785,  0x6DF596
-.pword 0x04041F,  0x521518,  0x8499EB,  0xE99E84,  0x1B1744,  0x1C0404
-.pword 0x91F063,  0x85879A,  0x64E593,  0x070512,  0x76111A,  0x849CE2
-.pword 0x949884,  0x1E69DB,  0x1E0404,  0x94DE68,  0x848498,  0x77E29C
-.pword 0x071A11,  0x641205,  0x8593FB,  0x909A87,  0x1D60F2,  0x1B0404
-.pword 0xEE4017,  0x84849E,  0x56EA99,  0x041815,  0x6C1F04,  0x9B96C9
-.pword 0x9D8587,  0x107FE6,  0x050705,  0xE67E10,  0x87859D,  0xC8969B
-.pword 0x041F6C,  0x151804,  0x99EA56,  0x9E8484,  0x1740EE,  0x04071B
-.pword 0xF2601D,  0x878590,  0xFB9385,  0x051267,  0x161A07,  0x9CED74
-.pword 0x988484,  0x68DC94,  0x040419,  0xDA691E,  0x849894,  0xE39C84
-.pword 0x1A1171,  0x120507,  0x93E565,  0x9A8785,  0x63F091,  0x07041C
-.pword 0x44171B,  0x849EE9,  0xEB9984,  0x18145D,  0x1F0404,  0x96F46D
-.pword 0x85879A,  0x78E792,  0x070513,  0x7D1005,  0x849DE1,  0x979B87
-.pword 0x1E6FC2,  0x190404,  0x95D46A,  0x848499,  0x4FEF9F,  0x071B17
-.pword 0x611D05,  0x8590FC,  0x938587,  0x1D66F9,  0x1A0705,  0xED4A16
-.pword 0x84849F,  0xD09598,  0x04196B,  0x6E1E04,  0x9B97C6,  0x9C8584
-.pword 0x1173E0,  0x05071A,  0xE47A13,  0x848592,  0xF6919A,  0x041C62
-.pword 0x141804,  0x9EE858,  0x9E8484,  0x1459E8,  0x040418,  0xF7621C
-.pword 0x879A91,  0xE49285,  0x05137A,  0x111A07,  0x9CE073,  0x9B8484
-.pword 0x6EC697,  0x04041E,  0xD36B19,  0x849895,  0xEC9F84,  0x1A164B
-.pword 0x1D0507,  0x93F967,  0x858785,  0x61FC90,  0x07051D,  0x4F161B
-.pword 0x849FEF,  0x959984,  0x196AD4,  0x1F0404,  0x97C26F,  0x85879B
-.pword 0x7DE19D,  0x070510,  0x781305,  0x8592E7,  0x969A87,  0x1F6DF4
-.pword 0x180404,  0xEB5D14,  0x848499,  0x45E99E,  0x041B14,  0x631C04
-.pword 0x9A91F1,  0x928587,  0x1265E5,  0x1A0705,  0xE37111,  0x84849C
-.pword 0xC5949B,  0x041E69,  0x6B1904,  0x9894DC,  0x9F8484,  0x1674ED
-.pword 0x05071A,  0xF86712,  0x878593,  0xFD9085,  0x051D60,  0x171B07
-.pword 0x9EEE42,  0x998484,  0x1557EA,  0x040418,  0xCE6C1F,  0x879B96
-.pword 0xE69D85,  0x05107F,  0x130507,  0x9DE67E,  0x9B8785,  0x6CC896
-.pword 0x04041F,  0x511518,  0x8499EA,  0xEE9E84,  0x1B1741,  0x1D0404
-.pword 0x90F360,  0x85879A,  0x64FB93,  0x070512,  0x77111A,  0x849CE2
-.pword 0x949884,  0x1E68DE,  0x1E0404,  0x94D868,  0x848498,  0x76E29C
-.pword 0x071A11,  0x651205,  0x8593E5,  0x919A87,  0x1C63F0,  0x1B0404
-.pword 0xE94417,  0x84849E,  0x52EB99,  0x041815,  0x6D1F04,  0x9A96F5
-.pword 0x928587,  0x1379E7,  0x050705,  0xE17C10,  0x87859D,  0xCD979B
-.pword 0x041F6F,  0x151904,  0x9995D5,  0x9F8484,  0x174CEF,  0x05041B
-.pword 0xFC611D,  0x878590,  0xF99385,  0x051267,  0x161A07,  0x9FED75
-.pword 0x988484,  0x6BD295,  0x040419,  0xC7691E,  0x849B97,  0xE39C84
-.pword 0x1A1170,  0x130507,  0x92E565,  0x9A8785,  0x62F691,  0x04041C
-.pword 0x5B1418,  0x849EE9,  0xE89E84,  0x18145F,  0x1C0404,  0x91F762
-.pword 0x85879A,  0x7BE492,  0x070513,  0x731005,  0x849DE0,  0x979B84
-.pword 0x1E6EC0,  0x190404,  0x95D16A,  0x848498,  0x48EC9F,  0x071B16
-.pword 0x661D05,  0x8590FE,  0x908587,  0x1D66FF,  0x1B0705,  0xEC4916
-.pword 0x84849F,  0xD79598,  0x04196A,  0x6E1E04,  0x9B97C3,  0x9D8584
-.pword 0x1072E0,  0x05071A,  0xE47B13,  0x878592,  0xF4969A,  0x041C6D
-.pword 0x141804,  0x99E85F,  0x9E8484,  0x145AE9,  0x040418,  0xF1631C
-.pword 0x879A91,  0xE59285,  0x051265,  0x111A07,  0x9CE370,  0x9B8484
-.pword 0x69C497,  0x04041E,  0xDD6B19,  0x849894,  0xED9F84,  0x1A1675
-.pword 0x120507,  0x93F867,  0x858785,  0x61FD90,  0x04051D,  0x4D171B
-.pword 0x849FEF,  0xEA9984,  0x191554,  0x1F0404,  0x96CF6F,  0x85849B
-.pword 0x7CE19D,  0x070510,  0x7E1305,  0x859DE6,  0x969B87,  0x1F6CCB
-.pword 0x180404,  0xEB5015,  0x848499,  0x46EE9E,  0x041B17,  0x601C04
-.pword 0x9A91F3,  0x938587,  0x1264FA,  0x1A0705,  0xE27711,  0x84849C
-.pword 0xD99498,  0x041E68,  0x681E04,  0x9894D9,  0x9C8484,  0x1177E2
-.pword 0x05071A,  0xFA6412,  0x878593,  0xF3919A,  0x041C60,  0x171B07
-.pword 0x9EEE46,  0x998484,  0x1553EB,  0x040418,  0xCA6C1F,  0x879A96
-.pword 0xE69D85,  0x05137E,  0x100507,  0x9DE17C,  0x9B8785,  0x6FCF96
-.pword 0x04041F,  0x551519,  0x849995,  0xEF9F84,  0x1B174D,  0x1D0507
-.pword 0x90FD61,  0x858785,  0x67F993,  0x070512,  0x75161A,  0x849FED
-.pword 0x959884,  0x196BD2,  0x1E0404,  0x97C469,  0x84849B,  0x70E39C
-.pword 0x071A11,  0x651205,  0x8592E4,  0x919A87,  0x1C62F6,  0x180404
-.pword 0xE95B14,  0x84849E,  0x5EE899,  0x041814,  0x621C04,  0x9A91F7
-.pword 0x928587,  0x137BE4,  0x050705,  0xE07210,  0x84859D,  0xC3979B
-.pword 0x041E6E,  0x6A1904,  0x9895D7,  0x9F8484,  0x1649EC,  0x05041B
-.pword 0xFF661D,  0x878590,  0xFE9085,  0x051D66,  0x161B07,  0x9FEC48
-.pword 0x988484,  0x6AD695,  0x040419,  0xC06E1E,  0x849B97,  0xE09D85
-.pword 0x1A1072,  0x130507,  0x92E47B,  0x9A8785,  0x62F791,  0x04041C
-.pword 0x5E1418,  0x8499E8,  0xE89E84,  0x18145B,  0x1C0404,  0x91F662
-.pword 0x85879A,  0x65E492,  0x070513,  0x70111A,  0x849CE3,  0x979B87
-.pword 0x1E69C7,  0x190404,  0x95D26B,  0x848498,  0x75ED9F,  0x071A16
-.pword 0x671D05,  0x8593F9,  0x908587,  0x1D61FC,  0x1B0705,  0xEF4C17
-.pword 0x84849F,  0xD59599,  0x041915,  0x6F1F04,  0x9B97CC,  0x9D8584
-.pword 0x107CE1,  0x050705,  0xE77913,  0x878592,  0xF5969A,  0x041F6D
-.pword 0x151804,  0x99EB53,  0x9E8484,  0x1747E9,  0x04041B,  0xF0631C
-.pword 0x879A91,  0xFA9385,  0x051264,  0x111A07,  0x9CE276,  0x988484
-.pword 0x68D894,  0x04041E,  0xDE681E,  0x849894,  0xE29C84,  0x1A1177
-.pword 0x120507,  0x93FA64,  0x9A8785,  0x60F391,  0x04041C,  0x41171B
-.pword 0x849EEE,  0xEA9984,  0x181550,  0x1F0404,  0x96CB6C,  0x85879B
-.pword 0x7EE69D,  0x070510,  0x7F1005,  0x859DE1,  0x969B87,  0x1F6CCE
-.pword 0x180404,  0xEA5715,  0x848499,  0x42EF9E,  0x071B17,  0x611D05
-.pword 0x8590FD,  0x938587,  0x1267F8,  0x1A0705,  0xED7416,  0x84849F
-.pword 0xDC9498,  0x04196B,  0x691E04,  0x9B94DA,  0x9C8487,  0x1170E3
-.pword 0x05071A,  0xE56512,  0x878592,  0xF1919A,  0x041C63,  0x141B04
-.pword 0x9EE95A,  0x998484,  0x145CEB,  0x040418,  0xF46D1F,  0x879A96
-.pword 0xE79285,  0x051378,  0x100507,  0x9DE172,  0x9B8485,  0x6FC397
-.pword 0x04041F,  0xD76A19,  0x849995,  0xEC9F84,  0x1B164E,  0x1D0504
-.pword 0x90FF66,  0x858785,  0x66FE90,  0x07051D,  0x48161B,  0x849FEC
-.pword 0x959884,  0x196AD1,  0x1E0404,  0x97C06E,  0x84849B,  0x72E09D
-.pword 0x071A10,  0x7B1305,  0x8592E4,  0x919A87,  0x1C62F7,  0x180404
-.pword 0xE85E14,  0x84849E,  0x58E89E,  0x041814,  0x621C04,  0x9A91F6
-.pword 0x928587,  0x137AE4,  0x1A0705,  0xE07311,  0x84849C,  0xC6979B
-.pword 0x041E6E,  0x6B1904,  0x9895D0,  0x9F8484,  0x164AEC,  0x05071A
-.pword 0xF9671D,  0x878593,  0xFC9085,  0x051D61,  0x171B04,  0x9FEF4C
-.pword 0x998484,  0x15D595,  0x040419,  0xCD6F1F,  0x849B97,  0xE19D85
-.pword 0x05107D,  0x130507,  0x92E779,  0x9A8785,  0x6DF596,  0x04041F
-.pword 0x521518,  0x8499EB,  0xE99E84,  0x1B1744,  0x1C0404,  0x91F063
-.pword 0x85879A,  0x65E593,  0x070512,  0x71111A,  0x849CE3,  0x949B84
-.pword 0x1E69DA,  0x190404,  0x94DC6B,  0x848498,  0x74ED9F,  0x071A16
-.pword 0x641205,  0x8593FB,  0x908587,  0x1C60F2,  0x1B0704,  0xEE4017
-.pword 0x84849E,  0x51EA99,  0x041815,  0x6C1F04,  0x9B96C8,  0x9D8587
-.pword 0x107EE6,  0x050705,  0xE67F10,  0x87859D,  0xC9969B,  0x041F6C
-.pword 0x151804,  0x99EA56,  0x9E8484,  0x1743EE,  0x05041B,  0xF2601D
-.pword 0x878590,  0xFB9385,  0x051264,  0x111A07,  0x9FED74,  0x988484
-.pword 0x68DF94,  0x04041E,  0xDB691E,  0x849894,  0xE39C84,  0x1A1171
-.pword 0x120507,  0x93E565,  0x9A8785,  0x63F091,  0x04041C,  0x44171B
-.pword 0x849EE9,  0xEB9984,  0x181552,  0x1F0404,  0x96F56D,  0x85879A
-.pword 0x78E792,  0x070513,  0x7D1005,  0x859DE1,  0x979B84,  0x1F6FC2
-.pword 0x190404,  0x95D46A,  0x848499,  0x4FEF9F,  0x041B17,  0x611D05
-.pword 0x8590FC,  0x938587,  0x1D66F9,  0x1A0705,  0xEC4B16,  0x84849F
-.pword 0xD39598,  0x04196B,  0x6E1E04,  0x9B97C6,  0x9C8484,  0x1173E3
-.pword 0x05071A,  0xE47A13,  0x878592,  0xF6919A,  0x041C62,  0x141804
-.pword 0x9EE858,  0x998484,  0x145EE8,  0x040418,  0xF7621C,  0x879A91
-.pword 0xE49285,  0x05137B,  0x101A07,  0x9CE072,  0x9B8784,  0x6EC197
-.pword 0x04041E,  0xD06A19,  0x849895,  0xEC9F84,  0x1A164B,  0x1D0507
-.pword 0x93F966,  0x858785,  0x61FC90,  0x07051D,  0x4C161B,  0x849FEF
-.pword 0x959984,  0x196A55,  0x1F0404,  0x97CC6E,  0x84849B,  0x72E19D
-.pword 0x071A10,  0x8590F2,  0x938587,  0x1264FB,  0x1A0705,  0xED7411
-.pword 0x84849F,  0xDF9498,  0x041E68,  0x691E04,  0x9894DB,  0x9C8484
-.pword 0x1171E3,  0x05071A,  0xE56512,  0x878593,  0xF0919A,  0x041C63
-.pword 0x171B04,  0x9EE944,  0x998484,  0x1552EB,  0x040418,  0xF56D1F
-.pword 0x879A96,  0xE79285,  0x051378,  0x100507,  0x9DE17D,  0x9B8485
-.pword 0x6FC297,  0x04041F,  0xD46A19,  0x849995,  0xEF9F84,  0x1B174F
-.pword 0x1D0504,  0x90FC61,  0x858785,  0x66F993,  0x07051D,  0x4B161A
-.pword 0x849FEC,  0x959884,  0x196BD3,  0x1E0404,  0x97C66E,  0x84849B
-.pword 0x73E39C,  0x071A11,  0x7A1305,  0x8592E4,  0x919A87,  0x1C62F6
-.pword 0x000404        
@@ -1,497 +0,0 @@
-/******************************************************************************
-*  Speech.s developed by AccelWork Inc. for Microchip Technology Inc. 
-*  Copyright (c) 2005 by Microchip. All rights are reserved. 
-*  
-*  This Copyright notice may not be removed or modified without prior written 
-*  consent of Microchip Technology Inc. 
-******************************************************************************/
-
-/******************************************************************************
-*  Speech.s
-*
-*  Description:
-*    This file is generated by dsPIC33F Speech Encoder Utility Version 1.00
-*    It contains the ALAW compressed data for a 8kHz,16-bit speech signal.The
-*    output array represents a 64kbps encoded bit stream.
-*
-*    Speech Encoder Utility settings:
-*       Input Source:  Ftune.wav
-*       Output Array:  G711_Ftune
-*       Array Size:    8193 bytes                
-*       Target Memory: Program Memory
-*       LAW:           ALAW
-*
-*    Modification History:
-*
-*       Date           Author              Description
-*       ----           ------              -----------
-*
-*    Dec-16-2005    Taruna Singh		   Created
-*    Dec-20-2005    Taruna Singh		   Ready for Alpha Release
-*
-******************************************************************************/
-
-/* There are 2731 elements in the data array. */
-   
-/* Data file for storing 24-bit constants in program memory */
-
-.global _G711_Ftune
-
-.section .G711, code
-_G711_Ftune:
-.pword 0x7995EB,  0x040413,  0xE0651F,  0x85849E,  0x6ACE90,  0x1A071B
-.pword 0x91DA14,  0x998485,  0x1D78ED,  0x1D0404,  0x99EC7E,  0x918584
-.pword 0x1A14D9,  0x6B1B07,  0x8593CA,  0xE19F84,  0x041F67,  0x761304
-.pword 0x8798E9,  0x569785,  0x070516,  0xF26E18,  0x848492,  0x63E59C
-.pword 0x05041E,  0x954C10,  0x9A879B,  0x114495,  0x190405,  0x9DFB6D
-.pword 0x9D8484,  0x196CFE,  0x110504,  0x9A945E,  0xEB9B87,  0x05134A
-.pword 0x611F04,  0x849FE7,  0xF19384,  0x071869,  0xD71705,  0x878596
-.pword 0x73EE98,  0x040412,  0xE3641C,  0x85849E,  0x15CF90,  0x1A071B
-.pword 0x91C514,  0x998785,  0x1D7BED,  0x1D0404,  0x99EC7E,  0x918587
-.pword 0x1A14DE,  0x6B1B07,  0x8593F5,  0xE19F84,  0x041F66,  0x761304
-.pword 0x8798E8,  0x51979A,  0x070516,  0xF26E18,  0x848492,  0x63E59C
-.pword 0x05041E,  0x954D10,  0x9A879B,  0x114495,  0x190405,  0x9DFB62
-.pword 0x9D8484,  0x196CFF,  0x160504,  0x9A945F,  0xEB9B87,  0x051375
-.pword 0x611F04,  0x849FE7,  0xF69384,  0x071868,  0xD1171A,  0x878596
-.pword 0x7DEE98,  0x040412,  0xE3651C,  0x85849E,  0x15C290,  0x1A071B
-.pword 0x91C615,  0x9E8485,  0x1C7AE2,  0x1D0404,  0x99EF7C,  0x968584
-.pword 0x1A14DD,  0x6B1807,  0x8593F4,  0xE19F84,  0x041F66,  0x771304
-.pword 0x8798E8,  0x50979A,  0x070516,  0xFD6F18,  0x848492,  0x63E59C
-.pword 0x05041E,  0x954210,  0x9A879B,  0x114695,  0x1E0405,  0x9CFA62
-.pword 0x9D8484,  0x196FFC,  0x160504,  0x9A945D,  0xEB9887,  0x051374
-.pword 0x661F04,  0x849FE6,  0xF79384,  0x071868,  0xD3171A,  0x878596
-.pword 0x7CEF99,  0x040412,  0xE2651C,  0x85849E,  0x15C090,  0x1B071B
-.pword 0x90C015,  0x9E8485,  0x1C65E2,  0x120404,  0x99EF7C,  0x968584
-.pword 0x1A17D2,  0x681807,  0x8493F4,  0xE69F84,  0x041F66,  0x771304
-.pword 0x8798E8,  0x52979A,  0x070516,  0xFC6F19,  0x848492,  0x62E59C
-.pword 0x05041E,  0x954010,  0x9B879B,  0x104095,  0x1E0405,  0x9CE562
-.pword 0x9D8484,  0x196FFC,  0x160507,  0x9A9752,  0xE89887,  0x041374
-.pword 0x661F04,  0x849FE6,  0xF79384,  0x071868,  0xD3171A,  0x878596
-.pword 0x7CEF99,  0x040412,  0xE2651C,  0x85849E,  0x15C390,  0x1A071B
-.pword 0x90C015,  0x9E8485,  0x1C7AE2,  0x1D0404,  0x99EF7C,  0x968587
-.pword 0x1A17D2,  0x681807,  0x8493F7,  0xE69F84,  0x041F66,  0x741304
-.pword 0x879BEB,  0x5D979A,  0x070516,  0xFC6F19,  0x84849D,  0x62FA9C
-.pword 0x05041E,  0x954010,  0x9B879B,  0x104095,  0x1E0405,  0x9CE563
-.pword 0x928484,  0x196FFC,  0x160504,  0x9A9752,  0xE89887,  0x051377
-.pword 0x661F04,  0x849FE6,  0xF49385,  0x071868,  0xD2171A,  0x848596
-.pword 0x7CEF99,  0x040412,  0xE27A1C,  0x85849E,  0x15C190,  0x1B071B
-.pword 0x90C315,  0x9E8485,  0x1C65E3,  0x120404,  0x99EF7D,  0x968587
-.pword 0x1A17D0,  0x681807,  0x8493F7,  0xE69F84,  0x041F61,  0x741305
-.pword 0x879BEB,  0x5D949A,  0x040516,  0xFC6F19,  0x84849D,  0x62FA9C
-.pword 0x05041E,  0x954111,  0x9B879A,  0x104295,  0x1E0405,  0x9CE563
-.pword 0x928484,  0x186FFD,  0x160507,  0x9A9750,  0xE89887,  0x041376
-.pword 0x661F04,  0x849FE1,  0xF49384,  0x071B6B,  0xDC141A,  0x878596
-.pword 0x7FEC99,  0x04041D,  0xE27A1C,  0x85849E,  0x15C691,  0x1B071A
-.pword 0x90CD15,  0x9E8485,  0x1C65E3,  0x120404,  0x98EE72,  0x968587
-.pword 0x1A17D1,  0x681807,  0x8493F6,  0xE79F84,  0x041F61,  0x751305
-.pword 0x879BEB,  0x5F949A,  0x070516,  0xFF6C19,  0x84849D,  0x62FB9C
-.pword 0x050419,  0x954711,  0x9B879A,  0x104D95,  0x1E0405,  0x9CE563
-.pword 0x928484,  0x186EF2,  0x160507,  0x9A9751,  0xE89887,  0x041376
-.pword 0x671F04,  0x849FE1,  0xF59385,  0x071B6B,  0xDF141A,  0x878591
-.pword 0x7FEC99,  0x04041D,  0xE27B1D,  0x858499,  0x15C491,  0x1B071A
-.pword 0x90CC15,  0x9E8485,  0x1C64E3,  0x120404,  0x98EE72,  0x968584
-.pword 0x1A17D6,  0x691807,  0x8493F6,  0xE79F84,  0x041F61,  0x4A1305
-.pword 0x879BEB,  0x5E949A,  0x040516,  0xFF6C19,  0x84849D,  0x6DFB9D
-.pword 0x050419,  0x954411,  0x9B879A,  0x104C95,  0x1E0405,  0x9CE463
-.pword 0x928484,  0x186EF3,  0x160507,  0x859757,  0xE99887,  0x041271
-.pword 0x671F04,  0x849EE1,  0xCB9385,  0x071B6A,  0xD9141A,  0x848591
-.pword 0x7EEC99,  0x04041D,  0xED781D,  0x858499,  0x14C591,  0x1B071A
-.pword 0x90CF6A,  0x9E8485,  0x1C64E0,  0x120404,  0x98EE73,  0x968587
-.pword 0x0517D4,  0x691807,  0x8492F1,  0xE79F84,  0x041F61,  0x4B1005
-.pword 0x879BEB,  0x59949A,  0x040511,  0xFE6C19,  0x84849D,  0x6DF89D
-.pword 0x050419,  0x944511,  0x9B879A,  0x104F95,  0x1E0405,  0x9CE460
-.pword 0x928484,  0x186EF3,  0x160507,  0x859754,  0xE99887,  0x041270
-.pword 0x671F04,  0x849EE0,  0xC89385,  0x071B6A,  0xD8141A,  0x878591
-.pword 0x79EC99,  0x04041D,  0xED781D,  0x858499,  0x14DA91,  0x1B071A
-.pword 0x90CE6A,  0x9E8485,  0x1C64E0,  0x120404,  0x98E970,  0x978587
-.pword 0x0517D5,  0x691807,  0x8492F0,  0xE49C84,  0x041E60,  0x481005
-.pword 0x879BEA,  0x58949A,  0x040511,  0xF96D19,  0x84849D,  0x6DF99D
-.pword 0x050419,  0x945B11,  0x9B879A,  0x1049EA,  0x1E0405,  0x9CE460
-.pword 0x928484,  0x1869F0,  0x170507,  0x8597D5,  0xE99887,  0x041270
-.pword 0x641C04,  0x849EE0,  0xC99085,  0x071B6A,  0xDA141A,  0x848591
-.pword 0x78ED99,  0x04041D,  0xEC791D,  0x858499,  0x14D891,  0x1B071A
-.pword 0x90CB6A,  0x9E8485,  0x1C67E0,  0x120404,  0x98E970,  0x978587
-.pword 0x051755,  0x6E1807,  0x8492F0,  0xE49C84,  0x041E60,  0x491005
-.pword 0x879BEA,  0x5A949A,  0x040511,  0xF86D19,  0x84849D,  0x6DF99D
-.pword 0x050419,  0x945811,  0x9B879A,  0x134BEA,  0x1E0405,  0x9FE761
-.pword 0x928484,  0x1869F1,  0x170507,  0x8596D7,  0xEE9887,  0x041273
-.pword 0x641C04,  0x849EE0,  0xCF9085,  0x071B15,  0xC4141A,  0x848591
-.pword 0x78ED99,  0x04041D,  0xEC7E1D,  0x858499,  0x14D991,  0x1B071A
-.pword 0x93CA6B,  0x9F8485,  0x1F67E1,  0x120404,  0x98E971,  0x978587
-.pword 0x051657,  0x6E1807,  0x8492F3,  0xE49C84,  0x041E60,  0x4F1005
-.pword 0x879B95,  0x44949A,  0x040511,  0xFB6D19,  0x84849D,  0x6CFE9D
-.pword 0x050719,  0x945E11,  0x9B879A,  0x134AEB,  0x1F0405,  0x9FE761
-.pword 0x928484,  0x1869F1,  0x170507,  0x8596D6,  0xEE9887,  0x041272
-.pword 0x641C04,  0x849EE3,  0xCC9085,  0x071B15,  0xC4151A,  0x848591
-.pword 0x7BED99,  0x04041D,  0xEC7E1D,  0x858499,  0x14DE91,  0x1B071A
-.pword 0x93CA6B,  0x9F8485,  0x1F67E1,  0x130404,  0x98E976,  0x979A87
-.pword 0x051656,  0x6E1804,  0x8492F2,  0xE49C84,  0x041E63,  0x4C1005
-.pword 0x879B95,  0x44959A,  0x040511,  0xFB6D19,  0x84849D,  0x6CFE9D
-.pword 0x050419,  0x945F11,  0x9B879A,  0x1375EB,  0x1F0405,  0x9FE761
-.pword 0x938484,  0x1868F6,  0x171A07,  0x8596D1,  0xEE9887,  0x041272
-.pword 0x651C04,  0x849EE3,  0xCD9085,  0x071B15,  0xC6151A,  0x848591
-.pword 0x7AE29E,  0x04041C,  0xEC7F1D,  0x858799,  0x14DC96,  0x1B071A
-.pword 0x93F56B,  0x9F8485,  0x1F66E1,  0x130404,  0x98E876,  0x979A87
-.pword 0x051651,  0x6E1807,  0x8492FD,  0xE59C84,  0x041E63,  0x421005
-.pword 0x879B95,  0x46959A,  0x040511,  0xFA621E,  0x84849C,  0x6FFF9D
-.pword 0x050719,  0x945C16,  0x9B879A,  0x1374EB,  0x1F0405,  0x9FE661
-.pword 0x938484,  0x1868F7,  0x171A07,  0x8596D0,  0xEF9987,  0x04127D
-.pword 0x651C04,  0x849EE3,  0xC39085,  0x071B15,  0xC1151B,  0x848591
-.pword 0x7AE29E,  0x04041C,  0xEF7C1D,  0x858499,  0x14DD96,  0x18071A
-.pword 0x93F468,  0x9F8485,  0x1F66E6,  0x130404,  0x98E877,  0x979A87
-.pword 0x051653,  0x6F1907,  0x8492FD,  0xE59C84,  0x041E63,  0x401005
-.pword 0x879B95,  0x40959B,  0x040510,  0xE5621E,  0x84849C,  0x6FFC92
-.pword 0x050719,  0x975316,  0x98879A,  0x1377E8,  0x1F0404,  0x9FE666
-.pword 0x938584,  0x1868F4,  0x141A07,  0x8596DD,  0xEF9987,  0x041D7C
-.pword 0x7A1C04,  0x849EE2,  0xC09085,  0x071B15,  0xC0151B,  0x848590
-.pword 0x65E39E,  0x04041C,  0xEF7D12,  0x858499,  0x17D396,  0x18071A
-.pword 0x93F768,  0x9F8484,  0x1F66E6,  0x130504,  0x98E874,  0x979A87
-.pword 0x051652,  0x6F1907,  0x8492FC,  0xE59C84,  0x041E62,  0x401005
-.pword 0x879B95,  0x43959B,  0x040510,  0xE5631E,  0x84849C,  0x6FFD92
-.pword 0x050719,  0x975316,  0x98879A,  0x1377E8,  0x1F0404,  0x9FE666
-.pword 0x938584,  0x1B6BF4,  0x141A07,  0x8596DD,  0xEF9987,  0x041D7C
-.pword 0x7A1C04,  0x849EE2,  0xC19185,  0x071A15,  0xC2151B,  0x848590
-.pword 0x65E39E,  0x04041C,  0xEF7D12,  0x858499,  0x17D096,  0x18071A
-.pword 0x93F768,  0x9F8484,  0x1F66E6,  0x130504,  0x98EB74,  0x949A87
-.pword 0x05165D,  0x6F1904,  0x849DFC,  0xFA9C84,  0x041E62,  0x411005
-.pword 0x879A95,  0x42959B,  0x040510,  0xE5631E,  0x84849C,  0x6FFD92
-.pword 0x050718,  0x975016,  0x98879A,  0x1376E8,  0x1F0404,  0x9FE166
-.pword 0x938584,  0x1B6BF5,  0x141A07,  0x8596DC,  0xEF9987,  0x041D7F
-.pword 0x7A1C04,  0x849EE2,  0xC69185,  0x071A15,  0xC2151B,  0x848590
-.pword 0x65E39E,  0x04041C,  0xEF7D12,  0x858499,  0x17D096,  0x18071A
-.pword 0x93F668,  0x9F8484,  0x1F61E6,  0x130504,  0x9BEB75,  0x949A87
-.pword 0x05165F,  0x6C1907,  0x849DFF,  0xFB9D84,  0x041E62,  0x471105
-.pword 0x879A95,  0x4C959B,  0x040510,  0xE5631E,  0x84849C,  0x6EF292
-.pword 0x050418,  0x975616,  0x98879A,  0x1371E9,  0x1F0404,  0x9FE167
-.pword 0x938584,  0x1B6BCA,  0x141A07,  0x8591DE,  0xEC9984,  0x041D7E
-.pword 0x7B1D04,  0x8499ED,  0xC49185,  0x071A15,  0xCC151B,  0x848590
-.pword 0x64E39E,  0x04041C,  0xEE7212,  0x858798,  0x17D796,  0x180705
-.pword 0x92F169,  0x9F8484,  0x1F61E7,  0x130504,  0x9BEB4A,  0x949A87
-.pword 0x05115E,  0x6C1907,  0x849DFE,  0xFB9D84,  0x04196D,  0x441105
-.pword 0x879A94,  0x4F959B,  0x040510,  0xE4601E,  0x84849C,  0x6EF392
-.pword 0x050718,  0x975416,  0x988785,  0x1271E9,  0x1F0404,  0x9EE167
-.pword 0x938584,  0x1B6ACB,  0x141A07,  0x8591D9,  0xEC9984,  0x041D7E
-.pword 0x781D04,  0x8499ED,  0xC59185,  0x071A14,  0xCE6A1B,  0x848590
-.pword 0x64E09E,  0x04041C,  0xEE7312,  0x858798,  0x17D496,  0x180705
-.pword 0x92F169,  0x9F8484,  0x1E61E7,  0x130504,  0x9BEA4B,  0x949A87
-.pword 0x051159,  0x6C1907,  0x849DFE,  0xF89D84,  0x04196D,  0x5A1105
-.pword 0x879A94,  0x4EEA9B,  0x040510,  0xE4601E,  0x84849C,  0x6EF392
-.pword 0x050718,  0x975517,  0x988785,  0x1270E9,  0x1C0404,  0x9EE064
-.pword 0x908584,  0x1B6AC8,  0x141A07,  0x8591DB,  0xED9984,  0x041D79
-.pword 0x791D04,  0x8499ED,  0xDB9185,  0x071A14,  0xC86A1B,  0x848590
-.pword 0x64E09E,  0x04041C,  0xE97012,  0x858798,  0x175597,  0x180705
-.pword 0x92F069,  0x9C8484,  0x1E60E4,  0x100504,  0x9BEA49,  0x949A87
-.pword 0x05115B,  0x6D1904,  0x849DF9,  0xF99D84,  0x04196D,  0x5B1105
-.pword 0x879A94,  0x49EA9B,  0x040510,  0xE4601E,  0x84849C,  0x69F092
-.pword 0x050718,  0x975517,  0x988785,  0x1270E9,  0x1C0404,  0x9EE064
-.pword 0x908584,  0x1B6AC9,  0x141A07,  0x8591DB,  0xED9984,  0x041D79
-.pword 0x791D04,  0x8499ED,  0xDB9185,  0x071A14,  0xC86A1B,  0x848590
-.pword 0x67E09E,  0x04041C,  0xE97112,  0x858798,  0x165497,  0x180705
-.pword 0x92F36E,  0x9C8484,  0x1E60E4,  0x100504,  0x9BEA4F,  0x949A87
-.pword 0x051144,  0x6D1904,  0x849DFB,  0xFE9D84,  0x04196C,  0x5E1105
-.pword 0x879A94,  0x4BEB9B,  0x040513,  0xE7611F,  0x84849F,  0x69F192
-.pword 0x050718,  0x96D417,  0x988785,  0x1273EE,  0x1C0404,  0x9EE064
-.pword 0x908584,  0x1B15CF,  0x141A07,  0x8591C4,  0xED9984,  0x041D78
-.pword 0x7E1D04,  0x8499EC,  0xD99185,  0x071A14,  0xCB6A1B,  0x848593
-.pword 0x67E19E,  0x04041F,  0xE97112,  0x858798,  0x165697,  0x180705
-.pword 0x92F26E,  0x9C8484,  0x1E63E4,  0x100504,  0x9B954F,  0x949A87
-.pword 0x051145,  0x6D1904,  0x849DFB,  0xFE9D84,  0x04196C,  0x5E1105
-.pword 0x879A94,  0x4AEB9B,  0x040513,  0xE7611F,  0x84849F,  0x69F693
-.pword 0x1A0718,  0x96D617,  0x988785,  0x1272EE,  0x1C0404,  0x9EE365
-.pword 0x908584,  0x1B15CC,  0x151A07,  0x8591C7,  0xE29E84,  0x041D7B
-.pword 0x7F1D04,  0x8499EC,  0xDF9685,  0x071A14,  0xF56B1B,  0x848593
-.pword 0x67E19F,  0x04041F,  0xE87613,  0x9A8798,  0x165197,  0x180705
-.pword 0x92F26F,  0x9C8484,  0x1E63E5,  0x100504,  0x9B954D,  0x959A87
-.pword 0x051147,  0x621E04,  0x849DFB,  0xFF9D84,  0x04196C,  0x5F1605
-.pword 0x879A94,  0x75EB9B,  0x040513,  0xE7611F,  0x84849F,  0x68F693
-.pword 0x1A0718,  0x96D117,  0x988785,  0x1272EE,  0x1C0404,  0x9EE365
-.pword 0x908584,  0x1B15CD,  0x151A07,  0x8591C7,  0xE29E84,  0x041C7B
-.pword 0x7F1D04,  0x8799EC,  0xDC9685,  0x071A14,  0xF56B1B,  0x848493
-.pword 0x66E19F,  0x04041F,  0xE87713,  0x9A8798,  0x165097,  0x180705
-.pword 0x92FD6F,  0x9C8484,  0x1E63E5,  0x100504,  0x9B9542,  0x959A87
-.pword 0x051146,  0x621E04,  0x849CFA,  0xFF9D84,  0x07196F,  0x5D1605
-.pword 0x879A94,  0x74EB9B,  0x040413,  0xE6661F,  0x84849F,  0x68F793
-.pword 0x1A0718,  0x96D017,  0x998785,  0x127DEF,  0x1C0404,  0x9EE365
-.pword 0x908584,  0x1B15C2,  0x151A07,  0x8590C1,  0xE29E84,  0x041C7A
-.pword 0x7C1D04,  0x8799EF,  0xD29685,  0x071A17,  0xF76818,  0x848593
-.pword 0x66E69F,  0x05041F,  0xE87413,  0x9A8498,  0x165397,  0x190405
-.pword 0x92FD6F,  0x9C8484,  0x1E63E5,  0x100504,  0x9B9543,  0x959B87
-.pword 0x051141,  0x621E04,  0x849CFA,  0xFC9284,  0x04196F,  0x521605
-.pword 0x879A97,  0x74E898,  0x040513,  0xE6661F,  0x85849F,  0x68F793
-.pword 0x1A0718,  0x96D217,  0x998785,  0x127CEF,  0x1C0404,  0x9EE27A
-.pword 0x908584,  0x1B15C1,  0x151B07,  0x8590C3,  0xE39E84,  0x041C65
-.pword 0x7D1204,  0x8499EF,  0xD39685,  0x071A17,  0xF76818,  0x848593
-.pword 0x66E69F,  0x05041F,  0xE87413,  0x9A8798,  0x165297,  0x190405
-.pword 0x92FC6F,  0x9C8484,  0x1E62FA,  0x100504,  0x9B9540,  0x959B87
-.pword 0x051040,  0x621E04,  0x849CE5,  0xFC9284,  0x07196F,  0x531605
-.pword 0x879A97,  0x77E898,  0x040413,  0xE6661F,  0x84849F,  0x6BF493
-.pword 0x1A071B,  0x96DD14,  0x998785,  0x1D7CEF,  0x1C0404,  0x9EE27A
-.pword 0x918584,  0x1A15C1,  0x151B07,  0x8590C2,  0xE39E84,  0x041C65
-.pword 0x7D1204,  0x8798EF,  0xD19685,  0x070517,  0xF66818,  0x848493
-.pword 0x61E79F,  0x05041F,  0xEB7513,  0x9A879B,  0x165F94,  0x190405
-.pword 0x9DFF6C,  0x9D8484,  0x1E62FB,  0x110504,  0x9B9547,  0x959B87
-.pword 0x05104D,  0x631E04,  0x849CE5,  0xF29284,  0x04196E,  0x511605
-.pword 0x879A97,  0x76E898,  0x040413,  0xE1671F,  0x85849F,  0x6BF593
-.pword 0x1A071B,  0x96DC14,  0x998485,  0x1D7FEC,  0x1C0404,  0x9EE27A
-.pword 0x918584,  0x1B15C6,  0x151B07,  0x8590C2,  0xE39E84,  0x041C65
-.pword 0x721204,  0x8798EE,  0xD69685,  0x071A17,  0xF66918,  0x848493
-.pword 0x61E79F,  0x05041F,  0xEB7513,  0x9A879B,  0x165F94,  0x190405
-.pword 0x9DFF6C,  0x9D8484,  0x1E62FB,  0x110504,  0x9B9544,  0x959B87
-.pword 0x05104C,  0x631E04,  0x849CE5,  0xF29284,  0x04196E,  0x561605
-.pword 0x879A97,  0x76E998,  0x040413,  0xE1671F,  0x85849F,  0x6BF593
-.pword 0x1A071B,  0x91DE14,  0x998785,  0x1D7EEC,  0x1D0404,  0x99ED7B
-.pword 0x918584,  0x1A14C4,  0x151B07,  0x8590CF,  0xE39E84,  0x041C64
-.pword 0x731204,  0x8798EE,  0xD79685,  0x070517,  0xF16918,  0x848492
-.pword 0x61E79F,  0x05041E,  0xEA4B13,  0x9A879B,  0x115994,  0x190705
-.pword 0x9DFE6C,  0x9D8484,  0x196DF8,  0x110504,  0x9A9445,  0xEA9B87
-.pword 0x05104F,  0x601E04,  0x849CE4,  0xF39284,  0x07186E,  0x541605
-.pword 0x878597,  0x71E998,  0x040412,  0xE0671F,  0x85849E,  0x6ACB93
-.pword 0x1A071B,  0x91D814,  0x998485,  0x1D79EC,  0x1D0404,  0x99ED78
-.pword 0x918584,  0x1A14DA,  0x6A1B07,  0x8590CE,  0xE09E84,  0x041C64
-.pword 0x731204,  0x8798EE,  0xD59785,  0x070517,  0xF06918,  0x848492
-.pword 0x60E79F,  0x05041E,  0xEA4810,  0x9A879B,  0x115894,  0x190405
-.pword 0x9DF96D,  0x9D8484,  0x196DF8,  0x110504,  0x9A945A,  0xEA9B87
-.pword 0x05104E,  0x601E04,  0x849CE4,  0xF39284,  0x07186E,  0x541605
-.pword 0x878597,  0x70E998,  0x040412,  0xE0671F,  0x85849E,  0x6AC890
-.pword 0x1A071B,  0x91D814,  0x998485,  0x1D79ED,  0x1D0404,  0x99ED79
-.pword 0x918584,  0x1A14DA,  0x6A1B07,  0x8590C9,  0xE09E84,  0x041C64
-.pword 0x701204,  0x8798E9,  0xD59785,  0x070517,  0xF06918,  0x848492
-.pword 0x60E49C,  0x05041E,  0xEA4910,  0x9A879B,  0x115B94,  0x190405
-.pword 0x9DF86D,  0x9D8484,  0x196DF9,  0x110504,  0x9A945B,  0xEA9B87
-.pword 0x051048,  0x601E04,  0x849FE7,  0xF09284,  0x071869,  0xD41705
-.pword 0x878596,  0x73EE98,  0x040412,  0xE0641C,  0x85849E,  0x6ACE90
-.pword 0x1A071B,  0x91C514,  0x998485,  0x1D78ED,  0x1D0404,  0x99EC79
-.pword 0x918587,  0x1A14D8,  0x6A1B07,  0x8593CB,  0xE09E84,  0x041F67
-.pword 0x711204,  0x8798E9,  0x549785,  0x070516,  0xF36E18,  0x848492
-.pword 0x60E49C,  0x05041E,  0xEA4E10,  0x9A879B,  0x115A94,  0x190405
-.pword 0x9DF86D,  0x9D8484,  0x196CF9,  0x110504,  0x9A9458,  0xEA9B87
-.pword 0x05134B,  0x611F04,  0x849FE7,  0xF19284,  0x071869,  0xD71705
-.pword 0x878596,  0x72EE98,  0x040412,  0xE3641C,  0x85849E,  0x15CF90
-.pword 0x1A071B,  0x91C414,  0x998485,  0x1D7BED,  0x1D0404,  0x99EC7E
-.pword 0x918587,  0x1A14DE,  0x6B1B07,  0x8593F5,  0xE19F84,  0x041F67
-.pword 0x761304,  0x8798E8,  0x569785,  0x070516,  0xF26E18,  0x848492
-.pword 0x63E49C,  0x05041E,  0x954C10,  0x9A879B,  0x114495,  0x190405
-.pword 0x9DFB62,  0x9D8484,  0x196CFF,  0x110504,  0x9A945F,  0xEB9B87
-.pword 0x051375,  0x611F04,  0x849FE7,  0xF69384,  0x071868,  0xD1171A
-.pword 0x878596,  0x72EE98,  0x040412,  0xE3651C,  0x85849E,  0x15CC90
-.pword 0x1A071B,  0x91C715,  0x9E8485,  0x1D7BE2,  0x1D0404,  0x99EC7F
-.pword 0x968584,  0x1A14DF,  0x6B1B07,  0x8593F5,  0xE19F84,  0x041F67
-.pword 0x761304,  0x8798E8,  0x51979A,  0x070516,  0xF26E18,  0x848492
-.pword 0x63E59C,  0x05041E,  0x954D10,  0x9A879B,  0x114695,  0x1E0405
-.pword 0x9CFA62,  0x9D8484,  0x196CFF,  0x160504,  0x9A945C,  0xEB9B87
-.pword 0x051375,  0x611F04,  0x849FE6,  0xF69384,  0x071868,  0xD0171A
-.pword 0x878596,  0x7DEF98,  0x040412,  0xE3651C,  0x85849E,  0x15C290
-.pword 0x1A071B,  0x91C615,  0x9E8485,  0x1C7AE2,  0x1D0404,  0x99EC7F
-.pword 0x968587,  0x1A14DC,  0x6B1B07,  0x8593F4,  0xE19F84,  0x041F66
-.pword 0x771304,  0x8798E8,  0x50979A,  0x070516,  0xFD6F18,  0x848492
-.pword 0x63E59C,  0x05041E,  0x954310,  0x9B879B,  0x104195,  0x1E0405
-.pword 0x9CFA62,  0x9D8484,  0x196FFC,  0x160504,  0x9A9452,  0xE89887
-.pword 0x051374,  0x661F04,  0x849FE6,  0xF79384,  0x071868,  0xD3171A
-.pword 0x878596,  0x7DEF99,  0x040412,  0xE3651C,  0x85849E,  0x15C390
-.pword 0x1B071B,  0x91C115,  0x9E8485,  0x1C7AE2,  0x1D0404,  0x99EF7C
-.pword 0x968584,  0x1A14DD,  0x681807,  0x8593F4,  0xE69F84,  0x041F66
-.pword 0x771305,  0x8798E8,  0x53979A,  0x040516,  0xFD6F19,  0x848492
-.pword 0x63E59C,  0x05041E,  0x954310,  0x9B879B,  0x104095,  0x1E0405
-.pword 0x9CE562,  0x928484,  0x196FFD,  0x160507,  0x9A9753,  0xE89887
-.pword 0x041377,  0x661F04,  0x849FE6,  0xF49385,  0x071B6B,  0xDD141A
-.pword 0x848596,  0x7CEF99,  0x04041D,  0xE27A1C,  0x85849E,  0x15C190
-.pword 0x1B071B,  0x90C215,  0x9E8485,  0x1C65E3,  0x120404,  0x98EF7D
-.pword 0x968587,  0x1A17D0,  0x681807,  0x8493F7,  0xE69F84,  0x041F66
-.pword 0x741304,  0x879BEB,  0x5D949A,  0x070516,  0xFF6F19,  0x84849D
-.pword 0x62FA9C,  0x05041E,  0x954611,  0x9B879A,  0x104295,  0x1E0405
-.pword 0x9CE563,  0x928484,  0x196FFD,  0x160504,  0x9A9750,  0xE89887
-.pword 0x041377,  0x661F04,  0x849FE6,  0xF49385,  0x07186B,  0xDD141A
-.pword 0x848596,  0x7CEF99,  0x04041D,  0xE27A1C,  0x85849E,  0x15C691
-.pword 0x1B071A,  0x90C215,  0x9E8485,  0x1C65E3,  0x120404,  0x98EF72
-.pword 0x968587,  0x1A17D1,  0x681807,  0x8493F6,  0xE69F84,  0x041F61
-.pword 0x751305,  0x879BEB,  0x5F949A,  0x070516,  0xFF6C19,  0x84849D
-.pword 0x62FB9C,  0x05041E,  0x954711,  0x9B879A,  0x104D95,  0x1E0405
-.pword 0x9CE563,  0x928484,  0x186EF2,  0x160504,  0x9A9751,  0xE89887
-.pword 0x041376,  0x671F04,  0x849FE1,  0xF59385,  0x071B6B,  0xDF141A
-.pword 0x848596,  0x7FEC99,  0x04041D,  0xE27B1C,  0x85849E,  0x15C691
-.pword 0x1B071A,  0x90CD15,  0x9E8485,  0x1C65E3,  0x120404,  0x98EE72
-.pword 0x968587,  0x1A17D1,  0x681807,  0x8493F6,  0xE79F84,  0x041F61
-.pword 0x751305,  0x879BEB,  0x5F949A,  0x070511,  0xFF6C19,  0x84849D
-.pword 0x62FB9D,  0x050419,  0x954411,  0x9B879A,  0x104C95,  0x1E0405
-.pword 0x9CE463,  0x928484,  0x186EF3,  0x160507,  0x859757,  0xE99887
-.pword 0x041271,  0x671F04,  0x849FE1,  0xCA9385,  0x071B6B,  0xDE141A
-.pword 0x848591,  0x7EEC99,  0x04041D,  0xED781D,  0x858499,  0x14C591
-.pword 0x1B071A,  0x90CF6A,  0x9E8485,  0x1C64E0,  0x120404,  0x98EE73
-.pword 0x968587,  0x0517D4,  0x691807,  0x8492F1,  0xE79F84,  0x041F61
-.pword 0x4B1305,  0x879BEB,  0x59949A,  0x040511,  0xFE6C19,  0x84849D
-.pword 0x6DF89D,  0x050419,  0x945A11,  0x9B879A,  0x104EEA,  0x1E0405
-.pword 0x9CE460,  0x928484,  0x186EF3,  0x170507,  0x859754,  0xE99887
-.pword 0x041271,  0x671F04,  0x849FE1,  0xCB9385,  0x071B6A,  0xD9141A
-.pword 0x848591,  0x7EEC99,  0x04041D,  0xED781D,  0x858499,  0x14DA91
-.pword 0x1B071A,  0x90CE6A,  0x9E8485,  0x1C64E0,  0x120404,  0x98EE73
-.pword 0x978587,  0x0517D5,  0x691807,  0x8492F0,  0xE49C84,  0x041E60
-.pword 0x491005,  0x879BEA,  0x5B949A,  0x040511,  0xF96D19,  0x84849D
-.pword 0x6DF99D,  0x050419,  0x945B11,  0x9B879A,  0x1049EA,  0x1E0405
-.pword 0x9CE460,  0x928484,  0x1869F0,  0x170504,  0x8597D5,  0xEE9887
-.pword 0x041270,  0x641C04,  0x849EE0,  0xC99085,  0x071B6A,  0xDB141A
-.pword 0x848591,  0x79ED99,  0x04041D,  0xED791D,  0x858499,  0x14DB91
-.pword 0x1B071A,  0x90C86A,  0x9E8485,  0x1C64E0,  0x120404,  0x98E970
-.pword 0x978587,  0x051755,  0x691807,  0x8492F0,  0xE49C84,  0x041E60
-.pword 0x491005,  0x879BEA,  0x5A949A,  0x040511,  0xF86D19,  0x84849D
-.pword 0x6DF99D,  0x050719,  0x945811,  0x9B879A,  0x1048EA,  0x1E0405
-.pword 0x9FE760,  0x928484,  0x1869F0,  0x170507,  0x8597D4,  0xEE9887
-.pword 0x041273,  0x641C04,  0x849EE0,  0xCE9085,  0x071B6A,  0xDA141A
-.pword 0x848591,  0x78ED99,  0x04041D,  0xEC791D,  0x858499,  0x14D891
-.pword 0x1B071A,  0x90C86A,  0x9E8485,  0x1F67E0,  0x120404,  0x98E971
-.pword 0x978587,  0x051654,  0x6E1807,  0x8492F3,  0xE49C84,  0x041E60
-.pword 0x4F1005,  0x879BEA,  0x45949A,  0x040511,  0xF86D19,  0x84849D
-.pword 0x6CFE9D,  0x050419,  0x945E11,  0x9B879A,  0x134AEB,  0x1F0405
-.pword 0x9FE761,  0x938484,  0x1869F1,  0x170507,  0x8596D7,  0xEE9887
-.pword 0x041273,  0x641C04,  0x849EE0,  0xCF9085,  0x071B6A,  0xC4141A
-.pword 0x848591,  0x7BED99,  0x04041D,  0xEC7E1D,  0x858499,  0x14DE91
-.pword 0x1B071A,  0x93CA6B,  0x9F8485,  0x1F67E1,  0x130404,  0x98E971
-.pword 0x978587,  0x051656,  0x6E1807,  0x8492F2,  0xE49C84,  0x041E63
-.pword 0x4C1005,  0x879B95,  0x47959A,  0x040511,  0xFB6219,  0x84849D
-.pword 0x6CFF9D,  0x050419,  0x945F11,  0x9B879A,  0x1375EB,  0x1F0405
-.pword 0x9FE761,  0x938484,  0x1868F6,  0x171A07,  0x8596D6,  0xEE9887
-.pword 0x041272,  0x651C04,  0x849EE3,  0xCD9085,  0x071B15,  0xC7151A
-.pword 0x848591,  0x7BE299,  0x04041C,  0xEC7F1D,  0x858799,  0x14DC96
-.pword 0x1B071A,  0x93F56B,  0x9F8484,  0x1F66E1,  0x130404,  0x98E876
-.pword 0x978587,  0x051650,  0x6E1807,  0x8492FD,  0xE59C84,  0x041E63
-.pword 0x421005,  0x879B95,  0x46959A,  0x040511,  0xFA621E,  0x84849C
-.pword 0x6CFF9D,  0x050419,  0x945C16,  0x9B879A,  0x1375EB,  0x1F0405
-.pword 0x9FE661,  0x938484,  0x1868F6,  0x171A07,  0x8596D0,  0xEF9887
-.pword 0x04127D,  0x651C04,  0x849EE3,  0xC29085,  0x071B15,  0xC6151B
-.pword 0x848591,  0x7AE29E,  0x04041C,  0xEC7F1D,  0x858499,  0x14DC96
-.pword 0x1B071A,  0x93F56B,  0x9F8484,  0x1F66E1,  0x130404,  0x98E877
-.pword 0x979A87,  0x051653,  0x6F1907,  0x8492FD,  0xE59C84,  0x041E63
-.pword 0x421005,  0x879B95,  0x41959A,  0x040510,  0xFA621E,  0x84849C
-.pword 0x6FFC92,  0x050419,  0x945D16,  0x98879A,  0x1374EB,  0x1F0405
-.pword 0x9FE666,  0x938484,  0x1868F7,  0x171A07,  0x8596D0,  0xEF9987
-.pword 0x04127D,  0x651C04,  0x849EE3,  0xC39085,  0x071B15,  0xC1151B
-.pword 0x848590,  0x7AE29E,  0x04041C,  0xEF7C12,  0x858499,  0x17D296
-.pword 0x18071A,  0x93F468,  0x9F8484,  0x1F66E6,  0x130404,  0x98E874
-.pword 0x979A87,  0x051652,  0x6F1907,  0x8492FC,  0xE59C84,  0x041E62
-.pword 0x401005,  0x879B95,  0x40959B,  0x040510,  0xE5621E,  0x84849C
-.pword 0x6FFC92,  0x050719,  0x975316,  0x98879A,  0x1377E8,  0x1F0404
-.pword 0x9FE666,  0x938584,  0x1868F4,  0x171A07,  0x8596DD,  0xEF9987
-.pword 0x041D7C,  0x7A1C04,  0x849EE2,  0xC09085,  0x071B15,  0xC3151B
-.pword 0x848590,  0x65E39E,  0x04041C,  0xEF7D12,  0x858799,  0x17D396
-.pword 0x18071A,  0x93F768,  0x9F8484,  0x1F66E6,  0x130504,  0x9BEB74
-.pword 0x949A87,  0x05165D,  0x6F1904,  0x849DFC,  0xFA9C84,  0x041E62
-.pword 0x411005,  0x879B95,  0x43959B,  0x040510,  0xE5631E,  0x84849C
-.pword 0x6FFD92,  0x050719,  0x975016,  0x98879A,  0x1377E8,  0x1F0404
-.pword 0x9FE166,  0x938584,  0x1B6BF5,  0x141A07,  0x8596DC,  0xEC9984
-.pword 0x041D7F,  0x7A1C04,  0x849EE2,  0xC69185,  0x071A15,  0xCD151B
-.pword 0x848590,  0x65E39E,  0x04041C,  0xEE7212,  0x858498,  0x17D696
-.pword 0x18041A,  0x93F669,  0x9F8484,  0x1F61E7,  0x130504,  0x9BEB75
-.pword 0x949A87,  0x05165F,  0x6C1904,  0x849DFF,  0xFB9D84,  0x041E62
-.pword 0x471105,  0x879B95,  0x4D959B,  0x040510,  0xE5631E,  0x84849C
-.pword 0x6EF292,  0x050418,  0x975616,  0x98879A,  0x1376E9,  0x1F0404
-.pword 0x9FE167,  0x938584,  0x1B6BF5,  0x141A07,  0x8591DE,  0xEC9987
-.pword 0x041D7E,  0x781D04,  0x8499ED,  0xC59185,  0x071A14,  0xCF6A1B
-.pword 0x848590,  0x64E09E,  0x04041C,  0xEE7312,  0x858798,  0x17D796
-.pword 0x180705,  0x92F169,  0x9F8484,  0x1F61E7,  0x130504,  0x9BEB4A
-.pword 0x949A87,  0x05115E,  0x6C1904,  0x849DFE,  0xFB9D84,  0x041E62
-.pword 0x471105,  0x879A95,  0x4D959B,  0x040510,  0xE5631E,  0x84849C
-.pword 0x6EF292,  0x050718,  0x975616,  0x98879A,  0x1376E9,  0x1F0404
-.pword 0x9FE167,  0x938584,  0x1B6BCA,  0x141A07,  0x8591DE,  0xEC9984
-.pword 0x041D7E,  0x7B1D04,  0x8499ED,  0xC49185,  0x071A15,  0xCC151B
-.pword 0x848590,  0x64E39E,  0x04041C,  0xEE7312,  0x858798,  0x17D796
-.pword 0x180705,  0x92F169,  0x9F8484,  0x1E61E7,  0x130504,  0x9BEA4B
-.pword 0x949A87,  0x051159,  0x6C1904,  0x849DFE,  0xF89D84,  0x04196D
-.pword 0x451105,  0x879A94,  0x4EEA9B,  0x040510,  0xE4601E,  0x84849C
-.pword 0x6EF392,  0x050718,  0x975417,  0x988785,  0x1270E9,  0x1C0404
-.pword 0x9EE067,  0x908584,  0x1B6AC8,  0x141A07,  0x8591D8,  0xEC9984
-.pword 0x041D7E,  0x781D04,  0x8499ED,  0xDA9185,  0x071A14,  0xCE6A1B
-.pword 0x848590,  0x64E09E,  0x04041C,  0xE97012,  0x858798,  0x17D597
-.pword 0x180705,  0x92F069,  0x9C8484,  0x1E60E4,  0x100504,  0x9BEA49
-.pword 0x949A87,  0x05115B,  0x6D1904,  0x849DF9,  0xF99D84,  0x04196D
-.pword 0x5B1105,  0x879A94,  0x49EA9B,  0x040510,  0xE4601E,  0x84849C
-.pword 0x6EF092,  0x050718,  0x975517,  0x988785,  0x1270E9,  0x1F0404
-.pword 0x9EE064,  0x908584,  0x1B6AC9,  0x141A07,  0x8591DA,  0xED9987
-.pword 0x041D78,  0x791D04,  0x8499EC,  0xD89185,  0x071A14,  0xC86A1B
-.pword 0x848590,  0x67E09E,  0x04041F,  0xE97112,  0x858798,  0x175497
-.pword 0x180705,  0x92F36E,  0x9C8484,  0x1E60E4,  0x100504,  0x9BEA4E
-.pword 0x949A87,  0x05115A,  0x6D1904,  0x849DF9,  0xF99D84,  0x04196D
-.pword 0x581105,  0x879A94,  0x48EA9B,  0x040510,  0xE4601E,  0x84849C
-.pword 0x69F092,  0x050718,  0x97D417,  0x988785,  0x1273EE,  0x1C0404
-.pword 0x9EE064,  0x908584,  0x1B6ACF,  0x141A07,  0x8591C5,  0xED9984
-.pword 0x041D78,  0x7E1D04,  0x8499EC,  0xDE9185,  0x071A14,  0xCA6B1B
-.pword 0x848593,  0x67E19F,  0x04041F,  0xE97113,  0x858798,  0x165697
-.pword 0x180705,  0x92F26E,  0x9C8484,  0x1E63E4,  0x100504,  0x9B954C
-.pword 0x959A87,  0x051144,  0x6D1904,  0x849DFB,  0xFE9D84,  0x04196C
-.pword 0x5E1105,  0x879A94,  0x4AEB9B,  0x040513,  0xE7611F,  0x84849F
-.pword 0x69F192,  0x050718,  0x96D717,  0x988785,  0x1272EE,  0x1C0404
-.pword 0x9EE364,  0x908584,  0x1B15CC,  0x141A07,  0x8591C4,  0xED9984
-.pword 0x041D7B,  0x7E1D04,  0x8799EC,  0xDE9185,  0x071A14,  0xF56B1B
-.pword 0x848593,  0x67E19F,  0x04041F,  0xE97613,  0x858798,  0x165697
-.pword 0x180705,  0x92F26E,  0x9C8484,  0x1E63E4,  0x100504,  0x9B954C
-.pword 0x959A87,  0x051144,  0x6D1904,  0x849DFB,  0xFE9D84,  0x04196C
-.pword 0x5E1105,  0x879A94,  0x75EB9B,  0x040513,  0xE7611F,  0x84849F
-.pword 0x68F693,  0x1A0718,  0x96D117,  0x988785,  0x1272EE,  0x1C0404
-.pword 0x9EE365,  0x908584,  0x1B15CD,  0x151A07,  0x8591C7,  0xE29E84
-.pword 0x041D7B,  0x7F1D04,  0x8499EC,  0xDF9685,  0x071A14,  0xF56B1B
-.pword 0x848593,  0x66E19F,  0x04041F,  0xE87613,  0x9A8798,  0x165197
-.pword 0x190405,  0x92F26F,  0x9C8484,  0x1E63E5,  0x100504,  0x9B954D
-.pword 0x959A87,  0x051147,  0x621E04,  0x849CFB,  0xFF9D84,  0x07196C
-.pword 0x5C1605,  0x879A94,  0x74EB9B,  0x040513,  0xE6611F,  0x84849F
-.pword 0x68F793,  0x1A0718,  0x96D017,  0x998785,  0x127DEF,  0x1C0404
-.pword 0x9EE365,  0x908584,  0x1B15C2,  0x151B07,  0x8591C6,  0xE29E84
-.pword 0x041C7A,  0x7C1D04,  0x8799EF,  0xDD9685,  0x071A14,  0xF46B1B
-.pword 0x848493,  0x66E69F,  0x04041F,  0xE87713,  0x9A8798,  0x165097
-.pword 0x190705,  0x92FD6F,  0x9C8484,  0x1E63E5,  0x100504,  0x9B9542
-.pword 0x959A87,  0x051041,  0x621E04,  0x849CFA,  0xFC9D84,  0x07196F
-.pword 0x5D1605,  0x879A97,  0x74E89B,  0x040413,  0xE6661F,  0x84849F
-.pword 0x68F793,  0x1A0718,  0x96D317,  0x998785,  0x127DEF,  0x1C0404
-.pword 0x9EE365,  0x908584,  0x1B15C3,  0x151B07,  0x8590C0,  0xE29E84
-.pword 0x041C65,  0x7C1204,  0x8799EF,  0xD29685,  0x071A17,  0xF76818
-.pword 0x848493,  0x66E69F,  0x04041F,  0xE87413,  0x9A8798,  0x165297
-.pword 0x190705,  0x9DFC6F,  0x9C8484,  0x1E62E5,  0x100504,  0x9B9541
-.pword 0x959B87,  0x051043,  0x631E04,  0x849CE5,  0xFD9284,  0x07196F
-.pword 0x531605,  0x879A97,  0x77E898,  0x040413,  0xE6661F,  0x85849F
-.pword 0x6BF493,  0x1A0718,  0x96DD14,  0x998485,  0x1D7CEF,  0x1C0404
-.pword 0x9EE27A,  0x918584,  0x1B15C1,  0x151B07,  0x8590C3,  0xE39E84
-.pword 0x041C65,  0x7D1204,  0x8799EF,  0xD09685,  0x071A17,  0xF76818
-.pword 0x848493,  0x61E69F,  0x05041F,  0xEB7413,  0x9A879B,  0x165C94
-.pword 0x190705,  0x9DFF6C,  0x9C8484,  0x1E62FA,  0x110504,  0x9A9546
-.pword 0x959B87,  0x051042,  0x631E04,  0x849CE5,  0xF29284,  0x07186F
-.pword 0x511605,  0x879A97,  0x76E898,  0x040413,  0xE1671F,  0x85849F
-.pword 0x6BF593,  0x1A071B,  0x96DC14,  0x998785,  0x1D7FEC,  0x1C0404
-.pword 0x9EE27A,  0x918584,  0x1A15C6,  0x151B07,  0x8590C2,  0xE39E84
-.pword 0x041C65,  0x7D1204,  0x8798EE,  0xD19685,  0x070517,  0xF66818
-.pword 0x848493,  0x61E69F,  0x05041F,  0xEB7513,  0x9A879B,  0x165C94
-.pword 0x190705,  0x9DFF6C,  0x9C8484,  0x1E62FA,  0x110504,  0x9A9546
-.pword 0x959B87,  0x05104D,  0x631E04,  0x849CE5,  0xF29284,  0x07186E
-.pword 0x561605,  0x878597,  0x76E998,  0x040413,  0xE1671F,  0x85849F
-.pword 0x6BF593,  0x1A071B,  0x96DF14,  0x998485,  0x1D7FEC,  0x1D0404
-.pword 0x9EE27B,  0x918584,  0x1A15C4,  0x151B07,  0x8590CC,  0xE39E84
-.pword 0x041C64,  0x721204,  0x8498EE,  0xD69685,  0x071A17,  0xF66918
-.pword 0x848493,  0x61E79F,  0x05041F,  0xEB4A13,  0x9A879B,  0x115E94
-.pword 0x190705,  0x9DFE6C,  0x9D8484,  0x196DF8,  0x110504,  0x9A9445
-.pword 0xEA9B87,  0x05104E,  0x601E04,  0x849CE4,  0xF39284,  0x07186E
-.pword 0x541605,  0x878597,  0x71E998,  0x040412,  0xE1671F,  0x85849F
-.pword 0x6BCA93,  0x1A071B,  0x91DE14,  0x998785,  0x1D7EEC,  0x1D0404
-.pword 0x99ED7B,  0x918584,  0x1A14C4,  0x151B07,  0x8590CF,  0xE09E84
-.pword 0x041C64,  0x731204,  0x8798EE,  0xD79685,  0x070517,  0xF16918
-.pword 0x848492,  0x61E79F,  0x05041E,  0xEA4B13,  0x9A879B,  0x115994
-.pword 0x190405,  0x9DF96C,  0x9D8484,  0x196DF8,  0x110504,  0x9A945A
-.pword 0xEA9B87,  0x05104E,  0x601E04,  0x849CE4,  0xF39284,  0x04186E
-.pword 0x541705,  0x878597,  0x70E998,  0x040412,  0xE0671C,  0x85849E
-.pword 0x6AC890,  0x1A071B,  0x91D814,  0x998485,  0x1D79EC,  0x1D0404
-.pword 0x99ED78,  0x918584,  0x1A14DA,  0x6A1B07,  0x8590CE,  0xE09E84
-.pword 0x041C64,  0x731204,  0x8798EE,  0xD59785,  0x070517,  0xF06918
-.pword 0x848492,  0x60E79F,  0x05041E,  0xEA4813,  0x9A879B,  0x115894
-.pword 0x190705,  0x9DF96C,  0x9D8484,  0x196DF8,  0x110504,  0x9A945B
-.pword 0xEA9B87,  0x051049,  0x601E04,  0x849CE4,  0xF09284,  0x071869
-.pword 0xD51705,  0x878597,  0x70E998,  0x040412,  0xE0641C,  0x85849E
-.pword 0x6AC990,  0x1A071B,  0x91DB14,  0x998785,  0x1D79ED,  0x1D0404
-.pword 0x99ED79,  0x918587,  0x1A14D8,  0x6A1B07,  0x8593C8,  0xE09E84
-.pword 0x041F67,  0x701204,  0x8798E9,  0x559785,  0x070516,  0xF36E18
-.pword 0x848492,  0x60E49C,  0x05041E,  0xEA4E10,  0x9A879B,  0x115A94
-.pword 0x190405,  0x9DF86D,  0x9D8484,  0x196CF9,  0x110504,  0x9A945E
-.pword 0xE89B84,  0x9B879A,  0x104EEA,  0x1E0405,  0x9CE460,  0x928484
-.pword 0x186EF3,  0x170504,  0x859754,  0xE99887,  0x041270,  0x671C04
-.pword 0x849EE0,  0xC89085,  0x071B6A,  0xD8141A,  0x848591,  0x79EC99
-.pword 0x04041D,  0xED781D,  0x858499,  0x14DA91,  0x1B071A,  0x90CE6A
-.pword 0x9E8485,  0x1C64E0,  0x120404,  0x98EE73,  0x978587,  0x0517D5
-.pword 0x691807,  0x8492F0,  0xE79F84,  0x041E60,  0x481305,  0x879BEA
-.pword 0x58949A,  0x070511,  0xF96C19,  0x84849D,  0x6DF89D,  0x050419
-.pword 0x945B11,  0x9B879A,  0x1049EA,  0x1E0405,  0x9CE460,  0x928484
-.pword 0x1869F0,  0x170507,  0x8597D5,  0xE99887,  0x041270,  0x641C04
-.pword 0x009EE0        
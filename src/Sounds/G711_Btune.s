@@ -1,497 +0,0 @@
-/******************************************************************************
-*  Speech.s developed by AccelWork Inc. for Microchip Technology Inc. 
-*  Copyright (c) 2005 by Microchip. All rights are reserved. 
-*  
-*  This Copyright notice may not be removed or modified without prior written 
-*  consent of Microchip Technology Inc. 
-******************************************************************************/
-
-/******************************************************************************
-*  Speech.s
-*
-*  Description:
-*    This file is generated by dsPIC33F Speech Encoder Utility Version 1.00
-*    It contains the ALAW compressed data for a 8kHz,16-bit speech signal.The
-*    output array represents a 64kbps encoded bit stream.
-*
-*    Speech Encoder Utility settings:
-*       Input Source:  Btune.wav
-*       Output Array:  G711_Btune
-*       Array Size:    8193 bytes                
-*       Target Memory: Program Memory
-*       LAW:           ALAW
-*
-*    Modification History:
-*
-*       Date           Author              Description
-*       ----           ------              -----------
-*
-*    Dec-16-2005    Taruna Singh		   Created
-*    Dec-20-2005    Taruna Singh		   Ready for Alpha Release
-*
-******************************************************************************/
-
-/* There are 2731 elements in the data array. */
-   
-/* Data file for storing 24-bit constants in program memory */
-
-.global _G711_Btune
-
-.section .G711, code
-_G711_Btune:
-.pword 0x190611,  0xF67B13,  0x849997,  0x939A84,  0x144AE6,  0x04041E
-.pword 0x631205,  0x9EEAC0,  0x858785,  0x5CED9D,  0x051F68,  0x1C0504
-.pword 0xEE556E,  0x87859C,  0xEB9F85,  0x1D6DDE,  0x040705,  0x43151E
-.pword 0x9A92E3,  0x998484,  0x66F594,  0x041A13,  0x171804,  0x90E573
-.pword 0x84849B,  0xFE9698,  0x181679,  0x1B0404,  0xF36510,  0x849897
-.pword 0x939A84,  0x1475E6,  0x070419,  0x631205,  0x9E95C3,  0x858784
-.pword 0x5EED9D,  0x051F68,  0x1C0507,  0xEED56E,  0x87859C,  0xE89F85
-.pword 0x1D6DDE,  0x040705,  0x43151E,  0x9A92E3,  0x998484,  0x66F594
-.pword 0x041A13,  0x171904,  0x90E573,  0x84849B,  0xFE9698,  0x18167E
-.pword 0x1B0404,  0xF36510,  0x849897,  0x939A84,  0x1475E6,  0x070419
-.pword 0x631205,  0x9E95C3,  0x858784,  0x5EED9D,  0x051F6B,  0x1C0507
-.pword 0xEED56E,  0x87859C,  0xE89F85,  0x1D6DDF,  0x040705,  0x40151E
-.pword 0x9A92E3,  0x998484,  0x66F594,  0x041A13,  0x171904,  0x90E570
-.pword 0x84849B,  0xFE9698,  0x181679,  0x1B0404,  0xF36511,  0x849897
-.pword 0x939A84,  0x1474E6,  0x040419,  0x60121A,  0x9E95C2,  0x858784
-.pword 0x59ED9D,  0x051F6B,  0x1C0507,  0xEED46F,  0x87859C,  0xE89F85
-.pword 0x1D6CDC,  0x040705,  0x416A1E,  0x8592E3,  0x9E8484,  0x66CA94
-.pword 0x041A13,  0x171904,  0x90E471,  0x84849B,  0xFF9698,  0x181178
-.pword 0x1B0404,  0xF27A11,  0x849897,  0x909A84,  0x1477E7,  0x040419
-.pword 0x60131A,  0x9E95CC,  0x858784,  0x5BED9D,  0x051F6B,  0x1C0507
-.pword 0xE9D66F,  0x87859C,  0xE89F85,  0x1D6CDD,  0x040705,  0x466A1E
-.pword 0x8592E3,  0x9E8487,  0x61CB94,  0x041A13,  0x171904,  0x90E470
-.pword 0x84849B,  0xFF9698,  0x181179,  0x1B0404,  0xF26511,  0x849897
-.pword 0x909A84,  0x1477E7,  0x040419,  0x60131A,  0x9E95CC,  0x858784
-.pword 0x5AE292,  0x051F6B,  0x1D0507,  0xE9D16F,  0x87859C,  0xE99C85
-.pword 0x1D6CD3,  0x040705,  0x476A1F,  0x8592E2,  0x9E8487,  0x61C894
-.pword 0x041A13,  0x171904,  0x90E471,  0x84849B,  0xFC9698,  0x1B1178
-.pword 0x1B0404,  0xFD7A11,  0x849896,  0x909A84,  0x1477E7,  0x040419
-.pword 0x60131A,  0x9E95CF,  0x858484,  0x5AE292,  0x051F6B,  0x1D0507
-.pword 0xE9D06F,  0x87859C,  0xE99C85,  0x1D6CD0,  0x050705,  0x446A1F
-.pword 0x8592E2,  0x9E8484,  0x61C995,  0x041A13,  0x171904,  0x90E476
-.pword 0x84849B,  0xFC9698,  0x1B117B,  0x1B0404,  0xFC7B11,  0x849896
-.pword 0x909B84,  0x1776E4,  0x040419,  0x61131A,  0x9E95C9,  0x858484
-.pword 0x44E292,  0x051F6A,  0x1D0507,  0xE9D06C,  0x87859C,  0xE99C85
-.pword 0x1D6FD0,  0x050705,  0x456A1F,  0x8592E2,  0x9E8487,  0x61CE95
-.pword 0x071A13,  0x171904,  0x90E776,  0x84849A,  0xFD9698,  0x1B117A
-.pword 0x1B0404,  0xFC7B11,  0x849896,  0x909B84,  0x1771E4,  0x040419
-.pword 0x61131A,  0x9E95C8,  0x858484,  0x47E292,  0x051F6A,  0x1D0507
-.pword 0xE9D26C,  0x87859C,  0xE99C85,  0x1D6FD1,  0x050705,  0x5A6B1F
-.pword 0x8592E2,  0x9E8487,  0x60CF95,  0x041A13,  0x141904,  0x90E777
-.pword 0x84849A,  0xFD9698,  0x1B117A,  0x1B0404,  0xFC7811,  0x849896
-.pword 0x909B84,  0x1771E4,  0x040419,  0x61131A,  0x9E94C8,  0x858784
-.pword 0x47E292,  0x041F6A,  0x1D0507,  0xE8D26C,  0x87859F,  0xE99C85
-.pword 0x1C6FD6,  0x050705,  0x5A6B1F,  0x8592E2,  0x9E8487,  0x60CF95
-.pword 0x041A13,  0x141904,  0x90E777,  0x84849A,  0xFD9698,  0x1B117A
-.pword 0x1B0404,  0xFF7811,  0x849896,  0x909B84,  0x1771E4,  0x040419
-.pword 0x61131A,  0x9E94CB,  0x858784,  0x46E392,  0x041E6A,  0x1D0507
-.pword 0xE8DD6C,  0x87859F,  0xEE9C85,  0x1C6FD7,  0x050705,  0x586B1F
-.pword 0x859DED,  0x9E8487,  0x60CD95,  0x041A12,  0x141904,  0x90E774
-.pword 0x84849A,  0xF29798,  0x1B1165,  0x1B0404,  0xFF7811,  0x849896
-.pword 0x909B84,  0x1770E4,  0x040419,  0x66131A,  0x9E94CA,  0x858484
-.pword 0x41E392,  0x041E15,  0x1D0507,  0xE8DC6C,  0x87859F,  0xEE9C85
-.pword 0x1C6FD4,  0x050705,  0x596B1F,  0x859DED,  0x9E8487,  0x60CD95
-.pword 0x041A12,  0x141904,  0x93E674,  0x84849A,  0xF39798,  0x1B1165
-.pword 0x180404,  0xFE7916,  0x849896,  0x909B84,  0x1773E5,  0x040419
-.pword 0x66131A,  0x9994F5,  0x858484,  0x43E392,  0x041E15,  0x1D0507
-.pword 0xE8DF6D,  0x87859F,  0xEE9C85,  0x1C6ED5,  0x050705,  0x5E6B1F
-.pword 0x859DED,  0x9E8487,  0x63C395,  0x070512,  0x141904,  0x93E675
-.pword 0x84849A,  0xF39798,  0x1B1165,  0x180404,  0xFE7E16,  0x849896
-.pword 0x909B84,  0x1773E5,  0x040419,  0x66131A,  0x9994F5,  0x858784
-.pword 0x43E392,  0x041E15,  0x1D0507,  0xEBDE6D,  0x87859F,  0xEE9C85
-.pword 0x1C6E55,  0x050705,  0x5F681F,  0x859DED,  0x9E8487,  0x63C395
-.pword 0x040512,  0x141904,  0x93E675,  0x84849A,  0xF39799,  0x1B1065
-.pword 0x180404,  0xF97E16,  0x849896,  0x919B84,  0x1773E5,  0x040418
-.pword 0x66101A,  0x9994F4,  0x9A8484,  0x4DE092,  0x041E15,  0x1D0507
-.pword 0xEBD86D,  0x87859F,  0xEF9C85,  0x1C6E54,  0x050705,  0x5C681F
-.pword 0x859DEC,  0x9E8487,  0x63C095,  0x040512,  0x141904,  0x93E675
-.pword 0x84849A,  0xF09799,  0x1B1065,  0x180404,  0xF97E16,  0x849891
-.pword 0x919B84,  0x1772E5,  0x040418,  0x67101A,  0x9994F4,  0x9A8484
-.pword 0x4DE092,  0x041E15,  0x1D0507,  0xEBD86D,  0x87859F,  0xEF9C85
-.pword 0x1C6E57,  0x050705,  0x5D681F,  0x859DEC,  0x9E8487,  0x63C6EA
-.pword 0x040512,  0x141E04,  0x93E64A,  0x84849A,  0xF09799,  0x1B1064
-.pword 0x180404,  0xF87F16,  0x849891,  0x919B84,  0x1772E5,  0x040418
-.pword 0x67101A,  0x9994F4,  0x9A8484,  0x4CE092,  0x041E15,  0x1D0507
-.pword 0xEBDB62,  0x87859F,  0xEF9C85,  0x1C6956,  0x050705,  0x52681F
-.pword 0x859DEC,  0x9F8487,  0x63C6EA,  0x070512,  0x141E04,  0x93E14B
-.pword 0x84849A,  0xF09799,  0x1B1064,  0x180404,  0xF87F16,  0x849B91
-.pword 0x919B84,  0x1772FA,  0x040418,  0x67101A,  0x9994F7,  0x9A8484
-.pword 0x4FE093,  0x041E15,  0x120504,  0xEBDA62,  0x87859F,  0xEF9D85
-.pword 0x1C6951,  0x050705,  0x53691C,  0x859DEC,  0x9F8487,  0x62C4EA
-.pword 0x070512,  0x151E04,  0x93E149,  0x84849A,  0xF69799,  0x1B1064
-.pword 0x180404,  0xFB7C16,  0x849B91,  0x919B84,  0x167DFA,  0x040418
-.pword 0x67101A,  0x9994F7,  0x9A8484,  0x4FE093,  0x041E15,  0x120507
-.pword 0xEBDA62,  0x87859F,  0xEF9D85,  0x1C6951,  0x050705,  0x53691C
-.pword 0x859DEC,  0x9F8487,  0x62C4EA,  0x070512,  0x151E04,  0x93E149
-.pword 0x84849A,  0xF69799,  0x1B1067,  0x180404,  0xFB7D16,  0x849B91
-.pword 0x919B84,  0x167CFB,  0x040418,  0x67101B,  0x9997F6,  0x9A8484
-.pword 0x4EE193,  0x041E15,  0x120507,  0xEAC562,  0x87849F,  0xEF9D85
-.pword 0x1C6950,  0x050705,  0x50691C,  0x859DEF,  0x9F8587,  0x62C4EA
-.pword 0x040512,  0x151E04,  0x93E149,  0x84849A,  0xF69799,  0x1B1064
-.pword 0x180404,  0xFB7C16,  0x849B91,  0x919B84,  0x167CFB,  0x040418
-.pword 0x64101B,  0x9997F1,  0x9A8484,  0x48E193,  0x041E14,  0x120504
-.pword 0xEAC763,  0x87849F,  0xEC9D85,  0x1C6852,  0x050705,  0x56691C
-.pword 0x859DEF,  0x9F8587,  0x62DBEB,  0x070512,  0x151E04,  0x93E04F
-.pword 0x84849A,  0xF79499,  0x1A1067,  0x180404,  0xFA7D16,  0x849B91
-.pword 0x919B84,  0x167FF8,  0x040418,  0x64101B,  0x9997F1,  0x9A8484
-.pword 0x4BE193,  0x041E14,  0x120507,  0xEAC663,  0x87849E,  0xEC9D85
-.pword 0x1F685D,  0x050705,  0x56691C,  0x859CEF,  0x9F8587,  0x6DDBEB
-.pword 0x07051D,  0x151E04,  0x92E04C,  0x84849A,  0xF79499,  0x1A1067
-.pword 0x180404,  0xFA7216,  0x849B91,  0x919B84,  0x167FF8,  0x040418
-.pword 0x64101B,  0x9997F1,  0x9A8484,  0x4BE193,  0x041E14,  0x120507
-.pword 0x95C163,  0x87849E,  0xEC9D85,  0x1F685C,  0x050705,  0x546E1C
-.pword 0x859CEF,  0x9F8587,  0x6DD9EB,  0x07051D,  0x151E04,  0x92E04D
-.pword 0x84849A,  0xF49499,  0x1A1067,  0x180404,  0xE57217,  0x849B91
-.pword 0x919884,  0x167FF9,  0x040418,  0x64101B,  0x9997F0,  0x9A8484
-.pword 0x75E693,  0x041914,  0x121A04,  0x95C063,  0x87849E,  0xED9D85
-.pword 0x1F685F,  0x050705,  0x556E1C,  0x859CEE,  0x9F8587,  0x6DD9EB
-.pword 0x07051D,  0x151E04,  0x92E042,  0x848785,  0xF49499,  0x1A1366
-.pword 0x180404,  0xE57317,  0x849B90,  0x969884,  0x167EF9,  0x040418
-.pword 0x65101B,  0x9997F0,  0x9A8484,  0x75E693,  0x041914,  0x120504
-.pword 0x95C063,  0x87849E,  0xED9D85,  0x1F685F,  0x050705,  0xD56E1C
-.pword 0x859CEE,  0x9F8587,  0x6DDFE8,  0x07051D,  0x151E04,  0x92E340
-.pword 0x848785,  0xF59499,  0x1A1366,  0x190404,  0xE57317,  0x849B90
-.pword 0x969884,  0x167EFE,  0x040418,  0x65111B,  0x9997F3,  0x9A8484
-.pword 0x75E693,  0x041914,  0x121A04,  0x95C260,  0x87849E,  0xED9D85
-.pword 0x1F6B59,  0x050705,  0xD56F1C,  0x859CEE,  0x9F8587,  0x6CDCE8
-.pword 0x07051D,  0x6A1E04,  0x92E341,  0x848485,  0xCA949E,  0x1A1366
-.pword 0x190404,  0xE47017,  0x849B90,  0x969884,  0x1179FF,  0x040418
-.pword 0x65111B,  0x9897F2,  0x9A8484,  0x74E790,  0x041914,  0x121A04
-.pword 0x95CD60,  0x87849E,  0xED9D85,  0x1F6B58,  0x050705,  0xD46F1C
-.pword 0x859CEE,  0x9F8587,  0x6CDCE8,  0x07051D,  0x151E04,  0x92E341
-.pword 0x848785,  0xCA9499,  0x1A1366,  0x190404,  0xE47017,  0x849B90
-.pword 0x969884,  0x1179FF,  0x040418,  0x65111B,  0x9897F2,  0x9A8484
-.pword 0x74E790,  0x041914,  0x131A04,  0x95CD60,  0x87849E,  0xED9D85
-.pword 0x1F6B58,  0x050705,  0xD76F1C,  0x859CEE,  0x9F8587,  0x6CDDE8
-.pword 0x07051D,  0x6A1F04,  0x92E347,  0x848485,  0xCB949E,  0x1A1361
-.pword 0x190404,  0xE47117,  0x849B90,  0x969884,  0x1178FF,  0x04041B
-.pword 0x7A111B,  0x9896F2,  0x9A8484,  0x77E790,  0x041914,  0x131A04
-.pword 0x95CF60,  0x87849E,  0xE29285,  0x1F6B5A,  0x050705,  0xD16F1D
-.pword 0x859CE9,  0x9C8587,  0x6CD2E9,  0x07051D,  0x6A1F04,  0x92E347
-.pword 0x848785,  0xC8949E,  0x1A1361,  0x190404,  0xE47117,  0x849B90
-.pword 0x969884,  0x1178FC,  0x04041B,  0x7A111B,  0x9896FD,  0x9A8484
-.pword 0x76E790,  0x041914,  0x131A04,  0x95CE61,  0x87849E,  0xE29285
-.pword 0x1F6A45,  0x050705,  0xD06F1D,  0x859CE9,  0x9C8587,  0x6FD3E9
-.pword 0x07051D,  0x6A1F04,  0x92E244,  0x848785,  0xC9959E,  0x1A1361
-.pword 0x190404,  0xE77617,  0x849B90,  0x969884,  0x117BFC,  0x04041B
-.pword 0x7A111B,  0x9896FD,  0x9B8484,  0x76E790,  0x041917,  0x131A04
-.pword 0x95CE61,  0x87849E,  0xE29285,  0x1F6A45,  0x050705,  0xD06C1D
-.pword 0x859CE9,  0x9C8587,  0x6FD0E9,  0x07051D,  0x6A1F05,  0x92E245
-.pword 0x848785,  0xC9959E,  0x1A1361,  0x190404,  0xE77617,  0x849B90
-.pword 0x969884,  0x117AFD,  0x04041B,  0x78111B,  0x9896FC,  0x9B8484
-.pword 0x71E490,  0x041917,  0x131A04,  0x95C861,  0x84849E,  0xE29285
-.pword 0x1F6A47,  0x050705,  0xD36C1D,  0x859CE9,  0x9C8587,  0x6FD1E9
-.pword 0x07051D,  0x6B1F04,  0x92E25A,  0x848785,  0xCF959E,  0x1A1360
-.pword 0x190404,  0xE77714,  0x849A90,  0x969884,  0x117AFD,  0x04041B
-.pword 0x78111B,  0x9896FF,  0x9B8484,  0x71E490,  0x041917,  0x131A04
-.pword 0x94CA66,  0x84849E,  0xE3929A,  0x1E6A41,  0x050404,  0xDC6C1D
-.pword 0x859FE8,  0x9C8587,  0x6FD7EE,  0x07051C,  0x6B1F05,  0x9DED58
-.pword 0x848785,  0xCD959E,  0x1A1260,  0x190404,  0xE77714,  0x849A90
-.pword 0x979884,  0x1165F2,  0x04041B,  0x781118,  0x9896FF,  0x9B8484
-.pword 0x71E490,  0x041917,  0x131A04,  0x94CB61,  0x84849E,  0xE39285
-.pword 0x1F6A46,  0x050405,  0xDD6C1D,  0x859CE8,  0x9C8587,  0x6FD7EE
-.pword 0x07051C,  0x6B1F05,  0x9DED58,  0x848485,  0xCD959E,  0x1A1260
-.pword 0x190404,  0xE77414,  0x849A90,  0x979884,  0x1165F2,  0x04041B
-.pword 0x791118,  0x9896FE,  0x9B8484,  0x70E490,  0x041917,  0x131A04
-.pword 0x94F566,  0x848499,  0xE39285,  0x1E1540,  0x050704,  0xDF6D1D
-.pword 0x859FE8,  0x9C8587,  0x6FD4EE,  0x07051C,  0x6B1F05,  0x9DED59
-.pword 0x848785,  0xC2959E,  0x1A1260,  0x190404,  0xE67414,  0x849A93
-.pword 0x979884,  0x1165F3,  0x04041B,  0x791618,  0x9896FE,  0x9B8484
-.pword 0x73E590,  0x041817,  0x131A04,  0x94F566,  0x848499,  0xE3929A
-.pword 0x1E1543,  0x050704,  0xDE6D1D,  0x859FE8,  0x9C8587,  0x6ED5EE
-.pword 0x07051C,  0x681F05,  0x9DED5E,  0x848785,  0xC3959E,  0x051263
-.pword 0x190407,  0xE67514,  0x849A93,  0x979884,  0x1065F3,  0x04041B
-.pword 0x7E1618,  0x9896FE,  0x9B8484,  0x73E590,  0x041817,  0x131A04
-.pword 0x94F566,  0x878499,  0xE39285,  0x1E1543,  0x050704,  0xDE6D1D
-.pword 0x859FEB,  0x9C8587,  0x6E55EE,  0x07051C,  0x681F05,  0x9DED5F
-.pword 0x848785,  0xC0959E,  0x051263,  0x190404,  0xE67514,  0x849A93
-.pword 0x979984,  0x1065F0,  0x04041B,  0x7E1618,  0x9891F9,  0x9B8484
-.pword 0x72E591,  0x041817,  0x131A04,  0x94F467,  0x878499,  0xE0929A
-.pword 0x1E154D,  0x050704,  0xD86D1D,  0x859FEB,  0x9C8587,  0x6E54EF
-.pword 0x07051C,  0x681F05,  0x9DEC5C,  0x848785,  0xC1959E,  0x051263
-.pword 0x190407,  0xE64A14,  0x849A93,  0x979984,  0x1064F0,  0x04041B
-.pword 0x7E1618,  0x9891F9,  0x9B8484,  0x72E591,  0x041817,  0x101A04
-.pword 0x94F466,  0x848499,  0xE0929A,  0x1E1542,  0x050704,  0xD96D1D
-.pword 0x859FEB,  0x9C8587,  0x6E54EE,  0x07051C,  0x681F05,  0x9DEC5C
-.pword 0x848785,  0xC1959E,  0x051263,  0x1E0404,  0xE64A14,  0x849A93
-.pword 0x979984,  0x1064F0,  0x04041B,  0x7F1618,  0x9891F8,  0x9B8484
-.pword 0x72FA91,  0x041817,  0x101B04,  0x94F767,  0x848499,  0xE0939A
-.pword 0x1E154C,  0x050404,  0xDB6212,  0x859FEB,  0x9C8587,  0x6E57EF
-.pword 0x07051C,  0x681F05,  0x9DEC5D,  0x848785,  0xC6EA9E,  0x051263
-.pword 0x1E0407,  0xE14B14,  0x849A93,  0x979984,  0x1064F1,  0x04041B
-.pword 0x7F1618,  0x9891F8,  0x9B8484,  0x72FA91,  0x041817,  0x101A04
-.pword 0x94F767,  0x848499,  0xE0939A,  0x1E154F,  0x050404,  0xDA6212
-.pword 0x859FEB,  0x9D8587,  0x6951EF,  0x07051C,  0x691C05,  0x9DEC53
-.pword 0x858785,  0xC7EA9F,  0x051262,  0x1E0404,  0xE14815,  0x849A93
-.pword 0x979984,  0x1064F1,  0x04041B,  0x7F1618,  0x9B91F8,  0x9B8484
-.pword 0x7DFA91,  0x041816,  0x101A04,  0x94F767,  0x848499,  0xE0939A
-.pword 0x1E154F,  0x050704,  0xDA6212,  0x859FEB,  0x9D8587,  0x6951EF
-.pword 0x07051C,  0x691C05,  0x9DEC53,  0x858485,  0xC4EA9F,  0x051262
-.pword 0x1E0404,  0xE14915,  0x849A93,  0x979984,  0x1067F6,  0x04041B
-.pword 0x7D1618,  0x9B91FB,  0x9B8484,  0x7CFB91,  0x041816,  0x101B04
-.pword 0x97F664,  0x848499,  0xE1939A,  0x1E1549,  0x050704,  0xC46212
-.pword 0x849FEA,  0x9D8587,  0x6953EC,  0x07051C,  0x691C05,  0x9DEF50
-.pword 0x858785,  0xC5EA9F,  0x051262,  0x1E0404,  0xE14E15,  0x849A93
-.pword 0x949984,  0x1067F6,  0x04041A,  0x7D1618,  0x9B91FA,  0x9B8484
-.pword 0x7CFB91,  0x041816,  0x101B04,  0x97F164,  0x848499,  0xE1939A
-.pword 0x1E1448,  0x050704,  0xC76212,  0x859FEA,  0x9D8587,  0x6952EC
-.pword 0x07051C,  0x691C05,  0x9DEF56,  0x858785,  0xDBEB9F,  0x051262
-.pword 0x1E0407,  0xE04C15,  0x849A93,  0x949984,  0x1067F7,  0x04041A
-.pword 0x721718,  0x9B91FA,  0x9B8484,  0x7FF891,  0x041816,  0x101B04
-.pword 0x97F164,  0x848499,  0xE1939A,  0x1E144B,  0x050404,  0xC66312
-.pword 0x859FEA,  0x9D8587,  0x685DEC,  0x07051C,  0x6E1C05,  0x9CEF57
-.pword 0x858785,  0xD8EB9F,  0x051D6D,  0x1E0407,  0xE04D15,  0x879A92
-.pword 0x949984,  0x1067F4,  0x04041A,  0x721718,  0x9B91E5,  0x988484
-.pword 0x7FF991,  0x041816,  0x101B04,  0x97F064,  0x848499,  0xE6939A
-.pword 0x1E144A,  0x050404,  0xC66312,  0x849FEA,  0x9D8587,  0x685DEC
-.pword 0x07051F,  0x6E1C05,  0x9CEF57,  0x858785,  0xD8EB9F,  0x051D6D
-.pword 0x1E0407,  0xE04D15,  0x849A92,  0x949984,  0x1066F4,  0x04041A
-.pword 0x721718,  0x9B91E5,  0x988484,  0x7EF991,  0x041816,  0x101B04
-.pword 0x97F064,  0x848499,  0xE6939A,  0x191475,  0x050704,  0xC06312
-.pword 0x849E95,  0x9D8587,  0x685FED,  0x07051F,  0x6E1C05,  0x9CEE55
-.pword 0x858785,  0xD9EB9F,  0x051D6D,  0x1E0407,  0xE04215,  0x849A92
-.pword 0x949984,  0x1366F4,  0x04041A,  0x731718,  0x9B91E5,  0x988484
-.pword 0x7EF996,  0x041816,  0x101B04,  0x97F365,  0x848499,  0xE6939A
-.pword 0x191475,  0x1A0404,  0xC36312,  0x849E95,  0x9D8587,  0x685EED
-.pword 0x07051F,  0x6E1C05,  0x9CEED5,  0x858785,  0xDFE89F,  0x051D6D
-.pword 0x1E0407,  0xE34015,  0x878592,  0x949984,  0x1366F5,  0x04041A
-.pword 0x731719,  0x9B90E5,  0x988484,  0x79FE96,  0x041816,  0x101B04
-.pword 0x97F365,  0x848498,  0xE6939A,  0x191474,  0x1A0404,  0xC36012
-.pword 0x849E95,  0x9D8587,  0x6B5EED,  0x07051F,  0x6E1C05,  0x9CEED5
-.pword 0x858785,  0xDFE89F,  0x051D6D,  0x1E0407,  0xE34015,  0x848592
-.pword 0x949984,  0x1366F5,  0x04041A,  0x731719,  0x9B90E5,  0x988484
-.pword 0x79FE96,  0x041816,  0x111B04,  0x97F365,  0x848498,  0xE6939A
-.pword 0x191474,  0x1A0404,  0xC26012,  0x849E95,  0x9D8584,  0x6B59ED
-.pword 0x07051F,  0x6F1C05,  0x9CEED4,  0x858785,  0xDDE89F,  0x051D6C
-.pword 0x1E0407,  0xE3466A,  0x878592,  0x949E84,  0x1361CB,  0x04041A
-.pword 0x711719,  0x9B90E4,  0x988484,  0x78FF96,  0x041811,  0x111B04
-.pword 0x97F265,  0x848498,  0xE7909A,  0x191474,  0x1A0404,  0xCD6012
-.pword 0x849E95,  0x9D8587,  0x6B58ED,  0x07051F,  0x6F1C05,  0x9CE9D6
-.pword 0x858785,  0xD2E89F,  0x051D6C,  0x1F0407,  0xE3476A,  0x878592
-.pword 0x949E84,  0x1361C8,  0x04041A,  0x711719,  0x9B90E4,  0x988484
-.pword 0x78FF96,  0x041B11,  0x111B04,  0x96FD7A,  0x848498,  0xE7909A
-.pword 0x191477,  0x1A0404,  0xCF6013,  0x849E95,  0x928587,  0x6B5AE2
-.pword 0x07051F,  0x6F1D05,  0x9CE9D1,  0x858785,  0xD3E99C,  0x051D6C
-.pword 0x1F0407,  0xE2476A,  0x878592,  0x949E84,  0x1361C8,  0x04041A
-.pword 0x711719,  0x9B90E4,  0x988484,  0x7BFC96,  0x041B11,  0x111B04
-.pword 0x96FD7A,  0x848498,  0xE7909A,  0x191477,  0x1A0404,  0xCF6013
-.pword 0x849E95,  0x928587,  0x6B5AE2,  0x07051F,  0x6F1D05,  0x9CE9D1
-.pword 0x858785,  0xD3E99C,  0x051D6C,  0x1F0407,  0xE2446A,  0x878592
-.pword 0x959E84,  0x1361CE,  0x04041A,  0x761719,  0x9A90E7,  0x988484
-.pword 0x7AFD96,  0x041B11,  0x111B04,  0x96FC7B,  0x848498,  0xE4909B
-.pword 0x191776,  0x1A0404,  0xC96113,  0x849E95,  0x928587,  0x6A44E2
-.pword 0x07051F,  0x6C1D05,  0x9CE9D0,  0x858785,  0xD0E99C,  0x051D6F
-.pword 0x1F0507,  0xE2456A,  0x878592,  0x959E84,  0x1361CE,  0x04041A
-.pword 0x761719,  0x9B90E7,  0x988484,  0x7BFD96,  0x041B11,  0x111B04
-.pword 0x96FC7B,  0x848498,  0xE4909B,  0x191776,  0x1A0404,  0xC86113
-.pword 0x849E95,  0x928584,  0x6A47E3,  0x07051F,  0x6C1D05,  0x9CE8D2
-.pword 0x858785,  0xD6E99C,  0x051D6F,  0x1F0507,  0xE25A6B,  0x878592
-.pword 0x959E84,  0x1360CF,  0x04041A,  0x771419,  0x9A90E7,  0x988484
-.pword 0x7AFD96,  0x041B11,  0x111B04,  0x96FF78,  0x848498,  0xE4909B
-.pword 0x191771,  0x1A0404,  0xC86113,  0x849E94,  0x928587,  0x6A47E3
-.pword 0x07041F,  0x6C1D05,  0x9CE8D2,  0x858785,  0xD1E99C,  0x051D6F
-.pword 0x1F0507,  0xE25A6B,  0x878592,  0x959E84,  0x1360CF,  0x04071A
-.pword 0x771419,  0x9A90E7,  0x988484,  0x7AF296,  0x041B11,  0x111804
-.pword 0x96FF78,  0x848498,  0xE4909B,  0x191771,  0x1A0404,  0xCB6113
-.pword 0x849E94,  0x928584,  0x6A46E3,  0x07041F,  0x6C1D05,  0x9FE8DD
-.pword 0x858785,  0xD7EE9C,  0x051C6F,  0x1F0507,  0xED596B,  0x87859D
-.pword 0x959E84,  0x1260C2,  0x04041A,  0x741419,  0x9A90E6,  0x988484
-.pword 0x65F397,  0x041B11,  0x161804,  0x96FE79,  0x848498,  0xE4909B
-.pword 0x191770,  0x1A0404,  0xF56613,  0x849994,  0x928584,  0x6A41E3
-.pword 0x07041E,  0x6C1D05,  0x9FE8DF,  0x858785,  0xD5EE9C,  0x051C6E
-.pword 0x1F0507,  0xED596B,  0x87859D,  0x959E84,  0x1260C2,  0x04041A
-.pword 0x741419,  0x9A93E6,  0x988484,  0x65F397,  0x041B11,  0x161804
-.pword 0x96FE79,  0x848498,  0xE5909B,  0x191770,  0x1A0404,  0xF56613
-.pword 0x849E94,  0x929A84,  0x1540E3,  0x04041E,  0x6D1D05,  0x9FE8DF
-.pword 0x858785,  0xD5EE9C,  0x051C6E,  0x1F0507,  0xED5E68,  0x84859D
-.pword 0x959E84,  0x1263C3,  0x04041A,  0x751419,  0x9A93E6,  0x998484
-.pword 0x65F397,  0x041B10,  0x161804,  0x96F97E,  0x848498,  0xE5909B
-.pword 0x181773,  0x1A0404,  0xF56613,  0x849994,  0x928587,  0x1543E3
-.pword 0x07041E,  0x6D1D05,  0x9FE8DE,  0x858785,  0x55EE9C,  0x051C6E
-.pword 0x1F0507,  0xED5F68,  0x87859D,  0x959E84,  0x1263C0,  0x04041A
-.pword 0x75141E,  0x9A93E6,  0x998484,  0x65F097,  0x041B10,  0x161804
-.pword 0x96F97E,  0x848498,  0xE5919B,  0x181772,  0x1A0404,  0xF46613
-.pword 0x849994,  0x929A87,  0x154DE0,  0x07041E,  0x6D1D05,  0x9FEBD9
-.pword 0x858785,  0x54EF9C,  0x051C6E,  0x1F0507,  0xEC5C68,  0x87859D
-.pword 0x959E84,  0x1263C0,  0x040405,  0x4A141E,  0x9A93E6,  0x998484
-.pword 0x64F097,  0x041B10,  0x161804,  0x91F97F,  0x848498,  0xE5919B
-.pword 0x181772,  0x1A0404,  0xF46710,  0x849994,  0x929A84,  0x154DE0
-.pword 0x07041E,  0x6D1D05,  0x9FEBD9,  0x858785,  0x57EF9C,  0x051C6E
-.pword 0x1F0507,  0xEC5D68,  0x87859D,  0xEA9E84,  0x1263C6,  0x040705
-.pword 0x4B141E,  0x9A93E1,  0x998484,  0x64F197,  0x041B10,  0x161804
-.pword 0x91F87F,  0x848498,  0xFA919B,  0x181772,  0x1A0404,  0xF76710
-.pword 0x849994,  0x939A84,  0x154CE0,  0x07041E,  0x621205,  0x9FEBDB
-.pword 0x858785,  0x56EF9D,  0x051C69,  0x1C0507,  0xEC5268,  0x87859D
-.pword 0xEA9F84,  0x1262C7,  0x040705,  0x48141E,  0x9A93E1,  0x998484
-.pword 0x64F197,  0x041B10,  0x161804,  0x91F87F,  0x84849B,  0xFA919B
-.pword 0x18167D,  0x1A0404,  0xF76710,  0x849994,  0x939A84,  0x154FE0
-.pword 0x07041E,  0x621205,  0x9FEBDA,  0x858785,  0x51EF9D,  0x051C69
-.pword 0x1C0507,  0xEC5369,  0x87859D,  0xEA9F85,  0x1262C4,  0x040705
-.pword 0x49151E,  0x9A93E1,  0x998484,  0x64F697,  0x041B10,  0x161804
-.pword 0x91FB7C,  0x84849B,  0xFB919B,  0x18167C,  0x1B0404,  0xF66410
-.pword 0x849997,  0x939A84,  0x1549E1,  0x07041E,  0x621205,  0x9FEAC5
-.pword 0x858785,  0x50EF9D,  0x051C69,  0x1C0507,  0xEC5069,  0x87859D
-.pword 0xEA9F84,  0x1262C5,  0x040705,  0x4E151E,  0x9A93E1,  0x998484
-.pword 0x67F697,  0x041B10,  0x161804,  0x91FB7D,  0x84849B,  0xFB919B
-.pword 0x18167C,  0x1B0404,  0xF66410,  0x849997,  0x939A84,  0x1549E1
-.pword 0x07041E,  0x621205,  0x9FEAC4,  0x858785,  0x53EC9D,  0x051C69
-.pword 0x1C0507,  0xEF5169,  0x84859D,  0xEB9F85,  0x1262DA,  0x040405
-.pword 0x4F151E,  0x9A93E1,  0x998484,  0x67F794,  0x041B10,  0x161804
-.pword 0x91FA7D,  0x84849B,  0xF8919B,  0x18167C,  0x1B0404,  0xF16410
-.pword 0x849997,  0x939A84,  0x1448E1,  0x04041E,  0x631205,  0x9FEAC6
-.pword 0x858785,  0x52EC9D,  0x051C68,  0x1C0507,  0xEF5669,  0x87859D
-.pword 0xEB9F85,  0x1262DB,  0x040705,  0x4F151E,  0x9A93E0,  0x998484
-.pword 0x67F794,  0x041A10,  0x161804,  0x91FA7D,  0x84849B,  0xF8919B
-.pword 0x18167F,  0x1B0404,  0xF16410,  0x849997,  0x939A84,  0x144BE1
-.pword 0x04041E,  0x631205,  0x9FEAC6,  0x858784,  0x5DEC9D,  0x051F68
-.pword 0x1C0507,  0xEF576E,  0x87859C,  0xEB9F85,  0x1D6DD8,  0x040705
-.pword 0x4D151E,  0x9A92E0,  0x998484,  0x67F494,  0x041A10,  0x171804
-.pword 0x91E572,  0x84849B,  0xF8919B,  0x18167F,  0x1B0404,  0xF16410
-.pword 0x849997,  0x939A84,  0x144BE1,  0x04041E,  0x631205,  0x9FEAC6
-.pword 0x858784,  0x5CEC9D,  0x051F68,  0x1C0507,  0xEF546E,  0x87859C
-.pword 0xEB9F85,  0x1D6DD9,  0x040405,  0x43151E,  0x9A92E0,  0x998484
-.pword 0x66F494,  0x041A10,  0x171904,  0x91E573,  0x84849B,  0xF99698
-.pword 0x18167E,  0x1B0404,  0xF06510,  0x849997,  0x939A84,  0x1475E6
-.pword 0x070419,  0x631205,  0x9E95C0,  0x858784,  0x5FED9D,  0x051F68
-.pword 0x1C0507,  0xEE556E,  0x87859C,  0xE89F85,  0x1D6DDE,  0x040705
-.pword 0x43151E,  0x9A92E0,  0x998484,  0x66F594,  0x041A13,  0x171904
-.pword 0x91E573,  0x84849B,  0xFE9698,  0x18167E,  0x1B0404,  0xF36511
-.pword 0x849997,  0x939A84,  0x1475E6,  0x040419,  0x63121A,  0x9E95C3
-.pword 0x858784,  0x5EED9D,  0x051F68,  0x1C0507,  0xEED56E,  0x87859C
-.pword 0xE89F85,  0x1D6DDE,  0x040705,  0x43151E,  0x8592E3,  0x998484
-.pword 0x66F594,  0x041A13,  0x171904,  0x91E573,  0x84849B,  0xFE9698
-.pword 0x181679,  0x1B0404,  0xF36511,  0x849997,  0x939A84,  0x1474E6
-.pword 0x040419,  0x60121A,  0x9E95C2,  0x858784,  0x59ED9D,  0x051F6B
-.pword 0x1C0507,  0xEED46F,  0x87859C,  0xE89F85,  0x1D6CDC,  0x040705
-.pword 0x416A1E,  0x8592E3,  0x9E8484,  0x66CA94,  0x041A13,  0x171904
-.pword 0x90E471,  0x84849B,  0xFF9698,  0x1B1178,  0x1B0404,  0xF27A11
-.pword 0x849896,  0x909A84,  0x1477E7,  0x040419,  0x60131A,  0x9E95CC
-.pword 0x858784,  0x5BED9D,  0x051F6B,  0x1C0507,  0xE9D76F,  0x87859C
-.pword 0xE89F85,  0x1D6CDD,  0x040705,  0x466A1E,  0x8592E3,  0x9E8487
-.pword 0x61CB94,  0x041A13,  0x171904,  0x90E471,  0x84849B,  0xFF9698
-.pword 0x1B1178,  0x1B0404,  0xFD7A11,  0x849896,  0x909A84,  0x1477E7
-.pword 0x040419,  0x60131A,  0x9E95CC,  0x858784,  0x5BE292,  0x051F6B
-.pword 0x1C0507,  0xE9D66F,  0x87859C,  0xE89F85,  0x1D6CD2,  0x040705
-.pword 0x476A1F,  0x8592E2,  0x9E8487,  0x61C894,  0x071A13,  0x171904
-.pword 0x90E471,  0x84849B,  0xFF9698,  0x1B1178,  0x1B0404,  0xFD7A11
-.pword 0x849896,  0x909A84,  0x1477E7,  0x040419,  0x60131A,  0x9E95CF
-.pword 0x858784,  0x5AE292,  0x051F6B,  0x1D0507,  0xE9D16F,  0x87859C
-.pword 0xE99C85,  0x1D6CD3,  0x040705,  0x446A1F,  0x8592E2,  0x9E8487
-.pword 0x61C995,  0x041A13,  0x171904,  0x90E471,  0x84849B,  0xFC9698
-.pword 0x1B1178,  0x1B0404,  0xFD7A11,  0x849896,  0x909A84,  0x1477E7
-.pword 0x040419,  0x60131A,  0x9E95CE,  0x858784,  0x45E292,  0x051F6A
-.pword 0x1D0507,  0xE9D16F,  0x87859C,  0xE99C85,  0x1D6CD3,  0x050705
-.pword 0x446A1F,  0x8592E2,  0x9E8487,  0x61C995,  0x041A13,  0x171904
-.pword 0x90E471,  0x84849B,  0xFC9698,  0x1B117B,  0x1B0404,  0xFD7B11
-.pword 0x849896,  0x909B84,  0x1776E7,  0x040419,  0x61131A,  0x9E95CE
-.pword 0x858484,  0x44E292,  0x051F6A,  0x1D0507,  0xE9D36C,  0x87859C
-.pword 0xE99C85,  0x1D6FD1,  0x050705,  0x5A6B1F,  0x8592E2,  0x9E8484
-.pword 0x60CF95,  0x041A13,  0x141904,  0x90E777,  0x84849A,  0xFD9698
-.pword 0x1B117A,  0x1B0404,  0xFC7B11,  0x849896,  0x909B84,  0x1776E4
-.pword 0x040419,  0x61131A,  0x9E95C9,  0x858784,  0x44E292,  0x041F6A
-.pword 0x1D0507,  0xE9D36C,  0x87859C,  0xE99C85,  0x1D6FD1,  0x050705
-.pword 0x5A6B1F,  0x8592E2,  0x9E8487,  0x60CF95,  0x041A13,  0x141904
-.pword 0x90E777,  0x84849A,  0xFD9698,  0x1B117A,  0x1B0404,  0xFF7811
-.pword 0x849896,  0x909B84,  0x1771E4,  0x040419,  0x61131A,  0x9E94CB
-.pword 0x858784,  0x47E392,  0x041E6A,  0x1D0507,  0xE8D26C,  0x87859F
-.pword 0xE99C85,  0x1C6FD6,  0x050705,  0x5B6B1F,  0x859DED,  0x9E8487
-.pword 0x60CC95,  0x071A12,  0x141904,  0x90E777,  0x84849A,  0xF29698
-.pword 0x1B117A,  0x1B0404,  0xFF7811,  0x849896,  0x909B84,  0x1771E4
-.pword 0x040419,  0x66131A,  0x9E94CB,  0x858484,  0x41E392,  0x041E6A
-.pword 0x1D0507,  0xE8DC6C,  0x87859F,  0xEE9C85,  0x1C6FD4,  0x050705
-.pword 0x596B1F,  0x859DED,  0x9E8487,  0x60C295,  0x041A12,  0x141904
-.pword 0x93E674,  0x84849A,  0xF29798,  0x1B1165,  0x1B0404,  0xFE7911
-.pword 0x849896,  0x909B84,  0x1770E4,  0x040419,  0x66131A,  0x9994F5
-.pword 0x858784,  0x40E392,  0x041E15,  0x1D0507,  0xE8DF6C,  0x87859F
-.pword 0xEE9C85,  0x1C6ED5,  0x050705,  0x5E6B1F,  0x859DED,  0x9E8487
-.pword 0x60C295,  0x071A12,  0x141904,  0x93E674,  0x84849A,  0xF39798
-.pword 0x1B1165,  0x180404,  0xFE7916,  0x849896,  0x909B84,  0x1773E5
-.pword 0x040419,  0x66131A,  0x9994F5,  0x858784,  0x43E392,  0x041E15
-.pword 0x1D0507,  0xEBDE6D,  0x87859F,  0xEE9C85,  0x1C6E55,  0x050705
-.pword 0x5E681F,  0x859DED,  0x9E8487,  0x60C295,  0x041A12,  0x141904
-.pword 0x90E674,  0x84849A,  0xF29798,  0x1B1165,  0x180404,  0xFE7916
-.pword 0x849896,  0x909B84,  0x1773E5,  0x040419,  0x66131A,  0x9994F5
-.pword 0x9A8484,  0x43E092,  0x041E15,  0x1D0504,  0xE8DE6D,  0x87859F
-.pword 0xEE9C85,  0x1C6E55,  0x050705,  0x5F681F,  0x859DED,  0x9E8487
-.pword 0x63C095,  0x070512,  0x141904,  0x93E675,  0x84849A,  0xF09799
-.pword 0x1B1065,  0x180404,  0xF97E16,  0x849896,  0x919B84,  0x1773E5
-.pword 0x040418,  0x66131A,  0x9994F4,  0x9A8484,  0x42E092,  0x041E15
-.pword 0x1D0507,  0xEBD96D,  0x87859F,  0xEF9C85,  0x1C6E54,  0x050705
-.pword 0x5C681F,  0x859DEC,  0x9E8487,  0x63C195,  0x070512,  0x141904
-.pword 0x93E675,  0x84879A,  0xF09798,  0x1B1064,  0x180404,  0xF97E16
-.pword 0x849B91,  0x919B84,  0x1772E5,  0x040418,  0x67101A,  0x9994F4
-.pword 0x9A8484,  0x4DE092,  0x041E15,  0x1D0507,  0xEBD86D,  0x87859F
-.pword 0xEF9C85,  0x1C6E57,  0x050705,  0x5D681F,  0x859DEC,  0x9E8487
-.pword 0x63C6EA,  0x070512,  0x141E04,  0x93E14B,  0x84849A,  0xF19799
-.pword 0x1B1064,  0x180404,  0xF87F16,  0x849B91,  0x919B84,  0x167DFA
-.pword 0x040418,  0x67101A,  0x9994F7,  0x9A8484,  0x4FE093,  0x041E15
-.pword 0x120507,  0xEBDA62,  0x87859F,  0xEF9D85,  0x1C6956,  0x050705
-.pword 0x52681C,  0x859DEC,  0x9F8487,  0x63C7EA,  0x070512,  0x141E04
-.pword 0x93E14B,  0x84849A,  0xF19799,  0x1B1064,  0x180404,  0xF87F16
-.pword 0x849B91,  0x919B84,  0x167DFA,  0x040418,  0x67101A,  0x9994F6
-.pword 0x9A8484,  0x4FE093,  0x041E15,  0x120507,  0xEBDA62,  0x87859F
-.pword 0xEF9D85,  0x1C6951,  0x050705,  0x53691C,  0x859DEC,  0x9F8487
-.pword 0x62C7EA,  0x070512,  0x151E04,  0x93E148,  0x84849A,  0xF69799
-.pword 0x1B1064,  0x180404,  0xFB7C16,  0x849B91,  0x919B84,  0x167CFB
-.pword 0x040418,  0x67101B,  0x9997F6,  0x9A8484,  0x4EE193,  0x041E15
-.pword 0x120507,  0xEBC562,  0x87859F,  0xEF9D85,  0x1C6951,  0x050705
-.pword 0x53691C,  0x859DEC,  0x9F8587,  0x62C5EA,  0x040512,  0x151E04
-.pword 0x93E14E,  0x84849A,  0xF69499,  0x1B1067,  0x180404,  0xFB7D16
-.pword 0x849B91,  0x919B84,  0x167CFB,  0x040418,  0x64101B,  0x9997F6
-.pword 0x9A8484,  0x49E193,  0x041E15,  0x120507,  0xEAC462,  0x87859F
-.pword 0xEC9D85,  0x1C6953,  0x050705,  0x51691C,  0x859DEF,  0x9F8587
-.pword 0x62C5EB,  0x040512,  0x151E04,  0x93E14E,  0x84849A,  0xF69499
-.pword 0x1B1067,  0x180404,  0xFA7D16,  0x849B91,  0x919B84,  0x167CF8
-.pword 0x040418,  0x64101B,  0x9997F1,  0x9A8484,  0x4BE193,  0x041E14
-.pword 0x120507,  0xEAC663,  0x87849F,  0xEC9D85,  0x1C685D,  0x050705
-.pword 0x56691C,  0x859CEF,  0x9F8587,  0x62DBEB,  0x07051D,  0x151E04
-.pword 0x93E04C,  0x84849A,  0xF79499,  0x1A1067,  0x180404,  0xFA7216
-.pword 0x849B91,  0x919B84,  0x167FF8,  0x040418,  0x64101B,  0x9997F1
-.pword 0x9A8484,  0x48E193,  0x041E14,  0x120504,  0xEAC763,  0x87849F
-.pword 0xEC9D85,  0x1C6852,  0x050705,  0x56691C,  0x859CEF,  0x9F8587
-.pword 0x6DD8EB,  0x07051D,  0x151E04,  0x93E04D,  0x84849A,  0xF49499
-.pword 0x1A1067,  0x180404,  0xE57217,  0x849B91,  0x919884,  0x167FF9
-.pword 0x040418,  0x64101B,  0x9997F0,  0x9A8484,  0x4AE193,  0x041E14
-.pword 0x120507,  0xEAC663,  0x87849E,  0xEC9D85,  0x1F685D,  0x050705
-.pword 0x546E1C,  0x859CEF,  0x9F8587,  0x6DD9EB,  0x07051D,  0x151E04
-.pword 0x92E042,  0x84849A,  0xF49499,  0x1A1067,  0x190404,  0xE57317
-.pword 0x849B91,  0x969884,  0x167EF9,  0x040418,  0x65101B,  0x9997F0
-.pword 0x9A8484,  0x75E693,  0x041E14,  0x121A04,  0x95C063,  0x87849E
-.pword 0xED9D85,  0x1F685F,  0x050705,  0x556E1C,  0x859CEE,  0x9F8587
-.pword 0x6DDEE8,  0x07051D,  0x151E04,  0x92E343,  0x84849A,  0xF59499
-.pword 0x1A1366,  0x180404,  0xE57317,  0x849B91,  0x969884,  0x167EF9
-.pword 0x040418,  0x65101B,  0x9997F3,  0x9A8484,  0x75E693,  0x041914
-.pword 0x120507,  0x95C363,  0x87849E,  0xED9D85,  0x1F685E,  0x050705
-.pword 0xD56E1C,  0x859CEE,  0x9F8587,  0x6DDFE8,  0x07051D,  0x151E04
-.pword 0x92E340,  0x84849A,  0xF59499,  0x1A1366,  0x190404,  0xE57017
-.pword 0x849B90,  0x969884,  0x1679FE,  0x040418,  0x65111B,  0x9897F3
-.pword 0x9A8484,  0x74E690,  0x041914,  0x121A04,  0x95CD60,  0x87849E
-.pword 0xED9D85,  0x1F6B58,  0x050705,  0xD76F1C,  0x859CEE,  0x9F8587
-.pword 0x6CDCE8,  0x07051D,  0x151E04,  0x92E341,  0x848785,  0xF59499
-.pword 0x1A1366,  0x190404,  0xE47017,  0x849B90,  0x969884,  0x1179FF
-.pword 0x040418,  0x65111B,  0x9897F2,  0x9A8484,  0x77E790,  0x041914
-.pword 0x131A04,  0x95CC60,  0x87849E,  0xED9D85,  0x1F6B58,  0x050705
-.pword 0xD76F1C,  0x859CEE,  0x9F8587,  0x6CDCE8,  0x07051D,  0x151E04
-.pword 0x92E341,  0x848785,  0xCA9499,  0x1A1366,  0x190404,  0xE47017
-.pword 0x849B90,  0x969884,  0x1178FF,  0x040418,  0x7A111B,  0x9897F2
-.pword 0x9A8484,  0x77E790,  0x041914,  0x131A04,  0x95CF60,  0x87849E
-.pword 0xE29285,  0x1F6B5B,  0x050705,  0xD66F1C,  0x859CE9,  0x9F8587
-.pword 0x6CD2E8,  0x07051D,  0x6A1F04,  0x92E247,  0x848785,  0xC8949E
-.pword 0x1A1361,  0x190404,  0xE47117,  0x849B90,  0x969884,  0x1178FF
-.pword 0x04041B,  0x7A111B,  0x9896FD,  0x9A8484,  0x77E790,  0x041914
-.pword 0x131A04,  0x95CF60,  0x87849E,  0xE29285,  0x1F6B5A,  0x050705
-.pword 0xD16F1D,  0x859CE9,  0x9C8587,  0x6CD3E9,  0x07051D,  0x6A1F05
-.pword 0x92E244,  0x848485,  0xC8959E,  0x1A1361,  0x190404,  0xE47117
-.pword 0x849B90,  0x969884,  0x1178FC,  0x04041B,  0x9B111B,  0x988484
-.pword 0x79FF96,  0x041811,  0x111B04,  0x97F265,  0x848498,  0xE7909A
-.pword 0x191477,  0x1A0404,  0xCC6013,  0x849E95,  0x9D8587,  0x6B58ED
-.pword 0x07051F,  0x6F1C05,  0x9CEED7,  0x858785,  0xDCE89F,  0x051D6C
-.pword 0x1E0407,  0xE34115,  0x878592,  0x949984,  0x1366CA,  0x04041A
-.pword 0x701719,  0x9B90E4,  0x988484,  0x78FF96,  0x041811,  0x111B04
-.pword 0x97F27A,  0x848498,  0xE7909A,  0x191477,  0x1A0404,  0xCF6013
-.pword 0x849E95,  0x928587,  0x6B5BE2,  0x07051F,  0x6F1C05,  0x9CE9D6
-.pword 0x858785,  0xD2E89F,  0x051D6C,  0x1F0407,  0xE2476A,  0x878592
-.pword 0x949E84,  0x1361C8,  0x04041A,  0x711719,  0x9B90E4,  0x988484
-.pword 0x78FF96,  0x041B11,  0x111B04,  0x96FD7A,  0x848498,  0xE7909A
-.pword 0x001477        
@@ -1,497 +0,0 @@
-/******************************************************************************
-*  Speech.s developed by AccelWork Inc. for Microchip Technology Inc. 
-*  Copyright (c) 2005 by Microchip. All rights are reserved. 
-*  
-*  This Copyright notice may not be removed or modified without prior written 
-*  consent of Microchip Technology Inc. 
-******************************************************************************/
-
-/******************************************************************************
-*  Speech.s
-*
-*  Description:
-*    This file is generated by dsPIC33F Speech Encoder Utility Version 1.00
-*    It contains the ALAW compressed data for a 8kHz,16-bit speech signal.The
-*    output array represents a 64kbps encoded bit stream.
-*
-*    Speech Encoder Utility settings:
-*       Input Source:  Gtune.wav
-*       Output Array:  G711_Gtune
-*       Array Size:    8193 bytes                
-*       Target Memory: Program Memory
-*       LAW:           ALAW
-*
-*    Modification History:
-*
-*       Date           Author              Description
-*       ----           ------              -----------
-*
-*    Dec-16-2005    Taruna Singh		   Created
-*    Dec-20-2005    Taruna Singh		   Ready for Alpha Release
-*
-******************************************************************************/
-
-/* There are 2731 elements in the data array. */
-   
-/* Data file for storing 24-bit constants in program memory */
-
-.global _G711_Gtune
-
-.section .G711, code
-_G711_Gtune:
-.pword 0x904161,  0x938485,  0x0516C2,  0x761D04,  0x848595,  0x68FE9F
-.pword 0x1E041A,  0x98EC67,  0xE39887,  0x071961,  0xE56E1B,  0x9A879E
-.pword 0x1C7DEA,  0x140504,  0x8492CB,  0x599685,  0x040413,  0x915010
-.pword 0x928485,  0x0517C2,  0x711D04,  0x878595,  0x68F89F,  0x19071A
-.pword 0x98ED66,  0xE29887,  0x071961,  0xFA6E1B,  0x9A849F,  0x1C73EA
-.pword 0x140504,  0x8492CE,  0x5D9685,  0x040410,  0x965C10,  0x928485
-.pword 0x0514CE,  0x731C04,  0x849AEA,  0x6EFA9F,  0x19071B,  0x98E261
-.pword 0xED9887,  0x071E66,  0xF8691B,  0x85849F,  0x1D7195,  0x170504
-.pword 0x8492C3,  0x519184,  0x040410,  0x965813,  0x9D8485,  0x0514CA
-.pword 0x7D1C04,  0x879AEA,  0x6EE59E,  0x19071B,  0x98E360,  0xEC9B87
-.pword 0x071E67,  0xFE681A,  0x85849F,  0x1D7795,  0x170504,  0x8493C6
-.pword 0x549184,  0x040410,  0x964513,  0x9D8485,  0x0514F4,  0x7F1C04
-.pword 0x879AEB,  0x6FE49E,  0x19071B,  0x99E360,  0xEF9B87,  0x071E64
-.pword 0xFF6B1A,  0x85849C,  0x1D7494,  0x160504,  0x8493C4,  0xD59184
-.pword 0x040511,  0x974613,  0x9D8485,  0x0515F7,  0x791F04,  0x879AE8
-.pword 0x6CE79E,  0x180718,  0x99E163,  0xEE9B87,  0x071E65,  0xFD6A1A
-.pword 0x85849C,  0x124B94,  0x160504,  0x8493D9,  0xD09084,  0x040511
-.pword 0x974212,  0x9D8485,  0x0515F0,  0x781F04,  0x879BE9,  0x6DE699
-.pword 0x180718,  0x99E162,  0xEE9B87,  0x041F7A,  0xF36A1A,  0x85849C
-.pword 0x124E94,  0x160504,  0x8490DD,  0xDF9084,  0x040516,  0x944912
-.pword 0x9C8485,  0x1A6AF2,  0x651F04,  0x879BEE,  0x62E199,  0x180718
-.pword 0x9EE66D,  0xE99B87,  0x041F78,  0xF11505,  0x85849D,  0x124297
-.pword 0x110504,  0x8490D0,  0xD99384,  0x040516,  0x944A12,  0x9C8485
-.pword 0x1A6BFD,  0x651E04,  0x879BEF,  0x63E099,  0x1B0718,  0x9EE76C
-.pword 0xE89A87,  0x041F7E,  0xF71505,  0x85849D,  0x134697,  0x110404
-.pword 0x8490D4,  0xC59384,  0x040516,  0x94741D,  0x9C8485,  0x1A6BFF
-.pword 0x641E07,  0x879BEC,  0x60E399,  0x1B0719,  0x9EE46F,  0xEB9A84
-.pword 0x041C7C,  0xF51405,  0x85849D,  0x135A96,  0x100404,  0x859156
-.pword 0xC09284,  0x040517,  0x95761D,  0x9F8485,  0x1A68F9,  0x671E07
-.pword 0x8798EC,  0x61E298,  0x1B0719,  0x9EE56E,  0xEA9A87,  0x041C7D
-.pword 0xCB1405,  0x858492,  0x135E96,  0x100404,  0x859153,  0xCD9284
-.pword 0x040517,  0x95701D,  0x9F8485,  0x1B69F8,  0x661907,  0x8798ED
-.pword 0x61E298,  0x1B0719,  0x9FFA6E,  0x959A84,  0x041C73,  0xCF1705
-.pword 0x858492,  0x105D91,  0x100404,  0x85965C,  0xCE9284,  0x040514
-.pword 0xEA731C,  0x9F849A,  0x1B6EFA,  0x611907,  0x8798E2,  0x66ED98
-.pword 0x1B071E,  0x9FF868,  0x958584,  0x041D71,  0xC31705,  0x858492
-.pword 0x105191,  0x130404,  0x859658,  0xCA9284,  0x040514,  0xEA7D1C
-.pword 0x9E849A,  0x1B6FE5,  0x601907,  0x8798E3,  0x67EC98,  0x1A041E
-.pword 0x9FFE68,  0x958584,  0x041D77,  0xC61705,  0x848493,  0x115591
-.pword 0x130404,  0x859644,  0xF49D84,  0x040514,  0xE87E1F,  0x9E879A
-.pword 0x1B6CE7,  0x631807,  0x8799E0,  0x64EF9B,  0x1A071E,  0x9CFC6B
-.pword 0x948584,  0x041D75,  0xDA1605,  0x848493,  0x11D790,  0x120404
-.pword 0x859740,  0xF69D84,  0x040515,  0xE8791F,  0x9E879A,  0x186CE7
-.pword 0x631807,  0x8799E1,  0x65EE9B,  0x1A041E,  0x9CF26A,  0x948584
-.pword 0x041248,  0xDE1605,  0x848493,  0x11D390,  0x120405,  0x85974D
-.pword 0xF09C84,  0x041A15,  0xE97B1F,  0x99879B,  0x186DE6,  0x6D1807
-.pword 0x8799E6,  0x7BE99B,  0x05041F,  0x9CF015,  0x978584,  0x04124C
-.pword 0xD21105,  0x848490,  0x16DF90,  0x120405,  0x859449,  0xF29C84
-.pword 0x041A6A,  0xEE651F,  0x99879B,  0x1862E1,  0x6D1807,  0x8799E6
-.pword 0x78E99A,  0x05041F,  0x9DF115,  0x978584,  0x041243,  0xD11105
-.pword 0x848490,  0x16D893,  0x1D0405,  0x859475,  0xFC9C84,  0x041A6B
-.pword 0xEF651E,  0x99879B,  0x1863E0,  0x6C1B07,  0x879EE7,  0x7EE89A
-.pword 0x05041F,  0x9DF715,  0x978584,  0x041347,  0xD51104,  0x848491
-.pword 0x16C493,  0x1D0405,  0x859474,  0xFF9F84,  0x071A6B,  0xEC641E
-.pword 0x99879B,  0x1960E3,  0x6F1B07,  0x849EE4,  0x7CEB9A,  0x05041C
-.pword 0x9DF514,  0x968584,  0x04135B,  0x561004,  0x848591,  0x17C092
-.pword 0x1D0405,  0x859576,  0xF99F84,  0x071B68,  0xED671E,  0x988798
-.pword 0x1961E2,  0x6E1B07,  0x849FE5,  0x72EA9A,  0x05041C,  0x92C914
-.pword 0x968584,  0x04105F,  0x521004,  0x848591,  0x17CF92,  0x1C0405
-.pword 0x9A9573,  0xFB9F84,  0x071B69,  0xE26619,  0x988798,  0x1966ED
-.pword 0x691B07,  0x849FFB,  0x70959A,  0x05041C,  0x92CD17,  0x918584
-.pword 0x041053,  0x5E1304,  0x848596,  0x14C892,  0x1C0405,  0x9AEA72
-.pword 0xE59E87,  0x071B6E,  0xE26119,  0x988798,  0x1E67EC,  0x681A07
-.pword 0x849FF9,  0x769585,  0x05041D,  0x92C317,  0x918584,  0x041056
-.pword 0x5B1304,  0x848596,  0x14F59D,  0x1C0405,  0x9AEB7C,  0xE49E84
-.pword 0x071B6F,  0xE36019,  0x9B8799,  0x1E64EC,  0x6B1A07,  0x849FFF
-.pword 0x749485,  0x05041D,  0x93C416,  0x908484,  0x0411D5,  0x461304
-.pword 0x848597,  0x15F79D,  0x1F0405,  0x9AE87E,  0xE79E87,  0x071B6C
-.pword 0xE06318,  0x9B8799,  0x1E65EF,  0x6B1A04,  0x849CFC,  0x4A9485
-.pword 0x05041D,  0x93D816,  0x908484,  0x0511D1,  0x431204,  0x848597
-.pword 0x15F19D,  0x1F0405,  0x9BE978,  0xE69987,  0x07186D,  0xE16218
-.pword 0x9B8799,  0x1F7AEE,  0x151A04,  0x849CF3,  0x4E9785,  0x050412
-.pword 0x90DC16,  0x908484,  0x0511DD,  0x4F1204,  0x848597,  0x15F39C
-.pword 0x1F041A,  0x9BE97A,  0xE69987,  0x071862,  0xE66D18,  0x9B8799
-.pword 0x1F7BE9,  0x151A04,  0x849CF0,  0x4D9785,  0x050412,  0x90D311
-.pword 0x938484,  0x0516DE,  0x481204,  0x848594,  0x6AF29C,  0x1F041A
-.pword 0x9BEE65,  0xE19987,  0x071862,  0xE76C18,  0x9A879E,  0x1F79E8
-.pword 0x150504,  0x849DF6,  0x409785,  0x050413,  0x90D611,  0x938484
-.pword 0x0516DA,  0x751D04,  0x848594,  0x6BFC9C,  0x1E041A,  0x9BEF64
-.pword 0xE09987,  0x071960,  0xE46F1B,  0x9A849E,  0x1C7FEB,  0x140504
-.pword 0x849DF4,  0x459685,  0x040413,  0x915410,  0x938485,  0x0517C6
-.pword 0x761D04,  0x848595,  0x68F99F,  0x1E071A,  0x98EC67,  0xE39887
-.pword 0x071960,  0xE56F1B,  0x9A849E,  0x1C7DEA,  0x140504,  0x849DCA
-.pword 0x589685,  0x040413,  0x915110,  0x928485,  0x0517C3,  0x711D04
-.pword 0x848595,  0x69F89F,  0x19071B,  0x98ED66,  0xE29887,  0x071961
-.pword 0xFA6E1B,  0x9A849F,  0x1C73EA,  0x140504,  0x8492CE,  0x5C9685
-.pword 0x040410,  0x915D10,  0x928485,  0x0517CE,  0x731C04,  0x878595
-.pword 0x69FA9F,  0x19071B,  0x98ED66,  0xED9887,  0x071966,  0xFB691B
-.pword 0x9A849F,  0x1D7095,  0x170504,  0x8492C2,  0x509185,  0x040410
-.pword 0x965913,  0x928485,  0x0514CB,  0x7D1C04,  0x849AEA,  0x6EE59E
-.pword 0x19071B,  0x98E360,  0xEC9887,  0x071E67,  0xF9681A,  0x85849F
-.pword 0x1D7695,  0x170504,  0x8493C1,  0x579184,  0x040410,  0x965A13
-.pword 0x9D8485,  0x0514F5,  0x7C1C04,  0x879AEB,  0x6FE49E,  0x19071B
-.pword 0x99E060,  0xEF9B87,  0x041E64,  0xFF6B1A,  0x85849C,  0x1D7494
-.pword 0x160504,  0x8493C5,  0xD79084,  0x040411,  0x974113,  0x9D8485
-.pword 0x0515F6,  0x791F04,  0x879AE8,  0x6CE79E,  0x180718,  0x99E063
-.pword 0xEF9B87,  0x041E65,  0xFD6A1A,  0x85849C,  0x124B94,  0x160504
-.pword 0x8493D9,  0xD39084,  0x040511,  0x974D12,  0x9C8485,  0x1A15F0
-.pword 0x7B1F04,  0x879BE9,  0x6DE699,  0x180718,  0x99E66D,  0xE99B87
-.pword 0x071F7A,  0xF3151A,  0x85849C,  0x124E97,  0x110504,  0x8490DC
-.pword 0xDC9084,  0x040511,  0x974E12,  0x9C8485,  0x1A15F3,  0x7A1F07
-.pword 0x879BE9,  0x62E199,  0x180718,  0x99E66D,  0xE99B87,  0x041F78
-.pword 0xF11505,  0x85849D,  0x124397,  0x110404,  0x8490D1,  0xDB9384
-.pword 0x040516,  0x94751D,  0x9C8485,  0x1A6AFD,  0x651E07,  0x879BEE
-.pword 0x63E099,  0x180718,  0x9EE76C,  0xE89A87,  0x041F79,  0xF71505
-.pword 0x85849D,  0x134197,  0x110404,  0x8490D4,  0xC59384,  0x040516
-.pword 0x94741D,  0x9C8485,  0x1A6BFF,  0x641E07,  0x879BEF,  0x60E099
-.pword 0x1B0719,  0x9EE46F,  0xEB9A87,  0x041C7F,  0xF41405,  0x85849D
-.pword 0x135A96,  0x100404,  0x859157,  0xC09384,  0x040517,  0x95761D
-.pword 0x9F8485,  0x1A68F9,  0x671E07,  0x8798EC,  0x60E398,  0x1B0719
-.pword 0x9EE56E,  0xEA9A87,  0x041C7D,  0xCB1405,  0x858492,  0x135E96
-.pword 0x100404,  0x859153,  0xCD9284,  0x040517,  0x95701C,  0x9F8485
-.pword 0x1B69FB,  0x661907,  0x8798ED,  0x61E298,  0x1B0719,  0x9FFA69
-.pword 0x959A84,  0x041C73,  0xCF1705,  0x858492,  0x105D91,  0x100404
-.pword 0x85965C,  0xC99284,  0x040514,  0xEA731C,  0x9F849A,  0x1B6EFA
-.pword 0x611907,  0x8798E2,  0x66ED98,  0x1B041E,  0x9FF869,  0x959A84
-.pword 0x041D71,  0xC31705,  0x858492,  0x105191,  0x130404,  0x859658
-.pword 0xF59284,  0x040514,  0xEB7C1C,  0x9E849A,  0x1B6FE4,  0x601907
-.pword 0x8799E3,  0x64EC9B,  0x1A071E,  0x9FFE6B,  0x948584,  0x041D77
-.pword 0xC71605,  0x848493,  0x105591,  0x130404,  0x859644,  0xF49D84
-.pword 0x040514,  0xEB7F1F,  0x9E879A,  0x1B6CE4,  0x631807,  0x8799E0
-.pword 0x64EF9B,  0x1A071E,  0x9CFC6B,  0x948584,  0x041D75,  0xDA1605
-.pword 0x848493,  0x11D790,  0x120405,  0x859740,  0xF69D84,  0x040515
-.pword 0xE8791F,  0x9E879A,  0x186DE7,  0x621807,  0x8799E1,  0x65EE9B
-.pword 0x1A071E,  0x9CF26A,  0x948584,  0x041248,  0xDE1605,  0x848493
-.pword 0x11D390,  0x120405,  0x85974C,  0xF09C84,  0x040515,  0xE9781F
-.pword 0x99879B,  0x186DE6,  0x621807,  0x8799E6,  0x7BE99B,  0x1A041F
-.pword 0x9CF015,  0x978584,  0x04124C,  0xDD1105,  0x848490,  0x16DC90
-.pword 0x120405,  0x85944E,  0xF29C84,  0x041A6A,  0xEE651F,  0x99879B
-.pword 0x1862E1,  0x6D1807,  0x879EE7,  0x79E89A,  0x05041F,  0x9DF615
-.pword 0x978584,  0x041243,  0xD11104,  0x848490,  0x16DB93,  0x1D0405
-.pword 0x859475,  0xFC9C84,  0x071A6A,  0xEF641E,  0x99879B,  0x1863E0
-.pword 0x6C1B07,  0x879EE7,  0x7EE89A,  0x05041F,  0x9DF615,  0x978584
-.pword 0x041346,  0xD41104,  0x848490,  0x16C593,  0x1D0405,  0x859474
-.pword 0xFF9C84,  0x041A6B,  0xEF641E,  0x99879B,  0x1960E3,  0x6F1B07
-.pword 0x879EE4,  0x7CEB9A,  0x05041C,  0x9DF514,  0x968584,  0x04135B
-.pword 0x561004,  0x848591,  0x17C092,  0x1D0405,  0x859576,  0xF99F84
-.pword 0x071B68,  0xED671E,  0x988798,  0x1961E2,  0x6E1B07,  0x849FE5
-.pword 0x72EA9A,  0x05041C,  0x92C814,  0x968584,  0x04135F,  0x521004
-.pword 0x848591,  0x17CC92,  0x1C0405,  0x859570,  0xFB9F84,  0x071B69
-.pword 0xED6619,  0x988798,  0x1966E2,  0x691B07,  0x849FFA,  0x73959A
-.pword 0x05041C,  0x92CF17,  0x918584,  0x041052,  0x5F1304,  0x848596
-.pword 0x14C992,  0x1C0405,  0x9AEA72,  0xE59E87,  0x071B6E,  0xE26119
-.pword 0x988798,  0x1E67EC,  0x681A07,  0x879FF9,  0x719585,  0x05041D
-.pword 0x92C317,  0x918484,  0x041051,  0x581304,  0x848596,  0x14F59D
-.pword 0x1C0405,  0x9AEB7C,  0xE49E87,  0x071B6F,  0xE36019,  0x9B8798
-.pword 0x1E67EC,  0x681A07,  0x849FFE,  0x779485,  0x05041D,  0x93C716
-.pword 0x918484,  0x041155,  0x441304,  0x848596,  0x14F49D,  0x1F0405
-.pword 0x9AEB7F,  0xE49E87,  0x071B6F,  0xE06319,  0x9B8799,  0x1E64EF
-.pword 0x6B1A04,  0x849CFC,  0x759485,  0x050412,  0x93DB16,  0x908484
-.pword 0x0511D1,  0x401204,  0x848597,  0x15F69D,  0x1F0405,  0x9AE879
-.pword 0xE79E87,  0x07186D,  0xE16218,  0x9B8799,  0x1F65EE,  0x6A1A04
-.pword 0x849CF2,  0x489485,  0x050412,  0x93DE16,  0x908484,  0x0511D2
-.pword 0x4C1204,  0x848597,  0x15F09C,  0x1F041A,  0x9BE97B,  0xE69987
-.pword 0x071862,  0xE66D18,  0x9B8799,  0x1F7BE9,  0x151A04,  0x849CF0
-.pword 0x4D9785,  0x050412,  0x90D311,  0x938484,  0x0516DE,  0x481204
-.pword 0x848594,  0x6AF29C,  0x1E071A,  0x9BEE65,  0xE19987,  0x071862
-.pword 0xE76C18,  0x9A879E,  0x1F79E8,  0x150504,  0x849DF6,  0x409785
-.pword 0x040412,  0x90D611,  0x938484,  0x0516DB,  0x751D04,  0x848594
-.pword 0x6BFC9C,  0x1E041A,  0x9BEF64,  0xE09987,  0x071963,  0xE46C1B
-.pword 0x9A879E,  0x1C7FEB,  0x140504,  0x849DF4,  0x449685,  0x040413
-.pword 0x915511,  0x938484,  0x0517C6,  0x771D04,  0x848595,  0x68FE9F
-.pword 0x1E071A,  0x98EC67,  0xE39887,  0x071960,  0xE56F1B,  0x9A849E
-.pword 0x1C7DEA,  0x140504,  0x8492CA,  0x589685,  0x040413,  0x915010
-.pword 0x928485,  0x0517C2,  0x711D04,  0x848595,  0x69F89F,  0x1E071B
-.pword 0x98ED66,  0xE29887,  0x071961,  0xFA6E1B,  0x9A849F,  0x1C7395
-.pword 0x140504,  0x8492CE,  0x5C9685,  0x040410,  0x915D10,  0x928485
-.pword 0x0514CF,  0x731C04,  0x849A95,  0x6EFA9F,  0x19041B,  0x98E261
-.pword 0xED9887,  0x041E66,  0xF8691B,  0x85849F,  0x1D7195,  0x170504
-.pword 0x8492C2,  0x509185,  0x040410,  0x965913,  0x928485,  0x0514CB
-.pword 0x7D1C04,  0x879AEA,  0x6EE59E,  0x19071B,  0x98E361,  0xEC9887
-.pword 0x071E67,  0xF9681A,  0x85849F,  0x1D7695,  0x170504,  0x8493C1
-.pword 0x579184,  0x040410,  0x965A13,  0x9D8485,  0x0514F4,  0x7F1C04
-.pword 0x879AEB,  0x6FE49E,  0x19071B,  0x99E060,  0xEF9B87,  0x071E64
-.pword 0xFF6B1A,  0x85849C,  0x1D7494,  0x160504,  0x8493C5,  0xD49084
-.pword 0x040411,  0x974613,  0x9D8485,  0x0515F7,  0x7E1F04,  0x879AE8
-.pword 0x6CE79E,  0x180718,  0x99E063,  0xEE9B87,  0x041E65,  0xFD6A1A
-.pword 0x85849C,  0x124B94,  0x160504,  0x8493D9,  0xD09084,  0x040511
-.pword 0x974212,  0x9D8485,  0x0515F1,  0x781F04,  0x879BE9,  0x6DE699
-.pword 0x180718,  0x99E162,  0xEE9B87,  0x041F7A,  0xF36A1A,  0x85849C
-.pword 0x124E97,  0x160504,  0x8490DC,  0xDD9084,  0x040511,  0x974F12
-.pword 0x9C8485,  0x1A6AF3,  0x7A1F04,  0x879BEE,  0x62E199,  0x180718
-.pword 0x9EE66D,  0xE99B87,  0x041F78,  0xF11505,  0x85849D,  0x124297
-.pword 0x110504,  0x8490D0,  0xD89384,  0x040516,  0x944A12,  0x9C8485
-.pword 0x1A6AFD,  0x651E07,  0x879BEE,  0x63E099,  0x180718,  0x9EE76C
-.pword 0xE89A87,  0x041F79,  0xF61505,  0x85849D,  0x134097,  0x110504
-.pword 0x8490D7,  0xDA9384,  0x040516,  0x94751D,  0x9C8485,  0x1A6BFF
-.pword 0x641E07,  0x879BEF,  0x60E099,  0x1B0719,  0x9EE46F,  0xEB9A87
-.pword 0x041C7F,  0xF41405,  0x85849D,  0x134596,  0x100404,  0x849154
-.pword 0xC69384,  0x040517,  0x95771D,  0x9F8485,  0x1A68FE,  0x671E07
-.pword 0x879BEC,  0x60E398,  0x1B0719,  0x9EE56F,  0xEA9A84,  0x041C7D
-.pword 0xCB1405,  0x858492,  0x135996,  0x100404,  0x859150,  0xCD9284
-.pword 0x040517,  0x95711D,  0x9F8485,  0x1B69F8,  0x661907,  0x8798ED
-.pword 0x61E298,  0x1B0719,  0x9FFA6E,  0x959A84,  0x041C73,  0xCF1705
-.pword 0x858492,  0x105D91,  0x100404,  0x85915C,  0xCE9284,  0x040517
-.pword 0x95731C,  0x9F849A,  0x1B6EFA,  0x611907,  0x8798E2,  0x66ED98
-.pword 0x1B0719,  0x9FF869,  0x958584,  0x041D71,  0xC21705,  0x858492
-.pword 0x105091,  0x130404,  0x859659,  0xCB9284,  0x040514,  0xEA7D1C
-.pword 0x9E849A,  0x1B6FE5,  0x601907,  0x8798E3,  0x67EC98,  0x1A071E
-.pword 0x9FFE68,  0x958584,  0x041D77,  0xC61705,  0x848493,  0x105491
-.pword 0x130404,  0x859645,  0xF49D84,  0x040514,  0xEB7F1C,  0x9E879A
-.pword 0x1B6FE4,  0x631907,  0x8799E0,  0x64EF9B,  0x1A071E,  0x9CFC6B
-.pword 0x948584,  0x041D75,  0xC51605,  0x848493,  0x11D490,  0x130404
-.pword 0x859741,  0xF69D84,  0x040515,  0xE8791F,  0x9E879A,  0x1B6CE7
-.pword 0x631807,  0x8799E0,  0x65EE9B,  0x1A071E,  0x9CFD6A,  0x948584
-.pword 0x04124B,  0xD91605,  0x848493,  0x11D090,  0x120405,  0x85974D
-.pword 0xF09D84,  0x041A15,  0xE97B1F,  0x99879B,  0x186DE6,  0x621807
-.pword 0x8799E6,  0x7AE99B,  0x1A041F,  0x9CF315,  0x978584,  0x04124F
-.pword 0xD21105,  0x848490,  0x16DF90,  0x120405,  0x859449,  0xF29C84
-.pword 0x041A6A,  0xEE7A1F,  0x99879B,  0x1862E1,  0x6D1807,  0x879EE6
-.pword 0x78E99B,  0x05041F,  0x9DF115,  0x978584,  0x041243,  0xD11105
-.pword 0x848490,  0x16D893,  0x1D0405,  0x85944A,  0xFC9C84,  0x041A6B
-.pword 0xEF641E,  0x99879B,  0x1963E0,  0x6C1B07,  0x879EE4,  0x7EE89A
-.pword 0x05041F,  0x9DF715,  0x978584,  0x041347,  0xD51104,  0x848491
-.pword 0x17C793,  0x1D0405,  0x859477,  0xFE9F84,  0x071A68,  0xEC671E
-.pword 0x98879B,  0x1960E3,  0x6F1B07,  0x879EE4,  0x7CEB9A,  0x05041C
-.pword 0x9DF514,  0x968584,  0x04135B,  0x561004,  0x848591,  0x17C092
-.pword 0x1D0405,  0x859571,  0xF89F84,  0x071A68,  0xED661E,  0x988798
-.pword 0x1961E2,  0x6E1B07,  0x849EE5,  0x72EA9A,  0x05041C,  0x92C814
-.pword 0x968584,  0x04135E,  0x531004,  0x848591,  0x17CD92,  0x1C0405
-.pword 0x859570,  0xFB9F84,  0x071B69,  0xED6619,  0x988798,  0x1966E2
-.pword 0x691B07,  0x849FFB,  0x70959A,  0x05041C,  0x92CC17,  0x918584
-.pword 0x041052,  0x5E1004,  0x848596,  0x14C892,  0x1C0405,  0x9AEA72
-.pword 0xE59F84,  0x071B6E,  0xE26119,  0x988798,  0x1E67ED,  0x681B07
-.pword 0x849FF9,  0x769585,  0x05041D,  0x92C017,  0x918484,  0x041056
-.pword 0x5B1304,  0x848596,  0x14F59D,  0x1C0405,  0x9AEB7C,  0xE49E84
-.pword 0x071B6F,  0xE36019,  0x9B8799,  0x1E64EF,  0x6B1A07,  0x849FFF
-.pword 0x779485,  0x05041D,  0x93C716,  0x918484,  0x041155,  0x441304
-.pword 0x848596,  0x14F49D,  0x1F0405,  0x9AE87E,  0xE79E87,  0x071B6C
-.pword 0xE06318,  0x9B8799,  0x1E64EF,  0x6B1A07,  0x849CFC,  0x759485
-.pword 0x05041D,  0x93DA16,  0x908484,  0x0411D7,  0x411204,  0x848597
-.pword 0x15F69D,  0x1F0405,  0x9AE879,  0xE79E84,  0x07186C,  0xE16218
-.pword 0x9B8799,  0x1F65EE,  0x6A1A04,  0x849CF2,  0x499485,  0x050412
-.pword 0x90DF16,  0x908484,  0x0511D2,  0x4C1204,  0x848597,  0x15F09C
-.pword 0x1F041A,  0x9BE97B,  0xE69987,  0x071862,  0xE66D18,  0x9B8799
-.pword 0x1F7BE9,  0x151A04,  0x849CF0,  0x4C9785,  0x050412,  0x90D211
-.pword 0x908484,  0x0516DF,  0x491204,  0x848594,  0x6AF29C,  0x1F041A
-.pword 0x9BEE65,  0xE19987,  0x071862,  0xE76C18,  0x9A879E,  0x1F79E8
-.pword 0x150504,  0x849DF6,  0x409785,  0x050412,  0x90D611,  0x938484
-.pword 0x0516DA,  0x751D04,  0x848594,  0x6BFC9C,  0x1E041A,  0x9BEF64
-.pword 0xE09987,  0x071963,  0xE46C1B,  0x9A879E,  0x1F7FEB,  0x140504
-.pword 0x849DF4,  0x449685,  0x040413,  0x915411,  0x938484,  0x0517C6
-.pword 0x771D04,  0x848595,  0x68FE9F,  0x1E071A,  0x9BEC67,  0xE39887
-.pword 0x071960,  0xE46F1B,  0x9A879E,  0x1C7CEB,  0x140504,  0x849DF5
-.pword 0x5B9685,  0x040413,  0x915610,  0x928484,  0x0517C0,  0x761D04
-.pword 0x848595,  0x68F99F,  0x1E071A,  0x98EC67,  0xE29887,  0x071961
-.pword 0xE56E1B,  0x9A849F,  0x1C72EA,  0x140504,  0x8492CE,  0x5C9685
-.pword 0x040410,  0x965C10,  0x928485,  0x0517CE,  0x731C04,  0x849A95
-.pword 0x6EFA9F,  0x19071B,  0x98E261,  0xED9887,  0x071966,  0xFB691B
-.pword 0x85849F,  0x1C7095,  0x170504,  0x8492CC,  0x539185,  0x040410
-.pword 0x965E13,  0x928485,  0x0514CB,  0x7D1C04,  0x879AEA,  0x6EE59E
-.pword 0x19071B,  0x98E261,  0xEC9887,  0x071E67,  0xF9681A,  0x85849F
-.pword 0x1D7695,  0x170504,  0x8492C0,  0x579184,  0x040410,  0x965A13
-.pword 0x9D8485,  0x0514F5,  0x7C1C04,  0x879AEB,  0x6FE49E,  0x19071B
-.pword 0x99E360,  0xEC9B87,  0x041E64,  0xFF6B1A,  0x85849C,  0x1D7494
-.pword 0x160504,  0x8493C4,  0xD59184,  0x040411,  0x974713,  0x9D8485
-.pword 0x0515F7,  0x7E1F04,  0x879AE8,  0x6CE79E,  0x180718,  0x99E063
-.pword 0xEF9B87,  0x041E65,  0xFD6B1A,  0x85849C,  0x124A94,  0x160504
-.pword 0x8493D8,  0xD19084,  0x040511,  0x974312,  0x9D8485,  0x0515F1
-.pword 0x781F04,  0x879BE9,  0x6DE69E,  0x180718,  0x99E162,  0xEE9B87
-.pword 0x041F7A,  0xF36A1A,  0x85849C,  0x124E94,  0x160504,  0x8490DC
-.pword 0xDD9084,  0x040516,  0x974F12,  0x9C8485,  0x1A15F3,  0x7A1F04
-.pword 0x879BEE,  0x62E199,  0x180718,  0x99E66D,  0xE99B87,  0x041F78
-.pword 0xF11505,  0x85849D,  0x124297,  0x110504,  0x8490D0,  0xD99384
-.pword 0x040516,  0x944B12,  0x9C8485,  0x1A6AFD,  0x651E04,  0x879BEE
-.pword 0x63E099,  0x180718,  0x9EE76C,  0xE89A87,  0x041F7E,  0xF61505
-.pword 0x85849D,  0x134197,  0x110504,  0x8490D4,  0xC59384,  0x040516
-.pword 0x94741D,  0x9F8485,  0x1A6BFF,  0x641E07,  0x879BEF,  0x63E098
-.pword 0x1B0718,  0x9EE46F,  0xEB9A87,  0x041F7F,  0xF41405,  0x85849D
-.pword 0x134496,  0x100404,  0x849154,  0xC69384,  0x040517,  0x95771D
-.pword 0x9F8485,  0x1A68FE,  0x671E07,  0x8798EC,  0x60E398,  0x1B0719
-.pword 0x9EE56F,  0xEA9A84,  0x041C7D,  0xCA1405,  0x858492,  0x135996
-.pword 0x100404,  0x859150,  0xC29284,  0x040517,  0x95711D,  0x9F8485
-.pword 0x1B69F8,  0x661907,  0x8798ED,  0x61E298,  0x1B0719,  0x9FFA6E
-.pword 0x959A84,  0x041C73,  0xCE1705,  0x858492,  0x105C96,  0x100404
-.pword 0x85965D,  0xCF9284,  0x040517,  0x95731C,  0x9F849A,  0x1B6EFA
-.pword 0x611907,  0x8798E2,  0x66ED98,  0x1B0719,  0x9FF869,  0x958584
-.pword 0x041D71,  0xC21705,  0x858492,  0x105091,  0x130404,  0x859658
-.pword 0xCA9284,  0x040514,  0xEA7D1C,  0x9E849A,  0x1B6FE5,  0x601907
-.pword 0x8798E3,  0x67EC98,  0x1A071E,  0x9FFE68,  0x958584,  0x041D76
-.pword 0xC61705,  0x848493,  0x105491,  0x130404,  0x859645,  0xF49D84
-.pword 0x040514,  0xEB7F1C,  0x9E879A,  0x1B6FE4,  0x631907,  0x8799E0
-.pword 0x64EF9B,  0x1A041E,  0x9CFF6B,  0x948584,  0x041D74,  0xDA1605
-.pword 0x848493,  0x11D790,  0x130404,  0x859741,  0xF69D84,  0x040515
-.pword 0xE87E1F,  0x9E879A,  0x186CE7,  0x631807,  0x8799E1,  0x65EE9B
-.pword 0x1A041E,  0x9CFD6A,  0x948584,  0x041248,  0xDE1605,  0x848493
-.pword 0x11D390,  0x120405,  0x85974D,  0xF09D84,  0x041A15,  0xE97B1F
-.pword 0x99879B,  0x186DE6,  0x621807,  0x8799E6,  0x7AE99B,  0x1A041F
-.pword 0x9CF315,  0x978584,  0x04124F,  0xDD1105,  0x848490,  0x16DC90
-.pword 0x120405,  0x859449,  0xF29C84,  0x041A6A,  0xEE7A1F,  0x99879B
-.pword 0x1862E1,  0x6D1807,  0x879EE6,  0x78E99B,  0x1A041F,  0x9DF115
-.pword 0x978584,  0x041243,  0xD11105,  0x848490,  0x16D893,  0x1D0405
-.pword 0x85944A,  0xFD9C84,  0x071A6A,  0xEF651E,  0x99879B,  0x1863E0
-.pword 0x6C1B07,  0x879EE7,  0x7EE89A,  0x05041F,  0x9DF715,  0x978584
-.pword 0x041346,  0xD51104,  0x848491,  0x16C493,  0x1D0405,  0x859474
-.pword 0xFF9F84,  0x071A6B,  0xEC641E,  0x99879B,  0x1960E3,  0x6F1B07
-.pword 0x879EE4,  0x7CEB9A,  0x05041C,  0x9DF514,  0x968584,  0x04135B
-.pword 0x561004,  0x848591,  0x17C092,  0x1D0405,  0x859576,  0xF99F84
-.pword 0x071A68,  0xEC671E,  0x988798,  0x1961E2,  0x6E1B07,  0x849EE5
-.pword 0x72EA9A,  0x05041C,  0x92C814,  0x968584,  0x04135E,  0x531004
-.pword 0x848591,  0x17CD92,  0x1C0405,  0x859570,  0xFB9F84,  0x071B69
-.pword 0xED6619,  0x988798,  0x1966E2,  0x691B07,  0x849FFA,  0x73959A
-.pword 0x05041C,  0x92CF17,  0x918584,  0x04105D,  0x5C1004,  0x848596
-.pword 0x14CE92,  0x1C0405,  0x9AEA72,  0xE59F84,  0x071B6E,  0xE26119
-.pword 0x988798,  0x1E66ED,  0x691B07,  0x849FF8,  0x719585,  0x05041D
-.pword 0x92C317,  0x918584,  0x041051,  0x5B1304,  0x848596,  0x14F59D
-.pword 0x1C0405,  0x9AEB7C,  0xE49E87,  0x071B6F,  0xE36019,  0x9B8798
-.pword 0x1E67EC,  0x681A07,  0x849FFE,  0x779585,  0x05041D,  0x93C717
-.pword 0x918484,  0x041155,  0x441304,  0x848596,  0x14F49D,  0x1C0405
-.pword 0x9AEB7F,  0xE49E87,  0x071B6F,  0xE06319,  0x9B8799,  0x1E64EF
-.pword 0x6B1A07,  0x849CFC,  0x759485,  0x05041D,  0x93DA16,  0x908484
-.pword 0x0411D6,  0x401204,  0x848597,  0x15F19D,  0x1F0405,  0x9AE879
-.pword 0xE79E87,  0x07186C,  0xE16218,  0x9B8799,  0x1F65EE,  0x6A1A04
-.pword 0x849CF2,  0x499485,  0x050412,  0x93DF16,  0x908484,  0x0511D3
-.pword 0x4D1204,  0x848597,  0x15F09C,  0x1F041A,  0x9BE97B,  0xE69987
-.pword 0x07186D,  0xE66D18,  0x9B8799,  0x1F7BE9,  0x151A04,  0x849CF0
-.pword 0x4C9785,  0x050412,  0x90D211,  0x908484,  0x0516DF,  0x481204
-.pword 0x848594,  0x6AF29C,  0x1E071A,  0x9BEE65,  0xE19987,  0x071862
-.pword 0xE76C18,  0x9A879E,  0x1F78E8,  0x150504,  0x849DF1,  0x439785
-.pword 0x040412,  0x90D611,  0x938484,  0x0516DB,  0x751D04,  0x848594
-.pword 0x6BFC9C,  0x1E071A,  0x9BEF65,  0xE09987,  0x071863,  0xE76C1B
-.pword 0x9A849E,  0x1F7EE8,  0x140504,  0x849DF7,  0x449785,  0x040413
-.pword 0x915511,  0x938484,  0x0517C7,  0x771D04,  0x848594,  0x6BFF9F
-.pword 0x1E071A,  0x9BEC64,  0xE39987,  0x071960,  0xE46F1B,  0x9A849E
-.pword 0x1C7CEB,  0x140504,  0x849DF5,  0x589685,  0x040413,  0x915110
-.pword 0x928485,  0x0517C3,  0x711D04,  0x848595,  0x68F89F,  0x1E071A
-.pword 0x98ED66,  0xE29887,  0x071961,  0xE56E1B,  0x9A849F,  0x1C72EA
-.pword 0x140504,  0x8492C9,  0x5F9685,  0x040410,  0x915210,  0x928485
-.pword 0x0517CC,  0x701C04,  0x849A95,  0x69FB9F,  0x19071B,  0x98E266
-.pword 0xED9887,  0x071966,  0xFB691B,  0x85849F,  0x1C7095,  0x170504
-.pword 0x8492CD,  0x539185,  0x040410,  0x965F13,  0x928485,  0x0514C9
-.pword 0x721C04,  0x849AEA,  0x6EE59F,  0x19071B,  0x98E261,  0xEC9887
-.pword 0x071E67,  0xF9681A,  0x85849F,  0x1D7695,  0x170504,  0x8492C0
-.pword 0x569184,  0x040410,  0x965B13,  0x9D8485,  0x0514F5,  0x7C1C04
-.pword 0x879AEB,  0x6FE49E,  0x19071B,  0x98E360,  0xEC9B87,  0x041E67
-.pword 0xFF681A,  0x85849C,  0x1D7494,  0x160504,  0x8493C5,  0xD49084
-.pword 0x040411,  0x974613,  0x9D8485,  0x0515F7,  0x7E1F04,  0x879AE8
-.pword 0x6CE79E,  0x180718,  0x99E063,  0xEE9B87,  0x071E65,  0xFD6A1A
-.pword 0x85849C,  0x1D4A94,  0x160504,  0x8493D8,  0xD19084,  0x040411
-.pword 0x974312,  0x9D8485,  0x0515F1,  0x781F04,  0x879AE8,  0x6DE79E
-.pword 0x180718,  0x99E162,  0xEE9B87,  0x041F65,  0xF26A1A,  0x85849C
-.pword 0x124994,  0x160504,  0x8490DF,  0xDD9084,  0x040511,  0x974F12
-.pword 0x9C8485,  0x1A15F3,  0x7A1F04,  0x879BE9,  0x62E699,  0x180718
-.pword 0x99E66D,  0xE99B87,  0x041F7B,  0xF0151A,  0x85849C,  0x124C97
-.pword 0x110504,  0x8490D2,  0xDE9384,  0x040516,  0x944812,  0x9C8485
-.pword 0x1A6AFD,  0x651E04,  0x879BEE,  0x63E099,  0x180718,  0x9EE76C
-.pword 0xE89A87,  0x041F79,  0xF61505,  0x85849D,  0x134197,  0x110404
-.pword 0x8490D7,  0xC59384,  0x040516,  0x94741D,  0x9C8485,  0x1A6BFF
-.pword 0x641E07,  0x879BEF,  0x63E099,  0x1B0719,  0x9EE46F,  0xEB9A87
-.pword 0x041C7F,  0xF41405,  0x85849D,  0x134596,  0x100404,  0x849157
-.pword 0xC19384,  0x040517,  0x95761D,  0x9F8485,  0x1A68F9,  0x671E07
-.pword 0x879BEC,  0x60E398,  0x1B0719,  0x9EE46E,  0xEA9A87,  0x041C7C
-.pword 0xF51405,  0x85849D,  0x135B96,  0x100404,  0x849156,  0xC19284
-.pword 0x040517,  0x95761D,  0x9F8485,  0x1B68F8,  0x661E07,  0x8798ED
-.pword 0x61E298,  0x1B0719,  0x9EE56E,  0xEA9A87,  0x041C72,  0xC91405
-.pword 0x858492,  0x105F96,  0x100404,  0x85965D,  0xCF9284,  0x040517
-.pword 0xEA731C,  0x9F849A,  0x1B6EFA,  0x611907,  0x8798E2,  0x66ED98
-.pword 0x1B0719,  0x9FFB69,  0x958584,  0x041D71,  0xC21705,  0x858492
-.pword 0x105091,  0x130404,  0x859658,  0xCA9D84,  0x040514,  0xEA7D1C
-.pword 0x9E879A,  0x1B6EE5,  0x601907,  0x8798E3,  0x67EC98,  0x1A071E
-.pword 0x9FF968,  0x958584,  0x041D76,  0xC11705,  0x848493,  0x105491
-.pword 0x130404,  0x859645,  0xF49D84,  0x040514,  0xEB7F1C,  0x9E879A
-.pword 0x1B6FE4,  0x631907,  0x8799E0,  0x64EF9B,  0x1A071E,  0x9CFF6B
-.pword 0x948584,  0x041D74,  0xC51605,  0x848493,  0x11D490,  0x130404
-.pword 0x859746,  0xF69D84,  0x040515,  0xE8791F,  0x9E879A,  0x186CE7
-.pword 0x631807,  0x8799E0,  0x65EE9B,  0x1A071E,  0x9CFD6A,  0x948584
-.pword 0x04124B,  0xD91605,  0x848493,  0x11D090,  0x120405,  0x859742
-.pword 0xF19D84,  0x040515,  0xE9781F,  0x9E879B,  0x186DE6,  0x621807
-.pword 0x8799E1,  0x7AEE9B,  0x1A041F,  0x9CF315,  0x978584,  0x04124F
-.pword 0xDD1105,  0x848490,  0x16DC90,  0x120405,  0x859449,  0xF29C84
-.pword 0x041A6A,  0xEE651F,  0x99879B,  0x1862E1,  0x6D1807,  0x8799E6
-.pword 0x78E99A,  0x05041F,  0x9DF115,  0x978584,  0x041243,  0xD11105
-.pword 0x848490,  0x16D893,  0x1D0405,  0x859475,  0xFC9C84,  0x071A6A
-.pword 0xEF651E,  0x99879B,  0x1863E0,  0x6C1B07,  0x879EE7,  0x7EE89A
-.pword 0x05041F,  0x9DF715,  0x978584,  0x041346,  0xD41104,  0x848490
-.pword 0x16C593,  0x1D0405,  0x859474,  0xFF9C84,  0x041A6B,  0xEF641E
-.pword 0x99879B,  0x1960E3,  0x6F1B07,  0x879EE4,  0x7CEB9A,  0x05041C
-.pword 0x9DF514,  0x968584,  0x04135A,  0x571004,  0x848491,  0x17C193
-.pword 0x1D0405,  0x859576,  0xF99F84,  0x071A68,  0xEC671E,  0x988798
-.pword 0x1961E3,  0x6E1B07,  0x849EE5,  0x7DEA9A,  0x05041C,  0x92CB14
-.pword 0x968584,  0x04135E,  0x531004,  0x848591,  0x17CD92,  0x1D0405
-.pword 0x9A9570,  0xFB9F84,  0x071B69,  0xED6619,  0x988798,  0x1966ED
-.pword 0x691B07,  0x849FFB,  0x73959A,  0x05041C,  0x92CF17,  0x918584
-.pword 0x04105D,  0x5C1004,  0x848596,  0x14C992,  0x1C0405,  0x9AEA72
-.pword 0xE59F84,  0x071B6E,  0xE26119,  0x988798,  0x1E66ED,  0x681A07
-.pword 0x849FF8,  0x719585,  0x05041D,  0x92C217,  0x918584,  0x041051
-.pword 0x581304,  0x848596,  0x14F59D,  0x1C0405,  0x9AEB7C,  0xE49E87
-.pword 0x071B6F,  0xE36019,  0x9B8798,  0x1E67EC,  0x681A07,  0x849FFE
-.pword 0x779585,  0x05041D,  0x93C617,  0x918484,  0x041055,  0x441304
-.pword 0x848596,  0x14F49D,  0x1F0405,  0x9AEB7F,  0xE49E87,  0x071B6F
-.pword 0xE06319,  0x9B8799,  0x1E64EF,  0x6B1A04,  0x849CFC,  0x759485
-.pword 0x05041D,  0x93DB16,  0x908484,  0x0411D6,  0x411204,  0x848597
-.pword 0x15F69D,  0x1F0405,  0x9AE879,  0xE79E87,  0x07186C,  0xE16218
-.pword 0x9B8799,  0x1E65EE,  0x6A1A07,  0x849CFD,  0x4B9485,  0x050412
-.pword 0x93D916,  0x908484,  0x0511D3,  0x421204,  0x848597,  0x15F09D
-.pword 0x1F041A,  0x9BE97B,  0xE69987,  0x07186D,  0xE66218,  0x9B8799
-.pword 0x1F7BE9,  0x151A04,  0x849CF0,  0x4C9785,  0x050412,  0x90D211
-.pword 0x908484,  0x0516DF,  0x491204,  0x848594,  0x6AF29C,  0x1F041A
-.pword 0x9BEE65,  0xE19987,  0x071862,  0xE66D18,  0x9B879E,  0x1F78E9
-.pword 0x150504,  0x849DF1,  0x439785,  0x050412,  0x90D111,  0x938484
-.pword 0x0516DB,  0x751D04,  0x848594,  0x6BFC9C,  0x1E041A,  0x9BEF64
-.pword 0xE09987,  0x071963,  0xE46C1B,  0x9A879E,  0x1F7FEB,  0x140504
-.pword 0x849DF4,  0x449685,  0x040413,  0x915510,  0x938484,  0x0516C7
-.pword 0x771D04,  0x848594,  0x6BFE9F,  0x1E071A,  0x9BEF64,  0xE39887
-.pword 0x071960,  0xE46F1B,  0x9A879E,  0x1C7CEB,  0x140504,  0x849DF5
-.pword 0x5B9685,  0x040413,  0x915610,  0x928484,  0x0517C0,  0x761D04
-.pword 0x848595,  0x68F99F,  0x1E071A,  0x98EC67,  0xE29887,  0x071961
-.pword 0xE56E1B,  0x9A879E,  0x1C72EA,  0x140504,  0x8492CB,  0x599685
-.pword 0x040413,  0x915310,  0x928485,  0x0517CD,  0x701C04,  0x849A95
-.pword 0x69FB9F,  0x19071B,  0x98ED66,  0xED9887,  0x071966,  0xFB691B
-.pword 0x9A849F,  0x1C7095,  0x170504,  0x8492CC,  0x529185,  0x040410
-.pword 0x965E13,  0x928485,  0x0514C8,  0x721C04,  0x879AEA,  0x6EE59E
-.pword 0x19071B,  0x98E261,  0xED9887,  0x071966,  0xF8681A,  0x85849F
-.pword 0x1D7195,  0x170504,  0x8492C0,  0x569184,  0x040410,  0x965B13
-.pword 0x9D8485,  0x0514F5,  0x7C1C04,  0x849AEB,  0x6FE49E,  0x19071B
-.pword 0x98E360,  0xEC9B87,  0x071E64,  0xFE6B1A,  0x85849F,  0x1D7794
-.pword 0x170504,  0x8493C7,  0xD59184,  0x040411,  0x974713,  0x9D8485
-.pword 0x0514F7,  0x7E1F04,  0x879AE8,  0x6CE79E,  0x18071B,  0x99E063
-.pword 0xEF9B87,  0x071E64,  0xFC6B1A,  0x85849C,  0x1D7594,  0x160504
-.pword 0x8493DB,  0xD69084,  0x040411,  0x974012,  0x9D8485,  0x0515F6
-.pword 0x791F04,  0x879AE8,  0x6DE79E,  0x180718,  0x99E162,  0xEE9B87
-.pword 0x041F65,  0xF26A1A,  0x85849C,  0x124994,  0x160504,  0x8490DF
-.pword 0xD29084,  0x040511,  0x974F12,  0x9C8485,  0x1A15F3,  0x7A1F04
-.pword 0x879BE9,  0x62E699,  0x180718,  0x99E66D,  0xE99B87,  0x041F7B
-.pword 0xF01505,  0x85849C,  0x124C97,  0x110504,  0x8490D3,  0xDE9384
-.pword 0x040516,  0x944812,  0x9C8485,  0x1A6AF2,  0x651E04,  0x879BEE
-.pword 0x62E199,  0x180718,  0x9EE76C,  0xE89A87,  0x041F79,  0xF61505
-.pword 0x85849D,  0x134097,  0x110504,  0x8490D7,  0xDA9384,  0x040516
-.pword 0x94751D,  0x9C8485,  0x1A6BFC,  0x641E04,  0x879BEF,  0x63E099
-.pword 0x1B0719,  0x9EE46F,  0xEB9A87,  0x041C7F,  0xF41405,  0x85849D
-.pword 0x134596,  0x100404,  0x849154,  0xC69384,  0x040517,  0x95771D
-.pword 0x9F8485,  0x1A68F9,  0x671E07,  0x879BEC,  0x60E398,  0x1B0719
-.pword 0x9EE56F,  0xEA9A84,  0x041C7D,  0xCA1405,  0x858492,  0x135996
-.pword 0x100404,  0x859150,  0xCD9284,  0x040517,  0x95711D,  0x9F8485
-.pword 0x1A69F8,  0x661907,  0x8798ED,  0x61E298,  0x1B0719,  0x9FFA6E
-.pword 0x959A87,  0x041C73,  0xCE1705,  0x858492,  0x105C96,  0x100404
-.pword 0x85915D,  0xCF9284,  0x040517,  0x95731C,  0x9F849A,  0x1B69FA
-.pword 0x611907,  0x8798E2,  0x66ED98,  0x1B0719,  0x9FFB69,  0x958584
-.pword 0x041C70,  0xCD1705,  0x858492,  0x105391,  0x130404,  0x85965E
-.pword 0xC89284,  0x040514,  0xEA721C,  0x9E849A,  0x1B6EE5,  0x611907
-.pword 0x8798E2,  0x67EC98,  0x1A041E,  0x9FF968,  0x958584,  0x041D76
-.pword 0xC11705,  0x848493,  0x105491,  0x130404,  0x859645,  0xF49D84
-.pword 0x040514,  0xEB7F1C,  0x9E879A,  0x1B6FE4,  0x601907,  0x8799E3
-.pword 0x64EF9B,  0x1A071E,  0x9CFF6B,  0x948584,  0x041D74,  0xC51605
-.pword 0x848493,  0x11D490,  0x130404,  0x859746,  0xF69D84,  0x040515
-.pword 0xE8791F,  0x9E879A,  0x186CE7,  0x621907,  0x8799E0,  0x65EE9B
-.pword 0x1A041E,  0xE56F1B,  0x9A849E,  0x1C7DEA,  0x140504,  0x8492CA
-.pword 0x599685,  0x040413,  0x915010,  0x928485,  0x0517CD,  0x711D04
-.pword 0x848595,  0x69F89F,  0x19071A,  0x98ED66,  0xE29887,  0x071961
-.pword 0xFA6E1B,  0x9A879F,  0x1C7395,  0x170504,  0x8492CE,  0x5C9685
-.pword 0x040410,  0x915D10,  0x928485,  0x0517CF,  0x731C04,  0x849A95
-.pword 0x69FA9F,  0x19071B,  0x98E261,  0xED9887,  0x071966,  0xFB691B
-.pword 0x85849F,  0x1C7095,  0x170504,  0x8492CD,  0x539185,  0x040410
-.pword 0x965E13,  0x928485,  0x0514C8,  0x721C04,  0x849AEA,  0x6EE59E
-.pword 0x19071B,  0x98E261,  0xEC9887,  0x041E67,  0xF9681A,  0x85849F
-.pword 0x007695        
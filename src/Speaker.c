@@ -40,28 +40,155 @@
  ************************************************************************/
 #include "Speaker.h"
 #include "Timer4Code.h"
+#include "Scheduler.h"
+#include "Profile.h"
+#include "Timebase.h"
 
 /************************************************************************
  Variables													
  ************************************************************************/
-int	 							samplesFromPgmMem	[ PGM_MEM_FRAME_SIZE];
+int	 							samplesFromPgmMem	[ PGM_MEM_FRAME_SIZE];	/* Large enough for either codec					*/
 char 							inputSamples			[FRAME_SIZE];
-int								outputSamples1		[FRAME_SIZE] = {0};
-int 							outputSamples2		[FRAME_SIZE];
-int*							currentOutputBuffer;
-unsigned int 					segmentIndex=0;
-char 							bufferIndicator;
-unsigned int 					pgmMemIndex;
-unsigned long 					samplePtr;
-unsigned int					sampleLength;
-int 							flagBufferFull=0;
-unsigned int 					speakerBusyFlag = 0;
-static volatile unsigned int	currentPWMDutyCycle;		/* Stores the current duty cycle					*/
-static volatile int				pwmCycleCount;				/* Keeps track of PWM cycles per speech sample  	*/
-static volatile int				bufferIndex 	= 0;		/* Index into the external sample buffer			*/
-static volatile int 			totalSamples;				/* Total samples to play							*/
-volatile int * 					ptrDataBuffer;
-volatile int 					isPlayingCurrentBuffer;
+int								voiceSamples		[FRAME_SIZE];		/* Decoded frame of a single voice					*/
+long							mixSamples			[FRAME_SIZE];		/* Sum of all voices when more than one plays		*/
+SPEAKER_RING					speakerRing;								/* Frames of PWM duty values waiting for the DMA feed	*/
+static unsigned int				speakerAlawDuty		[256];				/* A-law code to PWM duty, built by speakerInit	*/
+static unsigned int				speakerToneDuty		[SPEAKER_TONE_TABLE_SIZE];	/* speakerSine as PWM duty, built by speakerInit	*/
+SPEAKER_VOICE					speakerVoices		[SPEAKER_MAX_VOICES];
+unsigned int					speakerFrameCycles;							/* Cycles spent filling the last frame				*/
+unsigned int					speakerFrameCyclesMax;						/* Worst frame fill seen							*/
+unsigned int					speakerVoiceCyclesMax;						/* Worst fill cost of a single voice				*/
+unsigned int					speakerCodecCycles	[SPEAKER_CODECS];		/* Cycles to decode the last frame of each codec	*/
+unsigned int					speakerCodecCyclesMax[SPEAKER_CODECS];		/* Worst frame decode of each codec					*/
+unsigned int					speakerUnderruns;							/* DMA buffers sent at 50% while a voice played		*/
+unsigned int					speakerFillLatencyMax;						/* Worst cycles from a frame leaving to a refill	*/
+unsigned int					speakerRingLevelMin = AUDIO_RING_DEPTH;		/* Fewest queued frames seen while playing			*/
+static DWORD					speakerRequestTime;							/* timebaseCycles() when the DMA feed last took a frame	*/
+static volatile unsigned int	speakerRefillPending;						/* A frame was taken since the last refill			*/
+volatile SPEAKER_STATE			speakerState = SPEAKER_IDLE;				/* Audio power state								*/
+unsigned long					speakerStateCycles	[SPEAKER_STATES];		/* Audio interrupt cycles spent in each state		*/
+static unsigned int				speakerParkPending;							/* Draining and one 50% buffer is already queued	*/
+volatile unsigned long			speakerSampleClock;							/* Index of the first sample of the next frame made	*/
+unsigned int					speakerLateStarts;							/* Scheduled voices that began after their sample	*/
+static SPEAKER_FRAME_HOOK		speakerFrameHook;							/* Called at the start of every frame fill			*/
+unsigned int					dmaDutyBufferA		[DMA_FRAME_SIZE] __attribute__((space(dma)));	/* Ping half of the OC1RS feed	*/
+unsigned int					dmaDutyBufferB		[DMA_FRAME_SIZE] __attribute__((space(dma)));	/* Pong half of the OC1RS feed	*/
+
+/* One cycle of a sine at SPEAKER_TONE_LEVEL, indexed by the top 8 bits of a tone phase	*/
+static const int				speakerSine			[SPEAKER_TONE_TABLE_SIZE] =
+{
+	     0,    402,    804,   1205,   1606,   2005,   2404,   2801,
+	  3196,   3590,   3981,   4370,   4756,   5139,   5519,   5896,
+	  6270,   6639,   7005,   7366,   7723,   8075,   8423,   8765,
+	  9102,   9433,   9759,  10079,  10393,  10701,  11002,  11297,
+	 11585,  11865,  12139,  12405,  12664,  12915,  13159,  13394,
+	 13622,  13841,  14052,  14255,  14449,  14634,  14810,  14977,
+	 15136,  15285,  15425,  15556,  15678,  15790,  15892,  15985,
+	 16068,  16142,  16206,  16260,  16304,  16339,  16363,  16378,
+	 16383,  16378,  16363,  16339,  16304,  16260,  16206,  16142,
+	 16068,  15985,  15892,  15790,  15678,  15556,  15425,  15285,
+	 15136,  14977,  14810,  14634,  14449,  14255,  14052,  13841,
+	 13622,  13394,  13159,  12915,  12664,  12405,  12139,  11865,
+	 11585,  11297,  11002,  10701,  10393,  10079,   9759,   9433,
+	  9102,   8765,   8423,   8075,   7723,   7366,   7005,   6639,
+	  6270,   5896,   5519,   5139,   4756,   4370,   3981,   3590,
+	  3196,   2801,   2404,   2005,   1606,   1205,    804,    402,
+	     0,   -402,   -804,  -1205,  -1606,  -2005,  -2404,  -2801,
+	 -3196,  -3590,  -3981,  -4370,  -4756,  -5139,  -5519,  -5896,
+	 -6270,  -6639,  -7005,  -7366,  -7723,  -8075,  -8423,  -8765,
+	 -9102,  -9433,  -9759, -10079, -10393, -10701, -11002, -11297,
+	-11585, -11865, -12139, -12405, -12664, -12915, -13159, -13394,
+	-13622, -13841, -14052, -14255, -14449, -14634, -14810, -14977,
+	-15136, -15285, -15425, -15556, -15678, -15790, -15892, -15985,
+	-16068, -16142, -16206, -16260, -16304, -16339, -16363, -16378,
+	-16383, -16378, -16363, -16339, -16304, -16260, -16206, -16142,
+	-16068, -15985, -15892, -15790, -15678, -15556, -15425, -15285,
+	-15136, -14977, -14810, -14634, -14449, -14255, -14052, -13841,
+	-13622, -13394, -13159, -12915, -12664, -12405, -12139, -11865,
+	-11585, -11297, -11002, -10701, -10393, -10079,  -9759,  -9433,
+	 -9102,  -8765,  -8423,  -8075,  -7723,  -7366,  -7005,  -6639,
+	 -6270,  -5896,  -5519,  -5139,  -4756,  -4370,  -3981,  -3590,
+	 -3196,  -2801,  -2404,  -2005,  -1606,  -1205,   -804,   -402
+};
+
+/* Phase step of C4 to B4 at FS, 2^32 * f / FS with A4 = 440 Hz	*/
+static const unsigned long		speakerSemitoneStep	[12] =
+{
+	140459156UL, 148811292UL, 157660072UL, 167035027UL,
+	176967447UL, 187490479UL, 198639243UL, 210450947UL,
+	222965012UL, 236223201UL, 250269764UL, 265151578UL
+};
+
+/****************************************************************************
+  Function:
+    static unsigned int speakerLinToDuty(int sample)
+  Description:
+	Converts a linear sample to an Output Compare duty cycle.
+  Precondition:
+    None.
+  Parameters:
+    int sample - 16 bit linear sample.
+  Returns:
+    Duty cycle between 1 and MAX_PWM_PERIOD.
+  Remarks:
+    This is the scaling the PWM output has always used, including its
+    clamps, so table and mixed output match the old per-sample path.
+    It runs per sample in the frame fill of an ADPCM voice and of a mix,
+    so the long divide by INPUT_RANGE is done by adds and shifts.
+  ***************************************************************************/
+static unsigned int speakerLinToDuty(int sample)
+{
+	unsigned int offset = sample - (LOWEST_INPUT_VALUE);
+	unsigned long product;
+	unsigned int duty;
+
+	// The lowest sample, for which the product below would wrap
+	if(offset == 0)
+		return 1;
+
+	// INPUT_RANGE is 2^16 - 1, and n/(2^16 - 1) rounds down to
+	// (n + (n >> 16) + 1) >> 16 for every n up to 2^32 - 2^16
+	product = ((offset * MAX_PWM_PERIOD));
+	duty = (unsigned int)((product + (product >> 16) + 1) >> 16);
+	if(duty > MAX_PWM_PERIOD)
+		duty = MAX_PWM_PERIOD - 1;
+	if (duty <= 0)
+		duty = 1;
+	return duty;
+}
+
+/****************************************************************************
+  Function:
+    static void speakerBuildDutyTable(void)
+  Description:
+	Fills speakerAlawDuty and speakerToneDuty with duty cycles.
+  Precondition:
+    None.
+  Parameters:
+    None.
+  Returns:
+    None
+  Remarks:
+    Each code is run through G711Alaw2Lin and speakerLinToDuty, so a
+    looked-up duty is the same value the decoder and the formula give.
+    The sine is converted the same way so a lone tone needs no divide.
+  ***************************************************************************/
+static void speakerBuildDutyTable(void)
+{
+	char			code[1];
+	int				sample[1];
+	unsigned int	i;
+
+	for(i = 0; i < 256; i++)
+	{
+		code[0] = (char)i;
+		G711Alaw2Lin(code, sample, 1);
+		speakerAlawDuty[i] = speakerLinToDuty(sample[0]);
+	}
+
+	for(i = 0; i < SPEAKER_TONE_TABLE_SIZE; i++)
+		speakerToneDuty[i] = speakerLinToDuty(speakerSine[i]);
+}
 
 /****************************************************************************
   Function:
@@ -75,10 +202,13 @@ volatile int 					isPlayingCurrentBuffer;
   Returns:
     None
   Remarks:
-    None
+    Builds the A-law and tone duty cycle tables before the output is
+    started.
   ***************************************************************************/
 void speakerInit()
 {
+	speakerBuildDutyTable();
+
 	// Configure Output Compare module
 	OCPWMConfig();
 	
@@ -99,11 +229,120 @@ void speakerInit()
     1 - If the speaker is busy.
     0 - If the speaker is not busy.
   Remarks:
-    None
+    The speaker is busy until the last frame has been sent and the output
+    is parked again.
   ***************************************************************************/
 unsigned int speakerBusy(void)
 {
-	return speakerBusyFlag;
+	return (speakerState != SPEAKER_IDLE);
+}
+
+/****************************************************************************
+  Function:
+    static SPEAKER_VOICE * speakerClaimVoice(void)
+  Description:
+	Picks the voice a new sound is started on.
+  Precondition:
+    None.
+  Parameters:
+    None.
+  Returns:
+    A free voice, or the clip that has played the longest when all
+    SPEAKER_MAX_VOICES are busy.
+  Remarks:
+    Leaves the frame fill and the DMA feed interrupts disabled; the caller
+    sets the voice up and then calls speakerStartVoices().
+  ***************************************************************************/
+static SPEAKER_VOICE * speakerClaimVoice(void)
+{
+	SPEAKER_VOICE *	pVoice = &speakerVoices[0];
+	unsigned int	i;
+
+	// Keep the frame fill and the DMA feed out while the state changes
+	IEC1bits.T5IE = 0;
+	IEC0bits.DMA0IE = 0;
+
+	for(i = 0; i < SPEAKER_MAX_VOICES; i++)
+	{
+		if(!speakerVoices[i].active)
+		{
+			pVoice = &speakerVoices[i];
+			break;
+		}
+		if(speakerVoices[i].segmentIndex > pVoice->segmentIndex)
+			pVoice = &speakerVoices[i];
+	}
+	return pVoice;
+}
+
+/****************************************************************************
+  Function:
+    static void speakerStartVoices(void)
+  Description:
+	Makes sure the output is running after a voice has been started.
+  Precondition:
+    speakerClaimVoice() must have been called.
+  Parameters:
+    None.
+  Returns:
+    None
+  Remarks:
+    Re-enables the interrupts speakerClaimVoice() turned off.
+  ***************************************************************************/
+static void speakerStartVoices(void)
+{
+	if(speakerState == SPEAKER_IDLE)
+	{
+		// Output is parked: start from an empty ring
+		StructQueueInit(&speakerRing, AUDIO_RING_DEPTH);
+		speakerRingLevelMin	= AUDIO_RING_DEPTH;
+		speakerState		= SPEAKER_WARMING;
+		OCPWMResume();
+	}
+	else if(speakerState == SPEAKER_DRAINING)
+		speakerState		= SPEAKER_PLAYING;
+
+	if(!T5CONbits.TON)
+	{
+		// Producer had stopped: restart it and fill the ring now
+		initTmr5();
+		IFS1bits.T5IF = 1;
+	}
+	else
+		IEC1bits.T5IE = 1;
+
+	IEC0bits.DMA0IE = 1;
+}
+
+/****************************************************************************
+  Function:
+    static void speakerSetClip(SPEAKER_VOICE * pVoice, long SpeechSegment,
+                               long SpeechSegmentSize, unsigned int codec)
+  Description:
+	Points a claimed voice at the start of a message.
+  Precondition:
+    speakerClaimVoice() must have been called.
+  Parameters:
+    SPEAKER_VOICE * pVoice - voice to set up.
+    long SpeechSegment - program memory address of the message.
+    long SpeechSegmentSize - length of the message in samples.
+    unsigned int codec - SPEAKER_CODEC_G711 or SPEAKER_CODEC_IMA_ADPCM.
+  Returns:
+    None
+  Remarks:
+    The voice is not made active here.
+  ***************************************************************************/
+static void speakerSetClip(SPEAKER_VOICE * pVoice, long SpeechSegment, long SpeechSegmentSize, unsigned int codec)
+{
+	pVoice->type			= SPEAKER_VOICE_CLIP;
+	pVoice->codec			= codec;
+	pVoice->samplePtr		= (long)SpeechSegment;
+	pVoice->sampleLength	= SpeechSegmentSize/FRAME_SIZE;
+	pVoice->pgmMemIndex		= 0;
+	pVoice->segmentIndex	= 0;
+	pVoice->pending			= 0;
+	pVoice->skew			= 0;
+	ImaAdpcmInit(&pVoice->adpcm);
 }
 
 /****************************************************************************
@@ -120,22 +359,470 @@ unsigned int speakerBusy(void)
   Returns:
     None
   Remarks:
-    None
+    The segment is started on a free voice and mixed with whatever is
+    already playing. When all SPEAKER_MAX_VOICES voices are busy the voice
+    that has played the longest is taken over. From SPEAKER_IDLE the
+    output goes through SPEAKER_WARMING: the DMA feed restarts on 50%
+    buffers, the same level the output was parked at, while the ring
+    fills.
   ***************************************************************************/
 void speakerActivate(long SpeechSegment, long SpeechSegmentSize)
 {
-	speakerBusyFlag = 1;
-	segmentIndex=0;
-	
-	samplePtr = (long)SpeechSegment;
-	sampleLength = SpeechSegmentSize/FRAME_SIZE;
-		
-	currentOutputBuffer = outputSamples1;
-	pgmMemIndex = 0;
-	bufferIndicator = 0;
-	flagBufferFull=0;
-	isPlayingCurrentBuffer = 0;
-	initTmr5();	
+	speakerActivateCodec(SpeechSegment, SpeechSegmentSize, SPEAKER_CODEC_G711);
+}
+
+/****************************************************************************
+  Function:
+    void speakerActivateCodec(long SpeechSegment, long SpeechSegmentSize,
+                              unsigned int codec)
+  Description:
+	Plays a message encoded with either codec.
+  Precondition:
+    None.
+  Parameters:
+    long SpeechSegment - Address of the message in program memory.
+    long SpeechSegmentSize - length of the message in samples.
+    unsigned int codec - SPEAKER_CODEC_G711 or SPEAKER_CODEC_IMA_ADPCM,
+                         normally the SPEECH_CODEC_* tag of the asset.
+  Returns:
+    None
+  Remarks:
+    speakerActivateCodec(SPEECH_CLIP(name)) plays an asset from
+    SpeechAssets.h with the codec it was encoded with.
+  ***************************************************************************/
+void speakerActivateCodec(long SpeechSegment, long SpeechSegmentSize, unsigned int codec)
+{
+	SPEAKER_VOICE *	pVoice = speakerClaimVoice();
+
+	speakerSetClip(pVoice, SpeechSegment, SpeechSegmentSize, codec);
+	pVoice->active			= 1;
+
+	speakerStartVoices();
+}
+
+/****************************************************************************
+  Function:
+    void speakerActivateAt(long SpeechSegment, long SpeechSegmentSize,
+                           unsigned int codec, unsigned long startSample)
+  Description:
+	Schedules a message to start on an exact sample of the output.
+  Precondition:
+    None.
+  Parameters:
+    long SpeechSegment - Address of the message in program memory.
+    long SpeechSegmentSize - length of the message in samples.
+    unsigned int codec - SPEAKER_CODEC_G711 or SPEAKER_CODEC_IMA_ADPCM.
+    unsigned long startSample - speakerSampleClock value of the first
+                                sample of the message.
+  Returns:
+    None
+  Remarks:
+    The voice is claimed now and stays silent until the frame holding
+    startSample is made; the first FRAME_SIZE samples are then shifted into
+    place, so the start is exact to the sample rather than to the frame. A
+    start that has already passed plays at once and counts in
+    speakerLateStarts. May be called from a SPEAKER_FRAME_HOOK.
+  ***************************************************************************/
+void speakerActivateAt(long SpeechSegment, long SpeechSegmentSize, unsigned int codec, unsigned long startSample)
+{
+	SPEAKER_VOICE *	pVoice = speakerClaimVoice();
+	unsigned int	i;
+
+	speakerSetClip(pVoice, SpeechSegment, SpeechSegmentSize, codec);
+	pVoice->startSample		= startSample;
+	pVoice->pending			= 1;
+	for(i = 0; i < FRAME_SIZE; i++)
+	{
+		if(codec == SPEAKER_CODEC_IMA_ADPCM)
+			pVoice->tail.linear[i]	= 0;
+		else
+			pVoice->tail.alaw[i]	= SPEAKER_ALAW_SILENCE;
+	}
+	pVoice->active			= 1;
+
+	speakerStartVoices();
+}
+
+/****************************************************************************
+  Function:
+    void speakerSetFrameHook(SPEAKER_FRAME_HOOK hook)
+  Description:
+	Installs a function called at the start of every frame fill.
+  Precondition:
+    speakerInit() must have been called.
+  Parameters:
+    SPEAKER_FRAME_HOOK hook - function to call, 0 to remove it.
+  Returns:
+    None
+  Remarks:
+    The hook runs in the Timer 5 interrupt with the speakerSampleClock
+    value of the frame about to be made, so it can start voices with
+    speakerActivateAt() in step with the output. While a hook is installed
+    the output keeps running, with silence between voices, so the sample
+    clock never stops.
+  ***************************************************************************/
+void speakerSetFrameHook(SPEAKER_FRAME_HOOK hook)
+{
+	speakerClaimVoice();				// Only used to hold off the audio interrupts
+	speakerFrameHook = hook;
+
+	if(hook)
+		speakerStartVoices();
+	else
+	{
+		IEC1bits.T5IE = 1;
+		if(speakerState != SPEAKER_IDLE)
+			IEC0bits.DMA0IE = 1;
+	}
+}
+
+/****************************************************************************
+  Function:
+    unsigned long speakerSampleNow(void)
+  Description:
+	Reads the output sample clock.
+  Precondition:
+    None.
+  Parameters:
+    None.
+  Returns:
+    Index of the first sample of the next frame to be made.
+  Remarks:
+    The clock counts every sample made since power up and only stands
+    still while the output is parked.
+  ***************************************************************************/
+unsigned long speakerSampleNow(void)
+{
+	unsigned long	now;
+	unsigned int	t5ie = IEC1bits.T5IE;
+
+	IEC1bits.T5IE = 0;
+	now = speakerSampleClock;
+	IEC1bits.T5IE = t5ie;
+	return now;
+}
+
+/****************************************************************************
+  Function:
+    unsigned long speakerToneStep(int semitone, int octave, int cents)
+  Description:
+	Works out the phase step of a pitch for a tone voice.
+  Precondition:
+    None.
+  Parameters:
+    int semitone - 0 for C up to 11 for B, values outside wrap into the
+                   neighbouring octaves.
+    int octave - scientific pitch octave, 4 holds middle C and A4 = 440 Hz.
+    int cents - fine offset, any value.
+  Returns:
+    Phase step per sample, 2^32 * f / FS. 0 if the pitch is at or above
+    FS/2 or below 1 Hz.
+  Remarks:
+    The cents fraction left after whole semitones are taken out is applied
+    as 2^(c/1200) ~ 1 + 0.693147x + 0.240227x^2, which is within 0.06 cent
+    for |c| <= 100. Not meant to be called from an interrupt.
+  ***************************************************************************/
+unsigned long speakerToneStep(int semitone, int octave, int cents)
+{
+	unsigned long long	step;
+	long				factor;
+
+	// Take whole semitones out of cents, leaving -50..+50
+	semitone	+= cents/100;
+	cents		%= 100;
+	if(cents > 50)
+	{
+		cents -= 100;
+		semitone++;
+	}
+	else if(cents < -50)
+	{
+		cents += 100;
+		semitone--;
+	}
+
+	// Take whole octaves out of the semitone
+	octave		+= semitone/12;
+	semitone	%= 12;
+	if(semitone < 0)
+	{
+		semitone += 12;
+		octave--;
+	}
+
+	// Octave -5 is below 1 Hz throughout, and the shifts stay small
+	if(octave < -4 || octave > 11)
+		return 0;
+
+	// Q20 factor 2^(cents/1200)
+	factor = 1048576L + ((long)cents * 6057L)/10 + ((long)cents * cents * 175L)/1000;
+	step = ((unsigned long long)speakerSemitoneStep[semitone] * factor) >> 20;
+
+	if(octave >= 4)
+		step <<= (octave - 4);
+	else
+		step >>= (4 - octave);
+
+	if(step >= 0x80000000ULL || step < SPEAKER_TONE_MIN_STEP)
+		return 0;
+	return (unsigned long)step;
+}
+
+/****************************************************************************
+  Function:
+    int speakerToneStart(unsigned long phaseStep)
+  Description:
+	Starts a tone that sustains until speakerToneStop() is called.
+  Precondition:
+    speakerInit() must have been called.
+  Parameters:
+    unsigned long phaseStep - pitch, see speakerToneStep().
+  Returns:
+    The voice playing the tone, or -1 for a step of 0.
+  Remarks:
+    The tone is a sine from a SPEAKER_TONE_TABLE_SIZE entry table driven by
+    a 32 bit phase accumulator, so it mixes with clips like any other
+    voice and needs no recording in flash.
+  ***************************************************************************/
+int speakerToneStart(unsigned long phaseStep)
+{
+	SPEAKER_VOICE *	pVoice;
+
+	if(phaseStep == 0)
+		return -1;
+
+	pVoice = speakerClaimVoice();
+	pVoice->type			= SPEAKER_VOICE_TONE;
+	pVoice->phase			= 0;
+	pVoice->phaseStep		= phaseStep;
+	pVoice->segmentIndex	= 0;
+	pVoice->active			= 1;
+	speakerStartVoices();
+
+	return (int)(pVoice - speakerVoices);
+}
+
+/****************************************************************************
+  Function:
+    void speakerToneSet(int voice, unsigned long phaseStep)
+  Description:
+	Changes the pitch of a playing tone.
+  Precondition:
+    voice must have come from speakerToneStart().
+  Parameters:
+    int voice - tone voice.
+    unsigned long phaseStep - new pitch, see speakerToneStep().
+  Returns:
+    None
+  Remarks:
+    The phase carries on from where it was, so the change does not click.
+  ***************************************************************************/
+void speakerToneSet(int voice, unsigned long phaseStep)
+{
+	if(voice < 0 || voice >= SPEAKER_MAX_VOICES || phaseStep == 0)
+		return;
+	if(speakerVoices[voice].type == SPEAKER_VOICE_TONE)
+		speakerVoices[voice].phaseStep = phaseStep;
+}
+
+/****************************************************************************
+  Function:
+    void speakerToneStop(int voice)
+  Description:
+	Stops a tone.
+  Precondition:
+    voice must have come from speakerToneStart().
+  Parameters:
+    int voice - tone voice.
+  Returns:
+    None
+  Remarks:
+    The output drains and parks as soon as no other voice is playing.
+  ***************************************************************************/
+void speakerToneStop(int voice)
+{
+	if(voice < 0 || voice >= SPEAKER_MAX_VOICES)
+		return;
+	if(speakerVoices[voice].type == SPEAKER_VOICE_TONE)
+		speakerVoices[voice].active = 0;
+}
+
+/****************************************************************************
+  Function:
+    unsigned int speakerActiveVoices(void)
+  Description:
+	Counts the voices that are currently playing.
+  Precondition:
+    None.
+  Parameters:
+    None.
+  Returns:
+    Number of active voices, 0 to SPEAKER_MAX_VOICES.
+  Remarks:
+    None
+  ***************************************************************************/
+unsigned int speakerActiveVoices(void)
+{
+	unsigned int i, count = 0;
+
+	for(i = 0; i < SPEAKER_MAX_VOICES; i++)
+	{
+		if(speakerVoices[i].active)
+			count++;
+	}
+	return count;
+}
+
+/****************************************************************************
+  Function:
+    static void speakerReadAlaw(SPEAKER_VOICE * pVoice, char * codes)
+  Description:
+	Reads the next frame of a G.711 message.
+  Precondition:
+    None.
+  Parameters:
+    SPEAKER_VOICE * pVoice - voice to advance.
+    char * codes - FRAME_SIZE A-law codes.
+  Returns:
+    None
+  Remarks:
+    G.711 keeps no state between samples, so the program memory cursor is
+    all a voice has to remember.
+  ***************************************************************************/
+static void speakerReadAlaw(SPEAKER_VOICE * pVoice, char * codes)
+{
+	// Read program memory frame
+	ReadProgramMemory((pVoice->samplePtr+pVoice->pgmMemIndex),samplesFromPgmMem, PGM_MEM_FRAME_SIZE);
+	PackForG711(samplesFromPgmMem,codes, PGM_MEM_FRAME_SIZE);
+	pVoice->pgmMemIndex += PGM_MEM_FRAME_SIZE;
+}
+
+/****************************************************************************
+  Function:
+    static void speakerReadAdpcm(SPEAKER_VOICE * pVoice, int * samples)
+  Description:
+	Reads and decodes the next frame of an IMA-ADPCM message.
+  Precondition:
+    None.
+  Parameters:
+    SPEAKER_VOICE * pVoice - voice to advance.
+    int * samples - FRAME_SIZE linear samples.
+  Returns:
+    None
+  Remarks:
+    A frame is FRAME_SIZE/2 bytes, unpacked with PackForG711() just like
+    the A-law codes; the decoder state lives in the voice and is loaded
+    from the header word in front of the first frame.
+  ***************************************************************************/
+static void speakerReadAdpcm(SPEAKER_VOICE * pVoice, int * samples)
+{
+	if(pVoice->pgmMemIndex == 0)
+	{
+		// Header word: initial predictor below, step index above
+		ReadProgramMemory(pVoice->samplePtr, samplesFromPgmMem, 2);
+		pVoice->adpcm.predictor	= samplesFromPgmMem[0];
+		pVoice->adpcm.index		= samplesFromPgmMem[1] & 0x7F;
+		if(pVoice->adpcm.index > 88)
+			pVoice->adpcm.index = 88;
+		pVoice->pgmMemIndex		= 2;
+	}
+
+	ReadProgramMemory((pVoice->samplePtr+pVoice->pgmMemIndex),samplesFromPgmMem, PGM_MEM_ADPCM_FRAME_SIZE);
+	PackForG711(samplesFromPgmMem,inputSamples, PGM_MEM_ADPCM_FRAME_SIZE);
+	ImaAdpcmDecode(&pVoice->adpcm, inputSamples, samples, FRAME_SIZE);
+	pVoice->pgmMemIndex += PGM_MEM_ADPCM_FRAME_SIZE;
+}
+
+/****************************************************************************
+  Function:
+    static unsigned int speakerReadVoice(SPEAKER_VOICE * pVoice)
+  Description:
+	Reads the next frame of a voice: A-law codes into inputSamples for
+	G.711, linear samples into voiceSamples for IMA-ADPCM.
+  Precondition:
+    The voice must be active.
+  Parameters:
+    SPEAKER_VOICE * pVoice - voice to advance.
+  Returns:
+    1 - If a frame was read.
+    0 - If the voice has finished; it is released.
+  Remarks:
+    A voice with a skew plays one extra frame to send the end of its last
+    segment frame.
+  ***************************************************************************/
+static unsigned int speakerReadVoice(SPEAKER_VOICE * pVoice)
+{
+	unsigned int i, skew = pVoice->skew;
+	unsigned int more = (pVoice->segmentIndex < pVoice->sampleLength);
+
+	if(pVoice->segmentIndex > pVoice->sampleLength || (!more && !skew))
+	{
+		pVoice->active = 0;
+		return 0;
+	}
+
+	if(pVoice->codec == SPEAKER_CODEC_IMA_ADPCM)
+	{
+		if(!skew)
+			speakerReadAdpcm(pVoice, voiceSamples);
+		else
+		{
+			for(i = 0; i < skew; i++)
+				voiceSamples[i] = pVoice->tail.linear[FRAME_SIZE - skew + i];
+			if(more)
+				speakerReadAdpcm(pVoice, pVoice->tail.linear);
+			else
+				for(i = 0; i < FRAME_SIZE; i++)
+					pVoice->tail.linear[i] = 0;
+			for(i = skew; i < FRAME_SIZE; i++)
+				voiceSamples[i] = pVoice->tail.linear[i - skew];
+		}
+	}
+	else if(!skew)
+		speakerReadAlaw(pVoice, inputSamples);
+	else
+	{
+		// Started part way into a frame: the end of the previous segment
+		// frame comes first, then the start of the next one
+		for(i = 0; i < skew; i++)
+			inputSamples[i] = pVoice->tail.alaw[FRAME_SIZE - skew + i];
+
+		if(more)
+			speakerReadAlaw(pVoice, pVoice->tail.alaw);
+		else
+		{
+			for(i = 0; i < FRAME_SIZE; i++)
+				pVoice->tail.alaw[i] = SPEAKER_ALAW_SILENCE;
+		}
+
+		for(i = skew; i < FRAME_SIZE; i++)
+			inputSamples[i] = pVoice->tail.alaw[i - skew];
+	}
+
+	pVoice->segmentIndex++;
+	return 1;
+}
+
+/****************************************************************************
+  Function:
+    static unsigned int speakerElapsedCycles(DWORD start)
+  Description:
+	Instruction cycles since start, measured on the time base.
+  Precondition:
+    timebaseInit() must have been called.
+  Parameters:
+    DWORD start - timebaseCycles() at the start of the measurement.
+  Returns:
+    Elapsed cycles, held at 0xFFFF so the 16 bit counters cannot wrap.
+  Remarks:
+    The same clock as the profiling probes, and it keeps counting while
+    Timer 4 is stopped.
+  ***************************************************************************/
+static unsigned int speakerElapsedCycles(DWORD start)
+{
+	DWORD elapsed = timebaseCycles() - start;
+
+	return (elapsed > 0xFFFF) ? 0xFFFF : (unsigned int)elapsed;
 }
 
 /****************************************************************************
@@ -150,7 +837,9 @@ void speakerActivate(long SpeechSegment, long SpeechSegmentSize)
   Returns:
     None
   Remarks:
-    None
+    Timer 2 raises no interrupt. Every Timer 2 period requests one DMA
+    transfer that copies the next duty value into OC1RS, so the CPU is only
+    involved once per frame in _DMA0Interrupt.
   ***************************************************************************/
 void OCPWMConfig(void)
 {
@@ -160,9 +849,92 @@ void OCPWMConfig(void)
 	PR2						= 0;		/* This will produce an average value of Vdd/2	*/
 	IFS0bits.T2IF			= 0;
 	IEC0bits.T2IE			= 0;
-	IPC1bits.T2IP			= TIMER2_INT_PRIORITY;
 	TRISAbits.TRISA4 = 1;		// Setting the direction of I/O pin C0 as input
 	RPOR2 					= 0b0000000000010010;
+
+	/* DMA channel 0 feeds OC1RS from the ping-pong duty buffers	*/
+	DMA0CONbits.CHEN		= 0;
+	DMA0CONbits.SIZE		= 0;		// Word transfers
+	DMA0CONbits.DIR			= 1;		// DMA RAM to peripheral
+	DMA0CONbits.HALF		= 0;		// Interrupt when a whole buffer is sent
+	DMA0CONbits.NULLW		= 0;
+	DMA0CONbits.AMODE		= 0;		// Register indirect with post-increment
+	DMA0CONbits.MODE		= 2;		// Continuous, ping-pong
+	DMA0REQbits.IRQSEL		= DMA_REQ_TIMER2;
+	DMA0STA					= __builtin_dmaoffset(dmaDutyBufferA);
+	DMA0STB					= __builtin_dmaoffset(dmaDutyBufferB);
+	DMA0PAD					= DMA_PERIPHERAL_ADDRESS(OCRS);
+	DMA0CNT					= DMA_FRAME_SIZE - 1;
+	IFS0bits.DMA0IF			= 0;
+	IEC0bits.DMA0IE			= 0;
+	IPC1bits.DMA0IP			= DMA0_INT_PRIORITY;
+}
+
+/****************************************************************************
+  Function:
+    static void OCPWMFillDuty(unsigned int * dutyBuffer)
+  Description:
+	Fills one half of the DMA ping-pong buffer.
+  Precondition:
+    None.
+  Parameters:
+    unsigned int * dutyBuffer - DMA buffer half that has just been sent.
+  Returns:
+    None
+  Remarks:
+    The oldest frame in speakerRing is taken and each duty value is
+    repeated for FPWM_FS_RATIO PWM periods. An empty ring holds the output
+    at 50%. In SPEAKER_PLAYING that counts as an underrun, in
+    SPEAKER_DRAINING the output is parked once a whole 50% buffer has
+    gone out.
+  ***************************************************************************/
+static void OCPWMFillDuty(unsigned int * dutyBuffer)
+{
+	SPEAKER_FRAME *	pFrame;
+	unsigned int	i, j, duty;
+
+	if(StructQueueIsNotEmpty(&speakerRing, AUDIO_RING_DEPTH))
+	{
+		pFrame = StructQueueRemove(&speakerRing, AUDIO_RING_DEPTH);
+		speakerParkPending = 0;
+		if(speakerState == SPEAKER_WARMING)
+			speakerState = SPEAKER_PLAYING;
+		for(i = 0; i < FRAME_SIZE; i++)
+		{
+			duty = pFrame->duty[i];
+			for(j = 0; j < FPWM_FS_RATIO; j++)
+				*dutyBuffer++ = duty;
+		}
+
+		// Once the producer has stopped the ring is meant to drain
+		if(speakerState == SPEAKER_PLAYING)
+		{
+			if((unsigned int)StructQueueCount(&speakerRing, AUDIO_RING_DEPTH) < speakerRingLevelMin)
+				speakerRingLevelMin = StructQueueCount(&speakerRing, AUDIO_RING_DEPTH);
+
+			// Let the frame fill top the ring up straight away
+			if(!speakerRefillPending)
+			{
+				speakerRequestTime		= timebaseCycles();
+				speakerRefillPending	= 1;
+			}
+			IFS1bits.T5IF = 1;
+		}
+		return;
+	}
+
+	for(i = 0; i < DMA_FRAME_SIZE; i++)
+		*dutyBuffer++ = PWM_MID_DUTY;
+
+	if(speakerState == SPEAKER_PLAYING)
+		speakerUnderruns++;
+	else if(speakerState == SPEAKER_DRAINING)
+	{
+		// The other half may still hold the last frame, park once it is sent
+		if(speakerParkPending)
+			OCPWMPark();
+		speakerParkPending = 1;
+	}
 }
 
 /****************************************************************************
@@ -171,142 +943,152 @@ void OCPWMConfig(void)
   Description:
 	Starts Ouput Compare module in PWM mode.
   Precondition:
-    None.
+    OCPWMConfig() must have been called.
   Parameters:
     None.
   Returns:
     None
   Remarks:
-    None
+    The output is left parked at 50% in SPEAKER_IDLE; the DMA feed is only
+    started by speakerActivate().
   ***************************************************************************/ 
 void OCPWMStart(void)
 {
-	IEC0bits.T2IE			= 1;						// Enable Timer2 Interrupt	
 	T2CONbits.TON			= 1;						// Enable Timer2			
-	Delay(100);
+	schedulerDelay(100);
 	PR2 					= MAX_PWM_PERIOD;			// PWM Period			
-	OCRS					= (MAX_PWM_PERIOD/2);		// Initial Duty Cycle at 50% 	
-	OCR						= (MAX_PWM_PERIOD/2);
+	OCRS					= PWM_MID_DUTY;				// Initial Duty Cycle at 50% 	
+	OCR						= PWM_MID_DUTY;
 	OCCON					= OCCON_WORD;				// Turn module on			
-	pwmCycleCount			= 0;
-	bufferIndex				= 0;
-	isPlayingCurrentBuffer 	= 0;
+	StructQueueInit(&speakerRing, AUDIO_RING_DEPTH);
+	speakerState			= SPEAKER_IDLE;
 }	
 
 /****************************************************************************
   Function:
-    void OCPWMStop(void)
+    void OCPWMResume(void)
   Description:
-	Stops Output Compare module.
+	Restarts the DMA feed of OC1RS from a parked output.
   Precondition:
-    None.
+    OCPWMStart() must have been called.
   Parameters:
     None.
   Returns:
     None
   Remarks:
+    Both DMA halves start at 50%, the level OC1RS was parked at, so the
+    restart does not click. The caller enables the DMA interrupt.
+  ***************************************************************************/ 
+void OCPWMResume(void)
+{
+	unsigned int i;
+
+	for(i = 0; i < DMA_FRAME_SIZE; i++)
+	{
+		dmaDutyBufferA[i]	= PWM_MID_DUTY;
+		dmaDutyBufferB[i]	= PWM_MID_DUTY;
+	}
+	speakerParkPending		= 0;
+	IFS0bits.DMA0IF			= 0;
+	DMA0CONbits.CHEN		= 1;						// Start feeding OC1RS
+}
+
+/****************************************************************************
+  Function:
+    void OCPWMPark(void)
+  Description:
+	Stops the DMA feed and holds the output at 50%.
+  Precondition:
+    None.
+  Parameters:
+    None.
+  Returns:
     None
+  Remarks:
+    Timer 2 and OC1 keep running with no interrupts, so the speaker
+    stays at Vdd/2 and the idle cost is nothing but the peripherals.
   ***************************************************************************/ 
-void OCPWMStop(void)
+void OCPWMPark(void)
 {
-	OCCONbits.OCM 		= 0;		// Disable output compare
+	DMA0CONbits.CHEN		= 0;						// Stop the duty cycle feed
+	IEC0bits.DMA0IE			= 0;
+	IFS0bits.DMA0IF			= 0;
+	OCRS					= PWM_MID_DUTY;
+	speakerState			= SPEAKER_IDLE;
 }
 
 /****************************************************************************
   Function:
-    int OCPWMIsBusy(void)
+    void OCPWMStop(void)
   Description:
-	Checks if Output Compare module is busy.
+	Stops Output Compare module.
   Precondition:
     None.
   Parameters:
     None.
   Returns:
-    1 - If the Output Compare module is busy.
-    0 - If the Output Compare module is not busy.
+    None
   Remarks:
     None
-  ***************************************************************************/
-int OCPWMIsBusy(void)
+  ***************************************************************************/ 
+void OCPWMStop(void)
 {
-	return isPlayingCurrentBuffer;
+	DMA0CONbits.CHEN	= 0;		// Stop the duty cycle feed
+	IEC0bits.DMA0IE		= 0;
+	OCCONbits.OCM 		= 0;		// Disable output compare
+	speakerState		= SPEAKER_IDLE;
 }
 
 /****************************************************************************
   Function:
-    void OCPWMWrite(int * sourceDataBuffer,	int size)
+    int OCPWMIsBusy(void)
   Description:
-	Write to Ouput Compare module.
+	Checks if Output Compare module is busy.
   Precondition:
     None.
   Parameters:
-    int * sourceDataBuffer - Address of the source buffer played out of the speaker.
-    int size - Length of the buffer.
+    None.
   Returns:
-	None
+    1 - If frames are still queued for the Output Compare module.
+    0 - If the Output Compare module is not busy.
   Remarks:
     None
   ***************************************************************************/
-void OCPWMWrite(int * sourceDataBuffer,	int size)
+int OCPWMIsBusy(void)
 {
-	ptrDataBuffer 			= sourceDataBuffer;		
-	pwmCycleCount			= 0;					
-	bufferIndex				= 0;					// Point to the first sample		
-	isPlayingCurrentBuffer 	= 1;					// Playing the current buffer flag		
-	totalSamples 			= size;
+	return StructQueueIsNotEmpty(&speakerRing, AUDIO_RING_DEPTH);
 }
-		
+
 /****************************************************************************
   Function:
-    void __attribute__((interrupt, shadow, auto_psv)) _T2Interrupt(void)
+    void __attribute__((interrupt, no_auto_psv)) _DMA0Interrupt(void)
   Description:
-    Timer 2 interrupt service routine which populates the Output Compare
-    module with speech data.
+    DMA channel 0 interrupt service routine which refills the half of the
+    ping-pong buffer that has just been sent to OC1RS.
   Precondition:
-    Timer 2 and the Timer 2 interrupt must be enabled in order for
-    this function to execute.  
+    OCPWMStart() must have been called.
   Parameters:
     None
   Returns:
     None
   Remarks:
-    None
+    Runs once per frame (FS/FRAME_SIZE times a second) where the old
+    Timer 2 interrupt ran FPWM times a second, and not at all in
+    SPEAKER_IDLE.
   ***************************************************************************/
-void __attribute__((__interrupt__,no_auto_psv)) _T2Interrupt(void)
+void __attribute__((__interrupt__,no_auto_psv)) _DMA0Interrupt(void)
 {
-	IFS0bits.T2IF			= 0;
-	
-	if(flagBufferFull)
-	{
-		if(pwmCycleCount == 0)
-		{
-			/* The first sample	*/
-			unsigned int sample = ptrDataBuffer[bufferIndex] - (LOWEST_INPUT_VALUE);
-			currentPWMDutyCycle = ((sample * MAX_PWM_PERIOD))/INPUT_RANGE;
-			if(currentPWMDutyCycle > MAX_PWM_PERIOD) 
-				currentPWMDutyCycle = MAX_PWM_PERIOD - 1;
-			if (currentPWMDutyCycle <= 0) 
-				currentPWMDutyCycle = 1;
-			OCRS	= currentPWMDutyCycle;
-		}
-			
-		/* When the required number of PWM cycles have been completed	
-		   its time to move to the next sample and update the duty cycle */
-					
-		if((++ pwmCycleCount) == FPWM_FS_RATIO)
-		{
-			bufferIndex ++;
-			pwmCycleCount = 0;
-		}
-		
-		if(bufferIndex == totalSamples)
-		{
-			bufferIndex = 0;
-			isPlayingCurrentBuffer = 0;
-			flagBufferFull = 0;
-		}
-	}
-	
+	SPEAKER_STATE	state = speakerState;
+	DWORD			start = timebaseCycles();
+
+	PROFILE_BEGIN(PROFILE_DMA0_ISR);
+	IFS0bits.DMA0IF			= 0;
+
+	// PPST0 shows the buffer now being sent, so the other one is free
+	OCPWMFillDuty(DMACS1bits.PPST0 ? dmaDutyBufferA : dmaDutyBufferB);
+
+	speakerStateCycles[state] += speakerElapsedCycles(start);
+	PROFILE_END(PROFILE_DMA0_ISR);
 }
 
 /****************************************************************************
@@ -329,7 +1111,7 @@ void initTmr5()
         PR5 = SAMPPRD_SPEAK;
         IFS1bits.T5IF = 0;
         IEC1bits.T5IE = 1;
-		IPC7bits.T5IP			= TIMER2_INT_PRIORITY;
+		IPC7bits.T5IP			= TIMER5_INT_PRIORITY;
 		
         //Start Timer4
         T5CONbits.TON = 1;
@@ -373,6 +1155,195 @@ void StartTmr5()
 	T5CONbits.TON = 1;
 }
 
+/****************************************************************************
+  Function:
+    static void speakerToneFrame(SPEAKER_VOICE * pVoice, const int * wave, int * destination)
+  Description:
+	Steps a tone voice through one frame.
+  Precondition:
+    None.
+  Parameters:
+    SPEAKER_VOICE * pVoice - tone voice to advance.
+    const int * wave - one cycle of SPEAKER_TONE_TABLE_SIZE values.
+    int * destination - FRAME_SIZE values taken from wave.
+  Returns:
+    None
+  Remarks:
+    The top 8 bits of the 32 bit phase pick the table entry. The mask
+    keeps it in the table where long is wider, as in the host build.
+  ***************************************************************************/
+static void speakerToneFrame(SPEAKER_VOICE * pVoice, const int * wave, int * destination)
+{
+	unsigned long	phase = pVoice->phase;
+	unsigned long	step = pVoice->phaseStep;
+	unsigned int	i;
+
+	for(i = 0; i < FRAME_SIZE; i++)
+	{
+		destination[i] = wave[(unsigned int)(phase >> 24) & 0xFF];
+		phase += step;
+	}
+	pVoice->phase = phase;
+}
+
+/****************************************************************************
+  Function:
+    static unsigned int speakerFillFrame(unsigned int * duty)
+  Description:
+	Produces the next frame of PWM duty values from all active voices.
+  Precondition:
+    None.
+  Parameters:
+    unsigned int * duty - FRAME_SIZE duty values to fill.
+  Returns:
+    Number of voices that contributed, 1 for a silent frame while a voice
+    waits for its start or a frame hook is installed, 0 when nothing is
+    left to play.
+  Remarks:
+    A single voice goes straight to duty through speakerAlawDuty or
+    speakerToneDuty. With more voices each one is decoded and summed, and
+    the sum is saturated to the 16 bit range once and scaled with
+    speakerLinToDuty. The cost grows linearly with the number of active
+    voices and is bounded by SPEAKER_MAX_VOICES; the last and worst fill
+    times are kept in speakerFrameCycles, speakerFrameCyclesMax and
+    speakerVoiceCyclesMax.
+    The read and decode of each clip frame is timed by codec in
+    speakerCodecCycles and speakerCodecCyclesMax, so flash can be traded
+    against CPU per asset.
+  ***************************************************************************/
+static unsigned int speakerFillFrame(unsigned int * duty)
+{
+	unsigned int	i, v, voices, mixing, waiting, codec;
+	DWORD			start, decodeStart;
+	long			mixed, offset;
+
+	start	= timebaseCycles();
+	voices	= 0;
+	waiting	= 0;
+
+	if(speakerFrameHook)
+		speakerFrameHook(speakerSampleClock);
+
+	mixing	= (speakerActiveVoices() > 1);
+
+	for(v = 0; v < SPEAKER_MAX_VOICES; v++)
+	{
+		if(!speakerVoices[v].active)
+			continue;
+
+		if(speakerVoices[v].pending)
+		{
+			offset = (long)(speakerVoices[v].startSample - speakerSampleClock);
+			if(offset >= FRAME_SIZE)
+			{
+				waiting++;
+				continue;
+			}
+			if(offset < 0)
+			{
+				speakerLateStarts++;
+				offset = 0;
+			}
+			speakerVoices[v].skew		= (unsigned int)offset;
+			speakerVoices[v].pending	= 0;
+		}
+
+		if(speakerVoices[v].type == SPEAKER_VOICE_TONE)
+		{
+			if(!mixing)
+			{
+				speakerToneFrame(&speakerVoices[v], (const int *)speakerToneDuty, (int *)duty);
+				voices++;
+				continue;
+			}
+			speakerToneFrame(&speakerVoices[v], speakerSine, voiceSamples);
+		}
+		else
+		{
+			codec		= speakerVoices[v].codec;
+			decodeStart	= timebaseCycles();
+			if(!speakerReadVoice(&speakerVoices[v]))
+				continue;
+
+			if(codec == SPEAKER_CODEC_IMA_ADPCM)
+			{
+				// Already decoded to voiceSamples
+				if(!mixing)
+				{
+					for(i = 0; i < FRAME_SIZE; i++)
+						duty[i] = speakerLinToDuty(voiceSamples[i]);
+				}
+			}
+			else if(!mixing)
+			{
+				// Only one voice: look the duty cycles up directly
+				for(i = 0; i < FRAME_SIZE; i++)
+					duty[i] = speakerAlawDuty[(unsigned char)inputSamples[i]];
+			}
+			else
+			{
+				// G.711 Decoding of the buffered speech frame
+				G711Alaw2Lin(inputSamples,voiceSamples,FRAME_SIZE);
+			}
+
+			speakerCodecCycles[codec] = speakerElapsedCycles(decodeStart);
+			if(speakerCodecCycles[codec] > speakerCodecCyclesMax[codec])
+				speakerCodecCyclesMax[codec] = speakerCodecCycles[codec];
+
+			if(!mixing)
+			{
+				voices++;
+				continue;
+			}
+		}
+
+		// Sum at full width, the saturation is left to the end so a voice
+		// that swings back can still pull a sum over the limit back in
+		if(voices++ == 0)
+		{
+			for(i = 0; i < FRAME_SIZE; i++)
+				mixSamples[i] = voiceSamples[i];
+		}
+		else
+		{
+			for(i = 0; i < FRAME_SIZE; i++)
+				mixSamples[i] += voiceSamples[i];
+		}
+	}
+
+	if(!voices)
+	{
+		if(!waiting && !speakerFrameHook)
+			return 0;
+
+		// Keep the clock running with silence until the next voice
+		for(i = 0; i < FRAME_SIZE; i++)
+			duty[i] = speakerAlawDuty[SPEAKER_ALAW_SILENCE];
+		return 1;
+	}
+
+	if(mixing)
+	{
+		// Saturate the sum to the 16 bit range
+		for(i = 0; i < FRAME_SIZE; i++)
+		{
+			mixed = mixSamples[i];
+			if(mixed > HIGHEST_INPUT_VALUE)
+				mixed = HIGHEST_INPUT_VALUE;
+			else if(mixed < LOWEST_INPUT_VALUE)
+				mixed = LOWEST_INPUT_VALUE;
+			duty[i] = speakerLinToDuty((int)mixed);
+		}
+	}
+
+	speakerFrameCycles = speakerElapsedCycles(start);
+	if(speakerFrameCycles > speakerFrameCyclesMax)
+		speakerFrameCyclesMax = speakerFrameCycles;
+	if(speakerFrameCycles/voices > speakerVoiceCyclesMax)
+		speakerVoiceCyclesMax = speakerFrameCycles/voices;
+	return voices;
+}
+
 /****************************************************************************
   Function:
     void __attribute__((interrupt, shadow, auto_psv)) _T5Interrupt(void)
@@ -381,46 +1352,57 @@ void StartTmr5()
     speech segment.
   Precondition:
     Timer 5 and the Timer 5 interrupt must be enabled in order for
-    this function to execute.  
+    this function to execute.
   Parameters:
     None
   Returns:
     None
   Remarks:
-    None
+    Fills speakerRing ahead until it holds AUDIO_RING_DEPTH frames. Each
+    frame is written into the free slot before it is queued, so the DMA
+    feed never sees a half filled frame. _DMA0Interrupt raises this
+    interrupt as soon as it has taken a frame, Timer 5 itself only acts
+    as a backstop. speakerFillLatencyMax keeps the longest time from a
+    frame being taken to the ring being topped up again.
   ***************************************************************************/
 void __attribute__ ((interrupt, no_auto_psv)) _T5Interrupt()
 {
+	SPEAKER_FRAME *	pFrame;
+	SPEAKER_STATE	state = speakerState;
+	unsigned int	latency, requested;
+	DWORD			start = timebaseCycles();
 
-	if(!flagBufferFull)
+	PROFILE_BEGIN(PROFILE_T5_ISR);
+	IFS1bits.T5IF = 0;
+	requested				= speakerRefillPending;
+	speakerRefillPending	= 0;
+
+	while(StructQueueIsNotFull(&speakerRing, AUDIO_RING_DEPTH))
 	{
-		if(segmentIndex++ < sampleLength)
-		{
-			// Read program memory frame
-		    ReadProgramMemory((samplePtr+pgmMemIndex),samplesFromPgmMem, PGM_MEM_FRAME_SIZE);
-			PackForG711(samplesFromPgmMem,inputSamples, PGM_MEM_FRAME_SIZE);
-			
-			// G.711 Decoding of the buffered speech frame
-			G711Alaw2Lin(inputSamples,currentOutputBuffer,FRAME_SIZE);
-			
-			// Generate PWM signal using Output Compare module for the decoded speech frame
-			OCPWMWrite(currentOutputBuffer,FRAME_SIZE);
-			
-			bufferIndicator ^= 1;
-			currentOutputBuffer = (bufferIndicator) ? outputSamples2:outputSamples1;
-			pgmMemIndex += PGM_MEM_FRAME_SIZE;
-			flagBufferFull = 1;
-		}
-		else
+		pFrame = (speakerRing.head < (AUDIO_RING_DEPTH-1)) ?
+					&speakerRing.buffer[speakerRing.head+1] : &speakerRing.buffer[0];
+
+		if(!speakerFillFrame(pFrame->duty))
 		{
-			flagBufferFull = 0;
-			segmentIndex = 0;
-			OCRS			= (( MAX_PWM_PERIOD)/2);	/* Initial Duty Cycle at 50% 	*/
+			// Nothing left to play, the DMA feed drains what is queued
 			StopTmr5();
-			speakerBusyFlag = 0;
+			speakerState = SPEAKER_DRAINING;
+			break;
 		}
+
+		IEC0bits.DMA0IE = 0;
+		(void)StructQueueAdd(&speakerRing, AUDIO_RING_DEPTH);
+		IEC0bits.DMA0IE = 1;
+		speakerSampleClock += FRAME_SIZE;
 	}
-	
-	IFS1bits.T5IF = 0;	
-}
 
+	if(requested && T5CONbits.TON)
+	{
+		latency = speakerElapsedCycles(speakerRequestTime);
+		if(latency > speakerFillLatencyMax)
+			speakerFillLatencyMax = latency;
+	}
+
+	speakerStateCycles[state] += speakerElapsedCycles(start);
+	PROFILE_END(PROFILE_T5_ISR);
+}
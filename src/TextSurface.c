@@ -0,0 +1,403 @@
+/**********************************************************************
+* FileName:        		TextSurface.c
+* Dependencies:    		Header (.h) files if applicable, see below
+* Processor:       		PIC24HJ128GP504
+* Compiler:        		MPLAB C30 v3.11b or higher
+*
+* Retained text surface. The first text, and the first after
+* textSurfaceInvalidate(), is drawn in full: frame, cleared area and
+* every line, as StDraw() draws a STATICTEXT. After that each line of
+* the new text is laid out against the same line of the old one; glyph
+* cells of the old line that do not hold the same character at the same
+* x are cleared, then the new glyphs that were not there are drawn.
+* Nothing is allocated.
+************************************************************************/
+
+/************************************************************************
+ Header Includes
+ ************************************************************************/
+#include "Main.h"
+#include "TextSurface.h"
+
+/************************************************************************
+ Function Prototypes
+ ************************************************************************/
+static GOL_SCHEME *		textSurfaceScheme(TEXT_SURFACE * surface);
+static SHORT			textSurfaceCharWidth(XCHAR ch, void * font);
+static SHORT			textSurfaceLineX(TEXT_SURFACE * surface, const XCHAR * line, void * font);
+static const XCHAR *	textSurfaceNextLine(const XCHAR * line);
+static WORD				textSurfaceLineEqual(const XCHAR * a, const XCHAR * b);
+static void				textSurfaceUpdateLine(TEXT_SURFACE * surface, const XCHAR * oldLine,
+											  const XCHAR * newLine, SHORT y, WORD draw);
+static void				textSurfaceDrawAll(TEXT_SURFACE * surface, const XCHAR * text);
+
+/****************************************************************************
+  Function:
+    void textSurfaceInit(TEXT_SURFACE * surface, SHORT left, SHORT top,
+						 SHORT right, SHORT bottom, WORD state,
+						 GOL_SCHEME * pScheme)
+  Description:
+	Sets up a surface on an area of the screen.
+  Precondition:
+    None.
+  Parameters:
+    TEXT_SURFACE * surface - surface to set up.
+    SHORT left, top, right, bottom - area, frame included.
+    WORD state - ST_FRAME, ST_CENTER_ALIGN and ST_RIGHT_ALIGN as for
+		StCreate(), the other states are ignored.
+    GOL_SCHEME * pScheme - colours and font, NULL for the default scheme.
+  Returns:
+    None
+  Remarks:
+    Nothing is drawn until textSurfaceSetText().
+  ***************************************************************************/
+void textSurfaceInit(TEXT_SURFACE * surface, SHORT left, SHORT top, SHORT right, SHORT bottom,
+					 WORD state, GOL_SCHEME * pScheme)
+{
+	surface->left		= left;
+	surface->top		= top;
+	surface->right		= right;
+	surface->bottom		= bottom;
+	surface->state		= state;
+	surface->pScheme	= pScheme;
+	surface->valid		= 0;
+	surface->text[0]	= 0;
+}
+
+/****************************************************************************
+  Function:
+    void textSurfaceSetText(TEXT_SURFACE * surface, const XCHAR * text)
+  Description:
+	Shows a new text, lines separated by '\n', and flushes the display.
+  Precondition:
+    GOLInit() must have been called.
+  Parameters:
+    TEXT_SURFACE * surface - surface to draw on.
+    const XCHAR * text - text to show, copied; the first
+		TEXT_SURFACE_SIZE - 1 characters are kept.
+  Returns:
+    None
+  Remarks:
+    Only the glyph cells that change are drawn unless the surface is not
+    valid. Anything else drawn over the area must be followed by
+    textSurfaceInvalidate().
+  ***************************************************************************/
+void textSurfaceSetText(TEXT_SURFACE * surface, const XCHAR * text)
+{
+	GOL_SCHEME *	pScheme = textSurfaceScheme(surface);
+	XCHAR			newText[TEXT_SURFACE_SIZE];
+	const XCHAR *	oldLine;
+	const XCHAR *	newLine;
+	SHORT			height, y;
+	int				i;
+
+	for(i = 0; i < TEXT_SURFACE_SIZE - 1 && text[i] != 0; i++)
+		newText[i] = text[i];
+	newText[i] = 0;
+
+	if(!surface->valid)
+	{
+		textSurfaceDrawAll(surface, newText);
+	}
+	else
+	{
+		height = GetTextHeight(pScheme->pFont);
+		SetClip(CLIP_ENABLE);
+		SetClipRgn(surface->left + ST_INDENT, surface->top + 2, surface->right - ST_INDENT, surface->bottom - 1);
+
+		// Clear what goes away from every line first, a new glyph may
+		// overlap an old one of the next pass
+		SetColor(pScheme->CommonBkColor);
+		for(oldLine = surface->text, newLine = newText, y = surface->top;
+			oldLine != NULL || newLine != NULL;
+			oldLine = textSurfaceNextLine(oldLine), newLine = textSurfaceNextLine(newLine), y += height)
+		{
+			if(!textSurfaceLineEqual(oldLine, newLine))
+				textSurfaceUpdateLine(surface, oldLine, newLine, y, 0);
+		}
+
+		SetColor(pScheme->TextColor0);
+		SetFont(pScheme->pFont);
+		for(oldLine = surface->text, newLine = newText, y = surface->top;
+			oldLine != NULL || newLine != NULL;
+			oldLine = textSurfaceNextLine(oldLine), newLine = textSurfaceNextLine(newLine), y += height)
+		{
+			if(!textSurfaceLineEqual(oldLine, newLine))
+				textSurfaceUpdateLine(surface, oldLine, newLine, y, 1);
+		}
+		SetClip(CLIP_DISABLE);
+	}
+
+	for(i = 0; newText[i] != 0; i++)
+		surface->text[i] = newText[i];
+	surface->text[i] = 0;
+	surface->valid = 1;
+	FlushDisplay();
+}
+
+/****************************************************************************
+  Function:
+    void textSurfaceInvalidate(TEXT_SURFACE * surface)
+  Description:
+	Makes the next textSurfaceSetText() draw the whole surface.
+  Precondition:
+    None.
+  Parameters:
+    TEXT_SURFACE * surface - surface whose area was drawn over.
+  Returns:
+    None
+  Remarks:
+    None.
+  ***************************************************************************/
+void textSurfaceInvalidate(TEXT_SURFACE * surface)
+{
+	surface->valid = 0;
+}
+
+/****************************************************************************
+  Function:
+    static GOL_SCHEME * textSurfaceScheme(TEXT_SURFACE * surface)
+  Description:
+	Scheme the surface draws with.
+  Precondition:
+    GOLInit() must have been called.
+  Parameters:
+    TEXT_SURFACE * surface - surface.
+  Returns:
+    Its own scheme, or the GOL default one.
+  Remarks:
+    None.
+  ***************************************************************************/
+static GOL_SCHEME * textSurfaceScheme(TEXT_SURFACE * surface)
+{
+	return (surface->pScheme != NULL) ? surface->pScheme : _pDefaultGolScheme;
+}
+
+/****************************************************************************
+  Function:
+    static SHORT textSurfaceCharWidth(XCHAR ch, void * font)
+  Description:
+	Width of one glyph.
+  Precondition:
+    None.
+  Parameters:
+    XCHAR ch - character.
+    void * font - font.
+  Returns:
+    Its width in pixels, 0 if the font does not have it.
+  Remarks:
+    None.
+  ***************************************************************************/
+static SHORT textSurfaceCharWidth(XCHAR ch, void * font)
+{
+	XCHAR str[2];
+
+	str[0] = ch;
+	str[1] = 0;
+	return GetTextWidth(str, font);
+}
+
+/****************************************************************************
+  Function:
+    static SHORT textSurfaceLineX(TEXT_SURFACE * surface,
+								  const XCHAR * line, void * font)
+  Description:
+	x of the first glyph of a line, aligned as StDraw() aligns it.
+  Precondition:
+    None.
+  Parameters:
+    TEXT_SURFACE * surface - surface.
+    const XCHAR * line - line, ended by '\n' or 0.
+    void * font - font.
+  Returns:
+    The x position.
+  Remarks:
+    None.
+  ***************************************************************************/
+static SHORT textSurfaceLineX(TEXT_SURFACE * surface, const XCHAR * line, void * font)
+{
+	SHORT textWidth = GetTextWidth((XCHAR *)line, font);
+
+	if(surface->state & ST_CENTER_ALIGN)
+		return (surface->left + surface->right - textWidth) >> 1;
+	if(surface->state & ST_RIGHT_ALIGN)
+		return surface->right - textWidth - ST_INDENT;
+	return surface->left + ST_INDENT;
+}
+
+/****************************************************************************
+  Function:
+    static const XCHAR * textSurfaceNextLine(const XCHAR * line)
+  Description:
+	Steps to the next line of a text.
+  Precondition:
+    None.
+  Parameters:
+    const XCHAR * line - a line, or NULL past the last one.
+  Returns:
+    The next line, NULL if this was the last one.
+  Remarks:
+    None.
+  ***************************************************************************/
+static const XCHAR * textSurfaceNextLine(const XCHAR * line)
+{
+	if(line == NULL)
+		return NULL;
+	while(*line != 0 && *line != '\n')
+		line++;
+	return (*line == '\n') ? line + 1 : NULL;
+}
+
+/****************************************************************************
+  Function:
+    static WORD textSurfaceLineEqual(const XCHAR * a, const XCHAR * b)
+  Description:
+	Compares two lines up to their '\n' or end.
+  Precondition:
+    None.
+  Parameters:
+    const XCHAR * a, b - lines, NULL for a missing line.
+  Returns:
+    Non-zero if both hold the same characters.
+  Remarks:
+    A missing line equals an empty one.
+  ***************************************************************************/
+static WORD textSurfaceLineEqual(const XCHAR * a, const XCHAR * b)
+{
+	static const XCHAR empty = 0;
+
+	if(a == NULL)
+		a = &empty;
+	if(b == NULL)
+		b = &empty;
+	while(*a == *b && *a != 0 && *a != '\n')
+	{
+		a++;
+		b++;
+	}
+	return (*a == 0 || *a == '\n') && (*b == 0 || *b == '\n');
+}
+
+/****************************************************************************
+  Function:
+    static void textSurfaceUpdateLine(TEXT_SURFACE * surface,
+									  const XCHAR * oldLine,
+									  const XCHAR * newLine, SHORT y,
+									  WORD draw)
+  Description:
+	One pass over a changed line: clears the old glyph cells that go away,
+	or draws the new glyphs that were not there.
+  Precondition:
+    Clipping region, colour and for the draw pass the font are set.
+  Parameters:
+    TEXT_SURFACE * surface - surface.
+    const XCHAR * oldLine, newLine - the line before and after, NULL if
+		there is none.
+    SHORT y - top of the line.
+    WORD draw - 0 for the clearing pass, 1 for the drawing pass.
+  Returns:
+    None
+  Remarks:
+    Both lines are walked left to right together; a glyph stays where
+    the old and new line have the same character at the same x. Cells
+    are cleared only inside the area StDraw() cleans, which leaves the
+    frame alone.
+  ***************************************************************************/
+static void textSurfaceUpdateLine(TEXT_SURFACE * surface, const XCHAR * oldLine,
+								  const XCHAR * newLine, SHORT y, WORD draw)
+{
+	void *	font = textSurfaceScheme(surface)->pFont;
+	SHORT	height = GetTextHeight(font);
+	SHORT	oldX = 0, newX = 0, oldWidth, newWidth, top, bottom;
+	WORD	oldMore, newMore;
+
+	if(oldLine != NULL)
+		oldX = textSurfaceLineX(surface, oldLine, font);
+	if(newLine != NULL)
+		newX = textSurfaceLineX(surface, newLine, font);
+
+	top = (y < surface->top + 2) ? surface->top + 2 : y;
+	bottom = (y + height - 1 > surface->bottom - 1) ? surface->bottom - 1 : y + height - 1;
+
+	while(1)
+	{
+		oldMore = (oldLine != NULL && *oldLine != 0 && *oldLine != '\n');
+		newMore = (newLine != NULL && *newLine != 0 && *newLine != '\n');
+		if(!oldMore && !newMore)
+			break;
+
+		oldWidth = oldMore ? textSurfaceCharWidth(*oldLine, font) : 0;
+		newWidth = newMore ? textSurfaceCharWidth(*newLine, font) : 0;
+
+		if(oldMore && newMore && oldX == newX && *oldLine == *newLine)
+		{
+			// Same glyph in the same cell, leave it
+			oldX += oldWidth;	oldLine++;
+			newX += newWidth;	newLine++;
+		}
+		else if(oldMore && (!newMore || oldX <= newX))
+		{
+			if(!draw && oldWidth > 0)
+				Bar(oldX, top, oldX + oldWidth - 1, bottom);
+			oldX += oldWidth;	oldLine++;
+		}
+		else
+		{
+			if(draw)
+			{
+				MoveTo(newX, y);
+				OutChar(*newLine);
+			}
+			newX += newWidth;	newLine++;
+		}
+	}
+}
+
+/****************************************************************************
+  Function:
+    static void textSurfaceDrawAll(TEXT_SURFACE * surface,
+								   const XCHAR * text)
+  Description:
+	Draws the frame, cleans the area and draws every line of a text.
+  Precondition:
+    GOLInit() must have been called.
+  Parameters:
+    TEXT_SURFACE * surface - surface.
+    const XCHAR * text - text to draw.
+  Returns:
+    None
+  Remarks:
+    The same steps, in the same order, as StDraw(), except that the
+    text is clipped to the area cleaned. A glyph that reached past it
+    would leave pixels an update could not clear.
+  ***************************************************************************/
+static void textSurfaceDrawAll(TEXT_SURFACE * surface, const XCHAR * text)
+{
+	GOL_SCHEME *	pScheme = textSurfaceScheme(surface);
+	SHORT			height = GetTextHeight(pScheme->pFont);
+	SHORT			y;
+	const XCHAR *	line;
+	const XCHAR *	ch;
+
+	SetClip(CLIP_DISABLE);
+	if(surface->state & ST_FRAME)
+	{
+		SetColor(pScheme->Color1);
+		Rectangle(surface->left, surface->top, surface->right, surface->bottom);
+	}
+
+	SetClip(CLIP_ENABLE);
+	SetClipRgn(surface->left + ST_INDENT, surface->top + 2, surface->right - ST_INDENT, surface->bottom - 1);
+	SetColor(pScheme->CommonBkColor);
+	Bar(surface->left + 1, surface->top + 2, surface->right + 1, surface->bottom - 1);
+
+	SetColor(pScheme->TextColor0);
+	SetFont(pScheme->pFont);
+	for(line = text, y = surface->top; line != NULL; line = textSurfaceNextLine(line), y += height)
+	{
+		MoveTo(textSurfaceLineX(surface, line, pScheme->pFont), y);
+		for(ch = line; *ch != 0 && *ch != '\n'; ch++)
+			OutChar(*ch);
+	}
+	SetClip(CLIP_DISABLE);
+}
@@ -0,0 +1,145 @@
+/**********************************************************************
+* FileName:        		Timebase.c
+* Dependencies:    		Header (.h) files if applicable, see below
+* Processor:       		PIC24HJ128GP504
+* Compiler:        		MPLAB C30 v3.11b or higher
+*
+* Monotonic time base shared by the scheduler, the key scan, the drum
+* recorder and anything that needs to time itself. Timer 2 drives the
+* PWM and Timers 4 and 5 the key scan and audio fill, so rather than a
+* 32 bit timer pair the millisecond tick of Timer 1 is extended by its
+* own count register.
+************************************************************************/
+
+/************************************************************************
+ Header Includes
+ ************************************************************************/
+#include "p24HJ128GP504.h"
+#include "Timebase.h"
+#include "Timer1Code.h"
+
+/****************************************************************************
+  Function:
+    void timebaseInit(void)
+  Description:
+	Starts the Timer 1 millisecond tick.
+  Precondition:
+    The clock switch to the PLL must be complete.
+  Parameters:
+    None.
+  Returns:
+    None
+  Remarks:
+    Timer 1 belongs to the time base from here on; nothing else may
+    reprogram it.
+  ***************************************************************************/
+void timebaseInit(void)
+{
+	TickInit();
+}
+
+/****************************************************************************
+  Function:
+    DWORD millis(void)
+  Description:
+	Reads the millisecond tick.
+  Precondition:
+    None.
+  Parameters:
+    None.
+  Returns:
+    Milliseconds since timebaseInit(), wrapping every 49 days.
+  Remarks:
+    tick takes two instructions to read, so it is read until two reads
+    agree rather than masking the Timer 1 interrupt. An interrupt that
+    Timer 1 cannot preempt sees tick hold still and reads it first time.
+  ***************************************************************************/
+DWORD millis(void)
+{
+	DWORD now;
+
+	do
+	{
+		now = tick;
+	} while(now != tick);
+	return now;
+}
+
+/****************************************************************************
+  Function:
+    static DWORD timebaseRead(unsigned int * count)
+  Description:
+	Reads tick and TMR1 as one value.
+  Precondition:
+    timebaseInit() must have been called.
+  Parameters:
+    unsigned int * count - receives TMR1, cycles into the returned tick.
+  Returns:
+    The tick count is read with.
+  Remarks:
+    In an interrupt at or above the Timer 1 priority tick cannot move, so
+    a roll over that _T1Interrupt has not counted yet shows as T1IF set
+    with a small TMR1 and is added here.
+  ***************************************************************************/
+static DWORD timebaseRead(unsigned int * count)
+{
+	DWORD			now;
+	unsigned int	pending;
+
+	do
+	{
+		now		= tick;
+		*count	= TMR1;
+		pending	= IFS0bits.T1IF;
+	} while(now != tick);
+
+	if(pending && *count < (PR1 >> 1))
+		now++;
+	return now;
+}
+
+/****************************************************************************
+  Function:
+    DWORD micros(void)
+  Description:
+	Reads the tick together with the Timer 1 count inside it.
+  Precondition:
+    timebaseInit() must have been called.
+  Parameters:
+    None.
+  Returns:
+    Microseconds since timebaseInit(), wrapping every 71 minutes.
+  Remarks:
+    Safe in main() and in any interrupt, see timebaseRead().
+  ***************************************************************************/
+DWORD micros(void)
+{
+	unsigned int	count;
+	DWORD			now = timebaseRead(&count);
+
+	return now*TIMEBASE_US_PER_TICK + ((DWORD)count*TIMEBASE_US_PER_TICK)/((DWORD)PR1 + 1);
+}
+
+/****************************************************************************
+  Function:
+    DWORD timebaseCycles(void)
+  Description:
+	Reads the time base in instruction cycles.
+  Precondition:
+    timebaseInit() must have been called.
+  Parameters:
+    None.
+  Returns:
+    Cycles since timebaseInit(), wrapping every 108 seconds. Only
+    differences are meaningful.
+  Remarks:
+    Timer 1 counts every instruction cycle, so this is exact and costs
+    one multiply. Safe in main() and in any interrupt.
+  ***************************************************************************/
+DWORD timebaseCycles(void)
+{
+	unsigned int	count;
+	DWORD			now = timebaseRead(&count);
+
+	return now*((DWORD)PR1 + 1) + count;
+}
@@ -1,5 +1,6 @@
 #include "Main.h"
 #include "Timer1Code.h"
+#include "Timebase.h"
 
 // This is a special case of how we 'tell' the compiler that a global variable
 // is defined in another file. I have provided it ONLY shoudl you wish to
@@ -11,7 +12,8 @@ extern int T1IntCalled;	// the 'extern' means the variable is created elsewhere
   Function:
     void TickInit( void )
   Description:
-    This function sets up Timer 1 to generate an interrupt every 10 ms.
+    This function sets up Timer 1 to generate an interrupt every 1 ms,
+    the tick of Timebase.c.
   Precondition:
     None
   Parameters:
@@ -19,24 +21,22 @@ extern int T1IntCalled;	// the 'extern' means the variable is created elsewhere
   Returns:
     None
   Remarks:
-    The timer period and prescaler values are defined in HardwareProfile.h,
-    since they are dependent on the oscillator speed.
+    The timer has to keep running in Idle mode, it is what wakes the CPU
+    from Idle.
   ***************************************************************************/
 
-#define FS_1   			10000
-#define TIMER_PERIOD    (unsigned int)((GetInstructionClock()/FS_1)-1)
+#define TICK_PERIOD    (unsigned int)((GetInstructionClock()/TIMEBASE_TICK_RATE)-1)
 
 
 void TickInit( void )
 {
+    T1CON = 0;                      //Stop timer
     TMR1 = 0;
-    PR1 = 61900;
+    PR1 = TICK_PERIOD;
 
-   	T1CON = TIMER_ON | STOP_TIMER_IN_IDLE_MODE | TIMER_SOURCE_INTERNAL |
-       	    GATED_TIME_DISABLED | TIMER_16BIT_MODE | TIMER_PRESCALER;
+   	T1CON = TIMER_SOURCE_INTERNAL | GATED_TIME_DISABLED |
+       	    TIMER_16BIT_MODE | TIMER_PRESCALER_1;
 
-
-	T1CONbits.TCKPS = 3; 			//Set the prescaler to be 1:1
     IFS0bits.T1IF = 0;              //Clear flag
     IEC0bits.T1IE = 1;              //Enable interrupt
     T1CONbits.TON = 1;              //Run timer
@@ -65,9 +65,9 @@ void TickStop(void)
 
 /****************************************************************************
   Function:
-    void __attribute__((interrupt, shadow, auto_psv)) _T4Interrupt(void)
+    void __attribute__((interrupt, shadow, auto_psv)) _T1Interrupt(void)
   Description:
-    This function will be called it timer1 in Interupt mode
+    Advances the millisecond tick.
   Precondition:
     None
   Parameters:
@@ -84,6 +84,6 @@ void __attribute__((interrupt, shadow, auto_psv)) _T1Interrupt(void)
 
     // This variable is visible as it is defined in the header file (in a special way)
     T1IntCalled++;
-
+    tick++;
 }
 
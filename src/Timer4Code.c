@@ -39,6 +39,8 @@
  Header Includes													
  ************************************************************************/
 #include "Timer4Code.h"
+#include "KeyPress.h"
+#include "Profile.h"
 
 // One from main
 void SimpleCircleExample (void);
@@ -125,12 +127,17 @@ void StartTmr4()
   Returns:
     None
   Remarks:
-    None
+    Runs at FS4 (1 kHz); keyScan() debounces S1 and S2 and queues their
+    press, release, short and long events for pollKey().
   ***************************************************************************/
 void __attribute__ ((interrupt, no_auto_psv)) _T4Interrupt()
 {
 
 	IFS1bits.T4IF = 0;	
+
+	PROFILE_BEGIN(PROFILE_T4_ISR);
+	keyScan();
+	PROFILE_END(PROFILE_T4_ISR);
 			
 /* An example where we might check if switches have been pressed and if so set some flags */
 
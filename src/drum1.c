@@ -12,8 +12,8 @@ void play_drum(){
     
     while(Loop){
         
-        if(SWITCH_S1 == 0 || SWITCH_S2 == 0){
-            flag = getKey();
+        flag = waitKey(KEY_WAIT_FOREVER);
+        if(flag){
 
             if(flag <= S2_SHORT){
                 speakerActivate(SPEECH_ADDR_SELECT, SPEECH_SIZE_SELECT);
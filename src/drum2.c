@@ -2,52 +2,174 @@
 #include "drum2.h"
 #include "DisplayFunctions.h"
 #include "KeyPress.h"
+#include "Scheduler.h"
 
-void record_drum(){
-    Display_Printf("\n\nRECORD DRUM KIT");
-    int i, key = 0, flag;
-    int loop = 1;
-    int time1[50];
-    int hold = 0;
-    
-    while(loop){
-        
-        hold++;
-        Delay(10);
-        if(SWITCH_S1 == 0 || SWITCH_S2 == 0){
-            flag = getKey();
-            if(flag <= S2_SHORT){
-                speakerActivate(SPEECH_ADDR_SELECT, SPEECH_SIZE_SELECT);
-                time1[key] = hold;
-                hold = 0;
-                key++;
-            }
-            if(flag >= S1_LONG){
-                time1[key] = hold;
-                loop = 0;
-            }
+static unsigned long drumHit[DRUM_MAX_HITS];        // Sample of each hit after the first one
+static unsigned int drumHits;                       // Hits recorded
+static unsigned int drumOverruns;                   // Hits played after drumHit[] filled up
+static unsigned long drumLength;                    // Samples from the first hit to the stop press
+static const unsigned int drumGridMs[DRUM_GRIDS] = DRUM_GRID_MS;
+static volatile unsigned long drumGrid;             // Quantise grid in samples, 0 for off
+static volatile unsigned int drumLoop;              // Non-zero to start again after the last hit
+static volatile unsigned int drumRunning;           // Cleared to start playback from the next frame
+static unsigned int drumNext;                       // Next hit to schedule
+static unsigned long drumPassStart;                 // Sample clock value of the first hit of this pass
+
+//--------------------------------------------------------------------------------------------
+// Rounds a hit time to the nearest multiple of the grid, a grid of 0 leaves it alone
+unsigned long drumQuantise(unsigned long time, unsigned long grid)
+{
+    if(grid == 0)
+        return time;
+    return ((time + grid/2)/grid)*grid;
+}
+
+//--------------------------------------------------------------------------------------------
+// Length of a loop pass: the take rounded up to a whole number of grid steps, at least one, so
+// a take shorter than half a step does not collapse to nothing. Never less than a frame.
+unsigned long drumLoopLength(unsigned long length, unsigned long grid)
+{
+    if(grid != 0){
+        length = ((length + grid - 1)/grid)*grid;
+        if(length == 0)
+            length = grid;
+    }
+    if(length < FRAME_SIZE)
+        length = FRAME_SIZE;
+    return length;
+}
+
+//--------------------------------------------------------------------------------------------
+// Runs from the audio frame fill like the metronome and starts every hit that falls inside
+// the frame on its own sample. A loop pass is drumLength long, rounded up to the grid, so
+// quantised loops stay on the grid from one pass to the next. A hit quantised onto the end of
+// the pass is left out, it would land on the first hit of the next one.
+static void drumFrameHook(unsigned long frameStart)
+{
+    unsigned long grid = drumGrid;
+    unsigned long length, at;
+
+    if(!drumRunning){
+        drumPassStart = frameStart;
+        drumNext = 0;
+        drumRunning = 1;
+    }
+
+    length = drumLoopLength(drumLength, grid);
+
+    while(1){
+        if(drumNext >= drumHits){
+            if(!drumLoop)
+                return;
+            drumPassStart += length;
+            drumNext = 0;
+        }
+        at = drumQuantise(drumHit[drumNext], grid);
+        if(at >= length){
+            drumNext++;
+            continue;
         }
-        
+        at += drumPassStart;
+        if((long)(at - frameStart) >= FRAME_SIZE)
+            return;
+        speakerActivateAt(SPEECH_CLIP(SELECT), at);
+        drumNext++;
     }
-    int modifier = 30;
-    Display_Printf("\n\nPLAYING FROM RECORD");
-    loop = 1;
-    while(loop){
-        
-        for(i = 1; i <= key; i++){
+}
+
+static void drumShowPlayback(unsigned int grid)
+{
+    char str[48];
+
+    if(drumGridMs[grid] == 0)
+        sprintf(str, "PLAYBACK %u hits\nGrid off\nLoop %s", drumHits, drumLoop ? "on" : "off");
+    else
+        sprintf(str, "PLAYBACK %u hits\nGrid %u ms\nLoop %s", drumHits, drumGridMs[grid], drumLoop ? "on" : "off");
+    Display_Printf(str);
+}
+
+//--------------------------------------------------------------------------------------------
+// Each press is a hit, timed from the micros() stamp the key scan gave it rather than from
+// when this loop saw it. A long press ends the take; its own press is not a hit.
+static void drumRecord(void)
+{
+    KEY_EVENT event;
+    unsigned long first = 0, time;
+    unsigned int lastStored = 0;
+
+    drumHits = 0;
+    drumOverruns = 0;
+    drumLength = 0;
+    keyFlush();
+
+    while(1){
+        if(!pollKeyEvent(&event)){
+            schedulerYield();
+            continue;
+        }
+
+        if(event.code == S1_PRESS || event.code == S2_PRESS){
             speakerActivate(SPEECH_ADDR_SELECT, SPEECH_SIZE_SELECT);
-            if(SWITCH_S1 == 0 || SWITCH_S2 == 0){
-               return;
-            }
-            Delay((time1[i]*modifier)/2);
-            
+            if(drumHits == 0 && drumOverruns == 0)
+                first = event.micros;
+            time = (event.micros - first)/DRUM_US_PER_SAMPLE;
+            lastStored = (drumHits < DRUM_MAX_HITS);
+            if(lastStored)
+                drumHit[drumHits++] = time;
+            else
+                drumOverruns++;
+            drumLength = time;
+        }
+
+        if(event.code == S1_LONG || event.code == S2_LONG){
+            if(lastStored)
+                drumHits--;
+            return;
         }
-         for(i=0;i<100;i++){
-                Delay(5);
-                if(SWITCH_S1 == 0 || SWITCH_S2 == 0){
-                            return;
-                }
-         }
-        
     }
-}
\ No newline at end of file
+}
+
+void record_drum(){
+    int key;
+    unsigned int grid = 0;
+
+    Display_Printf("\n\nRECORD DRUM KIT");
+    drumRecord();
+    if(drumHits == 0)
+        return;
+
+    drumLoop = 1;
+    drumGrid = 0;
+    drumRunning = 0;
+    speakerSetFrameHook(drumFrameHook);
+    drumShowPlayback(grid);
+
+    // S1 steps through the quantise grids, S2 turns the loop on and off, S1 long plays the
+    // take again from the start and S2 long goes back to the drum kit
+    while(1){
+        key = waitKey(KEY_WAIT_FOREVER);
+
+        if(key == S2_LONG)
+            break;
+
+        if(key == S1_SHORT){
+            if(++grid >= DRUM_GRIDS)
+                grid = 0;
+            drumGrid = (unsigned long)drumGridMs[grid]*FS/1000;
+            drumRunning = 0;
+        }
+
+        if(key == S2_SHORT){
+            drumLoop = !drumLoop;
+            drumRunning = 0;
+        }
+
+        if(key == S1_LONG)
+            drumRunning = 0;
+
+        if(key == S1_SHORT || key == S2_SHORT)
+            drumShowPlayback(grid);
+    }
+
+    speakerSetFrameHook(0);
+}
@@ -11,10 +11,64 @@
 #include "Timer1code.h"
 #include "DisplayFunctions.h"
 #include "KeyPress.h"
+#include "Scheduler.h"
+
+static volatile unsigned int metronomeBpm10;        // Tempo in tenths of a BPM
+static unsigned int metronomeBeats;                 // Beats in a bar, the first is accented
+static unsigned int metronomeBeat;                  // Beat of the bar the next click is
+static unsigned int metronomeRunning;               // Cleared to start again from the next frame
+static unsigned int metronomeLastBpm10;             // Tempo the remainder was worked out for
+static unsigned long metronomeNextBeat;             // Sample clock value of the next click
+static unsigned long metronomeRemainder;            // Part of a sample carried to the next beat, in 1/bpm10
+
+//--------------------------------------------------------------------------------------------
+// Runs from the audio frame fill with the sample clock of the frame being made and starts
+// every click that falls inside it on its exact sample. Beat times are whole sample counts
+// with the fraction carried over, so they never drift from the true tempo.
+static void metronomeFrameHook(unsigned long frameStart)
+{
+    unsigned int bpm10 = metronomeBpm10;
+
+    if(!metronomeRunning){
+        metronomeNextBeat = frameStart;
+        metronomeRemainder = 0;
+        metronomeBeat = 0;
+        metronomeRunning = 1;
+    }
+    if(bpm10 != metronomeLastBpm10){
+        metronomeRemainder = 0;                     // New tempo takes over from the next beat
+        metronomeLastBpm10 = bpm10;
+    }
+
+    while((long)(metronomeNextBeat - frameStart) < FRAME_SIZE){
+        if(metronomeBeat == 0)
+            speakerActivateAt(SPEECH_CLIP(METRONOME1), metronomeNextBeat);
+        else
+            speakerActivateAt(SPEECH_CLIP(SELECT), metronomeNextBeat);
+
+        if(++metronomeBeat >= metronomeBeats)
+            metronomeBeat = 0;
+
+        metronomeRemainder += METRONOME_SAMPLES_MIN10;
+        metronomeNextBeat += metronomeRemainder / bpm10;
+        metronomeRemainder %= bpm10;
+    }
+}
+
+static void metronomeShowSpeed(unsigned int step)
+{
+    char str[40];
+    unsigned int bpm10 = metronomeBpm10;
+
+    sprintf(str, "Speed\n%u.%u bpm\nStep %s", bpm10/10, bpm10%10, (step == 10) ? "1" : "0.1");
+    Display_Printf(str);
+}
 
 void play_metronome(void) {
     int timesignature = 0, speed = 0, TimeSigReturn, SpeedReturn;
     int exitflag = 0;
+    int change;
+    unsigned int step = 10;
     
     TimeSigReturn = SelectTimeSignature();
     timesignature = TimeSigReturn /10;
@@ -26,90 +80,46 @@ void play_metronome(void) {
     exitflag = SpeedReturn %10;
     if(exitflag == 1)
             return ;
-    
-    int mark=0;
-    int change=0;
-    int i=0, tick=0;
 
-    
-    while(1){       
-        
-        
-        if(tick == 0){
-            speakerActivate(SPEECH_ADDR_METRONOME1, SPEECH_SIZE_METRONOME1);
-            //Delay(50);
-            tick++;
-        }
-        else {
-            speakerActivate(SPEECH_ADDR_SELECT, SPEECH_SIZE_SELECT);
-            //Delay(50);
-            tick++;
-        }
-        
-        if(tick == timesignature){
-            tick=0;
-        }
-        cTimer();
-          if(speed == 5)
-            speed = 6;
-        for(i=0;i<speed;i++){
-            TMR1=0;
-           while(TMR1<PR1/3){                        
-                if(SWITCH_S1== 0&&mark ==0){
-                change = getKey();
-                mark =1;
-                tick=0;
-                }
-                if(SWITCH_S2== 0&&mark==0){
-                change = getKey();
-                mark =1;
-                tick=0;
-                }
-           }
-           
-        }
-        if(speed == 6)
-            speed = 5;
-        TickStop();
-        mark = 0;
-        if(change == S1_SHORT || change == S1_LONG)
-             speed--;
+    switch (speed){
+        case 3: metronomeBpm10 = 1500; break;       // Presto
+        case 5: metronomeBpm10 = 750; break;        // Andante
+        default: metronomeBpm10 = 1200; break;      // Allegro
+    }
+    metronomeBeats = timesignature;
+    metronomeRunning = 0;
+    speakerSetFrameHook(metronomeFrameHook);
+    metronomeShowSpeed(step);
 
-           
-        if(change == S2_SHORT)
-             speed++;
+    // The beats are timed by the audio sample clock, the keys and display only change the tempo
+    while(1){
+        change = getKey();
 
-        
-           
         if(change == S2_LONG)
-            return;
-        
-      
-        if(speed>5)
-            speed = 3;
-        if(speed<3)
-            speed = 5;
-        
-        
-        if(change != 0)
-        {
-                switch (speed){
-                    case 3: GOLInit();
-                        Display_Printf("Speed\nPresto\n(150bpm)"); break;
+            break;
 
-                    case 4: GOLInit();
-                        Display_Printf("Speed\nAllegro\n(120bpm)"); break;
+        if(change == S1_LONG)
+            step = (step == 10) ? 1 : 10;
 
-                    case 5: GOLInit(); 
-                        Display_Printf("Speed\nAndante\n(75bpm)"); break;  
-                }
+        if(change == S1_SHORT){
+            if(metronomeBpm10 < METRONOME_BPM10_MIN + step)
+                metronomeBpm10 = METRONOME_BPM10_MIN;
+            else
+                metronomeBpm10 -= step;
         }
-        
-        change =0;
-        
-        
+
+        if(change == S2_SHORT){
+            if(metronomeBpm10 > METRONOME_BPM10_MAX - step)
+                metronomeBpm10 = METRONOME_BPM10_MAX;
+            else
+                metronomeBpm10 += step;
+        }
+
+        if(change != 0)
+            metronomeShowSpeed(step);
     }
 
+    speakerSetFrameHook(0);
     return ;
 
 }
@@ -119,7 +129,7 @@ int SelectSpeed(){
     int x,y=4;
     int press_flag = 0;
     Display_Printf("Speed\nAllegro");
-    Delay(100);
+    schedulerDelay(100);
     while(1){
        if(press_flag == 0){
              x = getKey();
@@ -142,14 +152,11 @@ int SelectSpeed(){
             y=3;
         
         switch (y){
-            case 3: Display_ClearScreen();
-                Display_Printf("Speed\nPresto"); break;
+            case 3: Display_Printf("Speed\nPresto"); break;
                 
-            case 4: Display_ClearScreen();
-                Display_Printf("Speed\nAllegro"); break;
+            case 4: Display_Printf("Speed\nAllegro"); break;
                 
-            case 5: Display_ClearScreen(); 
-                Display_Printf("Speed\nAndante"); break;  
+            case 5: Display_Printf("Speed\nAndante"); break;  
         }
         
         if(x==S1_LONG && press_flag == 1){
@@ -173,9 +180,9 @@ int SelectTimeSignature(void){
     int x = 0,y=4 ,loop = 1;
     int press_flag=0;
     Display_Printf("SelectTimeSignature\n4/4");
-    Delay(100);
+    schedulerDelay(100);
     while(loop){
-        Delay(10);
+        schedulerDelay(10);
         if(press_flag == 0){
              x = getKey();
              press_flag = 1;
@@ -198,14 +205,11 @@ int SelectTimeSignature(void){
             y=2;
         
         switch (y){
-            case 2: Display_ClearScreen();
-                Display_Printf("SelectTimeSignature\n2/4"); Delay (100); 
+            case 2: Display_Printf("SelectTimeSignature\n2/4"); schedulerDelay(100); 
                     break;
-            case 3: Display_ClearScreen();
-                Display_Printf("SelectTimeSignature\n3/4"); Delay(100); 
+            case 3: Display_Printf("SelectTimeSignature\n3/4"); schedulerDelay(100); 
                     break;
-            case 4: Display_ClearScreen();
-                Display_Printf("SelectTimeSignature\n4/4"); Delay(100); 
+            case 4: Display_Printf("SelectTimeSignature\n4/4"); schedulerDelay(100); 
                     break;  
         }
         
@@ -226,11 +230,3 @@ int SelectTimeSignature(void){
     
     return y;
 }
-
-void Initializetimer(void)
-{
-          T1CONbits.TON = 0;      // Stop timer
-          TMR1 = 0;               // Start value for the counter
-          PR1 = 61900;			// Value timer counts to
-          T1CONbits.TON = 1;      // Run timer
-}
\ No newline at end of file
@@ -0,0 +1,565 @@
+/**********************************************************************
+* FileName:        		wav2g711.c
+* Dependencies:    		G711.h, ../../src/G711Codec.c
+* Processor:       		Host (Linux, macOS, Windows with MinGW)
+* Compiler:        		gcc
+*
+* Host asset compiler for the speech clips in src/Sounds. Replaces the
+* Windows only dsPICSpeechRecord flow: every WAV file given is
+*   - mixed down to mono and resampled to FS (8 kHz),
+*   - trimmed of leading and trailing silence,
+*   - normalised to a fixed peak,
+*   - A-law or IMA-ADPCM encoded with the same codec sources the
+*     firmware links,
+*   - padded with silence to a multiple of FRAME_SIZE samples,
+* and written as G711_<Name>.s or ADPCM_<Name>.s holding three bytes per
+* 24-bit program word in the order PackForG711() unpacks them. One header
+* with the SPEECH_SIZE_*, SPEECH_ADDR_* and SPEECH_CODEC_* of every clip
+* is written alongside, so the sizes can no longer drift from the data.
+*
+* Build:
+*   gcc -O2 -I../../h -o wav2g711 wav2g711.c ../../src/G711Codec.c
+*       ../../src/ImaAdpcm.c -lm
+* or make tools in host/, which builds host/build/wav2g711 with the
+* warnings of the firmware; make test checks it with Wav2G711Test.
+*
+* Usage:
+*   wav2g711 [options] Name=file.wav ...
+*     -o dir     directory for the .s files          (default ../../src/Sounds)
+*     -H file    generated header                    (default ../../h/SpeechAssets.h)
+*     -f n       FRAME_SIZE to pad to, multiple of 6 (default 30)
+*     -t dB      silence threshold below the peak    (default 40)
+*     -p dB      peak level after normalising        (default 1)
+*     -c codec   g711 or adpcm for the clips after it (default g711)
+*   A clip given as file.wav alone is named after the file. ADPCM takes
+*   half the flash of G.711 and costs more cycles to decode; compare
+*   speakerCodecCyclesMax on the target to choose per clip.
+************************************************************************/
+
+/************************************************************************
+ Header Includes
+ ************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+#include "G711.h"
+#include "ImaAdpcm.h"
+
+/************************************************************************
+ Constants
+ ************************************************************************/
+#define FS					8000				/* Firmware sampling rate				*/
+#define DEFAULT_FRAME_SIZE	30
+#define SINC_ZEROS			16					/* Zero crossings each side of the resampling filter	*/
+#define WORDS_PER_LINE		6					/* .pword values per line, as the old encoder wrote	*/
+#define MAX_NAME			32
+#define MAX_ASSETS			64
+#define CODEC_G711			0					/* Same values as SPEAKER_CODEC_* in Speaker.h	*/
+#define CODEC_IMA_ADPCM		1
+
+#ifndef M_PI
+#define M_PI				3.14159265358979323846
+#endif
+
+/************************************************************************
+ Data Structures
+ ************************************************************************/
+typedef struct
+{
+	char			name[MAX_NAME];				/* Clip name, G711_<name> in the .s file	*/
+	const char *	path;						/* Source WAV file							*/
+	int				codec;						/* CODEC_G711 or CODEC_IMA_ADPCM			*/
+	long			size;						/* Samples, a multiple of the frame size	*/
+} ASSET;
+
+static const char * const codecLabel[]	= { "G711", "ADPCM" };
+static const char * const codecTag[]	= { "SPEAKER_CODEC_G711", "SPEAKER_CODEC_IMA_ADPCM" };
+
+/************************************************************************
+ Variables
+ ************************************************************************/
+static int		frameSize		= DEFAULT_FRAME_SIZE;
+static double	silenceDb		= 40.0;
+static double	peakDb			= 1.0;
+
+/****************************************************************************
+  Function:
+    static void fail(const char * what, const char * detail)
+  Description:
+	Reports an error and stops the tool.
+  ***************************************************************************/
+static void fail(const char * what, const char * detail)
+{
+	fprintf(stderr, "wav2g711: %s%s%s\n", what, detail ? ": " : "", detail ? detail : "");
+	exit(1);
+}
+
+static unsigned long readLE(const unsigned char * p, int bytes)
+{
+	unsigned long	value = 0;
+
+	while(bytes--)
+		value = (value << 8) | p[bytes];
+	return value;
+}
+
+/****************************************************************************
+  Function:
+    static double * readWav(const char * path, long * count, long * rate)
+  Description:
+	Loads a PCM WAV file as mono samples scaled to +/-1.
+  Remarks:
+    Accepts 8, 16, 24 and 32 bit integer PCM with any number of channels;
+    the channels are averaged.
+  ***************************************************************************/
+static double * readWav(const char * path, long * count, long * rate)
+{
+	FILE *			f = fopen(path, "rb");
+	unsigned char	hdr[12], chunk[8], fmt[16];
+	unsigned char *	data = 0;
+	unsigned long	len, dataLen = 0;
+	int				channels = 0, bits = 0, haveFmt = 0, bytes, c;
+	long			frames, i;
+	double *		out;
+
+	*rate = 0;
+	if(!f)
+		fail("cannot open", path);
+	if(fread(hdr, 1, 12, f) != 12 || memcmp(hdr, "RIFF", 4) || memcmp(hdr + 8, "WAVE", 4))
+		fail("not a RIFF WAVE file", path);
+
+	while(fread(chunk, 1, 8, f) == 8)
+	{
+		len = readLE(chunk + 4, 4);
+		if(!memcmp(chunk, "fmt ", 4))
+		{
+			if(len < 16 || fread(fmt, 1, 16, f) != 16)
+				fail("bad fmt chunk", path);
+			if(readLE(fmt, 2) != 1 && readLE(fmt, 2) != 0xFFFE)
+				fail("only integer PCM is supported", path);
+			channels	= (int)readLE(fmt + 2, 2);
+			*rate		= (long)readLE(fmt + 4, 4);
+			bits		= (int)readLE(fmt + 14, 2);
+			haveFmt		= 1;
+			fseek(f, (long)(len - 16 + (len & 1)), SEEK_CUR);
+		}
+		else if(!memcmp(chunk, "data", 4))
+		{
+			data = malloc(len ? len : 1);
+			if(!data || fread(data, 1, len, f) != len)
+				fail("truncated data chunk", path);
+			dataLen = len;
+			break;
+		}
+		else
+			fseek(f, (long)(len + (len & 1)), SEEK_CUR);
+	}
+	fclose(f);
+
+	if(!haveFmt || !data)
+		fail("missing fmt or data chunk", path);
+	if(channels < 1 || (bits != 8 && bits != 16 && bits != 24 && bits != 32) || *rate <= 0)
+		fail("unsupported sample format", path);
+
+	bytes	= bits/8;
+	frames	= (long)(dataLen/(unsigned long)(bytes*channels));
+	out		= malloc(sizeof(double)*(frames ? frames : 1));
+	if(!out)
+		fail("out of memory", 0);
+
+	for(i = 0; i < frames; i++)
+	{
+		double	sum = 0.0;
+
+		for(c = 0; c < channels; c++)
+		{
+			const unsigned char *	p = data + (i*channels + c)*bytes;
+			long					v;
+
+			if(bits == 8)
+				v = (long)p[0] - 128;						/* 8 bit WAV is unsigned	*/
+			else
+			{
+				v = (long)readLE(p, bytes);
+				if(v & (1L << (bits - 1)))
+					v -= (long)(((unsigned long)1 << (bits - 1)) << 1);
+			}
+			sum += (double)v/(double)(1L << (bits - 1));
+		}
+		out[i] = sum/channels;
+	}
+
+	free(data);
+	*count = frames;
+	return out;
+}
+
+/****************************************************************************
+  Function:
+    static double * resample(const double * in, long count, long rate,
+                             long * outCount)
+  Description:
+	Converts the clip to FS with a Hann windowed sinc filter.
+  Remarks:
+    The filter cut off follows the lower of the two Nyquist rates, so a
+    44.1 kHz recording is band limited before it is decimated.
+  ***************************************************************************/
+static double * resample(const double * in, long count, long rate, long * outCount)
+{
+	double		ratio	= (double)FS/(double)rate;
+	double		cutoff	= ratio < 1.0 ? ratio : 1.0;
+	double		width	= SINC_ZEROS/cutoff;
+	long		n		= (long)floor(count*ratio);
+	long		i, j;
+	double *	out;
+
+	out = malloc(sizeof(double)*(n ? n : 1));
+	if(!out)
+		fail("out of memory", 0);
+
+	for(i = 0; i < n; i++)
+	{
+		double	t		= i/ratio;
+		double	acc		= 0.0;
+		long	first	= (long)ceil(t - width);
+		long	last	= (long)floor(t + width);
+
+		for(j = first; j <= last; j++)
+		{
+			double	x = (t - j)*cutoff;
+			double	w, s;
+
+			if(j < 0 || j >= count)
+				continue;
+			s = (x == 0.0) ? 1.0 : sin(M_PI*x)/(M_PI*x);
+			w = 0.5 + 0.5*cos(M_PI*(t - j)/width);
+			acc += in[j]*s*w*cutoff;
+		}
+		out[i] = acc;
+	}
+
+	*outCount = n;
+	return out;
+}
+
+/****************************************************************************
+  Function:
+    static void writeClip(const ASSET * asset, const unsigned char * codes,
+                          long bytes, const char * dir)
+  Description:
+	Writes the encoded clip as a program memory table.
+  Remarks:
+    Byte 3k goes in the low byte of word k, 3k+1 in the middle byte and
+    3k+2 in the upper byte, which is what ReadProgramMemory() followed by
+    PackForG711() gives back.
+  ***************************************************************************/
+static void writeClip(const ASSET * asset, const unsigned char * codes, long bytes, const char * dir)
+{
+	const char *	label = codecLabel[asset->codec];
+	char			path[1024];
+	FILE *			f;
+	long			words = bytes/3, k;
+
+	snprintf(path, sizeof(path), "%s/%s_%s.s", dir, label, asset->name);
+	f = fopen(path, "w");
+	if(!f)
+		fail("cannot write", path);
+
+	fprintf(f, "/******************************************************************************\n");
+	fprintf(f, "*  %s_%s.s\n", label, asset->name);
+	fprintf(f, "*\n");
+	fprintf(f, "*  Description:\n");
+	fprintf(f, "*    Generated by tools/wav2g711 - do not edit.\n");
+	fprintf(f, "*    %s compressed data for a %d Hz, 16-bit speech signal.\n",
+			asset->codec == CODEC_IMA_ADPCM ? "IMA-ADPCM" : "ALAW", FS);
+	fprintf(f, "*\n");
+	fprintf(f, "*       Input Source:  %s\n", asset->path);
+	fprintf(f, "*       Output Array:  %s_%s\n", label, asset->name);
+	fprintf(f, "*       Array Size:    %ld bytes, %ld samples\n", bytes, asset->size);
+	fprintf(f, "*       Frame Size:    %d samples\n", frameSize);
+	fprintf(f, "*       Target Memory: Program Memory\n");
+	fprintf(f, "*       LAW:           %s\n", asset->codec == CODEC_IMA_ADPCM ? "IMA-ADPCM, low nibble first" : "ALAW");
+	fprintf(f, "*\n");
+	fprintf(f, "******************************************************************************/\n\n");
+	fprintf(f, "/* There are %ld elements in the data array. */\n\n", words);
+	fprintf(f, ".global _%s_%s\n\n", label, asset->name);
+	fprintf(f, ".section .G711, code\n");
+	fprintf(f, "_%s_%s:\n", label, asset->name);
+
+	for(k = 0; k < words; k++)
+	{
+		unsigned long	word =  (unsigned long)codes[3*k]
+							 | ((unsigned long)codes[3*k + 1] << 8)
+							 | ((unsigned long)codes[3*k + 2] << 16);
+
+		if(k % WORDS_PER_LINE == 0)
+			fprintf(f, ".pword 0x%06lX", word);
+		else
+			fprintf(f, ",  0x%06lX", word);
+		if(k % WORDS_PER_LINE == WORDS_PER_LINE - 1 || k == words - 1)
+			fprintf(f, "\n");
+	}
+
+	if(fclose(f))
+		fail("cannot write", path);
+}
+
+/****************************************************************************
+  Function:
+    static int bestStartIndex(int * linear, long size)
+  Description:
+	Picks the ADPCM step index a clip starts from.
+  Remarks:
+    A trimmed clip starts right on its onset, which the default index 0
+    would take tens of samples to catch up with. Every index is tried on
+    the first two frames and the one with the least error wins.
+  ***************************************************************************/
+static int bestStartIndex(int * linear, long size)
+{
+	long			n = size < 2L*frameSize ? size : 2L*frameSize, i;
+	int				index, best = 0;
+	double			error, bestError = -1.0;
+	char			codes[2*128];
+	int				decoded[2*128];
+	IMA_ADPCM_STATE	enc, dec;
+
+	if(n > (long)sizeof(decoded)/(long)sizeof(decoded[0]))
+		n = (long)sizeof(decoded)/(long)sizeof(decoded[0]);
+	n &= ~1L;
+
+	for(index = 0; index <= 88; index++)
+	{
+		ImaAdpcmInit(&enc);
+		ImaAdpcmInit(&dec);
+		enc.index = dec.index = index;
+		ImaAdpcmEncode(&enc, linear, codes, (int)n);
+		ImaAdpcmDecode(&dec, codes, decoded, (int)n);
+
+		for(error = 0.0, i = 0; i < n; i++)
+			error += ((double)linear[i] - decoded[i])*((double)linear[i] - decoded[i]);
+		if(bestError < 0.0 || error < bestError)
+		{
+			bestError	= error;
+			best		= index;
+		}
+	}
+	return best;
+}
+
+/****************************************************************************
+  Function:
+    static long compileClip(ASSET * asset, const char * dir)
+  Description:
+	Converts one WAV file and writes its .s file.
+  Returns:
+    Number of samples, always a multiple of the frame size.
+  ***************************************************************************/
+static long compileClip(ASSET * asset, const char * dir)
+{
+	double *		raw;
+	double *		pcm;
+	double			peak = 0.0, gain, threshold;
+	long			rawCount, rate, resampled, count, first, last, size, bytes, i;
+	IMA_ADPCM_STATE	state;
+	int *			linear;
+	unsigned char *	codes;
+
+	raw = readWav(asset->path, &rawCount, &rate);
+	pcm = resample(raw, rawCount, rate, &resampled);
+	free(raw);
+
+	for(i = 0; i < resampled; i++)
+		if(fabs(pcm[i]) > peak)
+			peak = fabs(pcm[i]);
+	if(peak <= 0.0)
+		fail("clip is silent", asset->path);
+
+	// Trim everything quieter than the threshold off both ends
+	threshold = peak*pow(10.0, -silenceDb/20.0);
+	for(first = 0; first < resampled && fabs(pcm[first]) < threshold; first++)
+		;
+	for(last = resampled - 1; last > first && fabs(pcm[last]) < threshold; last--)
+		;
+	count = last - first + 1;
+
+	size	= ((count + frameSize - 1)/frameSize)*frameSize;
+	gain	= pow(10.0, -peakDb/20.0)*32767.0/peak;
+	linear	= calloc((size_t)size, sizeof(int));
+	codes	= malloc((size_t)size + 3);
+	if(!linear || !codes)
+		fail("out of memory", 0);
+
+	for(i = 0; i < count; i++)
+	{
+		long	v = lrint(pcm[first + i]*gain);
+
+		if(v > 32767)
+			v = 32767;
+		else if(v < -32768)
+			v = -32768;
+		linear[i] = (int)v;
+	}
+
+	// The padding after the clip is left at zero, encoded like any sample
+	asset->size = size;
+	if(asset->codec == CODEC_IMA_ADPCM)
+	{
+		// Header word first: start at the step size that suits the onset
+		ImaAdpcmInit(&state);
+		state.index	= bestStartIndex(linear, size);
+		codes[0]	= 0;
+		codes[1]	= 0;
+		codes[2]	= (unsigned char)state.index;
+		ImaAdpcmEncode(&state, linear, (char *)codes + 3, (int)size);
+		bytes = 3 + size/2;
+	}
+	else
+	{
+		G711TblLin2Alaw(linear, (char *)codes, (int)size);
+		bytes = size;
+	}
+	writeClip(asset, codes, bytes, dir);
+
+	printf("%5s_%-16s %6ld samples %5ld frames %6ld bytes, %ld ms of silence trimmed\n",
+		   codecLabel[asset->codec], asset->name, size, size/frameSize, bytes,
+		   ((resampled - count)*1000L)/FS);
+
+	free(pcm);
+	free(linear);
+	free(codes);
+	return size;
+}
+
+/****************************************************************************
+  Function:
+    static void writeHeader(const ASSET * assets, int n, const char * path)
+  Description:
+	Writes the sizes and program memory addresses of every clip.
+  ***************************************************************************/
+static void writeHeader(const ASSET * assets, int n, const char * path)
+{
+	FILE *	f = fopen(path, "w");
+	char	upper[MAX_NAME];
+	int		a, c;
+
+	if(!f)
+		fail("cannot write", path);
+
+	fprintf(f, "/**********************************************************************\n");
+	fprintf(f, "* FileName:        		SpeechAssets.h\n");
+	fprintf(f, "*\n");
+	fprintf(f, "* Generated by tools/wav2g711 - do not edit. Sizes are in samples and\n");
+	fprintf(f, "* are always a multiple of FRAME_SIZE (%d). SPEECH_CODEC_* is the\n", frameSize);
+	fprintf(f, "* SPEAKER_CODEC_* each clip was encoded with.\n");
+	fprintf(f, "************************************************************************/\n\n");
+	fprintf(f, "#ifndef _SPEECH_ASSETS_H\n#define _SPEECH_ASSETS_H\n\n");
+	fprintf(f, "#define SPEECH_ASSET_FRAME_SIZE\t\t%d\n\n", frameSize);
+
+	for(a = 0; a < n; a++)
+	{
+		for(c = 0; assets[a].name[c]; c++)
+			upper[c] = (char)toupper((unsigned char)assets[a].name[c]);
+		upper[c] = 0;
+		fprintf(f, "#define SPEECH_SIZE_%-16s%ldL\n", upper, assets[a].size);
+		fprintf(f, "#define SPEECH_ADDR_%-16s__builtin_tbladdress(%s_%s)\n", upper, codecLabel[assets[a].codec], assets[a].name);
+		fprintf(f, "#define SPEECH_CODEC_%-15s%s\n", upper, codecTag[assets[a].codec]);
+	}
+
+	fprintf(f, "\n");
+	for(a = 0; a < n; a++)
+		fprintf(f, "extern void %s_%s();\n", codecLabel[assets[a].codec], assets[a].name);
+	fprintf(f, "\n#endif\n");
+
+	if(fclose(f))
+		fail("cannot write", path);
+}
+
+/****************************************************************************
+  Function:
+    static void nameAsset(ASSET * asset, char * arg)
+  Description:
+	Splits a Name=file.wav argument, or names the clip after its file.
+  ***************************************************************************/
+static void nameAsset(ASSET * asset, char * arg)
+{
+	char *			eq = strchr(arg, '=');
+	const char *	base;
+	size_t			len, i;
+
+	if(eq)
+	{
+		*eq = 0;
+		base = arg;
+		asset->path = eq + 1;
+		len = strlen(base);
+	}
+	else
+	{
+		asset->path = arg;
+		base = strrchr(arg, '/');
+		base = base ? base + 1 : arg;
+		len = strcspn(base, ".");
+	}
+
+	if(len == 0 || len >= MAX_NAME)
+		fail("bad clip name", arg);
+	for(i = 0; i < len; i++)
+	{
+		if(!isalnum((unsigned char)base[i]) && base[i] != '_')
+			fail("clip names must be C identifiers", arg);
+		asset->name[i] = base[i];
+	}
+	asset->name[len] = 0;
+}
+
+int main(int argc, char ** argv)
+{
+	static ASSET	assets[MAX_ASSETS];
+	const char *	dir		= "../../src/Sounds";
+	const char *	header	= "../../h/SpeechAssets.h";
+	int				n = 0, i, codec = CODEC_G711;
+
+	for(i = 1; i < argc; i++)
+	{
+		if(argv[i][0] == '-' && argv[i][1] && !argv[i][2] && i + 1 < argc)
+		{
+			switch(argv[i][1])
+			{
+				case 'o': dir		= argv[++i];				continue;
+				case 'H': header	= argv[++i];				continue;
+				case 'f': frameSize	= atoi(argv[++i]);			continue;
+				case 't': silenceDb	= atof(argv[++i]);			continue;
+				case 'p': peakDb	= atof(argv[++i]);			continue;
+				case 'c':
+					i++;
+					if(!strcmp(argv[i], "g711"))
+						codec = CODEC_G711;
+					else if(!strcmp(argv[i], "adpcm"))
+						codec = CODEC_IMA_ADPCM;
+					else
+						fail("unknown codec", argv[i]);
+					continue;
+			}
+			fail("unknown option", argv[i]);
+		}
+		if(n == MAX_ASSETS)
+			fail("too many clips", 0);
+		assets[n].codec = codec;
+		nameAsset(&assets[n++], argv[i]);
+	}
+
+	if(!n)
+	{
+		fprintf(stderr, "usage: wav2g711 [-o dir] [-H header] [-f frame] [-t dB] [-p dB] [-c g711|adpcm] Name=file.wav ...\n");
+		return 1;
+	}
+	if(frameSize <= 0 || frameSize % 6)
+		fail("frame size must be a positive multiple of 6", 0);
+
+	for(i = 0; i < n; i++)
+		compileClip(&assets[i], dir);
+	writeHeader(assets, n, header);
+	return 0;
+}
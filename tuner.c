@@ -12,11 +12,15 @@
 #include "DisplayFunctions.h"
 #include "KeyPress.h"
 
+/* Semitone above C of each note the tuner offers, indexed by note/10 */
+static const int tuneSemitone[8] = {0, 0, 2, 4, 5, 7, 9, 11};
+
 void PlayTune(void) {
     int note=10;
-    int i;
     int tune;
     int startflag=1;
+    int voice=-1;
+    unsigned long step;
     while(1){
         if(startflag ==1){
             Display_Printf("C");
@@ -33,31 +37,19 @@ void PlayTune(void) {
         }
             
         else {
+            // The tone sustains while the next key is awaited, only the pitch changes
             tune = note/10;
-            switch(tune){
-                    case 1:  speakerActivate(SPEECH_ADDR_CTUNE, SPEECH_SIZE_CTUNE); break;
-                    case 2:  speakerActivate(SPEECH_ADDR_DTUNE, SPEECH_SIZE_DTUNE); break;
-                    case 3:  speakerActivate(SPEECH_ADDR_ETUNE, SPEECH_SIZE_ETUNE); break;
-                    case 4:  speakerActivate(SPEECH_ADDR_FTUNE, SPEECH_SIZE_FTUNE);  break;
-                    case 5:  speakerActivate(SPEECH_ADDR_GTUNE, SPEECH_SIZE_GTUNE);  break;
-                    case 6:  speakerActivate(SPEECH_ADDR_ATUNE, SPEECH_SIZE_ATUNE); break;
-                    case 7:  speakerActivate(SPEECH_ADDR_BTUNE, SPEECH_SIZE_BTUNE);  break;
+            step = speakerToneStep(tuneSemitone[tune], 4, 0);
+            if(voice < 0)
+                voice = speakerToneStart(step);
+            else
+                speakerToneSet(voice, step);
+
+            note = SelectTune(note);
+            if(note%10 == 2){
+                speakerToneStop(voice);
+                return ;
             }
-            cTimer();
-        for(i=0;i<2;i++){
-            TMR1=0;
-           while(TMR1<PR1){              
-            
-                if(SWITCH_S1 == 0 || SWITCH_S2 == 0){
-                    note = SelectTune(note);
-                    i=2;
-                    break;
-                }
-                
-           }
-        }
-            if(note%10 == 2)
-                    return ;
         }    
         
     }
@@ -80,13 +72,13 @@ int SelectTune(int note){
              note = 1;     
         
         switch(note){
-                case 1: Display_ClearScreen(); Display_Printf("C"); break;
-                case 2: Display_ClearScreen(); Display_Printf("D"); break;
-                case 3: Display_ClearScreen(); Display_Printf("E"); break;
-                case 4: Display_ClearScreen(); Display_Printf("F"); break;
-                case 5: Display_ClearScreen(); Display_Printf("G"); break;
-                case 6: Display_ClearScreen(); Display_Printf("A"); break;
-                case 7: Display_ClearScreen(); Display_Printf("B"); break;
+                case 1: Display_Printf("C"); break;
+                case 2: Display_Printf("D"); break;
+                case 3: Display_Printf("E"); break;
+                case 4: Display_Printf("F"); break;
+                case 5: Display_Printf("G"); break;
+                case 6: Display_Printf("A"); break;
+                case 7: Display_Printf("B"); break;
           }
         
         